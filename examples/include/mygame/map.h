@@ -127,6 +127,7 @@ private:
     
     // Atlas de sprites pour les éléments de la carte (ex: navire)
     RC2D_TP_Atlas shipAtlas = {0}; /**< Atlas TexturePacker pour les sprites du jeu (ex: navire). */
+    RC2D_TP_FrameHandle shipFrame = RC2D_TP_INVALID_FRAME; /**< Handle de la frame du navire, résolu au chargement. */
 
     // Mode courant d'agencement (modifiable à chaud via input).
     MapLayoutMode currentLayoutMode = MAP_LAYOUT_FRAMED;
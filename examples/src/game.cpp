@@ -11,9 +11,31 @@ static RC2D_UIImage buttonCenterMapUI = {0};
 
 static Map map;
 
+/* Références sur le cache d'assets, rendues au déchargement */
+static RC2D_CachedAsset* backgroundAsset = NULL;
+static RC2D_CachedAsset* uiAssets[3] = { NULL };
+
+/* Charge la texture et le masque de hit-test d'un élément UI : un seul décodage, pas de surface gardée en RAM. */
+static void loadUIImage(RC2D_UIImage* uiImage, const char* path, RC2D_CachedAsset** asset)
+{
+    *asset = rc2d_assetcache_acquireImageWithHitMask(path, RC2D_STORAGE_TITLE, RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD);
+    uiImage->image = rc2d_assetcache_getImage(*asset);
+
+    const RC2D_HitMask* hitMask = rc2d_assetcache_getHitMask(*asset);
+    if (hitMask) uiImage->hitMask = *hitMask;
+}
+
 void rc2d_unload(void) 
 {
     map.Unload();
+
+    rc2d_assetcache_release(backgroundAsset);
+    backgroundAsset = NULL;
+    for (int i = 0; i < 3; ++i)
+    {
+        rc2d_assetcache_release(uiAssets[i]);
+        uiAssets[i] = NULL;
+    }
 }
 
 void rc2d_load(void) 
@@ -22,13 +44,13 @@ void rc2d_load(void)
     rc2d_window_setSize(1280, 720);
 
     // Charger le background UI
-    backgroundUI = rc2d_graphics_loadImageFromStorage("assets/images/background-ui-ingame.png", RC2D_STORAGE_TITLE);
+    backgroundAsset = rc2d_assetcache_acquireImage("assets/images/background-ui-ingame.png", RC2D_STORAGE_TITLE);
+    backgroundUI = rc2d_assetcache_getImage(backgroundAsset);
 
     /* =========================
     BARRE D'ACTION — BAS CENTRE
     ========================= */
-    barreActionUI.image       = rc2d_graphics_loadImageFromStorage("assets/images/barre-action-ingame.png", RC2D_STORAGE_TITLE);
-    barreActionUI.imageData   = rc2d_graphics_loadImageDataFromStorage("assets/images/barre-action-ingame.png", RC2D_STORAGE_TITLE);
+    loadUIImage(&barreActionUI, "assets/images/barre-action-ingame.png", &uiAssets[0]);
     barreActionUI.anchor      = RC2D_UI_ANCHOR_BOTTOM_CENTER;   // collé en bas, centré horizontalement
     barreActionUI.margin_mode = RC2D_UI_MARGIN_PERCENT;         // marge en % de la zone visible/safe
     barreActionUI.margin_x    = 0.0f;                           // pas de décalage horizontal
@@ -39,8 +61,7 @@ void rc2d_load(void)
     /* =========================
     MINIMAP — HAUT DROIT
     ========================= */
-    minimapUI.image       = rc2d_graphics_loadImageFromStorage("assets/images/minimap.png", RC2D_STORAGE_TITLE);
-    minimapUI.imageData   = rc2d_graphics_loadImageDataFromStorage("assets/images/minimap.png", RC2D_STORAGE_TITLE);
+    loadUIImage(&minimapUI, "assets/images/minimap.png", &uiAssets[1]);
     minimapUI.anchor      = RC2D_UI_ANCHOR_TOP_RIGHT;           // coin haut-droit
     minimapUI.margin_mode = RC2D_UI_MARGIN_PERCENT;             // marges en %
     minimapUI.margin_x    = 0.01f;                              // ~2% depuis la droite
@@ -51,8 +72,7 @@ void rc2d_load(void)
     /* =========================
     BOUTON CENTRER LA CARTE — BAS CENTRE
     ========================= */
-    buttonCenterMapUI.image       = rc2d_graphics_loadImageFromStorage("assets/images/button-centermap-ingame.png", RC2D_STORAGE_TITLE);
-    buttonCenterMapUI.imageData   = rc2d_graphics_loadImageDataFromStorage("assets/images/button-centermap-ingame.png", RC2D_STORAGE_TITLE);
+    loadUIImage(&buttonCenterMapUI, "assets/images/button-centermap-ingame.png", &uiAssets[2]);
     buttonCenterMapUI.anchor      = RC2D_UI_ANCHOR_BOTTOM_CENTER;
     buttonCenterMapUI.margin_mode = RC2D_UI_MARGIN_PERCENT;
     buttonCenterMapUI.margin_x    = 0.0f;
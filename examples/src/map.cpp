@@ -119,6 +119,7 @@ Map::Map()
     this->oceanRenderState = NULL;
     this->oceanTile = { NULL };
     this->shipAtlas = { 0 };
+    this->shipFrame = RC2D_TP_INVALID_FRAME;
     this->currentLayoutMode = MAP_LAYOUT_FRAMED;
     this->currentInsets = this->kInsetsFramed;
     this->mapRect = { 0, 0, 0, 0 };
@@ -182,6 +183,9 @@ void Map::Load()
         RC2D_log(RC2D_LOG_ERROR, "Failed to load ship atlas: %s", SDL_GetError());
     }
 
+    // Résoudre une seule fois le handle de la frame (pas de recherche par nom dans Draw)
+    this->shipFrame = rc2d_tp_getFrameHandle(&this->shipAtlas, "1.png");
+
     // 6) Initialiser la grille de la carte
     this->InitializeGrid();
 }
@@ -247,8 +251,9 @@ void Map::Update(double dt)
 
     if (dx != 0.0f || dy != 0.0f) 
     {
-        RC2D_log(RC2D_LOG_INFO, "Camera move: dx=%.1f, dy=%.1f, camera=(%.1f, %.1f, %.2f)\n",
-                 dx, dy, this->camera.x, this->camera.y, this->camera.zoom);
+        // Appelé à chaque frame pendant le déplacement : limité à 4 messages par seconde
+        RC2D_log_throttled(RC2D_LOG_INFO, 250, "Camera move: dx=%.1f, dy=%.1f, camera=(%.1f, %.1f, %.2f)\n",
+                           dx, dy, this->camera.x, this->camera.y, this->camera.zoom);
         this->UpdateCamera(dx, dy, 0.0f);
     }
 }
@@ -274,13 +279,13 @@ void Map::Draw()
     float shipWorldY = 10.0f;
     float shipScreenX = WorldToScreenX(shipWorldX);
     float shipScreenY = WorldToScreenY(shipWorldY);
-    rc2d_tp_drawFrameByName(&this->shipAtlas,
-                            "1.png",
-                            shipScreenX, shipScreenY,
-                            0.0,
-                            1.0f, 1.0f,
-                            -1.0f, -1.0f,
-                            false, false);
+    rc2d_tp_drawFrame(&this->shipAtlas,
+                      this->shipFrame,
+                      shipScreenX, shipScreenY,
+                      0.0,
+                      1.0f, 1.0f,
+                      -1.0f, -1.0f,
+                      false, false);
 
     // 4) Réinitialiser le clip rect
     SDL_SetRenderClipRect(rc2d_engine_state.renderer, nullptr);
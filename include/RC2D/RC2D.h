@@ -2,6 +2,8 @@
 #define RC2D_H
 
 #include <RC2D/RC2D_assert.h>
+#include <RC2D/RC2D_assetcache.h>
+#include <RC2D/RC2D_assetloader.h>
 #include <RC2D/RC2D_audio.h>
 #include <RC2D/RC2D_camera.h>
 #include <RC2D/RC2D_collision.h>
@@ -11,6 +13,7 @@
 #include <RC2D/RC2D_event.h>
 #include <RC2D/RC2D_filedialog.h>
 #include <RC2D/RC2D_filesystem.h>
+#include <RC2D/RC2D_frame.h>
 // #include <RC2D/RC2D_gamepad.h>
 #include <RC2D/RC2D_gpu.h>
 #include <RC2D/RC2D_guid.h>
@@ -28,6 +31,7 @@
 #include <RC2D/RC2D_platform.h>
 #include <RC2D/RC2D_power.h>
 // #include <RC2D/RC2D_rres.h>
+#include <RC2D/RC2D_save.h>
 #include <RC2D/RC2D_scancode.h>
 #include <RC2D/RC2D_storage.h>
 #include <RC2D/RC2D_system.h>
@@ -0,0 +1,321 @@
+#ifndef RC2D_ASSETCACHE_H
+#define RC2D_ASSETCACHE_H
+
+#include <RC2D/RC2D_assetloader.h>   // Requis pour : RC2D_AssetKind
+#include <RC2D/RC2D_graphics.h>      // Requis pour : RC2D_Image, RC2D_ImageData, RC2D_HitMask, RC2D_Font
+#include <RC2D/RC2D_storage.h>       // Requis pour : RC2D_StorageKind
+#include <RC2D/RC2D_texturepacker.h> // Requis pour : RC2D_TP_Atlas
+
+#include <SDL3_mixer/SDL_mixer.h>    // Requis pour : MIX_Audio
+
+#include <stdbool.h>                 // Requis pour : bool
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Entrée du cache d'assets, partagée et comptée par référence.
+ *
+ * \details
+ * Chaque appel à une fonction rc2d_assetcache_acquire*() (ou rc2d_assetcache_retain())
+ * doit être équilibré par un appel à rc2d_assetcache_release(). L'asset reste possédé par
+ * le cache : ne jamais appeler rc2d_graphics_freeImage(), rc2d_tp_freeAtlas(), etc. dessus.
+ *
+ * Une entrée qui n'est plus référencée reste en mémoire (réutilisable sans rechargement)
+ * jusqu'à ce que le budget mémoire du cache l'oblige à être évincée (LRU).
+ *
+ * \note Structure opaque.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_CachedAsset RC2D_CachedAsset;
+
+/**
+ * \brief Statistiques du cache d'assets.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_AssetCacheStats {
+    /** Acquisitions servies par une entrée déjà en mémoire. */
+    Uint64 hits;
+
+    /** Acquisitions ayant nécessité un chargement depuis le storage. */
+    Uint64 misses;
+
+    /** Entrées non référencées évincées pour respecter le budget. */
+    Uint64 evictions;
+
+    /** Estimation de la mémoire occupée par les entrées résidentes (octets, CPU + GPU). */
+    Uint64 bytes_resident;
+
+    /** Budget mémoire courant (octets). */
+    Uint64 budget_bytes;
+
+    /** Nombre d'entrées résidentes. */
+    int entry_count;
+
+    /** Nombre d'entrées encore référencées (non évinçables). */
+    int referenced_count;
+} RC2D_AssetCacheStats;
+
+/**
+ * \brief Budget mémoire du cache utilisé par défaut (256 Mo).
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_ASSETCACHE_DEFAULT_BUDGET_BYTES (256ull * 1024ull * 1024ull)
+
+/**
+ * \brief Modifie le budget mémoire du cache.
+ *
+ * \details
+ * Tant que la mémoire résidente dépasse le budget, les entrées non référencées les moins
+ * récemment utilisées sont libérées. Les entrées référencées ne sont jamais évincées : le
+ * budget peut donc être dépassé temporairement. Un budget de 0 libère chaque entrée dès
+ * que sa dernière référence est rendue.
+ *
+ * \param {Uint64} budgetBytes - Budget en octets.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetcache_setBudget(Uint64 budgetBytes);
+
+/**
+ * \brief Budget mémoire courant du cache (octets).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint64 rc2d_assetcache_getBudget(void);
+
+/**
+ * \brief Acquiert une image (texture) depuis le cache, en la chargeant si besoin.
+ *
+ * \details
+ * Si seules les données d'image (RC2D_ASSET_IMAGE_DATA) du même fichier sont en cache,
+ * la texture est créée depuis cette surface, sans relire ni redécoder le fichier.
+ *
+ * \param {const char*} storage_path - Chemin relatif dans le storage.
+ * \param {RC2D_StorageKind} storage_kind - RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER.
+ * \return {RC2D_CachedAsset*} Entrée référencée, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_assetcache_release()
+ */
+RC2D_CachedAsset* rc2d_assetcache_acquireImage(const char* storage_path, RC2D_StorageKind storage_kind);
+
+/**
+ * \brief Acquiert une image (texture) accompagnée de son masque de collision 1 bit.
+ *
+ * \details
+ * Retourne la même entrée que rc2d_assetcache_acquireImage() pour ce fichier : la texture
+ * est partagée et le masque lui est attaché, un par seuil alpha. Au premier chargement, un seul
+ * décodage (rc2d_graphics_loadImageWithHitMaskFromStorage()) ; si la texture est déjà en cache,
+ * seul le masque manquant est construit (décodage CPU, sans nouvel envoi au GPU). Aucune surface
+ * CPU n'est conservée.
+ *
+ * \param {Uint8} alphaThreshold - Seuil alpha du masque (voir RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD).
+ * \see rc2d_assetcache_acquireImage() pour les autres paramètres.
+ * \see rc2d_assetcache_getHitMask()
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_CachedAsset* rc2d_assetcache_acquireImageWithHitMask(const char* storage_path, RC2D_StorageKind storage_kind,
+                                                          Uint8 alphaThreshold);
+
+/**
+ * \brief Acquiert des données d'image (surface CPU) depuis le cache, en les chargeant si besoin.
+ *
+ * \see rc2d_assetcache_acquireImage() pour les paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_CachedAsset* rc2d_assetcache_acquireImageData(const char* storage_path, RC2D_StorageKind storage_kind);
+
+/**
+ * \brief Acquiert une police depuis le cache, en l'ouvrant si besoin.
+ *
+ * \details La taille fait partie de la clé : deux tailles différentes donnent deux entrées.
+ *
+ * \param {float} fontSize - Taille de la police en points.
+ * \see rc2d_assetcache_acquireImage() pour les autres paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_CachedAsset* rc2d_assetcache_acquireFont(const char* storage_path, RC2D_StorageKind storage_kind, float fontSize);
+
+/**
+ * \brief Acquiert un audio depuis le cache, en le chargeant si besoin.
+ *
+ * \details Le mode de décodage fait partie de la clé.
+ *
+ * \param {bool} predecode - Si vrai, décodage complet en mémoire.
+ * \see rc2d_assetcache_acquireImage() pour les autres paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_CachedAsset* rc2d_assetcache_acquireAudio(const char* storage_path, RC2D_StorageKind storage_kind, bool predecode);
+
+/**
+ * \brief Acquiert un atlas TexturePacker (JSON ou .rc2datlas) depuis le cache, en le chargeant si besoin.
+ *
+ * \see rc2d_tp_loadAtlasFromStorage()
+ * \see rc2d_assetcache_acquireImage() pour les paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_CachedAsset* rc2d_assetcache_acquireAtlas(const char* storage_path, RC2D_StorageKind storage_kind);
+
+/**
+ * \brief Ajoute une référence à une entrée déjà acquise.
+ *
+ * \param {RC2D_CachedAsset*} asset - Entrée à référencer (NULL autorisé).
+ * \return {RC2D_CachedAsset*} `asset`, pour chaîner.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_CachedAsset* rc2d_assetcache_retain(RC2D_CachedAsset* asset);
+
+/**
+ * \brief Rend une référence sur une entrée.
+ *
+ * \details
+ * À la dernière référence, l'entrée devient évinçable et est placée en tête de la liste LRU.
+ * Elle n'est libérée que si le budget mémoire est dépassé.
+ *
+ * \param {RC2D_CachedAsset*} asset - Entrée à rendre (NULL autorisé).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetcache_release(RC2D_CachedAsset* asset);
+
+/**
+ * \brief Type d'asset d'une entrée.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetKind rc2d_assetcache_getKind(const RC2D_CachedAsset* asset);
+
+/**
+ * \brief Image d'une entrée RC2D_ASSET_IMAGE.
+ *
+ * \details La texture reste possédée par le cache et valide tant que l'entrée est référencée.
+ *
+ * \return {RC2D_Image} L'image, ou une image vide si l'entrée est NULL ou d'un autre type.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Image rc2d_assetcache_getImage(const RC2D_CachedAsset* asset);
+
+/**
+ * \brief Masque de collision d'une entrée acquise via rc2d_assetcache_acquireImageWithHitMask().
+ *
+ * \details Le masque reste possédé par le cache et valide tant que l'entrée est référencée.
+ *
+ * \param {const RC2D_CachedAsset*} asset - Entrée image.
+ * \param {Uint8} alphaThreshold - Seuil alpha passé à rc2d_assetcache_acquireImageWithHitMask().
+ * \return {const RC2D_HitMask*} Le masque, ou NULL si l'entrée n'en a pas pour ce seuil.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+const RC2D_HitMask* rc2d_assetcache_getHitMask(const RC2D_CachedAsset* asset, Uint8 alphaThreshold);
+
+/**
+ * \brief Données d'image d'une entrée RC2D_ASSET_IMAGE_DATA.
+ *
+ * \details La surface reste possédée par le cache et valide tant que l'entrée est référencée.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_ImageData rc2d_assetcache_getImageData(const RC2D_CachedAsset* asset);
+
+/**
+ * \brief Police d'une entrée RC2D_ASSET_FONT.
+ *
+ * \details La police reste possédée par le cache et valide tant que l'entrée est référencée.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Font rc2d_assetcache_getFont(const RC2D_CachedAsset* asset);
+
+/**
+ * \brief Audio d'une entrée RC2D_ASSET_AUDIO.
+ *
+ * \details L'audio reste possédé par le cache et valide tant que l'entrée est référencée.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+MIX_Audio* rc2d_assetcache_getAudio(const RC2D_CachedAsset* asset);
+
+/**
+ * \brief Atlas d'une entrée RC2D_ASSET_ATLAS.
+ *
+ * \details L'atlas reste possédé par le cache et valide tant que l'entrée est référencée.
+ *
+ * \return {const RC2D_TP_Atlas*} L'atlas, ou NULL si l'entrée est NULL ou d'un autre type.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+const RC2D_TP_Atlas* rc2d_assetcache_getAtlas(const RC2D_CachedAsset* asset);
+
+/**
+ * \brief Libère toutes les entrées non référencées, quel que soit le budget.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetcache_trim(void);
+
+/**
+ * \brief Récupère les statistiques du cache.
+ *
+ * \param {RC2D_AssetCacheStats*} stats - [out] Statistiques courantes.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetcache_getStats(RC2D_AssetCacheStats* stats);
+
+/**
+ * \brief Remet à zéro les compteurs hits / misses / evictions.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetcache_resetStats(void);
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_ASSETCACHE_H
@@ -0,0 +1,397 @@
+#ifndef RC2D_ASSETLOADER_H
+#define RC2D_ASSETLOADER_H
+
+#include <RC2D/RC2D_graphics.h>      // Requis pour : RC2D_Image, RC2D_ImageData, RC2D_Font
+#include <RC2D/RC2D_storage.h>       // Requis pour : RC2D_StorageKind
+#include <RC2D/RC2D_texturepacker.h> // Requis pour : RC2D_TP_Atlas
+
+#include <SDL3_mixer/SDL_mixer.h>    // Requis pour : MIX_Audio
+
+#include <stdbool.h>                 // Requis pour : bool
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Chargeur d'assets asynchrone.
+ *
+ * \details
+ * Les lectures dans le storage et les décodages (IMG_Load_IO, parsing d'atlas, décodage audio)
+ * sont faits sur des threads workers. Le thread principal termine ensuite chaque asset
+ * (création de texture, ouverture de police) dans un budget de temps par frame, puis appelle
+ * la callback de complétion.
+ *
+ * \note Structure opaque : utiliser rc2d_assetloader_create() / rc2d_assetloader_destroy().
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_AssetLoader RC2D_AssetLoader;
+
+/**
+ * \brief Handle d'un chargement en cours ou terminé.
+ *
+ * \note Structure opaque, possédée par le loader : à rendre via rc2d_assetloader_releaseHandle().
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_AssetHandle RC2D_AssetHandle;
+
+/**
+ * \brief Type d'asset chargé par un RC2D_AssetHandle.
+ *
+ * \since Cette énumération est disponible depuis RC2D 1.0.0.
+ */
+typedef enum RC2D_AssetKind {
+    /** Texture (RC2D_Image), créée sur le thread principal. */
+    RC2D_ASSET_IMAGE,
+
+    /** Surface CPU (RC2D_ImageData). */
+    RC2D_ASSET_IMAGE_DATA,
+
+    /** Police (RC2D_Font), ouverte sur le thread principal. */
+    RC2D_ASSET_FONT,
+
+    /** Audio SDL3_mixer (MIX_Audio*). */
+    RC2D_ASSET_AUDIO,
+
+    /** Atlas TexturePacker (RC2D_TP_Atlas), texture créée sur le thread principal. */
+    RC2D_ASSET_ATLAS
+} RC2D_AssetKind;
+
+/**
+ * \brief État d'un chargement.
+ *
+ * \since Cette énumération est disponible depuis RC2D 1.0.0.
+ */
+typedef enum RC2D_AssetState {
+    /** En file d'attente, aucun worker ne l'a encore pris. */
+    RC2D_ASSET_STATE_QUEUED,
+
+    /** Lecture storage + décodage en cours sur un worker. */
+    RC2D_ASSET_STATE_DECODING,
+
+    /** Décodé, en attente de finalisation sur le thread principal (rc2d_assetloader_update). */
+    RC2D_ASSET_STATE_DECODED,
+
+    /** Terminé avec succès : l'asset peut être récupéré. */
+    RC2D_ASSET_STATE_READY,
+
+    /** Terminé en échec (voir les logs). */
+    RC2D_ASSET_STATE_FAILED
+} RC2D_AssetState;
+
+/**
+ * \brief Callback appelée sur le thread principal quand un chargement est terminé (succès ou échec).
+ *
+ * \param {RC2D_AssetHandle*} handle - Handle terminé (état READY ou FAILED).
+ * \param {void*} userdata - Pointeur utilisateur passé à la fonction de chargement.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef void (*RC2D_AssetCallback)(RC2D_AssetHandle* handle, void* userdata);
+
+/**
+ * \brief Budget de finalisation par frame utilisé par défaut (en millisecondes).
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_ASSETLOADER_DEFAULT_UPLOAD_BUDGET_MS 2.0
+
+/**
+ * \brief Crée un chargeur d'assets asynchrone et démarre ses workers.
+ *
+ * \details
+ * Le loader est mis à jour automatiquement à chaque frame par RC2D, avant rc2d_update().
+ * Un appel manuel à rc2d_assetloader_update() reste possible (écran de chargement, tests).
+ *
+ * \param {int} workerCount - Nombre de threads workers (<= 0 : choisi selon le nombre de cœurs).
+ * \param {double} uploadBudgetMs - Temps max (ms) passé par frame à finaliser des assets
+ * sur le thread principal (<= 0 : aucun budget, tout ce qui est décodé est finalisé).
+ * \return {RC2D_AssetLoader*} Le loader, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_assetloader_destroy()
+ */
+RC2D_AssetLoader* rc2d_assetloader_create(int workerCount, double uploadBudgetMs);
+
+/**
+ * \brief Arrête les workers et détruit le loader.
+ *
+ * \details
+ * Les chargements non terminés sont abandonnés et leurs données intermédiaires libérées.
+ * Les assets déjà READY appartiennent à l'appelant et ne sont pas libérés.
+ * Tous les handles du loader deviennent invalides.
+ *
+ * \param {RC2D_AssetLoader*} loader - Loader à détruire (NULL autorisé).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetloader_destroy(RC2D_AssetLoader* loader);
+
+/**
+ * \brief Modifie le budget de finalisation par frame.
+ *
+ * \param {RC2D_AssetLoader*} loader - Loader à modifier.
+ * \param {double} uploadBudgetMs - Temps max (ms) par frame (<= 0 : aucun budget).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetloader_setUploadBudget(RC2D_AssetLoader* loader, double uploadBudgetMs);
+
+/**
+ * \brief Finalise les assets décodés dans la limite du budget, et appelle leurs callbacks.
+ *
+ * \details
+ * Au moins un asset est finalisé par appel s'il y en a un de prêt, pour garantir la progression.
+ *
+ * \param {RC2D_AssetLoader*} loader - Loader à mettre à jour.
+ * \return {int} Nombre d'assets finalisés pendant cet appel.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_assetloader_update(RC2D_AssetLoader* loader);
+
+/**
+ * \brief Bloque jusqu'à ce que tous les chargements en cours soient terminés.
+ *
+ * \details
+ * Finalise sans budget au fur et à mesure du décodage. Pratique pour un chargement
+ * synchrone ponctuel ou pour les tests.
+ *
+ * \param {RC2D_AssetLoader*} loader - Loader à attendre.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetloader_waitAll(RC2D_AssetLoader* loader);
+
+/**
+ * \brief Progression globale du lot de chargements en cours.
+ *
+ * \details
+ * Le lot commence au premier chargement demandé alors que le loader était inactif,
+ * et se termine quand tous ses chargements sont READY ou FAILED.
+ *
+ * \param {const RC2D_AssetLoader*} loader - Loader à consulter.
+ * \return {float} Progression entre 0.0 et 1.0 (1.0 si rien n'est en cours).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+float rc2d_assetloader_getProgress(const RC2D_AssetLoader* loader);
+
+/**
+ * \brief Nombre de chargements non terminés (ni READY ni FAILED).
+ *
+ * \param {const RC2D_AssetLoader*} loader - Loader à consulter.
+ * \return {int} Nombre de chargements en cours.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_assetloader_getPendingCount(const RC2D_AssetLoader* loader);
+
+/**
+ * \brief Demande le chargement asynchrone d'une image (texture).
+ *
+ * \param {RC2D_AssetLoader*} loader - Loader à utiliser.
+ * \param {const char*} storage_path - Chemin relatif dans le storage.
+ * \param {RC2D_StorageKind} storage_kind - RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER.
+ * \param {RC2D_AssetCallback} callback - Callback de complétion (NULL autorisé).
+ * \param {void*} userdata - Pointeur transmis à la callback.
+ * \return {RC2D_AssetHandle*} Handle du chargement, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetHandle* rc2d_assetloader_loadImage(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                             RC2D_AssetCallback callback, void* userdata);
+
+/**
+ * \brief Demande le chargement asynchrone de données d'image (surface CPU).
+ *
+ * \see rc2d_assetloader_loadImage() pour les paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetHandle* rc2d_assetloader_loadImageData(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                                 RC2D_AssetCallback callback, void* userdata);
+
+/**
+ * \brief Demande le chargement asynchrone d'une police.
+ *
+ * \param {float} fontSize - Taille de la police en points.
+ * \see rc2d_assetloader_loadImage() pour les autres paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetHandle* rc2d_assetloader_loadFont(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                            float fontSize, RC2D_AssetCallback callback, void* userdata);
+
+/**
+ * \brief Demande le chargement asynchrone d'un audio.
+ *
+ * \param {bool} predecode - Si vrai, décodage complet en mémoire (sur le worker).
+ * \see rc2d_assetloader_loadImage() pour les autres paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetHandle* rc2d_assetloader_loadAudio(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                             bool predecode, RC2D_AssetCallback callback, void* userdata);
+
+/**
+ * \brief Demande le chargement asynchrone d'un atlas TexturePacker (JSON ou .rc2datlas).
+ *
+ * \see rc2d_tp_loadAtlasFromStorage()
+ * \see rc2d_assetloader_loadImage() pour les paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetHandle* rc2d_assetloader_loadAtlas(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                             RC2D_AssetCallback callback, void* userdata);
+
+/**
+ * \brief État courant d'un chargement.
+ *
+ * \param {const RC2D_AssetHandle*} handle - Handle à consulter.
+ * \return {RC2D_AssetState} État du chargement (RC2D_ASSET_STATE_FAILED si handle est NULL).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetState rc2d_assetloader_getState(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Progression d'un chargement, selon son étape.
+ *
+ * \param {const RC2D_AssetHandle*} handle - Handle à consulter.
+ * \return {float} 0.0 (en file), 0.25 (décodage), 0.75 (décodé), 1.0 (terminé).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+float rc2d_assetloader_getHandleProgress(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Indique si un chargement est terminé (READY ou FAILED).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_assetloader_isDone(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Type d'asset d'un handle.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_AssetKind rc2d_assetloader_getKind(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Chemin (dans le storage) demandé pour ce handle.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+const char* rc2d_assetloader_getPath(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Récupère l'image chargée (RC2D_ASSET_IMAGE, état READY).
+ *
+ * \details L'appelant devient propriétaire de la texture (rc2d_graphics_freeImage()).
+ *
+ * \return {RC2D_Image} L'image, ou une image vide si le handle n'est pas READY ou d'un autre type.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Image rc2d_assetloader_getImage(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Récupère les données d'image chargées (RC2D_ASSET_IMAGE_DATA, état READY).
+ *
+ * \details L'appelant devient propriétaire de la surface (rc2d_graphics_freeImageData()).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_ImageData rc2d_assetloader_getImageData(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Récupère la police chargée (RC2D_ASSET_FONT, état READY).
+ *
+ * \details L'appelant devient propriétaire de la police (rc2d_graphics_closeFont()).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Font rc2d_assetloader_getFont(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Récupère l'audio chargé (RC2D_ASSET_AUDIO, état READY).
+ *
+ * \details L'appelant devient propriétaire de l'audio (rc2d_audio_destroy()).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+MIX_Audio* rc2d_assetloader_getAudio(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Récupère l'atlas chargé (RC2D_ASSET_ATLAS, état READY).
+ *
+ * \details L'appelant devient propriétaire de l'atlas (rc2d_tp_freeAtlas()).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_TP_Atlas rc2d_assetloader_getAtlas(const RC2D_AssetHandle* handle);
+
+/**
+ * \brief Rend un handle au loader.
+ *
+ * \details
+ * Si le chargement est terminé, le handle est libéré immédiatement (l'asset READY reste à
+ * l'appelant). Sinon, le chargement est abandonné : son résultat sera libéré dès qu'il sera
+ * finalisé et sa callback ne sera pas appelée.
+ *
+ * \param {RC2D_AssetHandle*} handle - Handle à rendre (NULL autorisé).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetloader_releaseHandle(RC2D_AssetHandle* handle);
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_ASSETLOADER_H
@@ -20,6 +20,10 @@ extern "C" {
  * déjà initialisé de l’engine. Si \p predecode est vrai, l’audio est entièrement
  * décodé en mémoire (plus de RAM, démarrage instantané et seek rapide).
  *
+ * Le fichier est lu par morceaux via rc2d_storage_titleOpenStream() /
+ * rc2d_storage_userOpenStream() : il n’est jamais chargé en entier en plus de la copie
+ * conservée par SDL_mixer. Pour une musique longue, préférer rc2d_track_setAudioFromStorage().
+ *
  * \param storage_path  Chemin relatif dans le dossier de stockage.
  * \param storage_kind  Type de dossier de stockage (RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER).
  * \param predecode     Si vrai, décodage complet en mémoire ; sinon, décodage à la volée.
@@ -85,6 +89,27 @@ void rc2d_track_destroy(MIX_Track* track);
  */
 bool rc2d_track_setAudio(MIX_Track* track, MIX_Audio* audio);
 
+/**
+ * \brief Assigner à une piste un fichier audio du storage, lu en streaming.
+ *
+ * \details
+ * Contrairement à rc2d_audio_loadAudioFromStorage(), aucun MIX_Audio n’est créé : la piste
+ * lit et décode le fichier au fil de la lecture via un RC2D_StorageStream. La mémoire utilisée
+ * ne dépend pas de la durée du fichier, ce qui convient aux musiques et ambiances longues.
+ * Le stream est fermé par SDL_mixer quand la piste change d’entrée ou est détruite.
+ *
+ * \param track         Piste cible.
+ * \param storage_path  Chemin relatif dans le dossier de stockage.
+ * \param storage_kind  Type de dossier de stockage (RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER).
+ *
+ * \return (bool) true si succès, false sinon (consulter les logs avec SDL_GetError()).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n’importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_track_setAudioFromStorage(MIX_Track* track, const char *storage_path, RC2D_StorageKind storage_kind);
+
 /**
  * \brief Démarrer ou redémarrer la lecture d’une piste.
  *
@@ -11,6 +11,22 @@
 extern "C" {
 #endif
 
+/**
+ * \brief Vérifie si un point touche un pixel solide d'un élément UI image.
+ *
+ * \details
+ * Test AABB sur `last_drawn_rect`, puis test pixel-perfect sur `hitMask` s'il est rempli
+ * (sinon sur la surface `imageData`, sinon le test AABB suffit).
+ *
+ * \param {const RC2D_UIImage*} ui - Élément UI (doit être visible et hittable).
+ * \param {float} x - Coordonnée X logique du point.
+ * \param {float} y - Coordonnée Y logique du point.
+ * \return {bool} `true` si le point touche l'élément, sinon `false`.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
 bool rc2d_collision_pointInUIImagePixelPerfect(const RC2D_UIImage* ui, float x, float y);
 
 /**
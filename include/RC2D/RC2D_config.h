@@ -102,8 +102,9 @@ extern "C" {
  *   `rc2d_memory_report()` pour un rapport à un moment spécifique.
  *
  * \warning L'activation de cette fonctionnalité augmente la consommation de mémoire, car chaque allocation
- * est accompagnée d'une structure de suivi. De plus, les performances peuvent être légèrement dégradées
- * en raison de la gestion de la liste des allocations.
+ * occupe une entrée dans une table de hachage de suivi. L'ajout et le retrait restent en O(1) (tables réparties
+ * en shards verrouillés séparément, utilisables depuis plusieurs threads), mais chaque allocation paie tout de même
+ * deux prises de verrou.
  *
  * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
  */
@@ -111,6 +112,28 @@ extern "C" {
 #define RC2D_MEMORY_DEBUG_ENABLED 0
 #endif
 
+/**
+ * \brief Si RC2D_MEMORY_TELEMETRY_ENABLED est défini à 1, les allocations RC2D alimentent des compteurs
+ * de télémétrie, même dans les builds sans suivi de débogage.
+ *
+ * Chaque `RC2D_malloc`, `RC2D_calloc`, `RC2D_realloc`, `RC2D_free`, `RC2D_strdup` et `RC2D_strndup` incrémente
+ * des compteurs (allocations, libérations, octets, par tag de module). RC2D les échantillonne à la fin de
+ * chaque frame dans un historique circulaire, lisible via `rc2d_memory_getFrameHistory()`.
+ *
+ * Le coût est de quelques nanosecondes par appel : compteurs répartis en shards (un verrou rarement disputé
+ * par thread), tag courant en mémoire locale au thread. Sans suivi de débogage, la taille d'un bloc libéré
+ * est lue auprès de l'allocateur système (`malloc_usable_size`, `_msize`, `malloc_size`) : les octets comptés
+ * sont alors les tailles réellement réservées, et restent à 0 sur les plateformes qui n'exposent pas cette
+ * information ou si l'application a remplacé l'allocateur via `SDL_SetMemoryFunctions()`.
+ *
+ * \note Défini à 0, les macros `RC2D_malloc` & co appellent directement SDL, sans aucun surcoût.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_MEMORY_TELEMETRY_ENABLED
+#define RC2D_MEMORY_TELEMETRY_ENABLED 1
+#endif
+
 /**
  * \brief Si RC2D_VIDEO_MODULE_ENABLED est défini à 1, le support vidéo (enregistrement/lecture) est activé.
  * 
@@ -3,6 +3,11 @@
 
 #if RC2D_DATA_MODULE_ENABLED
 
+#include <RC2D/RC2D_storage.h> // Required for : RC2D_StorageStream
+
+#include <SDL3/SDL_stdinc.h> // Required for : Uint64
+
+#include <stdbool.h> // Required for : bool
 #include <stddef.h> // Required for : size_t
 
 /* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
@@ -96,10 +101,104 @@ typedef enum RC2D_CompressFormat {
      * Format de compression LZ4.
      * 
      * \note Utilisé pour la compression rapide et efficace des données.
+     * Limité à un bloc de LZ4_MAX_INPUT_SIZE octets (~2 Go).
+     */
+    RC2D_COMPRESS_FORMAT_LZ4,
+
+    /**
+     * Format de compression LZ4 HC (haute compression).
+     * 
+     * \note Compression plus lente mais meilleur ratio, pour les données compressées une fois
+     * et décompressées souvent (assets, sauvegardes). La décompression est aussi rapide que LZ4.
+     * Le niveau se règle via RC2D_CompressOptions::level.
+     */
+    RC2D_COMPRESS_FORMAT_LZ4_HC,
+
+    /**
+     * Format de compression LZ4 en blocs chaînés de 4 Mo.
+     * 
+     * \note Sans limite de taille : à utiliser pour les données de plus de 2 Go.
      */
-    RC2D_COMPRESS_FORMAT_LZ4
+    RC2D_COMPRESS_FORMAT_LZ4_STREAM,
+
+    /**
+     * Format de compression LZ4 avec dictionnaire prédéfini.
+     * 
+     * \note Améliore fortement le ratio des petits payloads similaires (snapshots réseau, petites sauvegardes).
+     * Le même dictionnaire doit être fourni via RC2D_CompressOptions::dictionary à la compression et à la décompression.
+     */
+    RC2D_COMPRESS_FORMAT_LZ4_DICT,
+
+    /**
+     * Format de compression LZ4 en blocs indépendants, compressés et décompressés en parallèle.
+     * 
+     * \note Pour les gros buffers (sauvegardes de monde, replays). Sans limite de taille.
+     * La taille de bloc et le nombre de threads se règlent via RC2D_CompressOptions ; 
+     * un niveau différent de RC2D_COMPRESS_LEVEL_DEFAULT compresse chaque bloc en LZ4 HC.
+     * Le résultat est identique quel que soit le nombre de threads.
+     */
+    RC2D_COMPRESS_FORMAT_LZ4_BLOCKS
 } RC2D_CompressFormat;
 
+/**
+ * \brief Niveau de compression par défaut du format choisi.
+ * 
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_COMPRESS_LEVEL_DEFAULT 0
+
+/**
+ * \brief Niveaux de compression acceptés par RC2D_COMPRESS_FORMAT_LZ4_HC.
+ * 
+ * \note Chaque niveau double le nombre de correspondances examinées par position.
+ * 
+ * \since Ces macros sont disponibles depuis RC2D 1.0.0.
+ */
+#define RC2D_COMPRESS_LEVEL_HC_MIN 1
+#define RC2D_COMPRESS_LEVEL_HC_DEFAULT 9
+#define RC2D_COMPRESS_LEVEL_HC_MAX 12
+
+/**
+ * \brief Dictionnaire de compression préparé, partageable entre plusieurs compressions.
+ * 
+ * \note Créé par rc2d_data_createCompressDictionary, libéré par rc2d_data_destroyCompressDictionary.
+ * 
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_CompressDictionary RC2D_CompressDictionary;
+
+/**
+ * \brief Options de compression / décompression.
+ * 
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_CompressOptions {
+    /**
+     * Niveau de compression, RC2D_COMPRESS_LEVEL_DEFAULT pour le niveau par défaut du format.
+     * 
+     * \note Utilisé par RC2D_COMPRESS_FORMAT_LZ4_HC, ramené entre RC2D_COMPRESS_LEVEL_HC_MIN et RC2D_COMPRESS_LEVEL_HC_MAX.
+     */
+    int level;
+
+    /**
+     * Dictionnaire utilisé par RC2D_COMPRESS_FORMAT_LZ4_DICT, ignoré par les autres formats.
+     */
+    const RC2D_CompressDictionary* dictionary;
+
+    /**
+     * Taille des blocs de RC2D_COMPRESS_FORMAT_LZ4_BLOCKS, 0 pour la valeur par défaut (1 Mo).
+     * 
+     * \note Ramenée entre 64 Ko et 64 Mo. Stockée dans les données compressées, inutile à la décompression.
+     */
+    size_t blockSize;
+
+    /**
+     * Nombre de threads de RC2D_COMPRESS_FORMAT_LZ4_BLOCKS (thread appelant inclus), 
+     * 0 pour un thread par coeur logique.
+     */
+    int threadCount;
+} RC2D_CompressOptions;
+
 /**
  * \brief Structure pour stocker des données compressées.
  * 
@@ -228,6 +327,28 @@ typedef struct RC2D_EncryptedData {
     RC2D_DataType dataType;
 } RC2D_EncryptedData;
 
+/**
+ * \brief Taille en octets du sel utilisé pour dériver les clés de chiffrement (PBKDF2).
+ * 
+ * \note Le sel est stocké en tête de RC2D_EncryptedData::data.
+ * 
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_CRYPTO_SALT_SIZE 16
+
+/**
+ * \brief Clé de chiffrement dérivée une seule fois d'une passphrase et d'un sel.
+ * 
+ * \details rc2d_data_encrypt / rc2d_data_decrypt dérivent la clé (PBKDF2, SHA3-512) à chaque appel.
+ * Pour chiffrer de nombreux petits messages avec la même passphrase, créer une RC2D_CryptoKey 
+ * puis utiliser rc2d_data_encryptWithKey / rc2d_data_decryptWithKey : seul un IV est généré par message.
+ * 
+ * \note Structure opaque : utiliser rc2d_data_createCryptoKey() / rc2d_data_destroyCryptoKey().
+ * 
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_CryptoKey RC2D_CryptoKey;
+
 /**
  * \brief Enum des formats de hachage pris en charge.
  * 
@@ -286,9 +407,64 @@ typedef enum RC2D_HashFormat {
     /**
      * Algorithme de hachage SHA3-512, produit un hachage de 512 bits, basé sur l'algorithme de hachage Keccak.
      */
-    RC2D_HASHING_FORMAT_SHA3_512
+    RC2D_HASHING_FORMAT_SHA3_512,
+
+    /**
+     * Algorithme xxHash XXH64, produit un hachage de 64 bits.
+     * Non cryptographique : destiné aux clés de cache et à la détection de changements, pas à la sécurité.
+     */
+    RC2D_HASHING_FORMAT_XXH64,
+
+    /**
+     * Algorithme xxHash XXH3, produit un hachage de 64 bits. Plus rapide que XXH64, surtout sur les petites entrées.
+     * Non cryptographique.
+     */
+    RC2D_HASHING_FORMAT_XXH3_64,
+
+    /**
+     * Algorithme xxHash XXH3, produit un hachage de 128 bits. Recommandé pour l'adressage d'assets par contenu.
+     * Non cryptographique.
+     */
+    RC2D_HASHING_FORMAT_XXH3_128
 } RC2D_HashFormat;
 
+/**
+ * \brief Taille maximale en octets d'un hash binaire, tous formats confondus (SHA-512 / SHA3-512).
+ * 
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_HASH_MAX_SIZE 64
+
+/**
+ * \brief Contexte de hachage incrémental (init / update / final).
+ * 
+ * \details Permet de hacher des données arbitraires par morceaux, sans les avoir entièrement en mémoire.
+ * Un contexte peut être réutilisé pour plusieurs hash successifs : après rc2d_data_hashFinal(), 
+ * il est réinitialisé pour le même format.
+ * 
+ * \note Structure opaque : utiliser rc2d_data_createHashContext() / rc2d_data_destroyHashContext().
+ * 
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_HashContext RC2D_HashContext;
+
+/**
+ * \brief Hash non cryptographique de 128 bits (XXH3).
+ * 
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_Hash128 {
+    /**
+     * 64 bits de poids faible.
+     */
+    Uint64 low64;
+
+    /**
+     * 64 bits de poids fort.
+     */
+    Uint64 high64;
+} RC2D_Hash128;
+
 /**
  * \brief Encode des données en utilisant le format spécifié.
  *
@@ -311,6 +487,9 @@ RC2D_EncodedData* rc2d_data_encode(const unsigned char* data, const size_t dataS
 /**
  * \brief Décode des données en utilisant le format spécifié.
  * 
+ * \details Le décodage utilise `encodedSize` (les données encodées n'ont pas besoin d'être terminées par un caractère nul) 
+ * et échoue si l'entrée contient un caractère invalide, voir rc2d_data_decodeTo().
+ * 
  * \param {const RC2D_EncodedData*} encodedData - Pointeur vers l'objet RC2D_EncodedData contenant les données encodées et les métadonnées nécessaires pour le décodage.
  * \return {unsigned char*} - Pointeur vers les données décodées, ou NULL en cas d'échec.
  * 
@@ -324,6 +503,104 @@ RC2D_EncodedData* rc2d_data_encode(const unsigned char* data, const size_t dataS
  */
 unsigned char* rc2d_data_decode(const RC2D_EncodedData* encodedData);
 
+/**
+ * \brief Retourne la taille exacte (sans caractère nul) d'un encodage.
+ * 
+ * \param {size_t} dataSize - Taille des données à encoder en octets.
+ * \param {RC2D_EncodeFormat} format - Format d'encodage.
+ * \return {size_t} - Nombre de caractères produits par rc2d_data_encodeTo(), ou 0 si le format n'est pas supporté.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+size_t rc2d_data_getEncodedSize(size_t dataSize, const RC2D_EncodeFormat format);
+
+/**
+ * \brief Retourne la taille maximale des données décodées depuis un encodage de taille donnée.
+ * 
+ * \note En Base64, la taille réelle peut être inférieure de 1 ou 2 octets selon le padding.
+ * 
+ * \param {size_t} encodedSize - Nombre de caractères encodés.
+ * \param {RC2D_EncodeFormat} format - Format d'encodage.
+ * \return {size_t} - Taille maximale en octets, ou 0 si le format n'est pas supporté.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+size_t rc2d_data_getDecodedMaxSize(size_t encodedSize, const RC2D_EncodeFormat format);
+
+/**
+ * \brief Encode des données dans un buffer fourni par l'appelant, sans allocation.
+ * 
+ * \details Utilise SSE2 / SSE4.1 / AVX2 ou NEON selon le processeur (détection à l'exécution), 
+ * avec un repli scalaire produisant exactement la même sortie. Aucun caractère nul n'est ajouté.
+ * L'hexadécimal est produit en majuscules, le Base64 utilise l'alphabet standard avec padding '='.
+ * 
+ * \param {const unsigned char*} data - Données à encoder (peut être NULL si dataSize vaut 0).
+ * \param {size_t} dataSize - Taille des données en octets.
+ * \param {RC2D_EncodeFormat} format - Format d'encodage.
+ * \param {char*} out - [out] Buffer de sortie.
+ * \param {size_t} outSize - Taille du buffer, au moins rc2d_data_getEncodedSize(dataSize, format).
+ * \param {size_t*} out_written - [out] Nombre de caractères écrits (peut être NULL).
+ * \return {bool} - true en cas de succès, false sinon (format non supporté, buffer trop petit).
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_decodeTo
+ */
+bool rc2d_data_encodeTo(const unsigned char* data, size_t dataSize, const RC2D_EncodeFormat format, char* out, size_t outSize, size_t* out_written);
+
+/**
+ * \brief Décode des données dans un buffer fourni par l'appelant, sans allocation.
+ * 
+ * \details L'entrée n'a pas besoin d'être terminée par un caractère nul. L'entrée est rejetée si elle contient 
+ * un caractère hors alphabet, si sa longueur est invalide (impaire en hexadécimal, non multiple de 4 en Base64) 
+ * ou si le padding '=' n'est pas en fin de Base64. L'hexadécimal est accepté en majuscules comme en minuscules.
+ * Les chemins vectorisés appliquent exactement la même validation que le chemin scalaire.
+ * 
+ * \param {const char*} encoded - Caractères encodés (peut être NULL si encodedSize vaut 0).
+ * \param {size_t} encodedSize - Nombre de caractères encodés.
+ * \param {RC2D_EncodeFormat} format - Format d'encodage.
+ * \param {unsigned char*} out - [out] Buffer de sortie.
+ * \param {size_t} outSize - Taille du buffer, au moins rc2d_data_getDecodedMaxSize(encodedSize, format) suffit toujours.
+ * \param {size_t*} out_written - [out] Nombre d'octets décodés (peut être NULL).
+ * \return {bool} - true en cas de succès, false si l'entrée est invalide ou le buffer trop petit.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_encodeTo
+ */
+bool rc2d_data_decodeTo(const char* encoded, size_t encodedSize, const RC2D_EncodeFormat format, unsigned char* out, size_t outSize, size_t* out_written);
+
+/**
+ * \brief Encode des données dans une chaîne temporaire allouée dans l'arène de la frame courante.
+ *
+ * \details Variante sans RC2D_malloc de rc2d_data_encode() pour les chaînes à usage immédiat
+ * (affichage, envoi réseau, clé de cache...) : rien à libérer, la mémoire est récupérée à la fin de la frame.
+ *
+ * \param {const unsigned char*} data - Pointeur vers les données à encoder.
+ * \param {size_t} dataSize - Taille des données à encoder en octets.
+ * \param {RC2D_EncodeFormat} format - Format d'encodage à utiliser.
+ * \param {size_t*} out_length - [out] Longueur de la chaîne (sans le caractère nul), ou NULL.
+ * \return {char*} - Chaîne terminée par un caractère nul, valide jusqu'à la fin de la frame courante, ou NULL en cas d'échec.
+ *
+ * \warning Ne pas libérer le pointeur retourné.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_frame_alloc
+ * \see rc2d_data_encodeTo
+ */
+char* rc2d_data_encodeFrame(const unsigned char* data, size_t dataSize, const RC2D_EncodeFormat format, size_t* out_length);
+
 /**
  * \brief Compresse des données en utilisant le format de compression spécifié.
  * 
@@ -359,14 +636,85 @@ RC2D_CompressedData* rc2d_data_compress(const unsigned char* data, const size_t
  */
 unsigned char* rc2d_data_decompress(const RC2D_CompressedData* compressedData);
 
+/**
+ * \brief Compresse des données avec des options (niveau, dictionnaire).
+ * 
+ * \param {const unsigned char*} data - Pointeur vers les données en clair à compresser.
+ * \param {size_t} dataSize - Taille des données en clair en octets.
+ * \param {RC2D_DataType} dataType - Type de données fournies.
+ * \param {RC2D_CompressFormat} format - Format de compression à utiliser.
+ * \param {const RC2D_CompressOptions*} options - Options de compression, ou NULL pour les valeurs par défaut.
+ * \return {RC2D_CompressedData*} - Pointeur vers un nouvel objet RC2D_CompressedData, ou NULL en cas d'échec 
+ * (notamment RC2D_COMPRESS_FORMAT_LZ4_DICT sans dictionnaire).
+ * 
+ * \warning La structure RC2D_CompressedData et son champ `data` doivent être libérés par l'appelant avec `RC2D_safe_free`.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris avec le même dictionnaire.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_decompressWithOptions
+ */
+RC2D_CompressedData* rc2d_data_compressWithOptions(const unsigned char* data, const size_t dataSize, const RC2D_DataType dataType, const RC2D_CompressFormat format, const RC2D_CompressOptions* options);
+
+/**
+ * \brief Décompresse des données avec des options (dictionnaire).
+ * 
+ * \param {const RC2D_CompressedData*} compressedData - Pointeur vers les données compressées.
+ * \param {const RC2D_CompressOptions*} options - Dictionnaire utilisé à la compression et nombre de threads, ou NULL.
+ * \return {unsigned char*} - Pointeur vers les données décompressées, ou NULL en cas d'échec.
+ * 
+ * \warning Le tableau retourné doit être libéré par l'appelant avec `RC2D_safe_free`.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_compressWithOptions
+ */
+unsigned char* rc2d_data_decompressWithOptions(const RC2D_CompressedData* compressedData, const RC2D_CompressOptions* options);
+
+/**
+ * \brief Prépare un dictionnaire de compression à partir de données représentatives.
+ * 
+ * Seuls les 64 derniers Ko sont utilisés : placer en fin de dictionnaire le contenu le plus fréquent.
+ * Le dictionnaire est indexé une seule fois, puis attaché sans recopie à chaque compression.
+ * 
+ * \param {const void*} data - Données représentatives (ex : un snapshot type), copiées.
+ * \param {size_t} dataSize - Taille des données en octets.
+ * \return {RC2D_CompressDictionary*} - Le dictionnaire, ou NULL en cas d'échec.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_destroyCompressDictionary
+ */
+RC2D_CompressDictionary* rc2d_data_createCompressDictionary(const void* data, size_t dataSize);
+
+/**
+ * \brief Libère un dictionnaire de compression.
+ * 
+ * \param {RC2D_CompressDictionary*} dictionary - Le dictionnaire à libérer, peut être NULL.
+ * 
+ * \threadsafety Aucune compression ne doit utiliser le dictionnaire pendant l'appel.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_createCompressDictionary
+ */
+void rc2d_data_destroyCompressDictionary(RC2D_CompressDictionary* dictionary);
+
 /**
  * \brief Hash une chaîne de caractères en utilisant le format de hachage spécifié. 
  * 
  * Calcule le hash d'une chaîne de caractères en utilisant le format de hashage spécifié.
  * Cette fonction prend une chaîne de caractères en entrée et retourne son hash calculé
  * selon l'algorithme spécifié par `format`. Les formats supportés incluent MD5, SHA1,
- * SHA224, SHA256, SHA384, SHA512, ainsi que les variantes SHA3. La sortie est convertie
- * en une chaîne hexadécimale représentant le hash. OpenSSL est utilisé pour le calcul du hash.
+ * SHA224, SHA256, SHA384, SHA512, les variantes SHA3 ainsi que xxHash (XXH64, XXH3). La sortie est convertie
+ * en une chaîne hexadécimale représentant le hash. OpenSSL est utilisé pour le calcul des hash cryptographiques.
+ * 
+ * \note Pour des données binaires ou lues par morceaux, utiliser rc2d_data_hashBytes() ou rc2d_data_createHashContext().
  * 
  * \param data La chaîne de caractères à hasher. Doit être une chaîne C terminée par un null ('\0').
  * \param format L'identifiant du format de hashage, spécifié par l'énumération `RC2D_HashFormat`.
@@ -383,6 +731,138 @@ unsigned char* rc2d_data_decompress(const RC2D_CompressedData* compressedData);
  */
 char* rc2d_data_hash(const char* data, const RC2D_HashFormat format);
 
+/**
+ * \brief Retourne la taille en octets du hash binaire produit par un format.
+ * 
+ * \param {RC2D_HashFormat} format - Le format de hachage.
+ * \return {size_t} - Taille du hash en octets, ou 0 si le format n'est pas supporté.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+size_t rc2d_data_getHashSize(const RC2D_HashFormat format);
+
+/**
+ * \brief Hash des données binaires en une seule fois.
+ * 
+ * \details Les formats xxHash sont écrits dans leur représentation canonique (big-endian), 
+ * identique à la sortie de l'outil `xxhsum`.
+ * 
+ * \param {const void*} data - Les données à hacher (peut être NULL si dataSize vaut 0).
+ * \param {size_t} dataSize - Taille des données en octets.
+ * \param {RC2D_HashFormat} format - Le format de hachage.
+ * \param {unsigned char*} out - [out] Buffer recevant le hash.
+ * \param {size_t} outSize - Taille du buffer, au moins rc2d_data_getHashSize(format) (RC2D_HASH_MAX_SIZE suffit toujours).
+ * \return {size_t} - Taille du hash écrit, ou 0 en cas d'échec.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+size_t rc2d_data_hashBytes(const void* data, size_t dataSize, const RC2D_HashFormat format, unsigned char* out, size_t outSize);
+
+/**
+ * \brief Crée un contexte de hachage incrémental.
+ * 
+ * \param {RC2D_HashFormat} format - Le format de hachage.
+ * \return {RC2D_HashContext*} - Le contexte, ou NULL en cas d'échec.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_hashUpdate
+ * \see rc2d_data_hashFinal
+ * \see rc2d_data_destroyHashContext
+ */
+RC2D_HashContext* rc2d_data_createHashContext(const RC2D_HashFormat format);
+
+/**
+ * \brief Ajoute des données au hash en cours.
+ * 
+ * \param {RC2D_HashContext*} context - Le contexte de hachage.
+ * \param {const void*} data - Les données à ajouter (peut être NULL si dataSize vaut 0).
+ * \param {size_t} dataSize - Taille des données en octets.
+ * \return {bool} - true en cas de succès, false sinon.
+ * 
+ * \threadsafety Un même contexte ne doit pas être utilisé par plusieurs threads en même temps.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_data_hashUpdate(RC2D_HashContext* context, const void* data, size_t dataSize);
+
+/**
+ * \brief Termine le hash en cours et réinitialise le contexte pour un nouveau hash.
+ * 
+ * \param {RC2D_HashContext*} context - Le contexte de hachage.
+ * \param {unsigned char*} out - [out] Buffer recevant le hash.
+ * \param {size_t} outSize - Taille du buffer, au moins rc2d_data_getHashSize() du format du contexte.
+ * \return {size_t} - Taille du hash écrit, ou 0 en cas d'échec.
+ * 
+ * \threadsafety Un même contexte ne doit pas être utilisé par plusieurs threads en même temps.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+size_t rc2d_data_hashFinal(RC2D_HashContext* context, unsigned char* out, size_t outSize);
+
+/**
+ * \brief Libère un contexte de hachage.
+ * 
+ * \param {RC2D_HashContext*} context - Le contexte à libérer, peut être NULL.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_data_destroyHashContext(RC2D_HashContext* context);
+
+/**
+ * \brief Hash le contenu restant d'un stream du storage, lu par morceaux.
+ * 
+ * \details Le stream est lu depuis sa position courante jusqu'à la fin : la mémoire utilisée 
+ * ne dépend pas de la taille du fichier. Le stream n'est pas fermé.
+ * 
+ * \param {RC2D_StorageStream*} stream - Stream ouvert (rc2d_storage_titleOpenStream / rc2d_storage_userOpenStream).
+ * \param {RC2D_HashFormat} format - Le format de hachage.
+ * \param {unsigned char*} out - [out] Buffer recevant le hash.
+ * \param {size_t} outSize - Taille du buffer, au moins rc2d_data_getHashSize(format).
+ * \return {size_t} - Taille du hash écrit, ou 0 en cas d'échec (y compris une erreur de lecture du stream).
+ * 
+ * \threadsafety Un stream ne doit être utilisé que par un thread à la fois.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+size_t rc2d_data_hashStream(RC2D_StorageStream* stream, const RC2D_HashFormat format, unsigned char* out, size_t outSize);
+
+/**
+ * \brief Hash rapide non cryptographique de 64 bits (XXH3), pour les clés de cache et la détection de changements.
+ * 
+ * \param {const void*} data - Les données à hacher (peut être NULL si dataSize vaut 0).
+ * \param {size_t} dataSize - Taille des données en octets.
+ * \param {Uint64} seed - Graine, 0 par défaut.
+ * \return {Uint64} - Le hash.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint64 rc2d_data_hash64(const void* data, size_t dataSize, Uint64 seed);
+
+/**
+ * \brief Hash rapide non cryptographique de 128 bits (XXH3), pour l'adressage d'assets par contenu.
+ * 
+ * \param {const void*} data - Les données à hacher (peut être NULL si dataSize vaut 0).
+ * \param {size_t} dataSize - Taille des données en octets.
+ * \param {Uint64} seed - Graine, 0 par défaut.
+ * \return {RC2D_Hash128} - Le hash.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Hash128 rc2d_data_hash128(const void* data, size_t dataSize, Uint64 seed);
+
 /**
  * \brief Chiffre des données à l'aide d'une passphrase, en utilisant un format de chiffrement spécifié. 
  * 
@@ -448,6 +928,90 @@ unsigned char* rc2d_data_decrypt(const RC2D_EncryptedData* encryptedData);
  */
 void rc2d_data_freeSecurity(RC2D_EncryptedData* encryptedData);
 
+/**
+ * \brief Dérive une clé de chiffrement réutilisable à partir d'une passphrase et d'un sel.
+ * 
+ * \param {const char*} passphrase - Passphrase, non conservée par la clé.
+ * \param {const unsigned char*} salt - Sel de RC2D_CRYPTO_SALT_SIZE octets (par ex. les premiers octets 
+ * d'un RC2D_EncryptedData existant), ou NULL pour générer un nouveau sel aléatoire.
+ * \param {RC2D_CipherFormat} format - Format de chiffrement symétrique (AES, ChaCha20, ChaCha20-Poly1305).
+ * \return {RC2D_CryptoKey*} - La clé, ou NULL en cas d'échec.
+ * 
+ * \note Coûteuse (PBKDF2) : à faire une fois par passphrase et par sel, pas par message.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_destroyCryptoKey
+ */
+RC2D_CryptoKey* rc2d_data_createCryptoKey(const char* passphrase, const unsigned char* salt, const RC2D_CipherFormat format);
+
+/**
+ * \brief Retourne le sel de la clé (RC2D_CRYPTO_SALT_SIZE octets), à conserver pour recréer la clé plus tard.
+ * 
+ * \param {const RC2D_CryptoKey*} cryptoKey - La clé.
+ * \return {const unsigned char*} - Le sel, valide jusqu'à la destruction de la clé, ou NULL.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+const unsigned char* rc2d_data_getCryptoKeySalt(const RC2D_CryptoKey* cryptoKey);
+
+/**
+ * \brief Libère une clé de chiffrement après avoir zéroisé la clé dérivée.
+ * 
+ * \param {RC2D_CryptoKey*} cryptoKey - La clé à libérer, peut être NULL.
+ * 
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_createCryptoKey
+ */
+void rc2d_data_destroyCryptoKey(RC2D_CryptoKey* cryptoKey);
+
+/**
+ * \brief Chiffre des données avec une clé déjà dérivée.
+ * 
+ * \details Même format que rc2d_data_encrypt (sel + IV + ciphertext, HMAC) : le résultat peut aussi 
+ * être déchiffré par rc2d_data_decrypt en renseignant la passphrase.
+ * 
+ * \param {RC2D_CryptoKey*} cryptoKey - La clé.
+ * \param {const unsigned char*} data - Données à chiffrer.
+ * \param {size_t} dataSize - Taille des données en octets.
+ * \param {RC2D_DataType} dataType - Type de données fournies.
+ * \return {RC2D_EncryptedData*} - Les données chiffrées (passphrase à NULL), ou NULL en cas d'échec.
+ * 
+ * \warning La structure retournée doit être libérée avec `rc2d_data_freeSecurity`.
+ * 
+ * \threadsafety Une même clé ne doit pas être utilisée par plusieurs threads en même temps 
+ * (son contexte de chiffrement est réutilisé) : créer une clé par thread.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_decryptWithKey
+ */
+RC2D_EncryptedData* rc2d_data_encryptWithKey(RC2D_CryptoKey* cryptoKey, const unsigned char* data, size_t dataSize, const RC2D_DataType dataType);
+
+/**
+ * \brief Déchiffre des données avec une clé déjà dérivée, après vérification du HMAC.
+ * 
+ * \param {RC2D_CryptoKey*} cryptoKey - La clé, dérivée avec le même sel que le message.
+ * \param {const RC2D_EncryptedData*} encryptedData - Données chiffrées (rc2d_data_encryptWithKey ou rc2d_data_encrypt).
+ * \return {unsigned char*} - Les données déchiffrées, ou NULL en cas d'échec (sel différent, données altérées...).
+ * 
+ * \warning Le tableau retourné doit être libéré par l'appelant avec `RC2D_safe_free`.
+ * 
+ * \threadsafety Une même clé ne doit pas être utilisée par plusieurs threads en même temps.
+ * 
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ * 
+ * \see rc2d_data_encryptWithKey
+ */
+unsigned char* rc2d_data_decryptWithKey(RC2D_CryptoKey* cryptoKey, const RC2D_EncryptedData* encryptedData);
+
 #ifdef __cplusplus
 }
 #endif  
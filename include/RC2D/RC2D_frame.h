@@ -0,0 +1,147 @@
+#ifndef RC2D_FRAME_H
+#define RC2D_FRAME_H
+
+#include <stdbool.h>                 // Requis pour : bool
+#include <stddef.h>                  // Requis pour : size_t
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Taille (en octets) d'un bloc des arènes de frame.
+ *
+ * Si une frame dépasse la capacité de son arène, un bloc supplémentaire est alloué ;
+ * les blocs sont fusionnés en un seul bloc plus grand à la remise à zéro suivante,
+ * de sorte qu'en régime établi une frame ne fait plus aucune allocation système.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_FRAME_ARENA_BLOCK_SIZE
+#define RC2D_FRAME_ARENA_BLOCK_SIZE (256 * 1024)
+#endif
+
+/**
+ * \brief Alignement utilisé quand `align` vaut 0.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_FRAME_DEFAULT_ALIGN 16
+
+/**
+ * \brief Statistiques des arènes de frame.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_FrameArenaStats {
+    /**
+     * Octets alloués dans l'arène de la frame courante.
+     */
+    size_t usedBytes;
+
+    /**
+     * Octets alloués dans l'arène double-buffer de la frame courante.
+     */
+    size_t doubleBufferedUsedBytes;
+
+    /**
+     * Capacité totale réservée par les trois arènes.
+     */
+    size_t capacityBytes;
+
+    /**
+     * Plus grand nombre d'octets alloués en une frame (toutes arènes confondues) depuis le démarrage.
+     */
+    size_t peakBytes;
+
+    /**
+     * Nombre de remises à zéro effectuées (nombre de frames terminées).
+     */
+    size_t frameIndex;
+} RC2D_FrameArenaStats;
+
+/**
+ * \brief Alloue un bloc temporaire dans l'arène de la frame courante.
+ *
+ * \details Allocation linéaire (simple incrément de pointeur) : il n'y a pas de libération individuelle.
+ * Toute la mémoire de l'arène est récupérée d'un coup par RC2D à la fin de la frame,
+ * juste après rc2d_graphics_present().
+ *
+ * \param {size_t} size - Taille du bloc en octets.
+ * \param {size_t} align - Alignement (puissance de 2), ou 0 pour RC2D_FRAME_DEFAULT_ALIGN.
+ * \return {void*} Bloc non initialisé, valide jusqu'à la fin de la frame courante, ou NULL en cas d'erreur.
+ *
+ * \warning Ne jamais passer ce pointeur à RC2D_free(), ni le conserver d'une frame à l'autre.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, tant que le bloc
+ * n'est pas utilisé après la fin de la frame.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_frame_allocDoubleBuffered
+ */
+void* rc2d_frame_alloc(size_t size, size_t align);
+
+/**
+ * \brief Alloue un bloc temporaire qui survit à la frame courante ET à la frame suivante.
+ *
+ * \details Deux arènes alternent : celle de la frame N est remise à zéro à la fin de la frame N+1.
+ * Utile pour des données produites pendant une frame et consommées pendant la suivante
+ * (résultats calculés dans rc2d_update() puis relus au tick d'après, etc.).
+ *
+ * \param {size_t} size - Taille du bloc en octets.
+ * \param {size_t} align - Alignement (puissance de 2), ou 0 pour RC2D_FRAME_DEFAULT_ALIGN.
+ * \return {void*} Bloc non initialisé, valide jusqu'à la fin de la frame suivante, ou NULL en cas d'erreur.
+ *
+ * \warning Ne jamais passer ce pointeur à RC2D_free().
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_frame_alloc
+ */
+void* rc2d_frame_allocDoubleBuffered(size_t size, size_t align);
+
+/**
+ * \brief Duplique une chaîne de caractères dans l'arène de la frame courante.
+ *
+ * \param {const char*} str - Chaîne à dupliquer.
+ * \return {char*} Copie valide jusqu'à la fin de la frame courante, ou NULL en cas d'erreur.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+char* rc2d_frame_strdup(const char* str);
+
+/**
+ * \brief Indique si un pointeur appartient à l'une des arènes de frame.
+ *
+ * \param {const void*} ptr - Pointeur à tester.
+ * \return {bool} true si le pointeur a été alloué par rc2d_frame_alloc / rc2d_frame_allocDoubleBuffered.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_frame_owns(const void* ptr);
+
+/**
+ * \brief Récupère les statistiques des arènes de frame.
+ *
+ * \param {RC2D_FrameArenaStats*} out_stats - [out] Statistiques.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_frame_getStats(RC2D_FrameArenaStats* out_stats);
+
+/* Termine les définitions de fonctions C lors de l'utilisation de C++ */
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_FRAME_H
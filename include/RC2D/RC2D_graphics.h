@@ -66,6 +66,37 @@ typedef struct RC2D_ImageData {
     SDL_Surface* sdl_surface;
 } RC2D_ImageData;
 
+/**
+ * \brief Masque de collision 1 bit par pixel, construit depuis le canal alpha d'une image.
+ *
+ * \details
+ * Remplace une surface RGBA complète pour les tests pixel-perfect : 1 bit au lieu de
+ * 32 par pixel. Le pixel (x, y) est solide si le bit `x & 7` de l'octet
+ * `bits[y * stride + (x >> 3)]` est à 1.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_HitMask {
+    /** Bits du masque, lignes de `stride` octets (NULL si aucun masque). */
+    Uint8* bits;
+
+    /** Largeur du masque en pixels (celle de l'image source). */
+    int w;
+
+    /** Hauteur du masque en pixels (celle de l'image source). */
+    int h;
+
+    /** Nombre d'octets par ligne : (w + 7) / 8. */
+    int stride;
+} RC2D_HitMask;
+
+/**
+ * \brief Seuil alpha par défaut des masques de collision : un pixel est solide si alpha > 32.
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD 32
+
 /**
  * Structure représentant un texte rendu.
  * @typedef {object} RC2D_Text
@@ -96,6 +127,19 @@ typedef struct RC2D_Font {
     void* _file_data; // <-- garde le buffer vivant pour rc2d_graphics_closeFont
 } RC2D_Font;
 
+/**
+ * \brief Lot de sprites (sprite batch) regroupant plusieurs quads texturés.
+ *
+ * Les quads ajoutés sont accumulés dans un seul tampon de sommets/indices
+ * tant qu'ils partagent la même texture, puis envoyés en un seul appel
+ * SDL_RenderGeometry lors du flush (ou au changement de texture).
+ *
+ * \note Structure opaque : utiliser rc2d_graphics_newSpriteBatch() / rc2d_graphics_freeSpriteBatch().
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_SpriteBatch RC2D_SpriteBatch;
+
 /* ========================================================================= */
 /*                               GRAPHICS CLASSIC                            */
 /* ========================================================================= */
@@ -243,6 +287,63 @@ void rc2d_graphics_freeImageData(RC2D_ImageData* imageData);
  */
 void rc2d_graphics_freeImage(RC2D_Image* image);
 
+/**
+ * \brief Charge une image et son masque de collision en un seul décodage.
+ *
+ * \details
+ * Le fichier est lu et décodé une fois : la texture est créée depuis la surface, le masque
+ * 1 bit est construit depuis son canal alpha, puis la surface est libérée. À préférer à
+ * la paire rc2d_graphics_loadImageFromStorage() + rc2d_graphics_loadImageDataFromStorage()
+ * quand la surface ne sert qu'aux tests pixel-perfect.
+ *
+ * \param {const char*} storage_path - Chemin relatif dans le stockage.
+ * \param {RC2D_StorageKind} storage_kind - RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER.
+ * \param {Uint8} alphaThreshold - Un pixel est solide si son alpha est strictement supérieur
+ * (voir RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD).
+ * \param {RC2D_HitMask*} hitMask - [out] Masque à libérer via rc2d_graphics_freeHitMask().
+ * \return {RC2D_Image} L'image, ou une image vide en cas d'échec (masque remis à zéro).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Image rc2d_graphics_loadImageWithHitMaskFromStorage(const char* storage_path, RC2D_StorageKind storage_kind,
+                                                         Uint8 alphaThreshold, RC2D_HitMask* hitMask);
+
+/**
+ * \brief Construit un masque de collision depuis des données d'image déjà décodées.
+ *
+ * \param {const RC2D_ImageData*} imageData - Surface source (tout format de pixel).
+ * \param {Uint8} alphaThreshold - Un pixel est solide si son alpha est strictement supérieur.
+ * \param {RC2D_HitMask*} hitMask - [out] Masque à libérer via rc2d_graphics_freeHitMask().
+ * \return {bool} true en cas de succès, false sinon (masque remis à zéro).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_graphics_newHitMaskFromImageData(const RC2D_ImageData* imageData, Uint8 alphaThreshold, RC2D_HitMask* hitMask);
+
+/**
+ * \brief Indique si le pixel (x, y) du masque est solide.
+ *
+ * \return {bool} false si le masque est vide ou si (x, y) est hors du masque.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_graphics_hitMaskTest(const RC2D_HitMask* hitMask, int x, int y);
+
+/**
+ * \brief Libère un masque de collision.
+ *
+ * \param {RC2D_HitMask*} hitMask - Masque à libérer (NULL autorisé), remis à zéro.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_graphics_freeHitMask(RC2D_HitMask* hitMask);
+
 /**
  * Définit la couleur de rendu.
  * @param color - Couleur RGBA à utiliser.
@@ -281,6 +382,120 @@ bool rc2d_graphics_setBlendMode(const RC2D_BlendMode blendMode);
  */
 bool rc2d_graphics_scale(float scaleX, float scaleY);
 
+/* ========================================================================= */
+/*                                SPRITE BATCH                               */
+/* ========================================================================= */
+
+/**
+ * \brief Crée un lot de sprites.
+ *
+ * \param {int} capacity Nombre de sprites pré-alloués (le lot grandit si nécessaire, <= 0 pour la valeur par défaut).
+ * \return {RC2D_SpriteBatch*} Le lot créé, ou NULL en cas d’échec.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_graphics_freeSpriteBatch()
+ */
+RC2D_SpriteBatch* rc2d_graphics_newSpriteBatch(int capacity);
+
+/**
+ * \brief Libère un lot de sprites (les sprites en attente sont abandonnés).
+ *
+ * \note Si le lot est le lot actif, il est désactivé.
+ *
+ * \param {RC2D_SpriteBatch*} batch Le lot à libérer.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_graphics_freeSpriteBatch(RC2D_SpriteBatch* batch);
+
+/**
+ * \brief Ajoute un quad texturé au lot.
+ *
+ * Mêmes transformations que rc2d_graphics_drawQuad(), plus une couleur de modulation.
+ * Si la texture diffère de celle des sprites en attente, le lot est d’abord flushé
+ * (l’ordre de dessin est conservé).
+ *
+ * \param {RC2D_SpriteBatch*} batch Le lot cible.
+ * \param {RC2D_Image*} image Image source.
+ * \param {const RC2D_Quad*} quad Sous-rectangle source, ou NULL pour l’image entière.
+ * \param {float} x, y Position du coin haut-gauche.
+ * \param {double} angle Rotation en degrés.
+ * \param {float} scaleX, scaleY Échelle.
+ * \param {float} offsetX, offsetY Centre de rotation (passer -1, -1 pour centrer).
+ * \param {bool} flipHorizontal, flipVertical Retournements.
+ * \param {RC2D_Color} color Couleur de modulation (255,255,255,255 = aucune).
+ * \return {bool} true si le sprite a été ajouté, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_graphics_addToSpriteBatch(RC2D_SpriteBatch* batch, RC2D_Image* image, const RC2D_Quad* quad,
+                                    float x, float y,
+                                    double angle,
+                                    float scaleX, float scaleY,
+                                    float offsetX, float offsetY,
+                                    bool flipHorizontal, bool flipVertical,
+                                    RC2D_Color color);
+
+/**
+ * \brief Dessine tous les sprites en attente en un seul appel SDL_RenderGeometry, puis vide le lot.
+ *
+ * \param {RC2D_SpriteBatch*} batch Le lot à flusher.
+ * \return {bool} true si le dessin a réussi (ou si le lot était vide), false sinon.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_graphics_flushSpriteBatch(RC2D_SpriteBatch* batch);
+
+/**
+ * \brief Vide le lot sans rien dessiner.
+ *
+ * \param {RC2D_SpriteBatch*} batch Le lot à vider.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_graphics_clearSpriteBatch(RC2D_SpriteBatch* batch);
+
+/**
+ * \brief Récupère le nombre de sprites en attente dans le lot.
+ *
+ * \param {const RC2D_SpriteBatch*} batch Le lot.
+ * \return {int} Le nombre de sprites en attente.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_graphics_getSpriteBatchCount(const RC2D_SpriteBatch* batch);
+
+/**
+ * \brief Définit le lot actif utilisé par rc2d_graphics_drawImage / rc2d_graphics_drawQuad / rc2d_tp_drawFrame*.
+ *
+ * Tant qu’un lot est actif, ces fonctions ajoutent leurs sprites au lot au lieu de dessiner
+ * immédiatement. Les autres primitives (rectangles, lignes, texte...) flushent d’abord le lot
+ * actif pour conserver l’ordre de dessin, et rc2d_graphics_present() le flushe avant la présentation.
+ *
+ * \note Le lot précédent est flushé avant d’être remplacé. Passer NULL revient au dessin immédiat.
+ *
+ * \param {RC2D_SpriteBatch*} batch Le lot à activer, ou NULL.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_graphics_setSpriteBatch(RC2D_SpriteBatch* batch);
+
+/**
+ * \brief Récupère le lot actif.
+ *
+ * \return {RC2D_SpriteBatch*} Le lot actif, ou NULL en mode de dessin immédiat.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_SpriteBatch* rc2d_graphics_getSpriteBatch(void);
+
 
 /* ========================================================================= */
 /*                                 TEXT / FONT                               */
@@ -4,6 +4,8 @@
 #include <RC2D/RC2D_engine.h>
 #include <RC2D/RC2D_math.h>
 #include <RC2D/RC2D_gpu.h>
+#include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_texturepacker.h>
 
 #include <SDL3/SDL_events.h>
 #include <SDL3/SDL_init.h>
@@ -322,6 +324,144 @@ void rc2d_onnx_cleanup(void);
  */
 void rc2d_filesystem_quit(void);
 
+/**
+ * \brief Charge les frames et méta d’un atlas TexturePacker, SANS créer la texture d’atlas.
+ *
+ * \details
+ * Même logique que rc2d_tp_loadAtlasFromStorage() (.rc2datlas précalculé prioritaire, JSON
+ * en fallback), mais s’arrête avant l’upload GPU : utilisé par les workers de
+ * RC2D_AssetLoader, la texture étant créée ensuite sur le thread principal.
+ *
+ * \param {const char*} path - Chemin (dans le storage) du JSON ou du .rc2datlas.
+ * \param {RC2D_StorageKind} storage_kind - RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER.
+ * \param {RC2D_TP_Atlas*} atlas - [out] Atlas sans texture (à libérer via rc2d_tp_freeAtlas()).
+ * \param {char*} image_path - [out] Chemin (dans le storage) de l’image d’atlas.
+ * \param {size_t} image_path_cap - Taille du buffer image_path.
+ * \return {bool} true en cas de succès, false sinon (atlas remis à zéro).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_tp_loadAtlasFramesFromStorage(const char* path, RC2D_StorageKind storage_kind,
+                                        RC2D_TP_Atlas* atlas, char* image_path, size_t image_path_cap);
+
+/**
+ * \brief Dessine les sprites en attente dans le lot actif (rc2d_graphics_setSpriteBatch).
+ *
+ * \note À appeler avant tout appel direct à SDL_Render* et avant tout changement d'état du renderer
+ * (couleur, blend, scale...) hors de RC2D_graphics, pour conserver l'ordre de dessin.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_graphics_flushActiveSpriteBatch(void);
+
+/**
+ * \brief Met à jour tous les RC2D_AssetLoader vivants (finalisation dans leur budget).
+ *
+ * \note Appelée à chaque frame dans SDL_AppIterate, avant rc2d_update().
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetloader_updateAll(void);
+
+/**
+ * \brief Détruit les RC2D_AssetLoader que l'application n'a pas détruits.
+ *
+ * \note Appelée par rc2d_engine_quit(), avant la fermeture des storages.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetloader_destroyAll(void);
+
+/**
+ * \brief Libère toutes les entrées du cache d'assets, même encore référencées.
+ *
+ * \note Appelée par rc2d_engine_quit(), après rc2d_unload() et avant la destruction du renderer.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_assetcache_destroyAll(void);
+
+/**
+ * \brief Termine la frame pour les arènes de frame : remet à zéro l'arène de la frame
+ * et l'arène double-buffer qui contenait les données de la frame précédente.
+ *
+ * \note Appelée à chaque frame dans SDL_AppIterate, juste après rc2d_graphics_present().
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_frame_endFrame(void);
+
+/**
+ * \brief Échantillonne les compteurs de télémétrie mémoire de la frame dans l'historique circulaire.
+ *
+ * \note Appelée à chaque frame dans SDL_AppIterate, après rc2d_frame_endFrame().
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_memory_sampleFrame(void);
+
+/**
+ * \brief Libère les blocs des arènes de frame.
+ *
+ * \note Appelée par rc2d_engine_quit(), avant rc2d_memory_report().
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_frame_quit(void);
+
+/**
+ * \brief Renvoie la racine (chemin réel, terminé par un séparateur) du storage user.
+ *
+ * \return {const char*} Racine du storage user, ou NULL s'il n'est pas ouvert ou si le backend
+ * n'a pas de système de fichiers.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+const char* rc2d_storage_getUserRoot(void);
+
+/**
+ * \brief Vide la file du logger asynchrone, arrête son thread et ferme le fichier de log.
+ *
+ * \note Appelée par rc2d_engine_quit(), juste avant rc2d_engine_cleanup_sdl() : les messages
+ * suivants (rapport mémoire compris) sont écrits de façon synchrone dans le log SDL.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_logger_quit(void);
+
+#if RC2D_DATA_MODULE_ENABLED
+/**
+ * \brief Termine les sauvegardes asynchrones en file, arrête le thread d'écriture et appelle les callbacks restantes.
+ *
+ * \note Appelée par rc2d_engine_quit(), avant la fermeture des storages.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_save_shutdown(void);
+#endif
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -4,6 +4,7 @@
 #include <RC2D/RC2D_assert.h>
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_atomic.h>
 
 #include <stdarg.h> // Required for : ... (va_list, va_start, va_end)
 
@@ -12,6 +13,54 @@
 extern "C" {
 #endif
 
+/**
+ * \brief Nombre d'enregistrements de la file du logger asynchrone (puissance de 2).
+ *
+ * Quand la file est pleine, les nouveaux messages sont perdus (et comptés) plutôt que de
+ * bloquer l'appelant ; seuls les messages RC2D_LOG_CRITICAL attendent qu'une place se libère.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_LOGGER_RING_CAPACITY
+#define RC2D_LOGGER_RING_CAPACITY 512
+#endif
+
+/**
+ * \brief Taille maximale (en octets, préfixe et '\0' compris) d'un message de log.
+ *
+ * Les messages plus longs sont tronqués.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_LOGGER_RECORD_SIZE
+#define RC2D_LOGGER_RECORD_SIZE 1024
+#endif
+
+/**
+ * \brief Niveau minimal (valeur de RC2D_LogLevel) des RC2D_log compilés dans le programme.
+ *
+ * Les appels RC2D_log, RC2D_log_every_n et RC2D_log_throttled de niveau constant inférieur
+ * sont supprimés à la compilation : ni appel de fonction, ni évaluation des arguments.
+ * Contrairement à rc2d_logger_set_priority(), ils ne peuvent pas être réactivés à l'exécution.
+ *
+ * Valeurs : 0=TRACE, 1=VERBOSE, 2=DEBUG, 3=INFO, 4=WARN, 5=ERROR, 6=CRITICAL.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_LOG_MIN_LEVEL
+#define RC2D_LOG_MIN_LEVEL 0
+#endif
+
+/**
+ * \brief Indique si un message de ce niveau serait affiché, sans appeler rc2d_logger_log().
+ *
+ * \param {RC2D_LogLevel} level - Le niveau de priorité du message.
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_LOG_ENABLED(level) \
+    ((int)(level) >= RC2D_LOG_MIN_LEVEL && (level) >= rc2d_logger_get_priority())
+
 /**
  * \brief Macro pour afficher un message de log avec le niveau de priorité spécifié.
  * 
@@ -20,6 +69,8 @@ extern "C" {
  *
  * Exemple d'affichage :
  * [info:rc2d_gpu.c:42:rc2d_gpu_getInfo] La propriété GPU est NULL !
+ *
+ * Les arguments ne sont évalués que si le message est affiché (voir RC2D_LOG_ENABLED).
  * 
  * \param {RC2D_LogLevel} level - Le niveau de priorité du message.
  * \param {const char*} format - Le format du message, suivant la syntaxe de printf.
@@ -29,8 +80,63 @@ extern "C" {
  * 
  * \since Cette macro est disponible depuis RC2D 1.0.0.
  */
-#define RC2D_log(level, format, ...) \
-    rc2d_logger_log((level), SDL_FILE, SDL_LINE, SDL_FUNCTION, (format), ##__VA_ARGS__)
+#define RC2D_log(level, format, ...) do { \
+    if (RC2D_LOG_ENABLED(level)) { \
+        rc2d_logger_log((level), SDL_FILE, SDL_LINE, SDL_FUNCTION, (format), ##__VA_ARGS__); \
+    } \
+} while (0)
+
+/**
+ * \brief Affiche un message de log une fois sur `n` passages par cet appel (le 1er, le n+1-ème, etc.).
+ *
+ * Le compteur est propre à chaque appel de la macro dans le code source.
+ *
+ * Exemple d'utilisation :
+ * RC2D_log_every_n(RC2D_LOG_DEBUG, 60, "Frame %d", frame);
+ *
+ * \param {RC2D_LogLevel} level - Le niveau de priorité du message.
+ * \param {int} n - Période (> 0).
+ * \param {const char*} format - Le format du message, suivant la syntaxe de printf.
+ * \param {...} - Les arguments à insérer dans le format du message.
+ *
+ * \threadsafety Cette macro peut être utilisée depuis n'importe quel thread.
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_log_every_n(level, n, format, ...) do { \
+    static SDL_AtomicInt rc2d_log_everyNCount_; \
+    if (RC2D_LOG_ENABLED(level) && \
+        (Uint32)SDL_AddAtomicInt(&rc2d_log_everyNCount_, 1) % (Uint32)(n) == 0) { \
+        rc2d_logger_log((level), SDL_FILE, SDL_LINE, SDL_FUNCTION, (format), ##__VA_ARGS__); \
+    } \
+} while (0)
+
+/**
+ * \brief Affiche un message de log au plus une fois toutes les `ms` millisecondes pour cet appel.
+ *
+ * Les passages entre deux messages sont ignorés. Utile pour un log dans une boucle de jeu
+ * (une frame à 144 Hz appelle la macro 144 fois par seconde).
+ *
+ * Exemple d'utilisation :
+ * RC2D_log_throttled(RC2D_LOG_INFO, 500, "Camera (%.1f, %.1f)", camera.x, camera.y);
+ *
+ * \param {RC2D_LogLevel} level - Le niveau de priorité du message.
+ * \param {Uint32} ms - Intervalle minimal entre deux messages, en millisecondes.
+ * \param {const char*} format - Le format du message, suivant la syntaxe de printf.
+ * \param {...} - Les arguments à insérer dans le format du message.
+ *
+ * \threadsafety Cette macro peut être utilisée depuis n'importe quel thread.
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_logger_should_log_throttled
+ */
+#define RC2D_log_throttled(level, ms, format, ...) do { \
+    static SDL_AtomicU32 rc2d_log_throttleLast_; \
+    if (RC2D_LOG_ENABLED(level) && rc2d_logger_should_log_throttled(&rc2d_log_throttleLast_, (ms))) { \
+        rc2d_logger_log((level), SDL_FILE, SDL_LINE, SDL_FUNCTION, (format), ##__VA_ARGS__); \
+    } \
+} while (0)
 
 /**
  * \brief Cette enum est utilisée pour définir le niveau de priorité des messages de log.
@@ -105,6 +211,8 @@ void rc2d_logger_set_priority(const RC2D_LogLevel logLevel);
  *
  * Cette fonction affiche un message de log, en utilisant le formatage printf,
  * si son niveau de priorité est supérieur ou égal au niveau de log actuel.
+ * En mode asynchrone (rc2d_logger_set_async()), le message est seulement placé dans la file
+ * du logger et écrit plus tard par son thread.
  *
  * \param {RC2D_LogLevel} logLevel - Le niveau de priorité du message.
  * \param {const char*} file - Le nom du fichier source.
@@ -119,6 +227,101 @@ void rc2d_logger_set_priority(const RC2D_LogLevel logLevel);
  */
 void rc2d_logger_log(RC2D_LogLevel logLevel, const char* file, int line, const char* function, const char* format, ...);
 
+/**
+ * \brief Décide si un message limité dans le temps doit être affiché (utilisé par RC2D_log_throttled).
+ *
+ * \param {SDL_AtomicU32*} lastTicks - État de l'appel : instant (SDL_GetTicks) du dernier message, 0 au départ.
+ * \param {Uint32} intervalMs - Intervalle minimal entre deux messages, en millisecondes.
+ * \return {bool} true si au moins `intervalMs` ms se sont écoulées depuis le dernier message.
+ * Un seul thread obtient true par intervalle.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_logger_should_log_throttled(SDL_AtomicU32* lastTicks, Uint32 intervalMs);
+
+/**
+ * \brief Active ou désactive le mode asynchrone du logger.
+ *
+ * En mode asynchrone, rc2d_logger_log() formate le message directement dans une file circulaire
+ * sans verrou (plusieurs producteurs, un consommateur) puis rend la main : un thread dédié
+ * vide la file vers les sorties (log SDL et/ou fichier), de sorte que l'appelant n'attend
+ * jamais une écriture console ou disque.
+ *
+ * Si la file est pleine, le message est perdu et compté (voir rc2d_logger_get_dropped_count()) ;
+ * le thread du logger signale les pertes dans les sorties. Un message RC2D_LOG_CRITICAL vide
+ * toujours la file avant de rendre la main.
+ *
+ * Désactiver le mode asynchrone vide la file et arrête le thread.
+ *
+ * \param {bool} enabled - true pour activer le mode asynchrone, false pour revenir au mode synchrone.
+ * \return {bool} true en cas de succès, false sinon.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_logger_flush
+ */
+bool rc2d_logger_set_async(bool enabled);
+
+/**
+ * \brief Active ou désactive la sortie des messages vers le log SDL (console, logcat, etc.).
+ *
+ * La sortie SDL est activée par défaut.
+ *
+ * \param {bool} enabled - true pour envoyer les messages au log SDL.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_logger_set_console_enabled(bool enabled);
+
+/**
+ * \brief Écrit aussi les messages de log dans un fichier du storage user, avec rotation.
+ *
+ * Les messages sont ajoutés à la fin du fichier. Quand il dépasse `maxBytes`, le fichier est
+ * renommé en "<path>.1" (les archives existantes sont décalées : "<path>.1" devient "<path>.2", etc.,
+ * la plus ancienne au-delà de `maxFiles` étant supprimée) et un nouveau fichier est commencé.
+ *
+ * \param {const char*} path - Chemin du fichier dans le storage user (ex. "logs/game.log"),
+ * ou NULL pour fermer le fichier de log courant.
+ * \param {Sint64} maxBytes - Taille à partir de laquelle le fichier est archivé, ou 0 pour ne jamais l'archiver.
+ * \param {int} maxFiles - Nombre d'archives conservées ("<path>.1" à "<path>.<maxFiles>").
+ * \return {bool} true en cas de succès, false sinon.
+ *
+ * \note Le storage user doit être ouvert (rc2d_storage_openUser()) et le dossier du fichier doit exister.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_logger_set_file_sink(const char* path, Sint64 maxBytes, int maxFiles);
+
+/**
+ * \brief Attend que tous les messages déjà journalisés soient écrits dans les sorties.
+ *
+ * En mode synchrone, force seulement l'écriture du fichier de log sur le disque.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_logger_flush(void);
+
+/**
+ * \brief Récupère le nombre de messages perdus parce que la file du logger asynchrone était pleine.
+ *
+ * \return {int} Nombre total de messages perdus depuis le démarrage.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_logger_get_dropped_count(void);
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
@@ -486,6 +486,24 @@ RC2D_BezierCurve* rc2d_math_subdivideBezierCurve(RC2D_BezierCurve* curve, double
  */
 RC2D_Point* rc2d_math_renderBezierCurve(RC2D_BezierCurve* curve, int depth, int* numPoints);
 
+/**
+ * \brief Variante de rc2d_math_renderBezierCurve() dont le tableau est alloué dans l'arène de la frame courante.
+ *
+ * \param {RC2D_BezierCurve*} curve - La courbe de Bézier à rendre.
+ * \param {int} depth - La profondeur de la récursion pour la subdivision.
+ * \param {int*} numPoints - Un pointeur vers une variable où stocker le nombre de points générés.
+ * \return {RC2D_Point*} - Un tableau de points valide jusqu'à la fin de la frame courante, ou NULL en cas d'erreur.
+ *
+ * \warning Ne pas libérer le tableau retourné.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_frame_alloc
+ */
+RC2D_Point* rc2d_math_renderBezierCurveFrame(RC2D_BezierCurve* curve, int depth, int* numPoints);
+
 /**
  * \brief Génère une liste de coordonnées pour un segment spécifié d'une courbe de Bézier.
  *
@@ -505,6 +523,26 @@ RC2D_Point* rc2d_math_renderBezierCurve(RC2D_BezierCurve* curve, int depth, int*
  * \see rc2d_math_renderBezierCurve
  */
 RC2D_Point* rc2d_math_renderSegmentBezierCurve(RC2D_BezierCurve* curve, double startpoint, double endpoint, int depth, int* numPoints);
+
+/**
+ * \brief Variante de rc2d_math_renderSegmentBezierCurve() dont le tableau est alloué dans l'arène de la frame courante.
+ *
+ * \param {RC2D_BezierCurve*} curve - La courbe de Bézier.
+ * \param {double} startpoint - Le point de départ du segment sur la courbe (0 <= startpoint <= 1).
+ * \param {double} endpoint - Le point de fin du segment sur la courbe (startpoint < endpoint <= 1).
+ * \param {int} depth - La profondeur de la récursion pour la subdivision.
+ * \param {int*} numPoints - Un pointeur vers une variable où stocker le nombre de points générés.
+ * \return {RC2D_Point*} - Un tableau de points valide jusqu'à la fin de la frame courante, ou NULL en cas d'erreur.
+ *
+ * \warning Ne pas libérer le tableau retourné.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_frame_alloc
+ */
+RC2D_Point* rc2d_math_renderSegmentBezierCurveFrame(RC2D_BezierCurve* curve, double startpoint, double endpoint, int depth, int* numPoints);
 RC2D_BezierCurve* rc2d_math_getDerivativeBezierCurve(RC2D_BezierCurve* curve);
 int rc2d_math_getDegreeBezierCurve(RC2D_BezierCurve* curve);
 int rc2d_math_getControlPointCountBezierCurve(RC2D_BezierCurve* curve);
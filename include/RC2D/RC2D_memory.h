@@ -150,6 +150,99 @@ char* rc2d_strdup_debug(const char* str, const char* file, int line, const char*
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
 char* rc2d_strndup_debug(const char* str, size_t n, const char* file, int line, const char* func);
+#elif RC2D_MEMORY_TELEMETRY_ENABLED
+/**
+ * \brief Sans suivi de débogage, les macros passent par des fonctions qui alimentent seulement
+ * les compteurs de télémétrie (voir RC2D_MEMORY_TELEMETRY_ENABLED).
+ *
+ * \since Ces macros sont disponibles depuis RC2D 1.0.0.
+ */
+#define RC2D_malloc(size) rc2d_malloc_telemetry(size)
+#define RC2D_calloc(nmemb, size) rc2d_calloc_telemetry(nmemb, size)
+#define RC2D_realloc(ptr, size) rc2d_realloc_telemetry(ptr, size)
+#define RC2D_free(ptr) rc2d_free_telemetry(ptr)
+#define RC2D_safe_free(ptr) do { if ((ptr) != NULL) { RC2D_free(ptr); (ptr) = NULL; } } while(0)
+#define RC2D_strdup(str) rc2d_strdup_telemetry(str)
+#define RC2D_strndup(str, n) rc2d_strndup_telemetry(str, n)
+
+/**
+ * \brief Équivalent de `SDL_malloc` comptabilisé par la télémétrie mémoire.
+ *
+ * \param size Taille du bloc de mémoire à allouer (en octets).
+ *
+ * \return Pointeur vers le bloc de mémoire alloué, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_malloc_telemetry(size_t size);
+
+/**
+ * \brief Équivalent de `SDL_calloc` comptabilisé par la télémétrie mémoire.
+ *
+ * \param nmemb Nombre d'éléments à allouer.
+ * \param size Taille de chaque élément (en octets).
+ *
+ * \return Pointeur vers le bloc de mémoire alloué et initialisé, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_calloc_telemetry(size_t nmemb, size_t size);
+
+/**
+ * \brief Équivalent de `SDL_realloc` comptabilisé par la télémétrie mémoire.
+ *
+ * \param ptr Pointeur vers le bloc de mémoire à réallouer.
+ * \param size Nouvelle taille du bloc de mémoire (en octets).
+ *
+ * \return Pointeur vers le bloc de mémoire réalloué, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_realloc_telemetry(void* ptr, size_t size);
+
+/**
+ * \brief Équivalent de `SDL_free` comptabilisé par la télémétrie mémoire.
+ *
+ * \param ptr Pointeur vers le bloc de mémoire à libérer (NULL est ignoré).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_free_telemetry(void* ptr);
+
+/**
+ * \brief Équivalent de `SDL_strdup` comptabilisé par la télémétrie mémoire.
+ *
+ * \param str Chaîne de caractères à dupliquer.
+ *
+ * \return Pointeur vers la nouvelle chaîne dupliquée, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+char* rc2d_strdup_telemetry(const char* str);
+
+/**
+ * \brief Équivalent de `SDL_strndup` comptabilisé par la télémétrie mémoire.
+ *
+ * \param str Chaîne de caractères à dupliquer.
+ * \param n Nombre maximum de caractères à dupliquer.
+ *
+ * \return Pointeur vers la nouvelle chaîne dupliquée, ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+char* rc2d_strndup_telemetry(const char* str, size_t n);
 #else
 #define RC2D_malloc(size) SDL_malloc(size)
 #define RC2D_calloc(nmemb, size) SDL_calloc(nmemb, size)
@@ -160,13 +253,314 @@ char* rc2d_strndup_debug(const char* str, size_t n, const char* file, int line,
 #define RC2D_strndup(str, n) SDL_strndup(str, n)
 #endif
 
+/**
+ * \brief Tags de télémétrie mémoire : chaque allocation est attribuée au tag courant du thread.
+ *
+ * \since Cette énumération est disponible depuis RC2D 1.0.0.
+ */
+typedef enum RC2D_MemoryTag {
+    RC2D_MEMORY_TAG_GENERAL = 0,    /**< Tag par défaut */
+    RC2D_MEMORY_TAG_ENGINE,         /**< Coeur du moteur */
+    RC2D_MEMORY_TAG_GRAPHICS,       /**< Rendu, textures, GPU */
+    RC2D_MEMORY_TAG_AUDIO,          /**< Audio */
+    RC2D_MEMORY_TAG_TEXT,           /**< Polices et texte */
+    RC2D_MEMORY_TAG_ASSETS,         /**< Chargement et cache d'assets */
+    RC2D_MEMORY_TAG_DATA,           /**< Compression, chiffrement, sauvegardes */
+    RC2D_MEMORY_TAG_STORAGE,        /**< Storage et système de fichiers */
+    RC2D_MEMORY_TAG_NET,            /**< Réseau */
+    RC2D_MEMORY_TAG_MATH,           /**< Mathématiques, pathfinding */
+    RC2D_MEMORY_TAG_UI,             /**< Interface utilisateur */
+    RC2D_MEMORY_TAG_GAME,           /**< Code du jeu (rc2d_update, rc2d_draw...) */
+    RC2D_MEMORY_TAG_USER_0,         /**< Libre pour l'application */
+    RC2D_MEMORY_TAG_USER_1,         /**< Libre pour l'application */
+    RC2D_MEMORY_TAG_USER_2,         /**< Libre pour l'application */
+    RC2D_MEMORY_TAG_USER_3,         /**< Libre pour l'application */
+    RC2D_MEMORY_TAG_COUNT
+} RC2D_MemoryTag;
+
+/**
+ * \brief Alloue avec un tag explicite, quel que soit le tag courant du thread.
+ *
+ * \since Ces macros sont disponibles depuis RC2D 1.0.0.
+ */
+#define RC2D_malloc_tagged(size, tag) (rc2d_memory_pushTag(tag), rc2d_memory_popTagPassthrough(RC2D_malloc(size)))
+#define RC2D_calloc_tagged(nmemb, size, tag) (rc2d_memory_pushTag(tag), rc2d_memory_popTagPassthrough(RC2D_calloc(nmemb, size)))
+#define RC2D_realloc_tagged(ptr, size, tag) (rc2d_memory_pushTag(tag), rc2d_memory_popTagPassthrough(RC2D_realloc(ptr, size)))
+
+/**
+ * \brief Exécute le bloc qui suit avec `tag` comme tag courant du thread.
+ *
+ * \code
+ * RC2D_MEMORY_TAG_SCOPE(RC2D_MEMORY_TAG_UI)
+ * {
+ *     rebuild_menu();
+ * }
+ * \endcode
+ *
+ * \warning Un `return`, `break` ou `goto` qui sort du bloc saute la restauration du tag :
+ * utilisez alors rc2d_memory_pushTag() / rc2d_memory_popTag().
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_MEMORY_TAG_SCOPE(tag) \
+    for (int rc2d_memory_tagScope_ = (rc2d_memory_pushTag(tag), 1); rc2d_memory_tagScope_; rc2d_memory_tagScope_ = (rc2d_memory_popTag(), 0))
+
+/**
+ * \brief Nombre de frames conservées par l'historique de télémétrie mémoire.
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_MEMORY_TELEMETRY_HISTORY
+#define RC2D_MEMORY_TELEMETRY_HISTORY 120
+#endif
+
+/**
+ * \brief Compteurs cumulés depuis le démarrage.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_MemoryCounters {
+    /**
+     * Nombre d'allocations (malloc, calloc, strdup, strndup, et realloc qui déplace ou crée un bloc).
+     */
+    Uint64 allocCount;
+
+    /**
+     * Nombre de libérations.
+     */
+    Uint64 freeCount;
+
+    /**
+     * Octets alloués.
+     */
+    Uint64 bytesAllocated;
+
+    /**
+     * Octets libérés.
+     */
+    Uint64 bytesFreed;
+
+    /**
+     * Allocations par tag.
+     */
+    Uint64 tagAllocCount[RC2D_MEMORY_TAG_COUNT];
+
+    /**
+     * Octets alloués par tag.
+     */
+    Uint64 tagBytesAllocated[RC2D_MEMORY_TAG_COUNT];
+} RC2D_MemoryCounters;
+
+/**
+ * \brief Statistiques mémoire d'une frame, échantillonnées à la fin de chaque frame.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_MemoryFrameStats {
+    /**
+     * Index de la frame (nombre d'échantillons pris avant celui-ci).
+     */
+    Uint64 frameIndex;
+
+    /**
+     * Allocations pendant la frame.
+     */
+    Uint64 allocCount;
+
+    /**
+     * Libérations pendant la frame.
+     */
+    Uint64 freeCount;
+
+    /**
+     * Octets alloués pendant la frame.
+     */
+    Uint64 bytesAllocated;
+
+    /**
+     * Octets libérés pendant la frame.
+     */
+    Uint64 bytesFreed;
+
+    /**
+     * Octets vivants à la fin de la frame.
+     */
+    Sint64 bytesInFlight;
+
+    /**
+     * Plus grande valeur de bytesInFlight échantillonnée depuis le démarrage.
+     */
+    Sint64 peakBytesInFlight;
+
+    /**
+     * Allocations pendant la frame, par tag.
+     */
+    Uint64 tagAllocCount[RC2D_MEMORY_TAG_COUNT];
+
+    /**
+     * Octets alloués pendant la frame, par tag.
+     */
+    Uint64 tagBytesAllocated[RC2D_MEMORY_TAG_COUNT];
+} RC2D_MemoryFrameStats;
+
+/**
+ * \brief Empile un tag de télémétrie pour le thread courant.
+ *
+ * \param tag Tag attribué aux allocations suivantes du thread.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_memory_popTag
+ */
+void rc2d_memory_pushTag(RC2D_MemoryTag tag);
+
+/**
+ * \brief Dépile le tag de télémétrie du thread courant.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_memory_popTag(void);
+
+/**
+ * \brief Dépile le tag courant et retourne `ptr` (utilisée par les macros `RC2D_*_tagged`).
+ *
+ * \param ptr Pointeur retourné tel quel.
+ * \return `ptr`.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_memory_popTagPassthrough(void* ptr);
+
+/**
+ * \brief Récupère le tag de télémétrie courant du thread.
+ *
+ * \return Le tag au sommet de la pile du thread, RC2D_MEMORY_TAG_GENERAL si elle est vide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_MemoryTag rc2d_memory_getCurrentTag(void);
+
+/**
+ * \brief Nom lisible d'un tag de télémétrie.
+ *
+ * \param tag Tag.
+ * \return Nom du tag (ex: "graphics"), ou "?" si le tag est invalide.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+const char* rc2d_memory_getTagName(RC2D_MemoryTag tag);
+
+/**
+ * \brief Récupère les compteurs cumulés de télémétrie mémoire.
+ *
+ * Pratique pour mesurer les allocations d'un chemin critique : lire les compteurs avant et après,
+ * puis comparer (ex: vérifier dans un test qu'une fonction n'alloue plus).
+ *
+ * \param out_counters [out] Compteurs (remis à zéro si la télémétrie est désactivée).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_memory_getCounters(RC2D_MemoryCounters* out_counters);
+
+/**
+ * \brief Récupère l'historique des statistiques mémoire par frame, de la plus récente à la plus ancienne.
+ *
+ * \param out_stats [out] Tableau recevant les statistiques.
+ * \param max_stats Taille du tableau.
+ *
+ * \return Nombre d'entrées écrites (au plus RC2D_MEMORY_TELEMETRY_HISTORY, 0 si la télémétrie est désactivée).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_memory_getFrameHistory(RC2D_MemoryFrameStats* out_stats, int max_stats);
+
+/**
+ * \brief Nombre de sites d'appel affichés par rc2d_memory_report().
+ *
+ * \since Cette macro de préprocesseur est disponible depuis RC2D 1.0.0.
+ */
+#ifndef RC2D_MEMORY_REPORT_TOP_N
+#define RC2D_MEMORY_REPORT_TOP_N 10
+#endif
+
+/**
+ * \brief Statistiques agrégées des allocations faites depuis un même site d'appel (fichier + ligne).
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_MemoryCallsiteStats {
+    /**
+     * Fichier source du site d'appel.
+     */
+    const char* file;
+
+    /**
+     * Ligne dans le fichier source.
+     */
+    int line;
+
+    /**
+     * Fonction appelante.
+     */
+    const char* func;
+
+    /**
+     * Nombre d'allocations encore vivantes.
+     */
+    Uint64 liveCount;
+
+    /**
+     * Octets encore vivants.
+     */
+    Uint64 liveBytes;
+
+    /**
+     * Pic d'octets vivants atteint depuis le démarrage.
+     */
+    Uint64 peakBytes;
+
+    /**
+     * Nombre cumulé d'allocations depuis le démarrage.
+     */
+    Uint64 totalCount;
+} RC2D_MemoryCallsiteStats;
+
+/**
+ * \brief Récupère les sites d'appel ayant le plus gros pic d'octets vivants, triés par pic décroissant.
+ *
+ * \param out_stats [out] Tableau recevant les statistiques.
+ * \param max_stats Taille du tableau.
+ *
+ * \return Nombre d'entrées écrites (0 si `RC2D_MEMORY_DEBUG_ENABLED` est défini à 0).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_memory_getTopCallsites(RC2D_MemoryCallsiteStats* out_stats, int max_stats);
+
 /**
  * \brief Affiche un rapport des fuites mémoire détectées.
  *
  * Cette fonction génère un rapport détaillé des blocs de mémoire alloués via les fonctions RC2D
  * (`RC2D_malloc`, etc.) qui n'ont pas été libérés. Le rapport inclut l'adresse du pointeur, la taille
  * allouée, le fichier source, la ligne, et la fonction où l'allocation a été effectuée. Si aucune fuite
- * n'est détectée, un message indiquant l'absence de fuites est affiché.
+ * n'est détectée, un message indiquant l'absence de fuites est affiché. Le rapport se termine par les
+ * `RC2D_MEMORY_REPORT_TOP_N` sites d'appel ayant le plus gros pic d'octets vivants.
  *
  * Le rapport est automatiquement généré à la fin de l'exécution du programme si
  * `RC2D_MEMORY_DEBUG_ENABLED` est activé, mais cette fonction peut être appelée manuellement pour
@@ -180,6 +574,169 @@ char* rc2d_strndup_debug(const char* str, size_t n, const char* file, int line,
  */
 void rc2d_memory_report(void);
 
+/**
+ * \brief Pool d'objets de taille fixe (opaque).
+ *
+ * Les objets sont découpés dans des slabs alignés sur une ligne de cache et recyclés via une
+ * liste libre : allocation et libération en O(1), sans fragmenter le tas. Idéal pour les objets
+ * créés et détruits en masse (projectiles, particules, contextes de tween, noeuds de recherche...).
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_Pool RC2D_Pool;
+
+/**
+ * \brief Statistiques d'un pool d'objets.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_PoolStats {
+    /**
+     * Taille demandée d'un objet.
+     */
+    size_t objectSize;
+
+    /**
+     * Nombre de slabs alloués.
+     */
+    size_t slabCount;
+
+    /**
+     * Nombre total d'objets disponibles dans les slabs.
+     */
+    size_t capacity;
+
+    /**
+     * Objets sortis de la liste libre partagée (objets en réserve dans les caches de thread compris).
+     */
+    size_t liveCount;
+
+    /**
+     * Maximum atteint par liveCount.
+     */
+    size_t peakCount;
+} RC2D_PoolStats;
+
+#if RC2D_MEMORY_DEBUG_ENABLED
+/**
+ * \brief Macros d'allocation dans un pool d'objets.
+ *
+ * Comme `RC2D_malloc` / `RC2D_free`, elles enregistrent le site d'appel dans le suivi mémoire
+ * lorsque `RC2D_MEMORY_DEBUG_ENABLED` est activé : un objet non rendu à son pool est signalé
+ * à la destruction du pool et par rc2d_memory_report(), avec le nom du pool.
+ *
+ * \since Ces macros sont disponibles depuis RC2D 1.0.0.
+ */
+#define RC2D_pool_alloc(pool) rc2d_memory_poolAllocDebug(pool, SDL_FILE, SDL_LINE, SDL_FUNCTION)
+#define RC2D_pool_free(pool, ptr) rc2d_memory_poolFreeDebug(pool, ptr, SDL_FILE, SDL_LINE, SDL_FUNCTION)
+
+/**
+ * \brief Alloue un objet dans un pool avec suivi de débogage.
+ *
+ * \param pool Pool d'objets.
+ * \param file Nom du fichier source où l'allocation est effectuée.
+ * \param line Numéro de ligne dans le fichier source.
+ * \param func Nom de la fonction appelante.
+ *
+ * \return Pointeur vers l'objet (non initialisé), ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_memory_poolAllocDebug(RC2D_Pool* pool, const char* file, int line, const char* func);
+
+/**
+ * \brief Rend un objet à son pool avec suivi de débogage.
+ *
+ * Un objet suivi qui n'appartient pas à `pool` est signalé et n'est pas libéré.
+ *
+ * \param pool Pool d'origine de l'objet.
+ * \param ptr Objet à rendre (NULL est ignoré).
+ * \param file Nom du fichier source où la libération est effectuée.
+ * \param line Numéro de ligne dans le fichier source.
+ * \param func Nom de la fonction appelante.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_memory_poolFreeDebug(RC2D_Pool* pool, void* ptr, const char* file, int line, const char* func);
+#else
+#define RC2D_pool_alloc(pool) rc2d_memory_poolAlloc(pool)
+#define RC2D_pool_free(pool, ptr) rc2d_memory_poolFree(pool, ptr)
+#endif
+
+/**
+ * \brief Crée un pool d'objets de taille fixe.
+ *
+ * \param name Nom du pool (copié), utilisé dans les logs et le rapport des fuites.
+ * \param objectSize Taille d'un objet en octets (les objets sont alignés sur 16 octets).
+ * \param objectsPerSlab Nombre d'objets par slab, ou 0 pour une valeur par défaut (slabs d'environ 16 Ko).
+ * \param threadCache true pour ajouter un cache de thread devant la liste libre partagée :
+ * chaque thread garde une petite réserve d'objets et ne prend le verrou du pool que par lots.
+ *
+ * \return Le pool, ou NULL en cas d'erreur. À détruire avec rc2d_memory_destroyPool().
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_Pool* rc2d_memory_createPool(const char* name, size_t objectSize, size_t objectsPerSlab, bool threadCache);
+
+/**
+ * \brief Détruit un pool d'objets et tous ses slabs.
+ *
+ * Les objets encore alloués deviennent invalides ; si `RC2D_MEMORY_DEBUG_ENABLED` est activé,
+ * ils sont listés comme fuites du pool.
+ *
+ * \param pool Pool à détruire (NULL est ignoré).
+ *
+ * \warning Aucun autre thread ne doit utiliser le pool pendant et après sa destruction.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_memory_destroyPool(RC2D_Pool* pool);
+
+/**
+ * \brief Alloue un objet dans un pool (sans suivi, préférez la macro `RC2D_pool_alloc`).
+ *
+ * \param pool Pool d'objets.
+ *
+ * \return Pointeur vers l'objet (non initialisé), ou NULL en cas d'échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void* rc2d_memory_poolAlloc(RC2D_Pool* pool);
+
+/**
+ * \brief Rend un objet à son pool (sans suivi, préférez la macro `RC2D_pool_free`).
+ *
+ * \param pool Pool d'origine de l'objet.
+ * \param ptr Objet à rendre (NULL est ignoré).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_memory_poolFree(RC2D_Pool* pool, void* ptr);
+
+/**
+ * \brief Récupère les statistiques d'un pool d'objets.
+ *
+ * \param pool Pool d'objets.
+ * \param out_stats [out] Statistiques.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_memory_getPoolStats(RC2D_Pool* pool, RC2D_PoolStats* out_stats);
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
@@ -1,6 +1,9 @@
 #ifndef RC2D_RRES_H
 #define RC2D_RRES_H
 
+#include <RC2D/RC2D_graphics.h>
+#include <RC2D/RC2D_storage.h>
+
 #include <rres/rres.h>
 #include <SDL3/SDL.h>
 #include <SDL3_image/SDL_image.h>
@@ -12,23 +15,6 @@
 extern "C" {
 #endif
 
-/**
- * \brief Structure représentant une image chargée à partir d'un chunk RRES.
- *
- * Contient une texture SDL3 GPU utilisée pour le rendu via l'API SDL3 GPU.
- * Cette structure est utilisée pour les sprites, les textures de fond, ou tout autre élément graphique.
- *
- * \since Cette structure est disponible depuis RC2D 1.0.0.
- */
-typedef struct Image {
-    /**
-     * \brief Texture SDL3 GPU utilisée pour le rendu.
-     *
-     * Cette texture doit être libérée avec SDL_ReleaseGPUTexture lorsque l'image n'est plus utilisée.
-     */
-    SDL_GPUTexture* texture;
-} Image;
-
 /**
  * \brief Structure représentant une police chargée à partir d'un chunk RRES.
  *
@@ -114,6 +100,166 @@ typedef struct Wave {
     // Mix_Chunk *sound;
 } Wave;
 
+/**
+ * \brief Charge un chunk d'un fichier RRES du storage, sans charger le fichier entier.
+ *
+ * Le fichier est lu via un RC2D_StorageStream : seuls l'en-tête, les infos des chunks
+ * et les données du chunk demandé sont lus, les autres chunks sont sautés. La mémoire
+ * utilisée ne dépend donc que de la taille du chunk, pas de celle du pack.
+ *
+ * \param storage_path Chemin relatif du fichier .rres dans le storage.
+ * \param storage_kind Type de dossier de stockage (RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER).
+ * \param rresId Identifiant du chunk (voir rresGetResourceId).
+ * \return Le chunk chargé, ou un chunk vide (data.raw à NULL) en cas d'erreur.
+ *
+ * \note Le chunk peut être compressé/chiffré : appelez ensuite rc2d_rres_unpackResourceChunk si besoin.
+ *
+ * \warning Le chunk retourné doit être libéré avec `rresUnloadResourceChunk`.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+rresResourceChunk rc2d_rres_loadResourceChunkFromStorage(const char *storage_path, RC2D_StorageKind storage_kind, int rresId);
+
+/**
+ * \brief Pack RRES ouvert une fois, dont le répertoire est gardé en mémoire.
+ *
+ * \details L'ouverture lit l'en-tête, les infos de chaque chunk et le répertoire central (CDIR),
+ * et les indexe dans des tables de hachage (identifiant -> position, nom -> identifiant).
+ * Les chargements lisent ensuite uniquement les octets du chunk demandé : par mapping mémoire
+ * quand le storage le permet, sinon par lecture à l'offset via un RC2D_StorageStream.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_RresPack RC2D_RresPack;
+
+/**
+ * \brief Ouvre un pack RRES du storage et indexe ses chunks.
+ *
+ * Seuls l'en-tête, les infos des chunks (32 octets chacun) et le CDIR sont lus : charger
+ * quelques sprites d'un pack de 500 Mo ne touche que ces octets-là.
+ *
+ * \param storage_path Chemin relatif du fichier .rres dans le storage.
+ * \param storage_kind Type de dossier de stockage (RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER).
+ * \return Le pack, ou NULL en cas d'erreur (fichier absent ou invalide).
+ *
+ * \note Le mapping n'est utilisé que pour le storage title ; le storage user passe par un flux.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_rres_closePack
+ */
+RC2D_RresPack *rc2d_rres_openPack(const char *storage_path, RC2D_StorageKind storage_kind);
+
+/**
+ * \brief Ferme un pack RRES et libère son index et son cache.
+ *
+ * \param pack Pack à fermer (NULL accepté).
+ *
+ * \warning Aucun autre thread ne doit utiliser le pack pendant sa fermeture.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_closePack(RC2D_RresPack *pack);
+
+/**
+ * \brief Renvoie le nombre de chunks indexés dans le pack (CDIR compris).
+ *
+ * \param pack Pack ouvert.
+ * \return Le nombre de chunks, 0 si pack est NULL.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_rres_getPackChunkCount(const RC2D_RresPack *pack);
+
+/**
+ * \brief Récupère les infos d'un chunk du pack sans lire ses données.
+ *
+ * \param pack Pack ouvert.
+ * \param rresId Identifiant du chunk.
+ * \param info [out] Infos du chunk (type, tailles, compression, chiffrement...).
+ * \return true si le chunk existe, false sinon.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_rres_getPackChunkInfo(const RC2D_RresPack *pack, int rresId, rresResourceChunkInfo *info);
+
+/**
+ * \brief Renvoie l'identifiant d'une ressource du pack à partir de son nom de fichier d'origine.
+ *
+ * Équivalent de rresGetResourceId, mais en temps constant via l'index du CDIR.
+ *
+ * \param pack Pack ouvert.
+ * \param fileName Nom de fichier tel qu'enregistré dans le répertoire central.
+ * \return L'identifiant, ou 0 si le nom est inconnu ou si le pack n'a pas de CDIR.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_rres_getPackResourceId(const RC2D_RresPack *pack, const char *fileName);
+
+/**
+ * \brief Charge et dépaquette un chunk du pack par identifiant.
+ *
+ * Seuls les octets du chunk sont lus. Le chunk est décompressé/déchiffré si besoin
+ * (voir rc2d_rres_unpackResourceChunk). Si un budget de cache est défini, une copie
+ * dépaquetée est conservée et les chargements suivants ne touchent plus au fichier.
+ *
+ * \param pack Pack ouvert.
+ * \param rresId Identifiant du chunk.
+ * \return Le chunk dépaqueté, ou un chunk vide (data.raw à NULL) en cas d'erreur.
+ *
+ * \note Pour un contenu dédoublonné par rc2d_rrespack, plusieurs identifiants du CDIR partagent
+ * le même chunk : info.id est alors celui du premier fichier empaqueté.
+ *
+ * \warning Le chunk retourné appartient à l'appelant et doit être libéré avec `rresUnloadResourceChunk`.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+rresResourceChunk rc2d_rres_loadPackChunk(RC2D_RresPack *pack, int rresId);
+
+/**
+ * \brief Charge et dépaquette un chunk du pack par nom de fichier (via le CDIR).
+ *
+ * \param pack Pack ouvert.
+ * \param fileName Nom de fichier tel qu'enregistré dans le répertoire central.
+ * \return Le chunk dépaqueté, ou un chunk vide (data.raw à NULL) en cas d'erreur.
+ *
+ * \warning Le chunk retourné doit être libéré avec `rresUnloadResourceChunk`.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+rresResourceChunk rc2d_rres_loadPackChunkByName(RC2D_RresPack *pack, const char *fileName);
+
+/**
+ * \brief Définit le budget (en octets) du cache LRU de chunks dépaquetés du pack.
+ *
+ * Par défaut le budget est de 0 : aucun chunk n'est conservé. Réduire le budget
+ * évince immédiatement les chunks les moins récemment chargés.
+ *
+ * \param pack Pack ouvert.
+ * \param budget_bytes Taille maximale cumulée des chunks en cache (données + props).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_setPackCacheBudget(RC2D_RresPack *pack, Uint64 budget_bytes);
+
 /**
  * \brief Charge des données brutes à partir d'un chunk RRES de type RRES_DATA_RAW.
  *
@@ -157,23 +303,27 @@ char *rc2d_rres_loadDataTextFromChunk(rresResourceChunk chunk);
 /**
  * \brief Charge une image à partir d'un chunk RRES de type RRES_DATA_IMAGE et crée une texture SDL3.
  *
- * Cette fonction convertit les données d'image RRES en une texture SDL3 utilisable pour le rendu. Elle prend en charge
- * différents formats de pixels définis dans rresPixelFormat et effectue les conversions nécessaires pour SDL3.
+ * Les formats non compressés sont téléversés directement depuis les données du chunk dans une
+ * SDL_Texture, sans surface intermédiaire (gris, gris + alpha et R32 sont d'abord étendus en RGBA32).
+ * Les formats BC1/BC2/BC3 et ASTC sont transmis tels quels au GPU quand le renderer est adossé à un
+ * SDL_GPUDevice qui les supporte ; sinon les formats BC sont décompressés sur le CPU. Seul le premier
+ * niveau de mipmap est utilisé.
  *
  * \param chunk Le chunk RRES contenant les données d'image (doit être de type RRES_DATA_IMAGE).
- * \return Une structure Image contenant la surface SDL et les métadonnées, ou une structure vide en cas d'erreur.
+ * \return Une image contenant la texture, ou une image vide (sdl_texture à NULL) en cas d'erreur.
  *
  * \note Les données doivent être non compressées et non chiffrées. Si elles sont compressées ou chiffrées,
  * appelez d'abord rc2d_rres_unpackResourceChunk.
+ *
+ * \note ETC/PVRTC ne sont pas supportés, ni ASTC sans support matériel (pas de décodeur CPU).
  * 
- * \warning La texture `image.texture` doit être libérée par l'appelant avec `SDL_ReleaseGPUTexture` lorsque l'image n'est plus nécessaire.
+ * \warning L'image doit être libérée par l'appelant avec `rc2d_graphics_freeImage`.
  *
- * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, mais le renderer doit être utilisé dans
- * un contexte thread-safe conformément aux règles de SDL3.
+ * \threadsafety Cette fonction doit être appelée depuis le thread principal (création de texture).
  *
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
-Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk);
+RC2D_Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk);
 
 /**
  * \brief Charge des données audio Wave à partir d'un chunk RRES de type RRES_DATA_WAVE.
@@ -238,13 +388,38 @@ Font rc2d_rres_loadFontFromChunk(rresResourceChunk chunk, float ptsize);
  * \warning Les champs `chunk->data.props` et `chunk->data.raw` alloués dynamiquement doivent 
  * être libérés par l'appelant avec `RC2D_safe_free` lorsque le chunk n'est plus nécessaire.
  *
- * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, mais la gestion du mot de passe doit être
- * thread-safe si plusieurs threads y accèdent.
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread, y compris en parallèle sur des chunks
+ * différents. Le mot de passe est copié au début du déchiffrement : le changer pendant l'appel n'a pas d'effet sur celui-ci.
  *
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
 int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk);
 
+/**
+ * \brief Décompresse et/ou déchiffre un lot de chunks RRES en les répartissant sur plusieurs threads.
+ *
+ * Chaque chunk est traité par rc2d_rres_unpackResourceChunk : le déchiffrement et la décompression LZ4 d'un chunk
+ * ne dépendent pas des autres, les threads prennent donc les chunks un par un jusqu'à épuisement du lot. Le thread
+ * appelant participe au travail et la fonction ne rend la main qu'une fois tout le lot traité.
+ *
+ * \param chunks Tableau des chunks à traiter, modifiés en place.
+ * \param count Nombre de chunks du tableau.
+ * \param threadCount Nombre de threads à utiliser (thread appelant compris), 0 pour un par coeur logique.
+ * Limité au nombre de chunks et à 16.
+ * \param results Tableau de `count` entiers recevant le code d'erreur de chaque chunk (voir
+ * rc2d_rres_unpackResourceChunk), ou NULL si seul le nombre d'échecs est utile.
+ * \return Le nombre de chunks en échec (0 si tout le lot a été traité), -1 si les arguments sont invalides.
+ *
+ * \note Avec des chunks chiffrés partageant le même salt, la clé n'est dérivée qu'une fois : les autres threads
+ * attendent qu'elle soit en cache plutôt que de relancer Argon2 (voir rc2d_rres_setKeyCacheEnabled).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread. Un même chunk ne doit pas figurer
+ * deux fois dans le lot.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_rres_unpackChunksParallel(rresResourceChunk *chunks, int count, int threadCount, int *results);
+
 /**
  * \brief Définit le mot de passe utilisé pour le déchiffrement des données RRES.
  *
@@ -259,7 +434,8 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk);
  * \note Si le mot de passe dépasse 15 caractères, un avertissement est affiché via RC2D_log et le mot de passe
  * n'est pas défini.
  *
- * \threadsafety Cette fonction n'est pas thread-safe. Utilisez une synchronisation si plusieurs threads modifient le mot de passe.
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread. Les chunks en cours de déchiffrement
+ * gardent le mot de passe qu'ils ont copié au début de rc2d_rres_unpackResourceChunk.
  *
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
@@ -274,7 +450,8 @@ void rc2d_rres_setCipherPassword(const char *pass);
  *
  * \warning Ne modifiez pas la chaîne retournée, car elle pointe vers une mémoire interne.
  *
- * \threadsafety Cette fonction n'est pas thread-safe si le mot de passe est modifié par un autre thread.
+ * \threadsafety La chaîne retournée pointe vers le buffer interne : elle peut changer si un autre thread modifie le
+ * mot de passe. Le déchiffrement des chunks n'utilise pas ce pointeur mais une copie faite sous verrou.
  *
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
@@ -285,13 +462,43 @@ const char *rc2d_rres_getCipherPassword(void);
  *
  * Cette fonction met à zéro le buffer interne contenant le mot de passe et réinitialise le pointeur interne.
  * Elle doit être appelée après le chargement des ressources chiffrées pour des raisons de sécurité.
+ * Le cache des clés dérivées est vidé en même temps (voir rc2d_rres_clearKeyCache).
  *
- * \threadsafety Cette fonction n'est pas thread-safe. Utilisez une synchronisation si plusieurs threads accèdent au mot de passe.
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
  *
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
 void rc2d_rres_cleanCipherPassword(void);
 
+/**
+ * \brief Active ou désactive le cache des clés de déchiffrement dérivées.
+ *
+ * Chaque chunk chiffré stocke un salt : la clé est dérivée du mot de passe et de ce salt par Argon2i
+ * (16 MB de zone de travail, 3 passes), ce qui coûte plusieurs dizaines de millisecondes. Avec le cache
+ * (actif par défaut), la dérivation ne tourne qu'une fois par couple (mot de passe, salt) : si le pack
+ * a été créé avec un salt partagé par tous ses chunks, la clé est dérivée une seule fois pour tout le pack.
+ *
+ * \param enabled true pour activer le cache, false pour dériver la clé à chaque chunk (le cache est vidé).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_setKeyCacheEnabled(bool enabled);
+
+/**
+ * \brief Efface les clés dérivées en cache et libère la zone de travail d'Argon2.
+ *
+ * La zone de travail (16 MB) est conservée entre deux chunks chiffrés pour éviter une allocation à chaque
+ * dérivation : appelez cette fonction une fois les ressources chiffrées chargées pour rendre cette mémoire.
+ * Appelée automatiquement par rc2d_rres_cleanCipherPassword et à la fermeture du moteur.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_rres_clearKeyCache(void);
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
@@ -0,0 +1,167 @@
+#ifndef RC2D_SAVE_H
+#define RC2D_SAVE_H
+
+#if RC2D_DATA_MODULE_ENABLED
+
+#include <RC2D/RC2D_data.h>          // Requis pour : RC2D_CompressFormat, RC2D_CipherFormat
+
+#include <stdbool.h>                 // Requis pour : bool
+#include <stddef.h>                  // Requis pour : size_t
+
+/* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Callback appelée sur le thread principal quand une sauvegarde asynchrone est terminée.
+ *
+ * \param {const char*} path - Chemin (dans le storage user) de la sauvegarde.
+ * \param {bool} success - true si le fichier final a été remplacé, false sinon (voir les logs).
+ * \param {void*} userdata - Pointeur utilisateur passé dans RC2D_SaveOptions.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef void (*RC2D_SaveCallback)(const char* path, bool success, void* userdata);
+
+/**
+ * \brief Options d'écriture d'une sauvegarde.
+ *
+ * \note Une structure remise à zéro écrit les données telles quelles, sans compression ni chiffrement.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_SaveOptions {
+    /**
+     * true pour compresser les données avant chiffrement.
+     */
+    bool compress;
+
+    /**
+     * Format de compression (si compress vaut true).
+     */
+    RC2D_CompressFormat compressFormat;
+
+    /**
+     * Niveau de compression, voir RC2D_CompressOptions::level.
+     */
+    int compressLevel;
+
+    /**
+     * Passphrase de chiffrement, NULL pour ne pas chiffrer. Copiée par rc2d_save_writeAsync.
+     */
+    const char* passphrase;
+
+    /**
+     * Format de chiffrement (si passphrase est renseignée).
+     */
+    RC2D_CipherFormat cipherFormat;
+
+    /**
+     * Callback de complétion (peut être NULL), appelée depuis rc2d_save_update().
+     */
+    RC2D_SaveCallback callback;
+
+    /**
+     * Pointeur utilisateur transmis à la callback.
+     */
+    void* userdata;
+} RC2D_SaveOptions;
+
+/**
+ * \brief Écrit une sauvegarde dans le storage user en arrière-plan.
+ *
+ * \details
+ * Les données sont copiées immédiatement : le buffer de l'appelant peut être réutilisé au retour.
+ * La compression, le chiffrement (dérivation PBKDF2 comprise) et l'écriture sont faits sur un
+ * thread dédié. Le fichier est d'abord écrit sous `<path>.tmp` puis renommé : en cas de crash,
+ * l'ancienne sauvegarde reste intacte. Les sauvegardes sont traitées dans l'ordre de soumission,
+ * deux écritures sur le même chemin laissent donc la plus récente.
+ *
+ * \param {const char*} path - Chemin (style Unix) de la sauvegarde dans le storage user.
+ * \param {const void*} data - Données à sauvegarder.
+ * \param {size_t} size - Taille des données en octets.
+ * \param {const RC2D_SaveOptions*} options - Options d'écriture, ou NULL pour une écriture brute.
+ * \return {bool} true si la sauvegarde a été mise en file, false sinon (la callback n'est pas appelée).
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_save_update
+ * \see rc2d_save_read
+ */
+bool rc2d_save_writeAsync(const char* path, const void* data, size_t size, const RC2D_SaveOptions* options);
+
+/**
+ * \brief Écrit une sauvegarde de façon synchrone (même format et même écriture atomique que rc2d_save_writeAsync).
+ *
+ * \param {const char*} path - Chemin (style Unix) de la sauvegarde dans le storage user.
+ * \param {const void*} data - Données à sauvegarder.
+ * \param {size_t} size - Taille des données en octets.
+ * \param {const RC2D_SaveOptions*} options - Options d'écriture (callback ignorée), ou NULL.
+ * \return {bool} true en cas de succès, false sinon.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_save_write(const char* path, const void* data, size_t size, const RC2D_SaveOptions* options);
+
+/**
+ * \brief Lit une sauvegarde écrite par rc2d_save_write / rc2d_save_writeAsync.
+ *
+ * \details Vérifie l'en-tête, puis déchiffre (HMAC vérifié) et décompresse selon ce qui a été utilisé à l'écriture.
+ *
+ * \param {const char*} path - Chemin (style Unix) de la sauvegarde dans le storage user.
+ * \param {const char*} passphrase - Passphrase utilisée à l'écriture, ou NULL si la sauvegarde n'est pas chiffrée.
+ * \param {void**} out_data - [out] Données lues, à libérer avec RC2D_free.
+ * \param {size_t*} out_size - [out] Taille des données lues.
+ * \return {bool} true en cas de succès, false sinon.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_save_read(const char* path, const char* passphrase, void** out_data, size_t* out_size);
+
+/**
+ * \brief Appelle les callbacks des sauvegardes asynchrones terminées.
+ *
+ * \note Appelée automatiquement à chaque frame par RC2D, avant rc2d_update().
+ *
+ * \return {int} Nombre de sauvegardes terminées traitées par cet appel.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_save_update(void);
+
+/**
+ * \brief Nombre de sauvegardes asynchrones en file ou en cours d'écriture.
+ *
+ * \return {int} Nombre de sauvegardes non terminées.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+int rc2d_save_getPendingCount(void);
+
+/**
+ * \brief Attend la fin de toutes les sauvegardes asynchrones, puis appelle leurs callbacks.
+ *
+ * \threadsafety Cette fonction doit être appelée sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_save_waitAll(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // RC2D_DATA_MODULE_ENABLED
+
+#endif // RC2D_SAVE_H
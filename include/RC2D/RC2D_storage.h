@@ -1,7 +1,8 @@
 #ifndef RC2D_STORAGE_H
 #define RC2D_STORAGE_H
 
-#include <SDL3/SDL_stdinc.h> // Required for : Uint64
+#include <SDL3/SDL_stdinc.h> // Required for : Uint64, size_t
+#include <SDL3/SDL_iostream.h> // Required for : SDL_IOStream, SDL_IOWhence
 
 /* Configuration pour les définitions de fonctions C, même lors de l'utilisation de C++ */
 #ifdef __cplusplus
@@ -123,6 +124,83 @@ bool rc2d_storage_userReady(void);
  */
 bool rc2d_storage_userMkdir(const char *path);
 
+/**
+ * \brief Renomme (ou déplace) un fichier du storage "User".
+ *
+ * \details Wrap de SDL_RenameStoragePath(user, oldpath, newpath). Sur les backends fichiers,
+ * la destination existante est remplacée de façon atomique : écrire dans un fichier temporaire
+ * puis le renommer garantit qu’un crash ne laisse jamais un fichier à moitié écrit.
+ *
+ * \param oldpath Chemin (style Unix) du fichier source dans le storage user.
+ * \param newpath Chemin (style Unix) de destination dans le storage user.
+ * \return true en cas de succès, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_storage_userRenamePath(const char *oldpath, const char *newpath);
+
+/**
+ * \brief Supprime un fichier ou un dossier vide du storage "User".
+ *
+ * \details Wrap de SDL_RemoveStoragePath(user, path).
+ *
+ * \param path Chemin (style Unix) à supprimer dans le storage user.
+ * \return true en cas de succès, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_storage_userRemovePath(const char *path);
+
+/**
+ * \brief Indique si un fichier existe dans le storage "Title".
+ *
+ * \details Wrap de SDL_GetStoragePathInfo(title, path). Aucune erreur n’est loggée si le
+ * fichier est absent : permet de tester un asset optionnel (ex: version précalculée).
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage title.
+ * \return true si le storage est prêt et que `path` est un fichier, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_storage_titleFileExists(const char *path);
+
+/**
+ * \brief Indique si un fichier existe dans le storage "User".
+ *
+ * \details Même contrat que rc2d_storage_titleFileExists(), mais sur le storage user.
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage user.
+ * \return true si le storage est prêt et que `path` est un fichier, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_storage_userFileExists(const char *path);
+
+/**
+ * \brief Taille d’un fichier du storage "Title", sans le lire.
+ *
+ * \details Wrap de SDL_GetStorageFileSize(title, path). Comme rc2d_storage_titleFileExists(),
+ * aucune erreur n’est loggée si le fichier est absent.
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage title.
+ * \return Taille du fichier en octets, 0 si absent ou si le storage n’est pas prêt.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint64 rc2d_storage_titleFileSize(const char *path);
+
+/**
+ * \brief Taille d’un fichier du storage "User", sans le lire.
+ *
+ * \details Même contrat que rc2d_storage_titleFileSize(), mais sur le storage user.
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage user.
+ * \return Taille du fichier en octets, 0 si absent ou si le storage n’est pas prêt.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint64 rc2d_storage_userFileSize(const char *path);
+
 /**
  * \brief Lit entièrement un fichier depuis le storage "Title" dans un buffer alloué.
  *
@@ -175,6 +253,212 @@ bool rc2d_storage_userReadFile(const char *path, void **out_data, Uint64 *out_le
  */
 bool rc2d_storage_userWriteFile(const char *path, const void *src, Uint64 len);
 
+/**
+ * \brief Vue en lecture seule sur le contenu d’un fichier du storage.
+ *
+ * \details Remplie par rc2d_storage_titleMapFile() / rc2d_storage_userMapFile(), à rendre
+ * via rc2d_storage_unmapFile(). Selon la plateforme, `data` pointe dans un mapping mémoire
+ * du fichier (aucune copie) ou dans un buffer lu via rc2d_storage_titleReadFile().
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_StorageMapping {
+    /** Contenu du fichier (lecture seule, ne pas libérer). */
+    const void *data;
+
+    /** Taille du contenu en octets. */
+    Uint64 len;
+
+    /** Interne : buffer alloué en fallback (NULL si mappé). */
+    void *_buffer;
+
+    /** Interne : adresse et taille du mapping mémoire (NULL / 0 si non mappé). */
+    void *_map_addr;
+    size_t _map_len;
+} RC2D_StorageMapping;
+
+/**
+ * \brief Donne accès au contenu d’un fichier du storage "Title" sans le copier.
+ *
+ * \details Sur Linux desktop, le fichier est mappé en lecture seule (mmap) depuis le dossier
+ * du storage title : les pages sont chargées à la demande par le noyau et partagées avec le
+ * page cache, sans allocation ni copie. Sur les autres plateformes, ou si le mapping échoue,
+ * le fichier est lu via rc2d_storage_titleReadFile() (même contrat pour l’appelant).
+ *
+ * Le contenu est typiquement passé à SDL_IOFromConstMem() puis rendu dès le décodage fini.
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage title.
+ * \param out_mapping [out] Vue sur le fichier, à rendre via rc2d_storage_unmapFile().
+ * \return true si le fichier est accessible et non vide, false sinon (mapping remis à zéro).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n’importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_storage_unmapFile()
+ */
+bool rc2d_storage_titleMapFile(const char *path, RC2D_StorageMapping *out_mapping);
+
+/**
+ * \brief Mappe un fichier du storage "Title" en mémoire, sans repli sur une lecture complète.
+ *
+ * \details Comme rc2d_storage_titleMapFile(), mais échoue (sans log) au lieu de lire le fichier
+ * en entier quand le mapping n’est pas disponible. Utile pour les gros fichiers lus par morceaux
+ * (packs), où l’appelant préfère alors rc2d_storage_titleOpenStream().
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage title.
+ * \param out_mapping [out] Vue sur le fichier, à rendre via rc2d_storage_unmapFile().
+ * \return true si le fichier est mappé, false sinon (mapping remis à zéro).
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n’importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_storage_titleTryMapFile(const char *path, RC2D_StorageMapping *out_mapping);
+
+/**
+ * \brief Équivalent de rc2d_storage_titleMapFile() pour le storage "User".
+ *
+ * \details Le storage user est modifiable : le fichier est toujours lu via
+ * rc2d_storage_userReadFile(), jamais mappé. Permet aux loaders de traiter les deux
+ * storages de la même façon.
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage user.
+ * \param out_mapping [out] Vue sur le fichier, à rendre via rc2d_storage_unmapFile().
+ * \return true si lecture réussie, false sinon.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_storage_userMapFile(const char *path, RC2D_StorageMapping *out_mapping);
+
+/**
+ * \brief Rend une vue obtenue via rc2d_storage_titleMapFile() / rc2d_storage_userMapFile().
+ *
+ * \param mapping Vue à rendre (NULL autorisé), remise à zéro.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n’importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_storage_unmapFile(RC2D_StorageMapping *mapping);
+
+/**
+ * \brief Stream de lecture sur un fichier du storage, lu par morceaux.
+ *
+ * \details Obtenu via rc2d_storage_titleOpenStream() / rc2d_storage_userOpenStream(), rendu via
+ * rc2d_storage_closeStream(). Contrairement à rc2d_storage_titleReadFile(), seules les données
+ * demandées sont lues : la mémoire utilisée ne dépend pas de la taille du fichier. Destiné aux
+ * gros assets lus au fil de l’eau (vidéos, musiques, packs rres).
+ *
+ * Le stream est aussi exposé comme un SDL_IOStream (rc2d_storage_streamGetIO()) pour les API
+ * qui en consomment un (SDL_mixer, SDL_image, FFmpeg via des callbacks, ...).
+ *
+ * \threadsafety Un stream ne doit être utilisé que par un thread à la fois.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_StorageStream RC2D_StorageStream;
+
+/**
+ * \brief Ouvre un fichier du storage "Title" en lecture par morceaux.
+ *
+ * \details Le storage title étant un dossier du système de fichiers sur les plateformes desktop,
+ * le fichier y est ouvert directement et lu à la demande. Sur les backends de storage sans accès
+ * fichier, le fichier est obtenu via rc2d_storage_titleMapFile() (même contrat pour l’appelant,
+ * sans borne mémoire).
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage title.
+ * \return (RC2D_StorageStream*) Stream positionné au début du fichier, ou NULL en cas d’échec.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n’importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_storage_closeStream()
+ */
+RC2D_StorageStream *rc2d_storage_titleOpenStream(const char *path);
+
+/**
+ * \brief Équivalent de rc2d_storage_titleOpenStream() pour le storage "User".
+ *
+ * \details Le fichier est lu depuis le dossier de préférences (SDL_GetPrefPath()) utilisé par le
+ * storage user. Ne pas écrire le fichier via rc2d_storage_userWriteFile() tant que le stream est
+ * ouvert.
+ *
+ * \param path Chemin (style Unix) du fichier dans le storage user.
+ * \return (RC2D_StorageStream*) Stream positionné au début du fichier, ou NULL en cas d’échec.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_StorageStream *rc2d_storage_userOpenStream(const char *path);
+
+/**
+ * \brief Lit jusqu’à 'size' octets depuis la position courante du stream.
+ *
+ * \param stream Stream ouvert.
+ * \param dst [out] Buffer de destination (au moins 'size' octets).
+ * \param size Nombre d’octets à lire.
+ * \return (size_t) Nombre d’octets lus : moins que 'size' en fin de fichier ou en cas d’erreur.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+size_t rc2d_storage_streamRead(RC2D_StorageStream *stream, void *dst, size_t size);
+
+/**
+ * \brief Déplace la position de lecture du stream.
+ *
+ * \param stream Stream ouvert.
+ * \param offset Décalage en octets, relatif à 'whence'.
+ * \param whence SDL_IO_SEEK_SET, SDL_IO_SEEK_CUR ou SDL_IO_SEEK_END.
+ * \return (Sint64) Nouvelle position depuis le début du fichier, -1 en cas d’erreur.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Sint64 rc2d_storage_streamSeek(RC2D_StorageStream *stream, Sint64 offset, SDL_IOWhence whence);
+
+/**
+ * \brief Renvoie la position de lecture courante du stream.
+ *
+ * \param stream Stream ouvert.
+ * \return (Sint64) Position depuis le début du fichier, -1 en cas d’erreur.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Sint64 rc2d_storage_streamTell(RC2D_StorageStream *stream);
+
+/**
+ * \brief Renvoie la taille du fichier ouvert par le stream.
+ *
+ * \param stream Stream ouvert.
+ * \return (Uint64) Taille en octets, 0 si 'stream' est NULL.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+Uint64 rc2d_storage_streamSize(RC2D_StorageStream *stream);
+
+/**
+ * \brief Renvoie le SDL_IOStream (lecture seule, seekable) qui porte le stream.
+ *
+ * \details Fermer ce SDL_IOStream via SDL_CloseIO() ferme aussi le stream : il peut donc être
+ * confié à une API qui en prend possession (par ex. MIX_LoadAudio_IO(..., closeio=true)). Dans ce
+ * cas, ne plus appeler rc2d_storage_closeStream() ensuite.
+ *
+ * \param stream Stream ouvert.
+ * \return (SDL_IOStream*) Stream SDL, NULL si 'stream' est NULL.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+SDL_IOStream *rc2d_storage_streamGetIO(RC2D_StorageStream *stream);
+
+/**
+ * \brief Ferme un stream et libère ses ressources.
+ *
+ * \param stream Stream à fermer (NULL autorisé).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_storage_closeStream(RC2D_StorageStream *stream);
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
@@ -62,6 +62,39 @@ typedef struct RC2D_TP_Frame {
     SDL_FPoint sourceSize;
 } RC2D_TP_Frame;
 
+/**
+ * \brief Handle de frame : index stable dans `atlas->frames`.
+ *
+ * \details
+ * Obtenu une seule fois via rc2d_tp_getFrameHandle(), il permet de dessiner une frame
+ * dans une boucle chaude sans hachage ni comparaison de chaînes.
+ *
+ * \since Ce type est disponible depuis RC2D 1.0.0.
+ */
+typedef int RC2D_TP_FrameHandle;
+
+/**
+ * \brief Valeur d’un handle de frame invalide (frame introuvable).
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_TP_INVALID_FRAME (-1)
+
+/**
+ * \brief Entrée de l’index de hachage nom -> frame (adressage ouvert, sondage linéaire).
+ *
+ * \note Usage interne à l’atlas.
+ *
+ * \since Cette structure est disponible depuis RC2D 1.0.0.
+ */
+typedef struct RC2D_TP_NameSlot {
+    /** Hash FNV-1a 32 bits du nom de la frame. */
+    Uint32 hash;
+
+    /** Index de la frame dans `frames`, ou RC2D_TP_INVALID_FRAME si l’entrée est vide. */
+    RC2D_TP_FrameHandle frame;
+} RC2D_TP_NameSlot;
+
 /**
  * \brief Atlas TexturePacker chargé (image d’atlas + frames + méta utiles).
  *
@@ -83,11 +116,55 @@ typedef struct RC2D_TP_Atlas {
 
     /** Taille de l’image d’atlas (meta.size.w/h) si présente dans le JSON. */
     SDL_FPoint atlas_size;
+
+    /* Interne */
+    /** Index de hachage nom -> frame (taille `_name_index_capacity`, puissance de 2). */
+    RC2D_TP_NameSlot* _name_index;
+
+    /** Capacité de l’index de hachage (0 si non construit). */
+    int _name_index_capacity;
+
+    /** Bloc unique contenant les noms internés des frames (les `filename` pointent dedans). */
+    char* _name_pool;
+
+    /**
+     * Contenu du fichier binaire (.rc2datlas) si l’atlas en provient : l’index, les noms
+     * et `atlas_image_name` pointent alors directement dedans (NULL pour un atlas JSON).
+     */
+    void* _baked_data;
 } RC2D_TP_Atlas;
 
+/**
+ * \brief Extension des atlas binaires précalculés ("baked") produits par rc2d_tp_bakeAtlas().
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_TP_BAKED_EXTENSION ".rc2datlas"
+
+/**
+ * \brief Version du format binaire d’atlas (incrémentée à chaque changement de layout).
+ *
+ * \details
+ * Layout (little-endian, tous les champs sur 4 octets) :
+ * - en-tête : magic "RTPA", version, frame_count, index_capacity, strings_size,
+ *   image_name_offset, atlas_w (float), atlas_h (float) ;
+ * - frames : frame_count x { name_offset, frame.xywh, spriteSourceSize.xywh, sourceSize.wh } ;
+ * - index  : index_capacity x { hash FNV-1a, frame } (identique à RC2D_TP_NameSlot) ;
+ * - table de chaînes : noms terminés par '\0' (strings_size octets).
+ *
+ * \since Cette macro est disponible depuis RC2D 1.0.0.
+ */
+#define RC2D_TP_BAKED_VERSION 1
+
 /**
  * \brief Charge un atlas TexturePacker (format "JSON (Array)") depuis le storage RC2D.
  *
+ * \details
+ * Si un atlas binaire précalculé existe à côté du JSON (même nom, extension
+ * RC2D_TP_BAKED_EXTENSION), il est chargé à la place via rc2d_tp_loadBakedAtlasFromStorage() :
+ * le parsing JSON n’est plus qu’un fallback. Un chemin se terminant déjà par
+ * RC2D_TP_BAKED_EXTENSION est chargé directement en binaire.
+ *
  * \attention L’image d’atlas (meta.image) est recherchée dans le **même dossier** que le JSON.
  *
  * \param json_path    Chemin relatif (dans le storage) du JSON.
@@ -100,6 +177,50 @@ typedef struct RC2D_TP_Atlas {
  */
 RC2D_TP_Atlas rc2d_tp_loadAtlasFromStorage(const char* json_path, RC2D_StorageKind storage_kind);
 
+/**
+ * \brief Charge un atlas binaire précalculé (.rc2datlas) depuis le storage RC2D.
+ *
+ * \details
+ * Le fichier est lu en une seule fois ; l’index de hachage et la table de noms sont
+ * utilisés tels quels depuis ce buffer. Seul le tableau `frames` est alloué (une allocation),
+ * aucune allocation par frame ni parsing JSON.
+ *
+ * \attention L’image d’atlas est recherchée dans le **même dossier** que le fichier binaire.
+ *
+ * \param path         Chemin relatif (dans le storage) du fichier .rc2datlas.
+ * \param storage_kind RC2D_STORAGE_TITLE ou RC2D_STORAGE_USER.
+ * \return Atlas initialisé, ou atlas vide (tous champs = 0) en cas d’échec (fichier invalide,
+ * version différente de RC2D_TP_BAKED_VERSION...).
+ *
+ * \threadsafety À appeler sur le thread principal.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ *
+ * \see rc2d_tp_bakeAtlas()
+ * \see rc2d_tp_freeAtlas()
+ */
+RC2D_TP_Atlas rc2d_tp_loadBakedAtlasFromStorage(const char* path, RC2D_StorageKind storage_kind);
+
+/**
+ * \brief Convertit un JSON TexturePacker ("JSON (Array)") en atlas binaire précalculé.
+ *
+ * \details
+ * Utilisé par l’outil de build `rc2d_tpbake`. Le résultat contient la table de chaînes,
+ * les frames et l’index de hachage des noms déjà construit (cf. RC2D_TP_BAKED_VERSION).
+ * Aucune texture n’est chargée.
+ *
+ * \param json_data Contenu du fichier JSON.
+ * \param json_len  Taille du contenu JSON.
+ * \param out_data  [out] Buffer alloué via RC2D_malloc (à libérer par l’appelant avec RC2D_safe_free).
+ * \param out_len   [out] Taille du buffer produit.
+ * \return true en cas de succès, false sinon.
+ *
+ * \threadsafety Cette fonction peut être appelée depuis n’importe quel thread.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_tp_bakeAtlas(const void* json_data, Uint64 json_len, void** out_data, Uint64* out_len);
+
 /**
  * \brief Libère les ressources d’un atlas TexturePacker (texture, frames, chaînes).
  *
@@ -109,15 +230,54 @@ RC2D_TP_Atlas rc2d_tp_loadAtlasFromStorage(const char* json_path, RC2D_StorageKi
  */
 void rc2d_tp_freeAtlas(RC2D_TP_Atlas* atlas);
 
+/**
+ * \brief (Re)construit l’index de hachage nom -> frame de l’atlas.
+ *
+ * \details
+ * Appelé automatiquement par rc2d_tp_loadAtlasFromStorage(). À rappeler uniquement si
+ * `frames` / `frame_count` ont été modifiés manuellement. En cas de doublon, la première
+ * frame portant le nom est conservée.
+ *
+ * \param atlas Atlas à indexer.
+ * \return true si l’index a été construit, false sinon (les recherches restent possibles en linéaire).
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+bool rc2d_tp_buildFrameIndex(RC2D_TP_Atlas* atlas);
+
 /**
  * \brief Récupère une frame par son nom (ex: "1.png").
  *
+ * \note Recherche en O(1) via l’index de hachage construit au chargement.
+ *
  * \param atlas    Atlas à consulter.
  * \param filename Nom exact tel que dans le JSON.
  * \return Pointeur interne vers la frame (ne pas libérer), ou NULL si introuvable.
  */
 const RC2D_TP_Frame* rc2d_tp_getFrame(const RC2D_TP_Atlas* atlas, const char* filename);
 
+/**
+ * \brief Récupère le handle d’une frame par son nom, à faire une seule fois (ex: au chargement).
+ *
+ * \param atlas    Atlas à consulter.
+ * \param filename Nom exact tel que dans le JSON.
+ * \return Handle de la frame, ou RC2D_TP_INVALID_FRAME si introuvable.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+RC2D_TP_FrameHandle rc2d_tp_getFrameHandle(const RC2D_TP_Atlas* atlas, const char* filename);
+
+/**
+ * \brief Récupère une frame depuis son handle (aucune recherche).
+ *
+ * \param atlas  Atlas à consulter.
+ * \param handle Handle obtenu via rc2d_tp_getFrameHandle().
+ * \return Pointeur interne vers la frame (ne pas libérer), ou NULL si le handle est invalide.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+const RC2D_TP_Frame* rc2d_tp_getFrameByHandle(const RC2D_TP_Atlas* atlas, RC2D_TP_FrameHandle handle);
+
 /**
  * \brief Dessine la portion de texture correspondant à la frame, SANS correction de trimming.
  *
@@ -146,6 +306,26 @@ void rc2d_tp_drawFrameByName(const RC2D_TP_Atlas* atlas, const char* filename,
                              float offsetX, float offsetY,
                              bool flipH, bool flipV);
 
+/**
+ * \brief Dessine une frame depuis son handle, SANS correction de trimming.
+ *
+ * \details
+ * Identique à rc2d_tp_drawFrameByName(), mais sans aucune recherche par nom :
+ * à privilégier dans les boucles de dessin (handle résolu une fois au chargement).
+ *
+ * \param atlas  Atlas contenant la frame.
+ * \param handle Handle obtenu via rc2d_tp_getFrameHandle().
+ * \see rc2d_tp_drawFrameByName() pour les autres paramètres.
+ *
+ * \since Cette fonction est disponible depuis RC2D 1.0.0.
+ */
+void rc2d_tp_drawFrame(const RC2D_TP_Atlas* atlas, RC2D_TP_FrameHandle handle,
+                       float x, float y,
+                       double angle,
+                       float scaleX, float scaleY,
+                       float offsetX, float offsetY,
+                       bool flipH, bool flipV);
+
 /* Termine les définitions de fonctions C lors de l'utilisation de C++ */
 #ifdef __cplusplus
 }
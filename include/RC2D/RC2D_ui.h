@@ -68,7 +68,8 @@ typedef enum RC2D_UIAnchor {
  */
 typedef struct RC2D_UIImage {
     RC2D_Image        image;             /**< Texture GPU (SDL_Texture) pour le rendu */
-    RC2D_ImageData    imageData;         /**< Surface CPU (SDL_Surface) pour les collisions pixel-perfect */
+    RC2D_ImageData    imageData;         /**< Surface CPU (SDL_Surface) pour les collisions pixel-perfect (ignorée si hitMask est rempli) */
+    RC2D_HitMask      hitMask;           /**< Masque 1 bit pour les collisions pixel-perfect (voir rc2d_graphics_loadImageWithHitMaskFromStorage) */
     RC2D_UIAnchor     anchor;            /**< Ancre */
     RC2D_UIMarginMode margin_mode;       /**< Pixels ou % */
     float             margin_x;          /**< pixels logiques OU pourcentage (0..1) suivant margin_mode */
@@ -119,9 +120,13 @@ typedef struct RC2D_UIImage {
  *
  * \code
  * // Exemple 1 — Pixels logiques : minimap en bas-droite avec 20 px de marge
+ * // Un seul décodage : texture + masque 1 bit pour le hit-test pixel-perfect
+ * RC2D_HitMask minimapMask;
+ * RC2D_Image minimapImage = rc2d_graphics_loadImageWithHitMaskFromStorage("minimap.png", RC2D_STORAGE_TITLE,
+ *                                                                         RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD, &minimapMask);
  * RC2D_UIImage minimap = {
- *     .image       = rc2d_graphics_newImageFromStorage("minimap.png", RC2D_STORAGE_TITLE),
- *     .imageData   = rc2d_graphics_newImageDataFromStorage("minimap.png", RC2D_STORAGE_TITLE),
+ *     .image       = minimapImage,
+ *     .hitMask     = minimapMask,
  *     .last_drawn_rect = {0,0,0,0} // initialisé à zéro
  *     .anchor      = RC2D_UI_ANCHOR_BOTTOM_RIGHT,
  *     .margin_mode = RC2D_UI_MARGIN_PIXELS,
@@ -140,7 +145,6 @@ typedef struct RC2D_UIImage {
  * \code
  * // Exemple 2 — Pourcentage : logo en haut-droite, 10%/10%
  * RC2D_UIImage logo = {
- *     .imageData   = rc2d_graphics_newImageDataFromStorage("logo.png", RC2D_STORAGE_TITLE),
  *     .image       = rc2d_graphics_newImageFromStorage("logo.png", RC2D_STORAGE_TITLE),
  *     .anchor      = RC2D_UI_ANCHOR_TOP_RIGHT,
  *     .margin_mode = RC2D_UI_MARGIN_PERCENT,
@@ -240,9 +240,8 @@ typedef struct RC2D_Video {
     double           fade_out_duration;   /* Durée du fade-out (en secondes) */
 
     AVIOContext    *avio;          // IO custom FFmpeg
-    SDL_IOStream   *sdl_io;        // stream SDL (mémoire)
-    void           *owned_mem;     // si on possède un buffer mémoire (à libérer)
-    size_t          owned_len;     // taille du buffer
+    SDL_IOStream   *sdl_io;        // stream SDL (porté par 'stream', ne pas fermer directement)
+    RC2D_StorageStream *stream;    // fichier du storage lu en streaming (à fermer)
     int64_t         io_size;       // taille connue (pour AVSEEK_SIZE)
 } RC2D_Video;
 
@@ -50,6 +50,8 @@
 #ifndef RRES_H
 #define RRES_H
 
+#include <SDL3/SDL_iostream.h>      // Required for: SDL_IOStream
+
 // Function specifiers in case library is build/used as a shared library (Windows)
 #if defined(_WIN32)
     #if defined(BUILD_LIBTYPE_SHARED)
@@ -283,6 +285,7 @@ extern "C" {
 #endif
 
 RRESAPI rresResourceChunk rresLoadResourceChunk(const char *fileName, int rresId);
+RRESAPI rresResourceChunk rresLoadResourceChunkFromIO(SDL_IOStream *rresFile, int rresId);    // Stream not closed, read from its current position
 RRESAPI void rresUnloadResourceChunk(rresResourceChunk chunk);
 RRESAPI rresResourceMulti rresLoadResourceMulti(const char *fileName, int rresId);
 RRESAPI void rresUnloadResourceMulti(rresResourceMulti multi);
@@ -349,11 +352,30 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, int rresId)
 
     RC2D_log(RC2D_LOG_INFO, "RRES: INFO: Loading resource from file: %s\n", fileName);
 
+    chunk = rresLoadResourceChunkFromIO(rresFile, rresId);
+
+    if (!SDL_CloseIO(rresFile))
+        RC2D_log(RC2D_LOG_WARN, "RRES: WARNING: Failed to close file: %s\n", SDL_GetError());
+
+    return chunk;
+}
+
+// NOTE: Only the header, the chunk infos and the requested chunk data are read,
+// other chunks are skipped with a seek (memory use is bounded by the requested chunk)
+rresResourceChunk rresLoadResourceChunkFromIO(SDL_IOStream *rresFile, int rresId)
+{
+    rresResourceChunk chunk = { 0 };
+
+    if (rresFile == NULL)
+    {
+        RC2D_log(RC2D_LOG_WARN, "RRES: WARNING: Invalid rres stream\n");
+        return chunk;
+    }
+
     rresFileHeader header = { 0 };
     if (SDL_ReadIO(rresFile, &header, sizeof(rresFileHeader)) != sizeof(rresFileHeader))
     {
         RC2D_log(RC2D_LOG_WARN, "RRES: WARNING: Failed to read file header: %s\n", SDL_GetError());
-        SDL_CloseIO(rresFile);
         return chunk;
     }
 
@@ -416,9 +438,6 @@ rresResourceChunk rresLoadResourceChunk(const char *fileName, int rresId)
         RC2D_log(RC2D_LOG_WARN, "RRES: WARNING: The provided file is not a valid rres file, file signature or version not valid\n");
     }
 
-    if (!SDL_CloseIO(rresFile))
-        RC2D_log(RC2D_LOG_WARN, "RRES: WARNING: Failed to close file: %s\n", SDL_GetError());
-
     return chunk;
 }
 
@@ -0,0 +1,655 @@
+#include <RC2D/RC2D_assetcache.h>
+#include <RC2D/RC2D_audio.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#include <SDL3/SDL_pixels.h>
+
+/* Nombre de buckets initial de la table de hachage (puissance de 2) */
+#define RC2D_ASSETCACHE_INITIAL_BUCKETS 64
+
+/* Pas de masque de collision à construire au chargement */
+#define RC2D_ASSETCACHE_NO_HITMASK (-1)
+
+/* Masque de collision attaché à une entrée RC2D_ASSET_IMAGE (un par seuil alpha) */
+typedef struct RC2D_AssetCacheHitMask {
+    Uint8 threshold;
+    RC2D_HitMask mask;
+    struct RC2D_AssetCacheHitMask* next;
+} RC2D_AssetCacheHitMask;
+
+struct RC2D_CachedAsset {
+    /* Clé : (type, storage, chemin, variante) ; les masques de collision sont attachés, hors clé */
+    RC2D_AssetKind kind;
+    RC2D_StorageKind storage_kind;
+    Uint32 variant;
+    Uint32 hash;
+    char* path;
+
+    int refcount;
+    Uint64 bytes;
+
+    RC2D_Image image;
+    RC2D_AssetCacheHitMask* hit_masks;
+    RC2D_ImageData image_data;
+    RC2D_Font font;
+    MIX_Audio* audio;
+    RC2D_TP_Atlas atlas;
+
+    /* Chaînage du bucket */
+    RC2D_CachedAsset* hash_next;
+
+    /* Liste LRU des entrées non référencées (tête = la moins récemment rendue) */
+    RC2D_CachedAsset* lru_prev;
+    RC2D_CachedAsset* lru_next;
+};
+
+typedef struct RC2D_AssetCache {
+    RC2D_CachedAsset** buckets;
+    int bucket_count;
+    int entry_count;
+    int referenced_count;
+
+    RC2D_CachedAsset* lru_head;
+    RC2D_CachedAsset* lru_tail;
+
+    Uint64 budget_bytes;
+    Uint64 bytes_resident;
+    Uint64 hits;
+    Uint64 misses;
+    Uint64 evictions;
+} RC2D_AssetCache;
+
+static RC2D_AssetCache rc2d_assetcache = { .budget_bytes = RC2D_ASSETCACHE_DEFAULT_BUDGET_BYTES };
+
+/* ========================================================================= */
+/*                               TABLE DE HACHAGE                             */
+/* ========================================================================= */
+
+/* Hash FNV-1a 32 bits du chemin, mélangé avec le reste de la clé. */
+static Uint32 rc2d_assetcache_hash(RC2D_AssetKind kind, RC2D_StorageKind storage_kind, Uint32 variant, const char* path)
+{
+    Uint32 h = 2166136261u;
+    while (*path)
+    {
+        h ^= (Uint8)*path++;
+        h *= 16777619u;
+    }
+    h ^= (Uint32)kind * 0x9E3779B1u;
+    h ^= (Uint32)storage_kind * 0x85EBCA77u;
+    h ^= variant * 0xC2B2AE3Du;
+    return h;
+}
+
+static RC2D_CachedAsset* rc2d_assetcache_find(RC2D_AssetKind kind, RC2D_StorageKind storage_kind, Uint32 variant,
+                                              const char* path, Uint32 hash)
+{
+    if (!rc2d_assetcache.buckets)
+    {
+        return NULL;
+    }
+
+    RC2D_CachedAsset* entry = rc2d_assetcache.buckets[hash & (Uint32)(rc2d_assetcache.bucket_count - 1)];
+    for (; entry; entry = entry->hash_next)
+    {
+        if (entry->hash == hash && entry->kind == kind && entry->storage_kind == storage_kind &&
+            entry->variant == variant && SDL_strcmp(entry->path, path) == 0)
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static bool rc2d_assetcache_grow(void)
+{
+    const int new_count = rc2d_assetcache.bucket_count ? rc2d_assetcache.bucket_count * 2 : RC2D_ASSETCACHE_INITIAL_BUCKETS;
+    RC2D_CachedAsset** new_buckets = (RC2D_CachedAsset**)RC2D_calloc((size_t)new_count, sizeof(RC2D_CachedAsset*));
+    if (!new_buckets)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: failed to allocate %d buckets", new_count);
+        return false;
+    }
+
+    for (int i = 0; i < rc2d_assetcache.bucket_count; ++i)
+    {
+        RC2D_CachedAsset* entry = rc2d_assetcache.buckets[i];
+        while (entry)
+        {
+            RC2D_CachedAsset* next = entry->hash_next;
+            const Uint32 slot = entry->hash & (Uint32)(new_count - 1);
+            entry->hash_next = new_buckets[slot];
+            new_buckets[slot] = entry;
+            entry = next;
+        }
+    }
+
+    RC2D_safe_free(rc2d_assetcache.buckets);
+    rc2d_assetcache.buckets = new_buckets;
+    rc2d_assetcache.bucket_count = new_count;
+    return true;
+}
+
+static void rc2d_assetcache_unlink(RC2D_CachedAsset* entry)
+{
+    RC2D_CachedAsset** link = &rc2d_assetcache.buckets[entry->hash & (Uint32)(rc2d_assetcache.bucket_count - 1)];
+    while (*link && *link != entry) link = &(*link)->hash_next;
+    if (*link) *link = entry->hash_next;
+}
+
+/* ========================================================================= */
+/*                                     LRU                                    */
+/* ========================================================================= */
+
+static void rc2d_assetcache_lruRemove(RC2D_CachedAsset* entry)
+{
+    if (entry->lru_prev) entry->lru_prev->lru_next = entry->lru_next;
+    else rc2d_assetcache.lru_head = entry->lru_next;
+    if (entry->lru_next) entry->lru_next->lru_prev = entry->lru_prev;
+    else rc2d_assetcache.lru_tail = entry->lru_prev;
+    entry->lru_prev = entry->lru_next = NULL;
+}
+
+static void rc2d_assetcache_lruPush(RC2D_CachedAsset* entry)
+{
+    entry->lru_prev = rc2d_assetcache.lru_tail;
+    entry->lru_next = NULL;
+    if (rc2d_assetcache.lru_tail) rc2d_assetcache.lru_tail->lru_next = entry;
+    else rc2d_assetcache.lru_head = entry;
+    rc2d_assetcache.lru_tail = entry;
+}
+
+/* ========================================================================= */
+/*                              CHARGEMENT / TAILLE                           */
+/* ========================================================================= */
+
+static Uint64 rc2d_assetcache_fileSize(const char* path, RC2D_StorageKind storage_kind)
+{
+    return storage_kind == RC2D_STORAGE_USER ? rc2d_storage_userFileSize(path) : rc2d_storage_titleFileSize(path);
+}
+
+static Uint64 rc2d_assetcache_textureBytes(const SDL_Texture* texture)
+{
+    if (!texture)
+    {
+        return 0;
+    }
+
+    /* Formats compressés / FourCC : on compte 4 octets par pixel */
+    int bpp = SDL_BYTESPERPIXEL(texture->format);
+    if (bpp <= 0) bpp = 4;
+    return (Uint64)texture->w * (Uint64)texture->h * (Uint64)bpp;
+}
+
+static Uint64 rc2d_assetcache_audioBytes(const RC2D_CachedAsset* entry)
+{
+    SDL_AudioSpec spec;
+    const Sint64 frames = MIX_GetAudioDuration(entry->audio);
+    if (entry->variant && frames > 0 && MIX_GetAudioFormat(entry->audio, &spec))
+    {
+        return (Uint64)frames * (Uint64)SDL_AUDIO_FRAMESIZE(spec);
+    }
+
+    /* Streaming (ou durée inconnue) : le fichier compressé reste en mémoire */
+    return rc2d_assetcache_fileSize(entry->path, entry->storage_kind);
+}
+
+/* Surface déjà décodée pour ce fichier (entrée RC2D_ASSET_IMAGE_DATA), ou NULL. */
+static const SDL_Surface* rc2d_assetcache_findSurface(RC2D_StorageKind storage_kind, const char* path)
+{
+    const Uint32 hash = rc2d_assetcache_hash(RC2D_ASSET_IMAGE_DATA, storage_kind, 0, path);
+    const RC2D_CachedAsset* data = rc2d_assetcache_find(RC2D_ASSET_IMAGE_DATA, storage_kind, 0, path, hash);
+    return data ? data->image_data.sdl_surface : NULL;
+}
+
+static RC2D_AssetCacheHitMask* rc2d_assetcache_findHitMask(const RC2D_CachedAsset* entry, Uint8 threshold)
+{
+    RC2D_AssetCacheHitMask* node = entry->hit_masks;
+    while (node && node->threshold != threshold) node = node->next;
+    return node;
+}
+
+/* Attache 'mask' (dont l'entrée prend possession) au seuil 'threshold' et compte sa taille dans l'entrée. */
+static bool rc2d_assetcache_addHitMask(RC2D_CachedAsset* entry, Uint8 threshold, RC2D_HitMask* mask)
+{
+    RC2D_AssetCacheHitMask* node = (RC2D_AssetCacheHitMask*)RC2D_calloc(1, sizeof(RC2D_AssetCacheHitMask));
+    if (!node)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: failed to allocate hit mask for '%s'", entry->path);
+        rc2d_graphics_freeHitMask(mask);
+        return false;
+    }
+
+    node->threshold = threshold;
+    node->mask = *mask;
+    node->next = entry->hit_masks;
+    entry->hit_masks = node;
+    entry->bytes += (Uint64)mask->stride * (Uint64)mask->h;
+    return true;
+}
+
+static void rc2d_assetcache_freeHitMasks(RC2D_CachedAsset* entry)
+{
+    while (entry->hit_masks)
+    {
+        RC2D_AssetCacheHitMask* next = entry->hit_masks->next;
+        rc2d_graphics_freeHitMask(&entry->hit_masks->mask);
+        RC2D_free(entry->hit_masks);
+        entry->hit_masks = next;
+    }
+}
+
+/* Construit le masque au seuil demandé pour une image déjà en cache : la texture n'est ni recréée ni renvoyée au GPU. */
+static bool rc2d_assetcache_ensureHitMask(RC2D_CachedAsset* entry, Uint8 threshold)
+{
+    if (rc2d_assetcache_findHitMask(entry, threshold))
+    {
+        return true;
+    }
+
+    RC2D_HitMask mask;
+    RC2D_ImageData image_data = { (SDL_Surface*)rc2d_assetcache_findSurface(entry->storage_kind, entry->path) };
+    if (image_data.sdl_surface)
+    {
+        if (!rc2d_graphics_newHitMaskFromImageData(&image_data, threshold, &mask)) return false;
+    }
+    else
+    {
+        /* Décodage CPU seul, la surface est libérée aussitôt le masque construit */
+        image_data = rc2d_graphics_loadImageDataFromStorage(entry->path, entry->storage_kind);
+        const bool ok = image_data.sdl_surface && rc2d_graphics_newHitMaskFromImageData(&image_data, threshold, &mask);
+        rc2d_graphics_freeImageData(&image_data);
+        if (!ok) return false;
+    }
+
+    const Uint64 bytes = entry->bytes;
+    if (!rc2d_assetcache_addHitMask(entry, threshold, &mask))
+    {
+        return false;
+    }
+    rc2d_assetcache.bytes_resident += entry->bytes - bytes;
+    return true;
+}
+
+/* Charge l'asset de l'entrée (clé déjà remplie) et estime sa taille. */
+static bool rc2d_assetcache_load(RC2D_CachedAsset* entry, float fontSize, int hitMaskThreshold)
+{
+    switch (entry->kind)
+    {
+        case RC2D_ASSET_IMAGE:
+        {
+            /* Surface déjà décodée pour ce fichier : on évite une relecture + un décodage */
+            const SDL_Surface* surface = rc2d_assetcache_findSurface(entry->storage_kind, entry->path);
+            const bool with_mask = hitMaskThreshold != RC2D_ASSETCACHE_NO_HITMASK;
+            const Uint8 threshold = (Uint8)hitMaskThreshold;
+            RC2D_HitMask mask = { NULL };
+            if (surface)
+            {
+                const RC2D_ImageData image_data = { (SDL_Surface*)surface };
+                if (with_mask && !rc2d_graphics_newHitMaskFromImageData(&image_data, threshold, &mask))
+                {
+                    return false;
+                }
+                entry->image.sdl_texture = SDL_CreateTextureFromSurface(rc2d_engine_state.renderer, (SDL_Surface*)surface);
+                if (!entry->image.sdl_texture)
+                {
+                    RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: SDL_CreateTextureFromSurface('%s') failed: %s",
+                             entry->path, SDL_GetError());
+                }
+            }
+            else if (with_mask)
+            {
+                entry->image = rc2d_graphics_loadImageWithHitMaskFromStorage(entry->path, entry->storage_kind, threshold, &mask);
+            }
+            else
+            {
+                entry->image = rc2d_graphics_loadImageFromStorage(entry->path, entry->storage_kind);
+            }
+            if (!entry->image.sdl_texture)
+            {
+                rc2d_graphics_freeHitMask(&mask);
+                return false;
+            }
+            entry->bytes = rc2d_assetcache_textureBytes(entry->image.sdl_texture);
+            if (with_mask && !rc2d_assetcache_addHitMask(entry, threshold, &mask))
+            {
+                rc2d_graphics_freeImage(&entry->image);
+                return false;
+            }
+            return true;
+        }
+
+        case RC2D_ASSET_IMAGE_DATA:
+        {
+            entry->image_data = rc2d_graphics_loadImageDataFromStorage(entry->path, entry->storage_kind);
+            const SDL_Surface* surface = entry->image_data.sdl_surface;
+            entry->bytes = surface ? (Uint64)surface->pitch * (Uint64)surface->h : 0;
+            return surface != NULL;
+        }
+
+        case RC2D_ASSET_FONT:
+            entry->font = rc2d_graphics_openFontFromStorage(entry->path, entry->storage_kind, fontSize);
+            entry->bytes = rc2d_assetcache_fileSize(entry->path, entry->storage_kind);
+            return entry->font.sdl_font != NULL;
+
+        case RC2D_ASSET_AUDIO:
+            entry->audio = rc2d_audio_loadAudioFromStorage(entry->path, entry->storage_kind, entry->variant != 0);
+            if (!entry->audio)
+            {
+                return false;
+            }
+            entry->bytes = rc2d_assetcache_audioBytes(entry);
+            return true;
+
+        case RC2D_ASSET_ATLAS:
+            entry->atlas = rc2d_tp_loadAtlasFromStorage(entry->path, entry->storage_kind);
+            if (!entry->atlas.frames)
+            {
+                return false;
+            }
+            entry->bytes = rc2d_assetcache_textureBytes(entry->atlas.atlas_image.sdl_texture) +
+                           (Uint64)entry->atlas.frame_count * sizeof(RC2D_TP_Frame) +
+                           (Uint64)entry->atlas._name_index_capacity * sizeof(RC2D_TP_NameSlot);
+            return true;
+    }
+
+    return false;
+}
+
+static void rc2d_assetcache_destroyEntry(RC2D_CachedAsset* entry)
+{
+    rc2d_assetcache_unlink(entry);
+    if (entry->refcount == 0) rc2d_assetcache_lruRemove(entry);
+    else rc2d_assetcache.referenced_count--;
+
+    switch (entry->kind)
+    {
+        case RC2D_ASSET_IMAGE:
+            rc2d_graphics_freeImage(&entry->image);
+            rc2d_assetcache_freeHitMasks(entry);
+            break;
+        case RC2D_ASSET_IMAGE_DATA: rc2d_graphics_freeImageData(&entry->image_data); break;
+        case RC2D_ASSET_FONT:       rc2d_graphics_closeFont(&entry->font); break;
+        case RC2D_ASSET_AUDIO:      rc2d_audio_destroy(entry->audio); break;
+        case RC2D_ASSET_ATLAS:      rc2d_tp_freeAtlas(&entry->atlas); break;
+    }
+
+    rc2d_assetcache.bytes_resident -= entry->bytes;
+    rc2d_assetcache.entry_count--;
+    RC2D_safe_free(entry->path);
+    RC2D_free(entry);
+}
+
+/* Évince les entrées non référencées les plus anciennes tant que le budget est dépassé. */
+static void rc2d_assetcache_enforceBudget(void)
+{
+    while (rc2d_assetcache.lru_head && rc2d_assetcache.bytes_resident > rc2d_assetcache.budget_bytes)
+    {
+        rc2d_assetcache_destroyEntry(rc2d_assetcache.lru_head);
+        rc2d_assetcache.evictions++;
+    }
+}
+
+static RC2D_CachedAsset* rc2d_assetcache_acquire(RC2D_AssetKind kind, const char* storage_path, RC2D_StorageKind storage_kind,
+                                                 Uint32 variant, float fontSize, int hitMaskThreshold)
+{
+    if (!storage_path || !*storage_path)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: invalid storage_path");
+        return NULL;
+    }
+
+    const Uint32 hash = rc2d_assetcache_hash(kind, storage_kind, variant, storage_path);
+    RC2D_CachedAsset* entry = rc2d_assetcache_find(kind, storage_kind, variant, storage_path, hash);
+    if (entry)
+    {
+        rc2d_assetcache.hits++;
+        rc2d_assetcache_retain(entry);
+        if (hitMaskThreshold != RC2D_ASSETCACHE_NO_HITMASK)
+        {
+            if (!rc2d_assetcache_ensureHitMask(entry, (Uint8)hitMaskThreshold))
+            {
+                RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: failed to build hit mask for '%s'", storage_path);
+                rc2d_assetcache_release(entry);
+                return NULL;
+            }
+            /* Le masque ajouté peut pousser d'anciennes entrées non référencées hors du budget */
+            rc2d_assetcache_enforceBudget();
+        }
+        return entry;
+    }
+
+    rc2d_assetcache.misses++;
+
+    if (rc2d_assetcache.entry_count >= rc2d_assetcache.bucket_count && !rc2d_assetcache_grow())
+    {
+        return NULL;
+    }
+
+    entry = (RC2D_CachedAsset*)RC2D_calloc(1, sizeof(RC2D_CachedAsset));
+    if (!entry)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: failed to allocate entry for '%s'", storage_path);
+        return NULL;
+    }
+    entry->kind = kind;
+    entry->storage_kind = storage_kind;
+    entry->variant = variant;
+    entry->hash = hash;
+    entry->path = RC2D_strdup(storage_path);
+    if (!entry->path || !rc2d_assetcache_load(entry, fontSize, hitMaskThreshold))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: failed to load '%s'", storage_path);
+        RC2D_safe_free(entry->path);
+        RC2D_free(entry);
+        return NULL;
+    }
+
+    const Uint32 slot = hash & (Uint32)(rc2d_assetcache.bucket_count - 1);
+    entry->hash_next = rc2d_assetcache.buckets[slot];
+    rc2d_assetcache.buckets[slot] = entry;
+    entry->refcount = 1;
+    rc2d_assetcache.entry_count++;
+    rc2d_assetcache.referenced_count++;
+    rc2d_assetcache.bytes_resident += entry->bytes;
+
+    /* Le nouvel asset peut pousser d'anciennes entrées non référencées hors du budget */
+    rc2d_assetcache_enforceBudget();
+    return entry;
+}
+
+/* ========================================================================= */
+/*                                     API                                    */
+/* ========================================================================= */
+
+void rc2d_assetcache_setBudget(Uint64 budgetBytes)
+{
+    rc2d_assetcache.budget_bytes = budgetBytes;
+    rc2d_assetcache_enforceBudget();
+}
+
+Uint64 rc2d_assetcache_getBudget(void)
+{
+    return rc2d_assetcache.budget_bytes;
+}
+
+RC2D_CachedAsset* rc2d_assetcache_acquireImage(const char* storage_path, RC2D_StorageKind storage_kind)
+{
+    return rc2d_assetcache_acquire(RC2D_ASSET_IMAGE, storage_path, storage_kind, 0, 0.0f, RC2D_ASSETCACHE_NO_HITMASK);
+}
+
+RC2D_CachedAsset* rc2d_assetcache_acquireImageWithHitMask(const char* storage_path, RC2D_StorageKind storage_kind,
+                                                          Uint8 alphaThreshold)
+{
+    /* Même entrée que rc2d_assetcache_acquireImage() : le masque est attaché à la texture existante */
+    return rc2d_assetcache_acquire(RC2D_ASSET_IMAGE, storage_path, storage_kind, 0, 0.0f, alphaThreshold);
+}
+
+RC2D_CachedAsset* rc2d_assetcache_acquireImageData(const char* storage_path, RC2D_StorageKind storage_kind)
+{
+    return rc2d_assetcache_acquire(RC2D_ASSET_IMAGE_DATA, storage_path, storage_kind, 0, 0.0f, RC2D_ASSETCACHE_NO_HITMASK);
+}
+
+RC2D_CachedAsset* rc2d_assetcache_acquireFont(const char* storage_path, RC2D_StorageKind storage_kind, float fontSize)
+{
+    /* La taille fait partie de la clé (comparaison bit à bit) */
+    Uint32 variant = 0;
+    SDL_memcpy(&variant, &fontSize, sizeof(variant));
+    return rc2d_assetcache_acquire(RC2D_ASSET_FONT, storage_path, storage_kind, variant, fontSize, RC2D_ASSETCACHE_NO_HITMASK);
+}
+
+RC2D_CachedAsset* rc2d_assetcache_acquireAudio(const char* storage_path, RC2D_StorageKind storage_kind, bool predecode)
+{
+    return rc2d_assetcache_acquire(RC2D_ASSET_AUDIO, storage_path, storage_kind, predecode ? 1u : 0u, 0.0f, RC2D_ASSETCACHE_NO_HITMASK);
+}
+
+RC2D_CachedAsset* rc2d_assetcache_acquireAtlas(const char* storage_path, RC2D_StorageKind storage_kind)
+{
+    return rc2d_assetcache_acquire(RC2D_ASSET_ATLAS, storage_path, storage_kind, 0, 0.0f, RC2D_ASSETCACHE_NO_HITMASK);
+}
+
+RC2D_CachedAsset* rc2d_assetcache_retain(RC2D_CachedAsset* asset)
+{
+    if (!asset)
+    {
+        return NULL;
+    }
+
+    if (asset->refcount++ == 0)
+    {
+        rc2d_assetcache_lruRemove(asset);
+        rc2d_assetcache.referenced_count++;
+    }
+    return asset;
+}
+
+void rc2d_assetcache_release(RC2D_CachedAsset* asset)
+{
+    if (!asset)
+    {
+        return;
+    }
+
+    if (asset->refcount <= 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetCache: release on unreferenced asset '%s'", asset->path);
+        return;
+    }
+
+    if (--asset->refcount == 0)
+    {
+        rc2d_assetcache.referenced_count--;
+        rc2d_assetcache_lruPush(asset);
+        rc2d_assetcache_enforceBudget();
+    }
+}
+
+RC2D_AssetKind rc2d_assetcache_getKind(const RC2D_CachedAsset* asset)
+{
+    return asset ? asset->kind : RC2D_ASSET_IMAGE;
+}
+
+RC2D_Image rc2d_assetcache_getImage(const RC2D_CachedAsset* asset)
+{
+    RC2D_Image image = { NULL };
+    if (asset && asset->kind == RC2D_ASSET_IMAGE)
+    {
+        image = asset->image;
+    }
+    return image;
+}
+
+const RC2D_HitMask* rc2d_assetcache_getHitMask(const RC2D_CachedAsset* asset, Uint8 alphaThreshold)
+{
+    if (!asset || asset->kind != RC2D_ASSET_IMAGE)
+    {
+        return NULL;
+    }
+
+    const RC2D_AssetCacheHitMask* node = rc2d_assetcache_findHitMask(asset, alphaThreshold);
+    return (node && node->mask.bits) ? &node->mask : NULL;
+}
+
+RC2D_ImageData rc2d_assetcache_getImageData(const RC2D_CachedAsset* asset)
+{
+    RC2D_ImageData image_data = { NULL };
+    if (asset && asset->kind == RC2D_ASSET_IMAGE_DATA)
+    {
+        image_data = asset->image_data;
+    }
+    return image_data;
+}
+
+RC2D_Font rc2d_assetcache_getFont(const RC2D_CachedAsset* asset)
+{
+    RC2D_Font font = { 0 };
+    if (asset && asset->kind == RC2D_ASSET_FONT)
+    {
+        font = asset->font;
+    }
+    return font;
+}
+
+MIX_Audio* rc2d_assetcache_getAudio(const RC2D_CachedAsset* asset)
+{
+    return (asset && asset->kind == RC2D_ASSET_AUDIO) ? asset->audio : NULL;
+}
+
+const RC2D_TP_Atlas* rc2d_assetcache_getAtlas(const RC2D_CachedAsset* asset)
+{
+    return (asset && asset->kind == RC2D_ASSET_ATLAS) ? &asset->atlas : NULL;
+}
+
+void rc2d_assetcache_trim(void)
+{
+    while (rc2d_assetcache.lru_head)
+    {
+        rc2d_assetcache_destroyEntry(rc2d_assetcache.lru_head);
+        rc2d_assetcache.evictions++;
+    }
+}
+
+void rc2d_assetcache_getStats(RC2D_AssetCacheStats* stats)
+{
+    if (!stats)
+    {
+        return;
+    }
+
+    stats->hits             = rc2d_assetcache.hits;
+    stats->misses           = rc2d_assetcache.misses;
+    stats->evictions        = rc2d_assetcache.evictions;
+    stats->bytes_resident   = rc2d_assetcache.bytes_resident;
+    stats->budget_bytes     = rc2d_assetcache.budget_bytes;
+    stats->entry_count      = rc2d_assetcache.entry_count;
+    stats->referenced_count = rc2d_assetcache.referenced_count;
+}
+
+void rc2d_assetcache_resetStats(void)
+{
+    rc2d_assetcache.hits = 0;
+    rc2d_assetcache.misses = 0;
+    rc2d_assetcache.evictions = 0;
+}
+
+void rc2d_assetcache_destroyAll(void)
+{
+    if (rc2d_assetcache.referenced_count > 0)
+    {
+        RC2D_log(RC2D_LOG_WARN, "RC2D_AssetCache: %d asset(s) still referenced at quit, freeing them now",
+                 rc2d_assetcache.referenced_count);
+    }
+
+    for (int i = 0; i < rc2d_assetcache.bucket_count; ++i)
+    {
+        while (rc2d_assetcache.buckets[i])
+        {
+            rc2d_assetcache_destroyEntry(rc2d_assetcache.buckets[i]);
+        }
+    }
+
+    RC2D_safe_free(rc2d_assetcache.buckets);
+    rc2d_assetcache.bucket_count = 0;
+    rc2d_assetcache_resetStats();
+}
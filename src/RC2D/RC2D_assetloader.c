@@ -0,0 +1,642 @@
+#include <RC2D/RC2D_assetloader.h>
+#include <RC2D/RC2D_audio.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_thread.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_timer.h>
+
+#include <SDL3_ttf/SDL_ttf.h>
+
+/* Nombre max de workers quand workerCount <= 0 (le décodage est vite limité par les I/O) */
+#define RC2D_ASSETLOADER_MAX_AUTO_WORKERS 4
+
+struct RC2D_AssetHandle {
+    RC2D_AssetLoader* loader;
+    RC2D_AssetKind kind;
+    char* path;
+    RC2D_StorageKind storage_kind;
+    float font_size;
+    bool predecode;
+    RC2D_AssetCallback callback;
+    void* userdata;
+
+    /* RC2D_AssetState, lu sans verrou par rc2d_assetloader_getState() */
+    SDL_AtomicInt state;
+
+    /* Thread principal uniquement : handle rendu avant la fin du chargement */
+    bool released;
+
+    /* Résultat du worker (décodé, pas encore finalisé) */
+    bool decoded_ok;
+    SDL_Surface* surface;
+    void* bytes;
+    Uint64 len;
+
+    /* Résultat final, possédé par l'appelant une fois READY */
+    RC2D_Image image;
+    RC2D_ImageData image_data;
+    RC2D_Font font;
+    MIX_Audio* audio;
+    RC2D_TP_Atlas atlas;
+
+    /* File de travail / file des décodés (protégées par loader->mutex) */
+    RC2D_AssetHandle* next_job;
+
+    /* Liste de tous les handles du loader (thread principal) */
+    RC2D_AssetHandle* next_handle;
+};
+
+struct RC2D_AssetLoader {
+    RC2D_Thread** workers;
+    int worker_count;
+
+    SDL_Mutex* mutex;
+    SDL_Condition* job_available;
+    bool quit;
+
+    RC2D_AssetHandle* jobs_head;
+    RC2D_AssetHandle* jobs_tail;
+    RC2D_AssetHandle* decoded_head;
+    RC2D_AssetHandle* decoded_tail;
+
+    /* Thread principal uniquement */
+    RC2D_AssetHandle* handles;
+    double upload_budget_ms;
+    int batch_total;
+    int batch_done;
+
+    /* Liste des loaders vivants, mis à jour automatiquement à chaque frame */
+    RC2D_AssetLoader* next_loader;
+};
+
+static RC2D_AssetLoader* rc2d_assetloader_loaders = NULL;
+
+/* ========================================================================= */
+/*                                  WORKERS                                   */
+/* ========================================================================= */
+
+static bool rc2d_assetloader_readStorage(const RC2D_AssetHandle* handle, void** bytes, Uint64* len)
+{
+    if (handle->storage_kind == RC2D_STORAGE_TITLE)
+    {
+        return rc2d_storage_titleReadFile(handle->path, bytes, len);
+    }
+    else if (handle->storage_kind == RC2D_STORAGE_USER)
+    {
+        return rc2d_storage_userReadFile(handle->path, bytes, len);
+    }
+
+    RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: invalid storage kind for '%s'", handle->path);
+    return false;
+}
+
+/* Lecture storage + décodage, sans aucun appel au renderer. */
+static bool rc2d_assetloader_decode(RC2D_AssetHandle* handle)
+{
+    switch (handle->kind)
+    {
+        case RC2D_ASSET_IMAGE:
+        case RC2D_ASSET_IMAGE_DATA:
+        {
+            RC2D_ImageData data = rc2d_graphics_loadImageDataFromStorage(handle->path, handle->storage_kind);
+            handle->surface = data.sdl_surface;
+            return handle->surface != NULL;
+        }
+
+        case RC2D_ASSET_FONT:
+            /* TTF_OpenFontIO est fait sur le thread principal ; le worker ne fait que la lecture */
+            return rc2d_assetloader_readStorage(handle, &handle->bytes, &handle->len);
+
+        case RC2D_ASSET_AUDIO:
+            handle->audio = rc2d_audio_loadAudioFromStorage(handle->path, handle->storage_kind, handle->predecode);
+            return handle->audio != NULL;
+
+        case RC2D_ASSET_ATLAS:
+        {
+            char image_path[1024];
+            if (!rc2d_tp_loadAtlasFramesFromStorage(handle->path, handle->storage_kind, &handle->atlas,
+                                                    image_path, sizeof(image_path)))
+            {
+                return false;
+            }
+            RC2D_ImageData data = rc2d_graphics_loadImageDataFromStorage(image_path, handle->storage_kind);
+            handle->surface = data.sdl_surface;
+            return handle->surface != NULL;
+        }
+    }
+
+    return false;
+}
+
+static int rc2d_assetloader_worker(void* data)
+{
+    RC2D_AssetLoader* loader = (RC2D_AssetLoader*)data;
+
+    for (;;)
+    {
+        SDL_LockMutex(loader->mutex);
+        while (!loader->quit && !loader->jobs_head)
+        {
+            SDL_WaitCondition(loader->job_available, loader->mutex);
+        }
+        if (loader->quit)
+        {
+            SDL_UnlockMutex(loader->mutex);
+            break;
+        }
+        RC2D_AssetHandle* job = loader->jobs_head;
+        loader->jobs_head = job->next_job;
+        if (!loader->jobs_head) loader->jobs_tail = NULL;
+        job->next_job = NULL;
+        SDL_UnlockMutex(loader->mutex);
+
+        SDL_SetAtomicInt(&job->state, RC2D_ASSET_STATE_DECODING);
+        job->decoded_ok = rc2d_assetloader_decode(job);
+
+        SDL_LockMutex(loader->mutex);
+        if (loader->decoded_tail) loader->decoded_tail->next_job = job;
+        else loader->decoded_head = job;
+        loader->decoded_tail = job;
+        SDL_SetAtomicInt(&job->state, RC2D_ASSET_STATE_DECODED);
+        SDL_UnlockMutex(loader->mutex);
+    }
+
+    return 0;
+}
+
+/* ========================================================================= */
+/*                             THREAD PRINCIPAL                               */
+/* ========================================================================= */
+
+/* Libère tout ce que le handle possède encore (résultat intermédiaire, ou final non remis). */
+static void rc2d_assetloader_discardResult(RC2D_AssetHandle* handle)
+{
+    if (handle->surface)
+    {
+        SDL_DestroySurface(handle->surface);
+        handle->surface = NULL;
+    }
+    RC2D_safe_free(handle->bytes);
+    rc2d_graphics_freeImage(&handle->image);
+    rc2d_graphics_freeImageData(&handle->image_data);
+    if (handle->font.sdl_font) rc2d_graphics_closeFont(&handle->font);
+    if (handle->audio)
+    {
+        rc2d_audio_destroy(handle->audio);
+        handle->audio = NULL;
+    }
+    rc2d_tp_freeAtlas(&handle->atlas);
+}
+
+/* Upload GPU / ouverture de police : la partie qui doit rester sur le thread principal. */
+static bool rc2d_assetloader_finalize(RC2D_AssetHandle* handle)
+{
+    if (!handle->decoded_ok)
+    {
+        return false;
+    }
+
+    switch (handle->kind)
+    {
+        case RC2D_ASSET_IMAGE:
+        case RC2D_ASSET_ATLAS:
+        {
+            SDL_Texture* texture = SDL_CreateTextureFromSurface(rc2d_engine_state.renderer, handle->surface);
+            SDL_DestroySurface(handle->surface);
+            handle->surface = NULL;
+            if (!texture)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: SDL_CreateTextureFromSurface('%s') failed: %s",
+                         handle->path, SDL_GetError());
+                return false;
+            }
+            if (handle->kind == RC2D_ASSET_IMAGE) handle->image.sdl_texture = texture;
+            else handle->atlas.atlas_image.sdl_texture = texture;
+            return true;
+        }
+
+        case RC2D_ASSET_IMAGE_DATA:
+            handle->image_data.sdl_surface = handle->surface;
+            handle->surface = NULL;
+            return true;
+
+        case RC2D_ASSET_FONT:
+        {
+            SDL_IOStream* io = SDL_IOFromConstMem(handle->bytes, (size_t)handle->len);
+            TTF_Font* sdl_font = io ? TTF_OpenFontIO(io, /*closeio=*/true, handle->font_size) : NULL;
+            if (!sdl_font)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: TTF_OpenFontIO('%s') failed: %s", handle->path, SDL_GetError());
+                return false;
+            }
+            handle->font.sdl_font   = sdl_font;
+            handle->font.fontSize   = handle->font_size;
+            handle->font.style      = TTF_STYLE_NORMAL;
+            handle->font.alignment  = TTF_HORIZONTAL_ALIGN_LEFT;
+            handle->font._file_data = handle->bytes;
+            handle->bytes = NULL;
+            return true;
+        }
+
+        case RC2D_ASSET_AUDIO:
+            return true;
+    }
+
+    return false;
+}
+
+static void rc2d_assetloader_freeHandle(RC2D_AssetHandle* handle)
+{
+    RC2D_AssetLoader* loader = handle->loader;
+    RC2D_AssetHandle** link = &loader->handles;
+    while (*link && *link != handle) link = &(*link)->next_handle;
+    if (*link) *link = handle->next_handle;
+
+    RC2D_safe_free(handle->path);
+    RC2D_free(handle);
+}
+
+static RC2D_AssetHandle* rc2d_assetloader_enqueue(RC2D_AssetLoader* loader, RC2D_AssetKind kind,
+                                                  const char* storage_path, RC2D_StorageKind storage_kind,
+                                                  RC2D_AssetCallback callback, void* userdata)
+{
+    if (!loader || !storage_path || !*storage_path)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: invalid arguments");
+        return NULL;
+    }
+
+    RC2D_AssetHandle* handle = (RC2D_AssetHandle*)RC2D_calloc(1, sizeof(RC2D_AssetHandle));
+    if (!handle)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: out of memory for handle");
+        return NULL;
+    }
+    handle->path = RC2D_strdup(storage_path);
+    if (!handle->path)
+    {
+        RC2D_free(handle);
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: out of memory for path");
+        return NULL;
+    }
+    handle->loader = loader;
+    handle->kind = kind;
+    handle->storage_kind = storage_kind;
+    handle->callback = callback;
+    handle->userdata = userdata;
+    SDL_SetAtomicInt(&handle->state, RC2D_ASSET_STATE_QUEUED);
+
+    handle->next_handle = loader->handles;
+    loader->handles = handle;
+
+    /* Nouveau lot si le précédent est terminé (pour la progression globale) */
+    if (loader->batch_done >= loader->batch_total)
+    {
+        loader->batch_total = 0;
+        loader->batch_done = 0;
+    }
+    loader->batch_total++;
+
+    return handle;
+}
+
+/* Publie le job aux workers, une fois tous ses paramètres renseignés. */
+static RC2D_AssetHandle* rc2d_assetloader_submit(RC2D_AssetHandle* handle)
+{
+    if (!handle) return NULL;
+
+    RC2D_AssetLoader* loader = handle->loader;
+    SDL_LockMutex(loader->mutex);
+    if (loader->jobs_tail) loader->jobs_tail->next_job = handle;
+    else loader->jobs_head = handle;
+    loader->jobs_tail = handle;
+    SDL_SignalCondition(loader->job_available);
+    SDL_UnlockMutex(loader->mutex);
+
+    return handle;
+}
+
+/* ========================================================================= */
+/*                               API PUBLIQUE                                 */
+/* ========================================================================= */
+
+RC2D_AssetLoader* rc2d_assetloader_create(int workerCount, double uploadBudgetMs)
+{
+    if (workerCount <= 0)
+    {
+        workerCount = SDL_GetNumLogicalCPUCores() - 1;
+        if (workerCount < 1) workerCount = 1;
+        if (workerCount > RC2D_ASSETLOADER_MAX_AUTO_WORKERS) workerCount = RC2D_ASSETLOADER_MAX_AUTO_WORKERS;
+    }
+
+    RC2D_AssetLoader* loader = (RC2D_AssetLoader*)RC2D_calloc(1, sizeof(RC2D_AssetLoader));
+    if (!loader)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: out of memory");
+        return NULL;
+    }
+    loader->upload_budget_ms = uploadBudgetMs;
+
+    loader->mutex = SDL_CreateMutex();
+    loader->job_available = SDL_CreateCondition();
+    loader->workers = (RC2D_Thread**)RC2D_calloc((size_t)workerCount, sizeof(RC2D_Thread*));
+    if (!loader->mutex || !loader->job_available || !loader->workers)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: failed to create synchronization primitives: %s", SDL_GetError());
+        rc2d_assetloader_destroy(loader);
+        return NULL;
+    }
+
+    for (int i = 0; i < workerCount; ++i)
+    {
+        loader->workers[i] = rc2d_thread_new(rc2d_assetloader_worker, "rc2d_assetloader", loader);
+        if (!loader->workers[i])
+        {
+            RC2D_log(RC2D_LOG_ERROR, "RC2D_AssetLoader: failed to start worker %d", i);
+            rc2d_assetloader_destroy(loader);
+            return NULL;
+        }
+        loader->worker_count++;
+    }
+
+    loader->next_loader = rc2d_assetloader_loaders;
+    rc2d_assetloader_loaders = loader;
+    return loader;
+}
+
+void rc2d_assetloader_destroy(RC2D_AssetLoader* loader)
+{
+    if (!loader) return;
+
+    /* Retirer le loader de la liste des loaders mis à jour chaque frame */
+    RC2D_AssetLoader** link = &rc2d_assetloader_loaders;
+    while (*link && *link != loader) link = &(*link)->next_loader;
+    if (*link) *link = loader->next_loader;
+
+    /* Arrêter les workers (un job en cours de décodage est terminé avant) */
+    if (loader->mutex)
+    {
+        SDL_LockMutex(loader->mutex);
+        loader->quit = true;
+        if (loader->job_available) SDL_BroadcastCondition(loader->job_available);
+        SDL_UnlockMutex(loader->mutex);
+    }
+    for (int i = 0; i < loader->worker_count; ++i)
+    {
+        rc2d_thread_wait(loader->workers[i], NULL);
+    }
+
+    /* Libérer les handles : les assets READY appartiennent déjà à l'appelant */
+    while (loader->handles)
+    {
+        RC2D_AssetHandle* handle = loader->handles;
+        loader->handles = handle->next_handle;
+        if (SDL_GetAtomicInt(&handle->state) != RC2D_ASSET_STATE_READY)
+        {
+            rc2d_assetloader_discardResult(handle);
+        }
+        RC2D_safe_free(handle->path);
+        RC2D_free(handle);
+    }
+
+    RC2D_safe_free(loader->workers);
+    if (loader->job_available) SDL_DestroyCondition(loader->job_available);
+    if (loader->mutex) SDL_DestroyMutex(loader->mutex);
+    RC2D_free(loader);
+}
+
+void rc2d_assetloader_setUploadBudget(RC2D_AssetLoader* loader, double uploadBudgetMs)
+{
+    if (!loader) return;
+    loader->upload_budget_ms = uploadBudgetMs;
+}
+
+int rc2d_assetloader_update(RC2D_AssetLoader* loader)
+{
+    if (!loader) return 0;
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    const bool unlimited = loader->upload_budget_ms <= 0.0;
+    Uint64 budget = 0;
+    if (!unlimited)
+    {
+        /* Un budget positif plus court qu'un tick du compteur reste un budget : au moins 1 tick */
+        budget = (Uint64)(loader->upload_budget_ms * (double)SDL_GetPerformanceFrequency() / 1000.0);
+        if (budget == 0) budget = 1;
+    }
+
+    int finalized = 0;
+    for (;;)
+    {
+        SDL_LockMutex(loader->mutex);
+        RC2D_AssetHandle* handle = loader->decoded_head;
+        if (handle)
+        {
+            loader->decoded_head = handle->next_job;
+            if (!loader->decoded_head) loader->decoded_tail = NULL;
+            handle->next_job = NULL;
+        }
+        SDL_UnlockMutex(loader->mutex);
+        if (!handle) break;
+
+        const bool ok = rc2d_assetloader_finalize(handle);
+        if (!ok) rc2d_assetloader_discardResult(handle);
+        SDL_SetAtomicInt(&handle->state, ok ? RC2D_ASSET_STATE_READY : RC2D_ASSET_STATE_FAILED);
+        loader->batch_done++;
+        finalized++;
+
+        if (handle->released)
+        {
+            /* Personne n'attend plus ce résultat */
+            rc2d_assetloader_discardResult(handle);
+            rc2d_assetloader_freeHandle(handle);
+        }
+        else if (handle->callback)
+        {
+            handle->callback(handle, handle->userdata);
+        }
+
+        /* Au moins un asset par appel, puis on s'arrête dès que le budget est consommé */
+        if (!unlimited && SDL_GetPerformanceCounter() - start >= budget) break;
+    }
+
+    return finalized;
+}
+
+void rc2d_assetloader_waitAll(RC2D_AssetLoader* loader)
+{
+    if (!loader) return;
+
+    const double budget = loader->upload_budget_ms;
+    loader->upload_budget_ms = 0.0;
+    while (rc2d_assetloader_getPendingCount(loader) > 0)
+    {
+        if (rc2d_assetloader_update(loader) == 0)
+        {
+            SDL_Delay(1);
+        }
+    }
+    loader->upload_budget_ms = budget;
+}
+
+float rc2d_assetloader_getProgress(const RC2D_AssetLoader* loader)
+{
+    if (!loader || loader->batch_total == 0) return 1.0f;
+    return (float)loader->batch_done / (float)loader->batch_total;
+}
+
+int rc2d_assetloader_getPendingCount(const RC2D_AssetLoader* loader)
+{
+    if (!loader) return 0;
+    return loader->batch_total - loader->batch_done;
+}
+
+RC2D_AssetHandle* rc2d_assetloader_loadImage(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                             RC2D_AssetCallback callback, void* userdata)
+{
+    return rc2d_assetloader_submit(rc2d_assetloader_enqueue(loader, RC2D_ASSET_IMAGE, storage_path, storage_kind, callback, userdata));
+}
+
+RC2D_AssetHandle* rc2d_assetloader_loadImageData(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                                 RC2D_AssetCallback callback, void* userdata)
+{
+    return rc2d_assetloader_submit(rc2d_assetloader_enqueue(loader, RC2D_ASSET_IMAGE_DATA, storage_path, storage_kind, callback, userdata));
+}
+
+RC2D_AssetHandle* rc2d_assetloader_loadFont(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                            float fontSize, RC2D_AssetCallback callback, void* userdata)
+{
+    RC2D_AssetHandle* handle = rc2d_assetloader_enqueue(loader, RC2D_ASSET_FONT, storage_path, storage_kind, callback, userdata);
+    if (handle) handle->font_size = fontSize;
+    return rc2d_assetloader_submit(handle);
+}
+
+RC2D_AssetHandle* rc2d_assetloader_loadAudio(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                             bool predecode, RC2D_AssetCallback callback, void* userdata)
+{
+    RC2D_AssetHandle* handle = rc2d_assetloader_enqueue(loader, RC2D_ASSET_AUDIO, storage_path, storage_kind, callback, userdata);
+    if (handle) handle->predecode = predecode;
+    return rc2d_assetloader_submit(handle);
+}
+
+RC2D_AssetHandle* rc2d_assetloader_loadAtlas(RC2D_AssetLoader* loader, const char* storage_path, RC2D_StorageKind storage_kind,
+                                             RC2D_AssetCallback callback, void* userdata)
+{
+    return rc2d_assetloader_submit(rc2d_assetloader_enqueue(loader, RC2D_ASSET_ATLAS, storage_path, storage_kind, callback, userdata));
+}
+
+RC2D_AssetState rc2d_assetloader_getState(const RC2D_AssetHandle* handle)
+{
+    if (!handle) return RC2D_ASSET_STATE_FAILED;
+    return (RC2D_AssetState)SDL_GetAtomicInt((SDL_AtomicInt*)&handle->state);
+}
+
+float rc2d_assetloader_getHandleProgress(const RC2D_AssetHandle* handle)
+{
+    switch (rc2d_assetloader_getState(handle))
+    {
+        case RC2D_ASSET_STATE_QUEUED:   return 0.0f;
+        case RC2D_ASSET_STATE_DECODING: return 0.25f;
+        case RC2D_ASSET_STATE_DECODED:  return 0.75f;
+        default:                        return 1.0f;
+    }
+}
+
+bool rc2d_assetloader_isDone(const RC2D_AssetHandle* handle)
+{
+    const RC2D_AssetState state = rc2d_assetloader_getState(handle);
+    return state == RC2D_ASSET_STATE_READY || state == RC2D_ASSET_STATE_FAILED;
+}
+
+RC2D_AssetKind rc2d_assetloader_getKind(const RC2D_AssetHandle* handle)
+{
+    return handle ? handle->kind : RC2D_ASSET_IMAGE;
+}
+
+const char* rc2d_assetloader_getPath(const RC2D_AssetHandle* handle)
+{
+    return handle ? handle->path : NULL;
+}
+
+RC2D_Image rc2d_assetloader_getImage(const RC2D_AssetHandle* handle)
+{
+    if (rc2d_assetloader_getState(handle) != RC2D_ASSET_STATE_READY || handle->kind != RC2D_ASSET_IMAGE)
+    {
+        return (RC2D_Image){ NULL };
+    }
+    return handle->image;
+}
+
+RC2D_ImageData rc2d_assetloader_getImageData(const RC2D_AssetHandle* handle)
+{
+    if (rc2d_assetloader_getState(handle) != RC2D_ASSET_STATE_READY || handle->kind != RC2D_ASSET_IMAGE_DATA)
+    {
+        return (RC2D_ImageData){ NULL };
+    }
+    return handle->image_data;
+}
+
+RC2D_Font rc2d_assetloader_getFont(const RC2D_AssetHandle* handle)
+{
+    if (rc2d_assetloader_getState(handle) != RC2D_ASSET_STATE_READY || handle->kind != RC2D_ASSET_FONT)
+    {
+        return (RC2D_Font){0};
+    }
+    return handle->font;
+}
+
+MIX_Audio* rc2d_assetloader_getAudio(const RC2D_AssetHandle* handle)
+{
+    if (rc2d_assetloader_getState(handle) != RC2D_ASSET_STATE_READY || handle->kind != RC2D_ASSET_AUDIO)
+    {
+        return NULL;
+    }
+    return handle->audio;
+}
+
+RC2D_TP_Atlas rc2d_assetloader_getAtlas(const RC2D_AssetHandle* handle)
+{
+    if (rc2d_assetloader_getState(handle) != RC2D_ASSET_STATE_READY || handle->kind != RC2D_ASSET_ATLAS)
+    {
+        return (RC2D_TP_Atlas){0};
+    }
+    return handle->atlas;
+}
+
+void rc2d_assetloader_releaseHandle(RC2D_AssetHandle* handle)
+{
+    if (!handle) return;
+
+    if (rc2d_assetloader_isDone(handle))
+    {
+        rc2d_assetloader_freeHandle(handle);
+    }
+    else
+    {
+        /* Encore chez un worker ou dans la file des décodés : libéré à la finalisation */
+        handle->released = true;
+    }
+}
+
+void rc2d_assetloader_updateAll(void)
+{
+    for (RC2D_AssetLoader* loader = rc2d_assetloader_loaders; loader; loader = loader->next_loader)
+    {
+        rc2d_assetloader_update(loader);
+    }
+}
+
+void rc2d_assetloader_destroyAll(void)
+{
+    while (rc2d_assetloader_loaders)
+    {
+        RC2D_log(RC2D_LOG_WARN, "RC2D_AssetLoader: loader not destroyed before quit, destroying it now");
+        rc2d_assetloader_destroy(rc2d_assetloader_loaders);
+    }
+}
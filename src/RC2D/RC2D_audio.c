@@ -9,15 +9,9 @@
 /*  Assets audio                                                             */
 /* ------------------------------------------------------------------------- */
 
-MIX_Audio* rc2d_audio_loadAudioFromStorage(const char *storage_path, RC2D_StorageKind storage_kind, bool predecode)
+/* Ouvre un stream de lecture sur un fichier audio du storage (NULL + log en cas d'échec). */
+static RC2D_StorageStream* open_audio_stream(const char *storage_path, RC2D_StorageKind storage_kind)
 {
-    // Check si le mixer est initialisé et si le chemin est valide
-    if (!rc2d_engine_state.mixer) 
-    {
-        RC2D_log(RC2D_LOG_ERROR, "Mixer non initialisé.");
-        return NULL;
-    }
-
     // Validation du chemin et de la valeur du storage path
     if (!storage_path || *storage_path == '\0') 
     {
@@ -37,52 +31,56 @@ MIX_Audio* rc2d_audio_loadAudioFromStorage(const char *storage_path, RC2D_Storag
         return NULL;
     }
 
-    // Lire le fichier depuis le stockage Title
-    void *bytes = NULL; 
-    Uint64 len = 0;
+    // Ouvre le fichier en lecture par morceaux : le décodeur ne lit que ce dont il a besoin
+    RC2D_StorageStream *stream = NULL;
     if (storage_kind == RC2D_STORAGE_TITLE) 
     {
-        if (!rc2d_storage_titleReadFile(storage_path, &bytes, &len)) 
-        {
-            RC2D_log(RC2D_LOG_ERROR, "Failed to read '%s' from Title storage", storage_path);
-            return NULL;
-        }
+        stream = rc2d_storage_titleOpenStream(storage_path);
     }
     else if (storage_kind == RC2D_STORAGE_USER) 
     {
-        if (!rc2d_storage_userReadFile(storage_path, &bytes, &len)) 
-        {
-            RC2D_log(RC2D_LOG_ERROR, "Failed to read '%s' from User storage", storage_path);
-            return NULL;
-        }
+        stream = rc2d_storage_userOpenStream(storage_path);
     } 
     else 
     {
-        RC2D_log(RC2D_LOG_ERROR, "rc2d_audio_loadFromStorage: invalid storage kind");
+        RC2D_log(RC2D_LOG_ERROR, "open_audio_stream: invalid storage kind");
+        return NULL;
+    }
+
+    if (!stream) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Failed to open '%s' from %s storage", storage_path, (storage_kind == RC2D_STORAGE_TITLE) ? "Title" : "User");
         return NULL;
     }
 
     // Vérifier que le fichier n'est pas vide
-    if (len == 0 || !bytes) 
+    if (rc2d_storage_streamSize(stream) == 0) 
     {
+        rc2d_storage_closeStream(stream);
         RC2D_log(RC2D_LOG_ERROR, "File '%s' is empty in %s storage", storage_path, (storage_kind == RC2D_STORAGE_TITLE) ? "Title" : "User");
         return NULL;
     }
 
-    // Crée un IO stream en lecture sur le buffer (pas de copie).
-    SDL_IOStream *ioStream = SDL_IOFromConstMem(bytes, (size_t)len);
-    if (!ioStream) 
+    return stream;
+}
+
+MIX_Audio* rc2d_audio_loadAudioFromStorage(const char *storage_path, RC2D_StorageKind storage_kind, bool predecode)
+{
+    // Check si le mixer est initialisé et si le chemin est valide
+    if (!rc2d_engine_state.mixer) 
     {
-        RC2D_safe_free(bytes);
-        RC2D_log(RC2D_LOG_ERROR, "SDL_IOFromConstMem failed for '%s': %s", storage_path, SDL_GetError());
+        RC2D_log(RC2D_LOG_ERROR, "Mixer non initialisé.");
         return NULL;
     }
 
-    // Charger l'audio depuis la mémoire
-    MIX_Audio* audio = MIX_LoadAudio_IO(rc2d_engine_state.mixer, ioStream, predecode, /*closeio=*/true);
+    RC2D_StorageStream *stream = open_audio_stream(storage_path, storage_kind);
+    if (!stream) 
+    {
+        return NULL;
+    }
 
-    // Maintenant que MIX_LoadAudio_IO a fini (et a fermé le stream), on peut libérer le buffer.
-    RC2D_safe_free(bytes);
+    // Charger l'audio depuis le stream : MIX_LoadAudio_IO le ferme (closeio), ce qui ferme aussi le stream
+    MIX_Audio* audio = MIX_LoadAudio_IO(rc2d_engine_state.mixer, rc2d_storage_streamGetIO(stream), predecode, /*closeio=*/true);
 
     // Vérifier que l'audio a bien été chargé
     if (!audio) 
@@ -152,6 +150,32 @@ bool rc2d_track_setAudio(MIX_Track* track, MIX_Audio* audio)
     return true;
 }
 
+bool rc2d_track_setAudioFromStorage(MIX_Track* track, const char *storage_path, RC2D_StorageKind storage_kind)
+{
+    if (!track) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Paramètre NULL dans rc2d_track_setAudioFromStorage.");
+        return false;
+    }
+
+    RC2D_StorageStream *stream = open_audio_stream(storage_path, storage_kind);
+    if (!stream) 
+    {
+        return false;
+    }
+
+    // La piste prend possession du stream (closeio) et le lit pendant la lecture
+    if (!MIX_SetTrackIOStream(track, rc2d_storage_streamGetIO(stream), /*closeio=*/true)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "MIX_SetTrackIOStream('%s') a échoué : %s", storage_path, SDL_GetError());
+        rc2d_storage_closeStream(stream);
+        return false;
+    }
+
+    RC2D_log(RC2D_LOG_DEBUG, "Stream audio '%s' assigné à la piste.", storage_path);
+    return true;
+}
+
 bool rc2d_track_play(MIX_Track* track, int loops)
 {
     if (!track) 
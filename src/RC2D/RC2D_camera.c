@@ -129,7 +129,7 @@ int rc2d_camera_getPermission(RC2D_Camera *camera)
     int state = SDL_GetCameraPermissionState(camera->sdl_camera);
     if (state == 0) 
     {
-        RC2D_log(RC2D_LOG_DEBUG,"rc2d_camera_get_permission : en attente de permission utilisateur");
+        RC2D_log_throttled(RC2D_LOG_DEBUG, 1000, "rc2d_camera_get_permission : en attente de permission utilisateur");
     } 
     else if (state == -1) 
     {
@@ -137,7 +137,8 @@ int rc2d_camera_getPermission(RC2D_Camera *camera)
     } 
     else 
     {
-        RC2D_log(RC2D_LOG_INFO, "rc2d_camera_get_permission : permission accordée");
+        // Souvent interrogée à chaque frame : un message par seconde au plus
+        RC2D_log_throttled(RC2D_LOG_INFO, 1000, "rc2d_camera_get_permission : permission accordée");
     }
 
     return state;
@@ -155,7 +156,7 @@ SDL_Surface *rc2d_camera_getFrame(RC2D_Camera *camera, Uint64 *timestamp_ns)
     if (!frame) 
     {
         // NULL est normal si aucune image n'est disponible
-        RC2D_log(RC2D_LOG_DEBUG,"rc2d_camera_get_frame : aucune image disponible");
+        RC2D_log_throttled(RC2D_LOG_DEBUG, 1000, "rc2d_camera_get_frame : aucune image disponible");
     }
 
     return frame;
@@ -170,7 +171,7 @@ void rc2d_camera_releaseFrame(RC2D_Camera *camera, SDL_Surface *frame)
     }
     
     SDL_ReleaseCameraFrame(camera->sdl_camera, frame);
-    RC2D_log(RC2D_LOG_DEBUG,"rc2d_camera_release_frame : image libérée");
+    RC2D_log_throttled(RC2D_LOG_DEBUG, 1000, "rc2d_camera_release_frame : image libérée");
 }
 
 bool rc2d_camera_getSpec(RC2D_Camera *camera, RC2D_CameraSpec *spec) 
@@ -19,8 +19,16 @@ bool rc2d_collision_pointInUIImagePixelPerfect(const RC2D_UIImage* ui, float x,
     if (x < r.x || y < r.y || x > r.x + r.w || y > r.y + r.h)
         return false;
 
+    // Masque 1 bit : coords logiques -> coords masque
+    if (ui->hitMask.bits)
+    {
+        const float local_x = (x - r.x) * ((float)ui->hitMask.w / r.w);
+        const float local_y = (y - r.y) * ((float)ui->hitMask.h / r.h);
+        return rc2d_graphics_hitMaskTest(&ui->hitMask, (int)local_x, (int)local_y);
+    }
+
     if (!ui->imageData.sdl_surface)
-        return true; // pas de surface CPU, pas de test pixel-perfect
+        return true; // ni masque ni surface CPU, pas de test pixel-perfect
 
     // Pixel-perfect : transformer coords logiques -> coords surface
     const float local_x = (x - r.x) * ((float)ui->imageData.sdl_surface->w / r.w);
@@ -35,7 +43,7 @@ bool rc2d_collision_pointInUIImagePixelPerfect(const RC2D_UIImage* ui, float x,
     Uint32 pixel = pixels[(int)local_y * pitch + (int)local_x];
 
     Uint8 alpha = pixel >> 24; // canal alpha
-    return (alpha > 32); // seuil arbitraire
+    return (alpha > RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD);
 }
 
 bool rc2d_collision_pointInPolygon(const RC2D_Point point, const RC2D_Polygon* polygon) 
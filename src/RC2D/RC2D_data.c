@@ -3,17 +3,31 @@
 #include <RC2D/RC2D_data.h>
 #include <RC2D/RC2D_logger.h>
 #include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_frame.h>
+#include <RC2D/RC2D_thread.h>
 
 /**
  * SDL3
  */
 #include <SDL3/SDL_stdinc.h> // Required for : SDL_malloc, SDL_free
+#include <SDL3/SDL_endian.h> // Required for : SDL_Swap32LE
+#include <SDL3/SDL_atomic.h> // Required for : SDL_AtomicInt
+#include <SDL3/SDL_iostream.h> // Required for : SDL_GetIOStatus
+#include <SDL3/SDL_cpuinfo.h> // Required for : SDL_GetNumLogicalCPUCores, SDL_HasAVX2...
+#include <SDL3/SDL_intrin.h> // Required for : SSE2, SSE4.1, AVX2, NEON
 
 /*
 Librairies pour la compression de données
 */
 #include <lz4/lz4.h>      // Required for : Algorithm LZ4
 
+/*
+Librairie pour le hachage non cryptographique
+*/
+#define XXH_STATIC_LINKING_ONLY
+#include <xxhash/xxhash.h> // Required for : Algorithm XXH64, XXH3
+
+#include <limits.h> // Required for : INT_MAX
 #include <time.h>
 #include <sys/types.h>
 
@@ -30,372 +44,984 @@ Librairies OpenSSL pour les algorithmes de chiffrement symétrique / asymétriqu
 /*
 Encrypt and Decrypt
 */
-#define SALT_SIZE 16      // Taille du sel pour le chiffrement par mot de passe (PBKDF2)
+#define SALT_SIZE RC2D_CRYPTO_SALT_SIZE // Taille du sel pour le chiffrement par mot de passe (PBKDF2)
 #define ITERATIONS 100000 // Nombre d'itérations pour le chiffrement par mot de passe (PBKDF2)
 
+/*
+Encodage Base64 / Hexadécimal
+*/
+
 /**
- * Convertit un caractère hexadécimal en sa valeur décimale.
- * 
- * @param {char} c - Le caractère hexadécimal à convertir.
- * @returns {char} La valeur décimale du caractère hexadécimal.
- * @algorithm Conversion d'un caractère hexadécimal en décimal.
+ * Table de correspondance pour l'encodage hexadécimal (majuscules).
  */
-static char hex_char_to_val(char c) 
-{
-    if (c >= '0' && c <= '9') return c - '0';
-    if (c >= 'A' && c <= 'F') return 10 + c - 'A';
-    if (c >= 'a' && c <= 'f') return 10 + c - 'a';
-
-    return 0; // Gestion simplifiée des erreurs
-}
+static const char hex_map[] = "0123456789ABCDEF";
 
 /**
- * Encode des données en utilisant l'encodage hexadécimal.
+ * Table de correspondance pour l'encodage Base64.
  *
- * @param {const unsigned char*} data - Pointeur vers les données à encoder.
- * @param {size_t} sizeData - Taille des données à encoder en octets.
- * @param {RC2D_DataType} dataType - Type des données à encoder.
- * @return {RC2D_EncodedData*} - Pointeur vers un objet RC2D_EncodedData contenant les données encodées et les métadonnées, ou NULL en cas d'échec.
+ * Cette table est utilisée pour convertir des octets en caractères Base64.
+ * Chaque caractère dans la chaîne représente une valeur de 0 à 63.
+ */
+static const char base64_map[] = {
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
+};
+
+/**
+ * Table inverse de base64_map : valeur 0-63 d'un caractère Base64, 0xFF si le caractère est invalide.
+ */
+static const Uint8 base64_reverse_map[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/**
+ * Table inverse de hex_map : valeur 0-15 d'un caractère hexadécimal (majuscule ou minuscule), 0xFF si invalide.
+ */
+static const Uint8 hex_reverse_map[256] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+/**
+ * Encode en hexadécimal, version scalaire (repli et fin des buffers vectorisés).
  *
- * @note Cette fonction alloue dynamiquement de la mémoire pour les données encodées et pour la structure RC2D_EncodedData retournée. 
- * L'appelant est responsable de libérer cette mémoire.
+ * @param {const unsigned char*} data - Données à encoder.
+ * @param {size_t} size - Nombre d'octets à encoder.
+ * @param {char*} out - Buffer de sortie, au moins size * 2 caractères.
  */
-static RC2D_EncodedData* hex_encode(const unsigned char* data, size_t sizeData, RC2D_DataType dataType) 
+static void hex_encode_scalar(const unsigned char* data, size_t size, char* out)
 {
-    if (data == NULL || sizeData == 0) 
+    for (size_t i = 0; i < size; ++i)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour l'encodage hexadécimal dans hex_encode().\n");
-        return NULL; // Invalid input
+        out[i * 2] = hex_map[data[i] >> 4];
+        out[i * 2 + 1] = hex_map[data[i] & 0xF];
     }
+}
 
-    static const char* hex_map = "0123456789ABCDEF";
-    size_t extraChar = (dataType == RC2D_DATA_TYPE_TEXT) ? 1 : 0; // +1 pour le caractère nul si c'est du texte
-
-    // Allouer de l'espace pour la chaîne hexadécimale avec ou sans caractère nul supplémentaire
-    char* hex = RC2D_malloc(sizeData * 2 + extraChar);
-    if (hex == NULL) 
+/**
+ * Décode de l'hexadécimal, version scalaire.
+ *
+ * @param {const char*} hex - Caractères à décoder, au moins size * 2.
+ * @param {size_t} size - Nombre d'octets à produire.
+ * @param {unsigned char*} out - Buffer de sortie, au moins size octets.
+ * @returns {bool} false si un caractère n'est pas hexadécimal.
+ */
+static bool hex_decode_scalar(const char* hex, size_t size, unsigned char* out)
+{
+    for (size_t i = 0; i < size; ++i)
     {
-        return NULL; // Échec de l'allocation mémoire
+        const Uint8 high = hex_reverse_map[(Uint8)hex[i * 2]];
+        const Uint8 low = hex_reverse_map[(Uint8)hex[i * 2 + 1]];
+        if ((high | low) & 0x80)
+        {
+            return false;
+        }
+        out[i] = (unsigned char)((high << 4) | low);
     }
 
-    for (size_t i = 0; i < sizeData; ++i) 
-    {
-        hex[i * 2] = hex_map[(data[i] >> 4) & 0xF];
-        hex[i * 2 + 1] = hex_map[data[i] & 0xF];
-    }
+    return true;
+}
 
-    // Ajouter un caractère nul à la fin uniquement pour les données textuelles
-    if (extraChar) 
+/**
+ * Encode en Base64 (padding compris), version scalaire.
+ *
+ * @param {const unsigned char*} data - Données à encoder.
+ * @param {size_t} size - Nombre d'octets à encoder.
+ * @param {char*} out - Buffer de sortie, au moins 4 * ((size + 2) / 3) caractères.
+ */
+static void base64_encode_scalar(const unsigned char* data, size_t size, char* out)
+{
+    size_t i = 0;
+    for (; i + 3 <= size; i += 3, out += 4)
     {
-        hex[sizeData * 2] = '\0'; // Assure la compatibilité avec les chaînes C pour les données textuelles
+        const Uint32 triple = ((Uint32)data[i] << 16) | ((Uint32)data[i + 1] << 8) | data[i + 2];
+        out[0] = base64_map[(triple >> 18) & 63];
+        out[1] = base64_map[(triple >> 12) & 63];
+        out[2] = base64_map[(triple >> 6) & 63];
+        out[3] = base64_map[triple & 63];
     }
 
-    RC2D_EncodedData* encodedData = RC2D_malloc(sizeof(RC2D_EncodedData));
-    if (encodedData == NULL) 
+    // 1 ou 2 octets restants : padding '='
+    if (i < size)
     {
-        RC2D_safe_free(hex); // Assurez-vous de libérer hex si l'allocation de encodedData échoue
-        return NULL;
+        const bool two = (i + 1 < size);
+        const Uint32 triple = ((Uint32)data[i] << 16) | (two ? (Uint32)data[i + 1] << 8 : 0);
+        out[0] = base64_map[(triple >> 18) & 63];
+        out[1] = base64_map[(triple >> 12) & 63];
+        out[2] = two ? base64_map[(triple >> 6) & 63] : '=';
+        out[3] = '=';
     }
-
-    // Set the properties of the encoded data structure
-    encodedData->data = hex;
-    encodedData->originalSize = sizeData;
-    encodedData->encodedSize = sizeData * 2;
-    encodedData->encodeFormat = RC2D_ENCODE_FORMAT_HEX;
-    encodedData->dataType = dataType;
-
-    return encodedData;
 }
 
 /**
- * Décode une chaîne hexadécimale en données binaires.
+ * Décode des quartets Base64 complets (sans padding), version scalaire.
  *
- * @param {const char*} hex - Chaîne de caractères hexadécimale à décoder.
- * @param {RC2D_DataType} dataType - Type des données attendues après décodage.
- * @return {unsigned char*} - Pointeur vers les données décodées, ou NULL en cas d'échec.
- *
- * @note Cette fonction alloue dynamiquement de la mémoire pour les données décodées. 
- * L'appelant est responsable de libérer cette mémoire.
+ * @param {const char*} cipher - Caractères à décoder, au moins quads * 4.
+ * @param {size_t} quads - Nombre de quartets à décoder.
+ * @param {unsigned char*} out - Buffer de sortie, au moins quads * 3 octets.
+ * @returns {bool} false si un caractère n'appartient pas à l'alphabet Base64.
  */
-static unsigned char* hex_decode(const char* hex, RC2D_DataType dataType) 
+static bool base64_decode_scalar(const char* cipher, size_t quads, unsigned char* out)
 {
-    if (hex == NULL) 
+    for (size_t q = 0; q < quads; ++q, cipher += 4, out += 3)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le décodage hexadécimal dans hex_decode().\n");
-        return NULL; // Invalid input
+        const Uint32 a = base64_reverse_map[(Uint8)cipher[0]];
+        const Uint32 b = base64_reverse_map[(Uint8)cipher[1]];
+        const Uint32 c = base64_reverse_map[(Uint8)cipher[2]];
+        const Uint32 d = base64_reverse_map[(Uint8)cipher[3]];
+        if ((a | b | c | d) & 0x80)
+        {
+            return false;
+        }
+
+        const Uint32 triple = (a << 18) | (b << 12) | (c << 6) | d;
+        out[0] = (unsigned char)(triple >> 16);
+        out[1] = (unsigned char)(triple >> 8);
+        out[2] = (unsigned char)triple;
     }
 
-    size_t len = SDL_strlen(hex) / 2;
+    return true;
+}
 
-    // Allouer de l'espace supplémentaire pour le caractère nul uniquement si c'est du texte
-    size_t extraChar = (dataType == RC2D_DATA_TYPE_TEXT) ? 1 : 0;
+/*
+Versions vectorisées : chacune traite autant de blocs complets que possible et retourne
+le nombre d'unités traitées, le reste étant laissé au bloc suivant (plus petit) ou au scalaire.
+Au décodage, un bloc contenant un caractère invalide arrête la boucle : le chemin scalaire
+reprend à ce bloc et rejette l'entrée, la validation est donc identique sur tous les chemins.
+*/
 
-    unsigned char* plain = RC2D_malloc(len + extraChar);
-    if (plain == NULL) 
-    {
-        return NULL; // Gestion de l'échec de l'allocation mémoire
-    }
+#ifdef SDL_SSE2_INTRINSICS
+/**
+ * Convertit 16 quartets (0-15) en caractères hexadécimaux majuscules.
+ */
+static __m128i SDL_TARGETING("sse2") hex_nibbles_to_chars_sse2(__m128i nibbles)
+{
+    const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('A' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+/**
+ * Convertit 16 caractères hexadécimaux en quartets, les caractères invalides sont signalés dans 'invalid'.
+ */
+static __m128i SDL_TARGETING("sse2") hex_chars_to_nibbles_sse2(__m128i chars, __m128i* invalid)
+{
+    const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(chars, _mm_set1_epi8('9' + 1)));
+    const __m128i lower = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    const __m128i isAlpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    const __m128i isValid = _mm_or_si128(isDigit, isAlpha);
+    *invalid = _mm_or_si128(*invalid, _mm_andnot_si128(isValid, _mm_set1_epi8(-1)));
+
+    const __m128i digit = _mm_and_si128(isDigit, _mm_sub_epi8(chars, _mm_set1_epi8('0')));
+    const __m128i alpha = _mm_and_si128(isAlpha, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10)));
+    return _mm_or_si128(digit, alpha);
+}
 
-    for (size_t i = 0; i < len; ++i) 
+/**
+ * Regroupe 16 quartets (haut, bas, haut, bas...) en 8 octets, dans les 16 bits de chaque paire.
+ */
+static __m128i SDL_TARGETING("sse2") hex_merge_pairs_sse2(__m128i nibbles)
+{
+    return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4), _mm_srli_epi16(nibbles, 8));
+}
+
+static size_t SDL_TARGETING("sse2") hex_encode_sse2(const unsigned char* data, size_t size, char* out)
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
     {
-        plain[i] = (hex_char_to_val(hex[i * 2]) << 4) + hex_char_to_val(hex[i * 2 + 1]);
+        const __m128i bytes = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i high = hex_nibbles_to_chars_sse2(_mm_and_si128(_mm_srli_epi16(bytes, 4), _mm_set1_epi8(0x0F)));
+        const __m128i low = hex_nibbles_to_chars_sse2(_mm_and_si128(bytes, _mm_set1_epi8(0x0F)));
+        _mm_storeu_si128((__m128i*)(out + i * 2), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128((__m128i*)(out + i * 2 + 16), _mm_unpackhi_epi8(high, low));
     }
 
-    // Ajouter un caractère nul à la fin uniquement pour les données de type texte
-    if (extraChar) 
+    return i;
+}
+
+static size_t SDL_TARGETING("sse2") hex_decode_sse2(const char* hex, size_t size, unsigned char* out)
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
     {
-        plain[len] = '\0';
+        __m128i invalid = _mm_setzero_si128();
+        const __m128i first = hex_chars_to_nibbles_sse2(_mm_loadu_si128((const __m128i*)(hex + i * 2)), &invalid);
+        const __m128i second = hex_chars_to_nibbles_sse2(_mm_loadu_si128((const __m128i*)(hex + i * 2 + 16)), &invalid);
+        if (_mm_movemask_epi8(invalid) != 0)
+        {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i*)(out + i), _mm_packus_epi16(hex_merge_pairs_sse2(first), hex_merge_pairs_sse2(second)));
     }
 
-    return plain;
+    return i;
 }
+#endif // SDL_SSE2_INTRINSICS
 
+#ifdef SDL_SSE4_1_INTRINSICS
 /**
- * Table de correspondance pour l'encodage Base64.
- * 
- * Cette table est utilisée pour convertir des octets en caractères Base64.
- * Chaque caractère dans la chaîne représente une valeur de 0 à 63.
+ * Convertit 16 index Base64 (0-63) en caractères, via une table de décalages indexée par pshufb.
  */
-static const char base64_map[] = {
-    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
-    'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
-    'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
-    'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'
-};
+static __m128i SDL_TARGETING("sse4.1") base64_index_to_chars_sse41(__m128i indices)
+{
+    const __m128i shiftLut = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    // 0-25 -> 13, 26-51 -> 0, 52-61 -> 1-10, 62 -> 11, 63 -> 12
+    __m128i lut = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    lut = _mm_or_si128(lut, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    return _mm_add_epi8(indices, _mm_shuffle_epi8(shiftLut, lut));
+}
 
 /**
- * Encode des données en utilisant l'encodage Base64.
- *
- * @param {const unsigned char*} data - Pointeur vers les données à encoder.
- * @param {size_t} sizeData - Taille des données à encoder en octets.
- * @param {RC2D_DataType} dataType - Type des données à encoder.
- * @return {RC2D_EncodedData*} - Pointeur vers un objet RC2D_EncodedData contenant les données encodées et les métadonnées, ou NULL en cas d'échec.
- *
- * @note Cette fonction alloue dynamiquement de la mémoire pour les données encodées et pour la structure RC2D_EncodedData retournée. 
- * L'appelant est responsable de libérer cette mémoire.
+ * Découpe 12 octets (dans les 16 chargés) en 16 index Base64 de 6 bits.
  */
-static RC2D_EncodedData* base64_encode(const unsigned char* data, size_t sizeData, RC2D_DataType dataType) 
+static __m128i SDL_TARGETING("sse4.1") base64_split_sse41(__m128i bytes)
 {
-    if (data == NULL || sizeData == 0) 
-    {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour l'encodage Base64 dans base64_encode().\n");
-        return NULL; // Invalid input
-    }
-
-    size_t output_len = 4 * ((sizeData + 2) / 3);
+    bytes = _mm_shuffle_epi8(bytes, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    const __m128i ac = _mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    const __m128i bd = _mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(ac, bd);
+}
 
-    // Adjust allocation for null-termination based on data type
-    char* cipher = RC2D_malloc(output_len + (dataType == RC2D_DATA_TYPE_TEXT ? 1 : 0)); 
-    if (cipher == NULL) 
+/**
+ * Convertit 16 caractères Base64 en index, retourne false si un caractère est hors alphabet.
+ */
+static bool SDL_TARGETING("sse4.1") base64_chars_to_index_sse41(__m128i chars, __m128i* indices)
+{
+    const __m128i lutLo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lutHi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i lutRoll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i mask2F = _mm_set1_epi8(0x2F);
+
+    const __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), mask2F);
+    const __m128i lowNibbles = _mm_and_si128(chars, mask2F);
+    if (!_mm_testz_si128(_mm_shuffle_epi8(lutLo, lowNibbles), _mm_shuffle_epi8(lutHi, highNibbles)))
     {
-        return NULL; // Memory allocation failed
+        return false;
     }
 
-    size_t i, c = 0;
-    for (i = 0; i < sizeData;) 
-    {
-        uint32_t octet_a = i < sizeData ? data[i++] : 0;
-        uint32_t octet_b = i < sizeData ? data[i++] : 0;
-        uint32_t octet_c = i < sizeData ? data[i++] : 0;
+    const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(_mm_cmpeq_epi8(chars, mask2F), highNibbles));
+    *indices = _mm_add_epi8(chars, roll);
+    return true;
+}
 
-        uint32_t triple = (octet_a << 16) + (octet_b << 8) + octet_c;
+/**
+ * Regroupe 16 index de 6 bits en 12 octets (dans les 16 bits de poids faible de chaque dword, puis compactés).
+ */
+static __m128i SDL_TARGETING("sse4.1") base64_merge_sse41(__m128i indices)
+{
+    const __m128i pairs = _mm_maddubs_epi16(indices, _mm_set1_epi32(0x01400140));
+    const __m128i triples = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(triples, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
 
-        cipher[c++] = base64_map[(triple >> 18) & 63];
-        cipher[c++] = base64_map[(triple >> 12) & 63];
-        cipher[c++] = base64_map[(triple >> 6) & 63];
-        cipher[c++] = base64_map[triple & 63];
+static size_t SDL_TARGETING("sse4.1") base64_encode_sse41(const unsigned char* data, size_t size, char* out)
+{
+    // 16 octets lus pour 12 consommés
+    size_t i = 0;
+    for (; i + 16 <= size; i += 12, out += 16)
+    {
+        const __m128i indices = base64_split_sse41(_mm_loadu_si128((const __m128i*)(data + i)));
+        _mm_storeu_si128((__m128i*)out, base64_index_to_chars_sse41(indices));
     }
 
-    // Handle padding and null-termination
-    if (sizeData % 3 > 0) 
-    { // Add padding '=' characters if needed
-        for (size_t pad = sizeData % 3; pad < 3; ++pad) 
+    return i;
+}
+
+static size_t SDL_TARGETING("sse4.1") base64_decode_sse41(const char* cipher, size_t quads, unsigned char* out)
+{
+    size_t q = 0;
+    for (; q + 4 <= quads; q += 4)
+    {
+        __m128i indices;
+        if (!base64_chars_to_index_sse41(_mm_loadu_si128((const __m128i*)(cipher + q * 4)), &indices))
         {
-            cipher[c - (3 - pad)] = '=';
+            break;
         }
-    }
-
-    if (dataType == RC2D_DATA_TYPE_TEXT) 
-    { // Add null-terminator if data is text
-        cipher[output_len] = '\0';
-    }
 
-    // Allocate memory for the encoded data structure
-    RC2D_EncodedData* encodedData = RC2D_malloc(sizeof(RC2D_EncodedData));
-    if (!encodedData) 
-    {
-        RC2D_safe_free(cipher);
-        return NULL;
+        const __m128i bytes = base64_merge_sse41(indices);
+        const int tail = _mm_extract_epi32(bytes, 2);
+        _mm_storel_epi64((__m128i*)(out + q * 3), bytes);
+        SDL_memcpy(out + q * 3 + 8, &tail, 4);
     }
 
-    // Set the properties of the encoded data structure
-    encodedData->data = cipher;
-    encodedData->originalSize = sizeData;
-    encodedData->encodedSize = output_len;
-    encodedData->encodeFormat = RC2D_ENCODE_FORMAT_BASE64;
-    encodedData->dataType = dataType;
+    return q;
+}
+#endif // SDL_SSE4_1_INTRINSICS
 
-    return encodedData;
+#ifdef SDL_AVX2_INTRINSICS
+static __m256i SDL_TARGETING("avx2") hex_nibbles_to_chars_avx2(__m256i nibbles)
+{
+    const __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)), _mm256_set1_epi8('A' - '0' - 10));
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')), letters);
 }
 
-/**
- * Décode des données encodées en Base64.
- *
- * @param {const char*} cipher - Chaîne de caractères encodée en Base64 à décoder.
- * @param {RC2D_DataType} dataType - Type des données attendues après décodage.
- * @return {unsigned char*} - Pointeur vers les données décodées, ou NULL en cas d'échec.
- *
- * @note Cette fonction alloue dynamiquement de la mémoire pour les données décodées. 
- * L'appelant est responsable de libérer cette mémoire.
- */
-static unsigned char* base64_decode(const char* cipher, RC2D_DataType dataType) 
+static __m256i SDL_TARGETING("avx2") hex_chars_to_nibbles_avx2(__m256i chars, __m256i* invalid)
 {
-    if (cipher == NULL) 
-    {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le décodage Base64 dans base64_decode().\n");
-        return NULL;
-    }
+    const __m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+    const __m256i lower = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+    const __m256i isAlpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+    const __m256i isValid = _mm256_or_si256(isDigit, isAlpha);
+    *invalid = _mm256_or_si256(*invalid, _mm256_andnot_si256(isValid, _mm256_set1_epi8(-1)));
+
+    const __m256i digit = _mm256_and_si256(isDigit, _mm256_sub_epi8(chars, _mm256_set1_epi8('0')));
+    const __m256i alpha = _mm256_and_si256(isAlpha, _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)));
+    return _mm256_or_si256(digit, alpha);
+}
 
-    // Calculer la taille des données décodées
-    size_t input_len = SDL_strlen(cipher);
-    size_t output_len = (input_len / 4) * 3;
-    if (cipher[input_len - 1] == '=') output_len--;
-    if (cipher[input_len - 2] == '=') output_len--;
+static __m256i SDL_TARGETING("avx2") hex_merge_pairs_avx2(__m256i nibbles)
+{
+    return _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(nibbles, _mm256_set1_epi16(0x00FF)), 4), _mm256_srli_epi16(nibbles, 8));
+}
 
-    // Allouer avec ou sans espace supplémentaire pour le caractère nul selon le dataType
-    unsigned char* plain = RC2D_malloc(output_len + (dataType == RC2D_DATA_TYPE_TEXT ? 1 : 0));
-    if (plain == NULL) 
+static size_t SDL_TARGETING("avx2") hex_encode_avx2(const unsigned char* data, size_t size, char* out)
+{
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
     {
-        return NULL;
+        const __m256i bytes = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i high = hex_nibbles_to_chars_avx2(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), _mm256_set1_epi8(0x0F)));
+        const __m256i low = hex_nibbles_to_chars_avx2(_mm256_and_si256(bytes, _mm256_set1_epi8(0x0F)));
+
+        // unpack travaille par voie de 128 bits : remettre les moitiés dans l'ordre
+        const __m256i lo = _mm256_unpacklo_epi8(high, low);
+        const __m256i hi = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256((__m256i*)(out + i * 2), _mm256_permute2x128_si256(lo, hi, 0x20));
+        _mm256_storeu_si256((__m256i*)(out + i * 2 + 32), _mm256_permute2x128_si256(lo, hi, 0x31));
     }
 
-    int i, p = 0;
-    for (i = 0; i < input_len; i += 4) 
+    return i;
+}
+
+static size_t SDL_TARGETING("avx2") hex_decode_avx2(const char* hex, size_t size, unsigned char* out)
+{
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
     {
-        // Trouver les positions des caractères dans base64_map
-        int b[4];
-        for (int j = 0; j < 4; j++) {
-            b[j] = (cipher[i+j] == '=') ? 0 : (SDL_strchr(base64_map, cipher[i+j]) - base64_map);
+        __m256i invalid = _mm256_setzero_si256();
+        const __m256i first = hex_chars_to_nibbles_avx2(_mm256_loadu_si256((const __m256i*)(hex + i * 2)), &invalid);
+        const __m256i second = hex_chars_to_nibbles_avx2(_mm256_loadu_si256((const __m256i*)(hex + i * 2 + 32)), &invalid);
+        if (_mm256_movemask_epi8(invalid) != 0)
+        {
+            break;
         }
 
-        // Convertir les 4 octets de base64 en 3 octets normaux
-        plain[p++] = ((b[0] << 2) | (b[1] >> 4));
-        if (cipher[i + 2] != '=') plain[p++] = ((b[1] & 0xF) << 4) | (b[2] >> 2);
-        if (cipher[i + 3] != '=') plain[p++] = ((b[2] & 0x3) << 6) | b[3];
+        const __m256i packed = _mm256_packus_epi16(hex_merge_pairs_avx2(first), hex_merge_pairs_avx2(second));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_permute4x64_epi64(packed, 0xD8));
     }
 
-    // Ajouter un caractère nul uniquement si les données sont de type texte
-    if (dataType == RC2D_DATA_TYPE_TEXT) 
+    return i;
+}
+
+static size_t SDL_TARGETING("avx2") base64_encode_avx2(const unsigned char* data, size_t size, char* out)
+{
+    const __m256i splitShuffle = _mm256_broadcastsi128_si256(_mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    const __m256i shiftLut = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0));
+
+    // 12 octets par voie de 128 bits : 28 octets lus pour 24 consommés
+    size_t i = 0;
+    for (; i + 28 <= size; i += 24, out += 32)
     {
-        plain[output_len] = '\0';
+        __m256i bytes = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(data + i))),
+                                                _mm_loadu_si128((const __m128i*)(data + i + 12)), 1);
+        bytes = _mm256_shuffle_epi8(bytes, splitShuffle);
+        const __m256i ac = _mm256_mulhi_epu16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+        const __m256i bd = _mm256_mullo_epi16(_mm256_and_si256(bytes, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+        const __m256i indices = _mm256_or_si256(ac, bd);
+
+        __m256i lut = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        lut = _mm256_or_si256(lut, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256((__m256i*)out, _mm256_add_epi8(indices, _mm256_shuffle_epi8(shiftLut, lut)));
     }
 
-    return plain;
+    return i;
 }
 
-RC2D_EncodedData* rc2d_data_encode(const unsigned char* data, size_t dataSize, RC2D_DataType dataType, RC2D_EncodeFormat format) {
-    if (data == NULL || dataSize == 0) 
+static size_t SDL_TARGETING("avx2") base64_decode_avx2(const char* cipher, size_t quads, unsigned char* out)
+{
+    const __m256i lutLo = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A));
+    const __m256i lutHi = _mm256_broadcastsi128_si256(_mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10));
+    const __m256i lutRoll = _mm256_broadcastsi128_si256(_mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0));
+    const __m256i packShuffle = _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    const __m256i mask2F = _mm256_set1_epi8(0x2F);
+
+    size_t q = 0;
+    for (; q + 8 <= quads; q += 8)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour l'encodage dans rc2d_data_encode().\n");
-        return NULL; // Invalid input
+        const __m256i chars = _mm256_loadu_si256((const __m256i*)(cipher + q * 4));
+        const __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), mask2F);
+        const __m256i lowNibbles = _mm256_and_si256(chars, mask2F);
+        if (!_mm256_testz_si256(_mm256_shuffle_epi8(lutLo, lowNibbles), _mm256_shuffle_epi8(lutHi, highNibbles)))
+        {
+            break;
+        }
+
+        const __m256i roll = _mm256_shuffle_epi8(lutRoll, _mm256_add_epi8(_mm256_cmpeq_epi8(chars, mask2F), highNibbles));
+        const __m256i indices = _mm256_add_epi8(chars, roll);
+        const __m256i pairs = _mm256_maddubs_epi16(indices, _mm256_set1_epi32(0x01400140));
+        const __m256i triples = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+
+        // 12 octets utiles par voie, regroupés en 24 octets contigus
+        const __m256i bytes = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(triples, packShuffle), _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+        _mm_storeu_si128((__m128i*)(out + q * 3), _mm256_castsi256_si128(bytes));
+        _mm_storel_epi64((__m128i*)(out + q * 3 + 16), _mm256_extracti128_si256(bytes, 1));
     }
-    
-    // Allocation de mémoire pour la structure RC2D_EncodedData
-    RC2D_EncodedData* encodedData = (RC2D_EncodedData*)RC2D_malloc(sizeof(RC2D_EncodedData));
-    if (!encodedData) 
+
+    return q;
+}
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+/**
+ * Retourne true si tous les octets du vecteur valent 0xFF.
+ */
+static bool neon_all_set(uint8x16_t mask)
+{
+    const uint64x2_t lanes = vreinterpretq_u64_u8(mask);
+    return (vgetq_lane_u64(lanes, 0) & vgetq_lane_u64(lanes, 1)) == ~(Uint64)0;
+}
+
+static uint8x16_t hex_nibbles_to_chars_neon(uint8x16_t nibbles)
+{
+    const uint8x16_t letters = vandq_u8(vcgtq_u8(nibbles, vdupq_n_u8(9)), vdupq_n_u8('A' - '0' - 10));
+    return vaddq_u8(vaddq_u8(nibbles, vdupq_n_u8('0')), letters);
+}
+
+static uint8x16_t hex_chars_to_nibbles_neon(uint8x16_t chars, uint8x16_t* valid)
+{
+    const uint8x16_t digit = vsubq_u8(chars, vdupq_n_u8('0'));
+    const uint8x16_t isDigit = vcltq_u8(digit, vdupq_n_u8(10));
+    const uint8x16_t alpha = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    const uint8x16_t isAlpha = vcltq_u8(alpha, vdupq_n_u8(6));
+    *valid = vandq_u8(*valid, vorrq_u8(isDigit, isAlpha));
+    return vbslq_u8(isDigit, digit, vaddq_u8(alpha, vdupq_n_u8(10)));
+}
+
+static uint8x16_t base64_index_to_chars_neon(uint8x16_t indices)
+{
+    uint8x16_t chars = vaddq_u8(indices, vdupq_n_u8('A'));
+    chars = vbslq_u8(vcgtq_u8(indices, vdupq_n_u8(25)), vaddq_u8(indices, vdupq_n_u8('a' - 26)), chars);
+    chars = vbslq_u8(vcgtq_u8(indices, vdupq_n_u8(51)), vsubq_u8(indices, vdupq_n_u8(52 - '0')), chars);
+    chars = vbslq_u8(vceqq_u8(indices, vdupq_n_u8(62)), vdupq_n_u8('+'), chars);
+    return vbslq_u8(vceqq_u8(indices, vdupq_n_u8(63)), vdupq_n_u8('/'), chars);
+}
+
+static uint8x16_t base64_chars_to_index_neon(uint8x16_t chars, uint8x16_t* valid)
+{
+    const uint8x16_t upper = vsubq_u8(chars, vdupq_n_u8('A'));
+    const uint8x16_t lower = vsubq_u8(chars, vdupq_n_u8('a'));
+    const uint8x16_t digit = vsubq_u8(chars, vdupq_n_u8('0'));
+    const uint8x16_t isUpper = vcltq_u8(upper, vdupq_n_u8(26));
+    const uint8x16_t isLower = vcltq_u8(lower, vdupq_n_u8(26));
+    const uint8x16_t isDigit = vcltq_u8(digit, vdupq_n_u8(10));
+    const uint8x16_t isPlus = vceqq_u8(chars, vdupq_n_u8('+'));
+    const uint8x16_t isSlash = vceqq_u8(chars, vdupq_n_u8('/'));
+    *valid = vandq_u8(*valid, vorrq_u8(vorrq_u8(vorrq_u8(isUpper, isLower), vorrq_u8(isDigit, isPlus)), isSlash));
+
+    uint8x16_t indices = vandq_u8(isUpper, upper);
+    indices = vbslq_u8(isLower, vaddq_u8(lower, vdupq_n_u8(26)), indices);
+    indices = vbslq_u8(isDigit, vaddq_u8(digit, vdupq_n_u8(52)), indices);
+    indices = vbslq_u8(isPlus, vdupq_n_u8(62), indices);
+    return vbslq_u8(isSlash, vdupq_n_u8(63), indices);
+}
+
+static size_t hex_encode_neon(const unsigned char* data, size_t size, char* out)
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
     {
-        return NULL; // Memory allocation failed
+        const uint8x16_t bytes = vld1q_u8(data + i);
+        uint8x16x2_t chars;
+        chars.val[0] = hex_nibbles_to_chars_neon(vshrq_n_u8(bytes, 4));
+        chars.val[1] = hex_nibbles_to_chars_neon(vandq_u8(bytes, vdupq_n_u8(0x0F)));
+        vst2q_u8((uint8_t*)out + i * 2, chars);
     }
 
-    // Encodage des données en utilisant le format spécifié
-    switch (format) 
+    return i;
+}
+
+static size_t hex_decode_neon(const char* hex, size_t size, unsigned char* out)
+{
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16)
     {
-        case RC2D_ENCODE_FORMAT_BASE64:
-            encodedData = base64_encode(data, dataSize, dataType);
-            break;
-        case RC2D_ENCODE_FORMAT_HEX:
-            encodedData = hex_encode(data, dataSize, dataType);
+        const uint8x16x2_t chars = vld2q_u8((const uint8_t*)hex + i * 2);
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        const uint8x16_t high = hex_chars_to_nibbles_neon(chars.val[0], &valid);
+        const uint8x16_t low = hex_chars_to_nibbles_neon(chars.val[1], &valid);
+        if (!neon_all_set(valid))
+        {
             break;
-        default:
-            RC2D_safe_free(encodedData);
-            RC2D_safe_free(encodedData->data);
-            RC2D_log(RC2D_LOG_ERROR, "Format d'encodage non supporté dans rc2d_data_encode().\n");
-            return NULL; // Unsupported format
-    }
+        }
 
-    // Vérifier si l'encodage a échoué
-    if (!encodedData || !encodedData->data) 
-    {
-        RC2D_safe_free(encodedData);
-        RC2D_safe_free(encodedData->data);
-        return NULL; // Encoding failed
+        vst1q_u8(out + i, vorrq_u8(vshlq_n_u8(high, 4), low));
     }
 
-    // Additional properties are already set by the specific encoding functions
-    return encodedData;
+    return i;
 }
 
-unsigned char* rc2d_data_decode(const RC2D_EncodedData* encodedData) 
+static size_t base64_encode_neon(const unsigned char* data, size_t size, char* out)
 {
-    if (!encodedData || !encodedData->data) 
+    size_t i = 0;
+    for (; i + 48 <= size; i += 48, out += 64)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le décodage dans rc2d_data_decode().\n");
-        return NULL; // Invalid data
+        const uint8x16x3_t bytes = vld3q_u8(data + i);
+        uint8x16x4_t chars;
+        chars.val[0] = vshrq_n_u8(bytes.val[0], 2);
+        chars.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(bytes.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(bytes.val[1], 4));
+        chars.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(bytes.val[1], vdupq_n_u8(0x0F)), 2), vshrq_n_u8(bytes.val[2], 6));
+        chars.val[3] = vandq_u8(bytes.val[2], vdupq_n_u8(0x3F));
+        for (int k = 0; k < 4; k++)
+        {
+            chars.val[k] = base64_index_to_chars_neon(chars.val[k]);
+        }
+        vst4q_u8((uint8_t*)out, chars);
     }
 
-    unsigned char* decodedData = NULL;
-    switch (encodedData->encodeFormat) 
+    return i;
+}
+
+static size_t base64_decode_neon(const char* cipher, size_t quads, unsigned char* out)
+{
+    size_t q = 0;
+    for (; q + 16 <= quads; q += 16)
     {
-        case RC2D_ENCODE_FORMAT_BASE64:
-            decodedData = base64_decode(encodedData->data, encodedData->dataType);
-            break;
-        case RC2D_ENCODE_FORMAT_HEX:
-            decodedData = hex_decode(encodedData->data, encodedData->dataType);
+        const uint8x16x4_t chars = vld4q_u8((const uint8_t*)cipher + q * 4);
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+        uint8x16_t indices[4];
+        for (int k = 0; k < 4; k++)
+        {
+            indices[k] = base64_chars_to_index_neon(chars.val[k], &valid);
+        }
+        if (!neon_all_set(valid))
+        {
             break;
-        default:
-            return NULL; // Unsupported format
+        }
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(indices[0], 2), vshrq_n_u8(indices[1], 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(indices[1], 4), vshrq_n_u8(indices[2], 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(indices[2], 6), indices[3]);
+        vst3q_u8(out + q * 3, bytes);
     }
 
-    // The caller is responsible for freeing the memory allocated for the decoded data
-    return decodedData;
+    return q;
 }
+#endif // SDL_NEON_INTRINSICS
 
 /**
- * Compresse des données en utilisant l'algorithme de compression LZ4.
+ * Encode en hexadécimal avec le chemin le plus large disponible, puis le scalaire pour la fin.
  *
- * @param {const unsigned char*} data - Pointeur vers les données en clair à compresser.
- * @param {size_t} dataSize - Taille des données en clair en octets.
- * @param {RC2D_CompressFormat} format - Format de compression utilisé, défini par l'énumération RC2D_CompressFormat.
- * @param {RC2D_DataType} dataType - Type de données fournies, influençant potentiellement l'optimisation de la compression.
- * @return {RC2D_CompressedData*} - Pointeur vers un nouvel objet RC2D_CompressedData contenant les données compressées et les métadonnées, ou NULL en cas d'échec de la compression ou de problèmes d'allocation mémoire.
+ * @param {const unsigned char*} data - Données à encoder.
+ * @param {size_t} size - Nombre d'octets à encoder.
+ * @param {char*} out - Buffer de sortie, au moins size * 2 caractères.
+ */
+static void hex_encode_to(const unsigned char* data, size_t size, char* out)
+{
+    size_t done = 0;
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) done = hex_encode_avx2(data, size, out);
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) done += hex_encode_sse2(data + done, size - done, out + done * 2);
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) done = hex_encode_neon(data, size, out);
+#endif
+    hex_encode_scalar(data + done, size - done, out + done * 2);
+}
+
+/**
+ * Décode de l'hexadécimal avec le chemin le plus large disponible, puis le scalaire pour la fin.
  *
- * Cette fonction calcule la taille maximale des données compressées, alloue dynamiquement de la mémoire pour le résultat de la compression, puis effectue la compression. En cas de succès, elle retourne un objet RC2D_CompressedData contenant les données compressées ainsi que des informations supplémentaires telles que la taille originale et compressée des données, le format de compression et le type de données.
+ * @param {const char*} hex - Caractères à décoder, au moins size * 2.
+ * @param {size_t} size - Nombre d'octets à produire.
+ * @param {unsigned char*} out - Buffer de sortie, au moins size octets.
+ * @returns {bool} false si un caractère n'est pas hexadécimal.
+ */
+static bool hex_decode_to(const char* hex, size_t size, unsigned char* out)
+{
+    size_t done = 0;
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) done = hex_decode_avx2(hex, size, out);
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) done += hex_decode_sse2(hex + done * 2, size - done, out + done);
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) done = hex_decode_neon(hex, size, out);
+#endif
+    return hex_decode_scalar(hex + done * 2, size - done, out + done);
+}
+
+/**
+ * Encode en Base64 avec le chemin le plus large disponible, puis le scalaire pour la fin et le padding.
  *
- * @note L'objet RC2D_CompressedData retourné doit être libéré par l'appelant pour éviter les fuites de mémoire.
- * @warning La fonction vérifie la capacité d'allouer suffisamment de mémoire pour les données compressées et la structure RC2D_CompressedData. Elle retourne NULL en cas d'allocation mémoire échouée.
+ * @param {const unsigned char*} data - Données à encoder.
+ * @param {size_t} size - Nombre d'octets à encoder.
+ * @param {char*} out - Buffer de sortie, au moins 4 * ((size + 2) / 3) caractères.
  */
-static RC2D_CompressedData* compress_lz4(const unsigned char* data, size_t dataSize, RC2D_CompressFormat format, RC2D_DataType dataType) 
+static void base64_encode_to(const unsigned char* data, size_t size, char* out)
 {
-    if (!data || dataSize == 0) 
+    size_t done = 0;
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) done = base64_encode_avx2(data, size, out);
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) done += base64_encode_sse41(data + done, size - done, out + done / 3 * 4);
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) done = base64_encode_neon(data, size, out);
+#endif
+    base64_encode_scalar(data + done, size - done, out + done / 3 * 4);
+}
+
+/**
+ * Décode du Base64 (avec padding) avec le chemin le plus large disponible.
+ *
+ * @param {const char*} cipher - Caractères à décoder.
+ * @param {size_t} size - Nombre de caractères, multiple de 4.
+ * @param {unsigned char*} out - Buffer de sortie.
+ * @param {size_t} outSize - Taille du buffer de sortie.
+ * @param {size_t*} written - [out] Nombre d'octets décodés.
+ * @returns {bool} false si l'entrée est invalide ou le buffer trop petit.
+ */
+static bool base64_decode_to(const char* cipher, size_t size, unsigned char* out, size_t outSize, size_t* written)
+{
+    if (size % 4 != 0)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la compression dans compress_lz4().\n");
-        return NULL; // Invalid input
+        RC2D_log(RC2D_LOG_ERROR, "Longueur Base64 invalide (%zu, multiple de 4 attendu) dans base64_decode_to().\n", size);
+        return false;
     }
 
-    // Calcul de la taille maximale des données compressées
-    int maxCompressedSize = LZ4_compressBound(dataSize);
-
-    // Allocation de mémoire pour les données compressées
-    unsigned char* compressedBuffer = (unsigned char*)RC2D_malloc(maxCompressedSize);
-    if (!compressedBuffer) 
+    *written = 0;
+    if (size == 0)
     {
-        // Échec de l'allocation mémoire
-        return NULL;
+        return true;
     }
 
-    // Compression des données
-    int compressedDataSize = LZ4_compress_default((const char*)data, (char*)compressedBuffer, dataSize, maxCompressedSize);
-    if (compressedDataSize <= 0) 
+    // Le dernier quartet peut contenir du padding : il est toujours décodé séparément
+    const char* last = cipher + size - 4;
+    const size_t padding = (last[3] == '=') ? ((last[2] == '=') ? 2 : 1) : 0;
+    const size_t quads = size / 4 - 1;
+    const size_t decodedSize = quads * 3 + 3 - padding;
+    if (outSize < decodedSize)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Buffer trop petit pour le décodage Base64 (%zu < %zu) dans base64_decode_to().\n", outSize, decodedSize);
+        return false;
+    }
+
+    size_t done = 0;
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) done = base64_decode_avx2(cipher, quads, out);
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) done += base64_decode_sse41(cipher + done * 4, quads - done, out + done * 3);
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) done = base64_decode_neon(cipher, quads, out);
+#endif
+
+    const char tail[4] = { last[0], last[1], padding == 2 ? 'A' : last[2], padding >= 1 ? 'A' : last[3] };
+    unsigned char bytes[3];
+    if (!base64_decode_scalar(cipher + done * 4, quads - done, out + done * 3) ||
+        !base64_decode_scalar(tail, 1, bytes))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Caractère Base64 invalide dans base64_decode_to().\n");
+        return false;
+    }
+    SDL_memcpy(out + quads * 3, bytes, 3 - padding);
+
+    *written = decodedSize;
+    return true;
+}
+
+size_t rc2d_data_getEncodedSize(size_t dataSize, const RC2D_EncodeFormat format)
+{
+    switch (format)
+    {
+        case RC2D_ENCODE_FORMAT_BASE64:
+            return 4 * ((dataSize + 2) / 3);
+        case RC2D_ENCODE_FORMAT_HEX:
+            return dataSize * 2;
+        default:
+            return 0;
+    }
+}
+
+size_t rc2d_data_getDecodedMaxSize(size_t encodedSize, const RC2D_EncodeFormat format)
+{
+    switch (format)
+    {
+        case RC2D_ENCODE_FORMAT_BASE64:
+            return (encodedSize / 4) * 3;
+        case RC2D_ENCODE_FORMAT_HEX:
+            return encodedSize / 2;
+        default:
+            return 0;
+    }
+}
+
+bool rc2d_data_encodeTo(const unsigned char* data, size_t dataSize, const RC2D_EncodeFormat format, char* out, size_t outSize, size_t* out_written)
+{
+    if (out_written != NULL) *out_written = 0;
+
+    if ((data == NULL && dataSize > 0) || (out == NULL && outSize > 0))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Paramètres invalides dans rc2d_data_encodeTo().\n");
+        return false;
+    }
+
+    if (format != RC2D_ENCODE_FORMAT_BASE64 && format != RC2D_ENCODE_FORMAT_HEX)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Format d'encodage non supporté dans rc2d_data_encodeTo().\n");
+        return false;
+    }
+
+    const size_t encodedSize = rc2d_data_getEncodedSize(dataSize, format);
+    if (outSize < encodedSize)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Buffer trop petit pour l'encodage (%zu < %zu) dans rc2d_data_encodeTo().\n", outSize, encodedSize);
+        return false;
+    }
+
+    if (format == RC2D_ENCODE_FORMAT_BASE64)
+    {
+        base64_encode_to(data, dataSize, out);
+    }
+    else
+    {
+        hex_encode_to(data, dataSize, out);
+    }
+
+    if (out_written != NULL) *out_written = encodedSize;
+    return true;
+}
+
+bool rc2d_data_decodeTo(const char* encoded, size_t encodedSize, const RC2D_EncodeFormat format, unsigned char* out, size_t outSize, size_t* out_written)
+{
+    if (out_written != NULL) *out_written = 0;
+
+    if ((encoded == NULL && encodedSize > 0) || (out == NULL && outSize > 0))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Paramètres invalides dans rc2d_data_decodeTo().\n");
+        return false;
+    }
+
+    size_t written = 0;
+    switch (format)
+    {
+        case RC2D_ENCODE_FORMAT_BASE64:
+            if (!base64_decode_to(encoded, encodedSize, out, outSize, &written))
+            {
+                return false;
+            }
+            break;
+        case RC2D_ENCODE_FORMAT_HEX:
+            written = encodedSize / 2;
+            if (encodedSize % 2 != 0 || outSize < written)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "Longueur hexadécimale impaire ou buffer trop petit dans rc2d_data_decodeTo().\n");
+                return false;
+            }
+            if (!hex_decode_to(encoded, written, out))
+            {
+                RC2D_log(RC2D_LOG_ERROR, "Caractère hexadécimal invalide dans rc2d_data_decodeTo().\n");
+                return false;
+            }
+            break;
+        default:
+            RC2D_log(RC2D_LOG_ERROR, "Format d'encodage non supporté dans rc2d_data_decodeTo().\n");
+            return false;
+    }
+
+    if (out_written != NULL) *out_written = written;
+    return true;
+}
+
+RC2D_EncodedData* rc2d_data_encode(const unsigned char* data, size_t dataSize, RC2D_DataType dataType, RC2D_EncodeFormat format) {
+    if (data == NULL || dataSize == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour l'encodage dans rc2d_data_encode().\n");
+        return NULL; // Invalid input
+    }
+
+    const size_t encodedSize = rc2d_data_getEncodedSize(dataSize, format);
+    if (encodedSize == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Format d'encodage non supporté dans rc2d_data_encode().\n");
+        return NULL; // Unsupported format
+    }
+
+    // +1 pour le caractère nul si c'est du texte
+    const size_t extraChar = (dataType == RC2D_DATA_TYPE_TEXT) ? 1 : 0;
+    char* encoded = RC2D_malloc(encodedSize + extraChar);
+    RC2D_EncodedData* encodedData = RC2D_malloc(sizeof(RC2D_EncodedData));
+    if (encoded == NULL || encodedData == NULL)
+    {
+        RC2D_safe_free(encoded);
+        RC2D_safe_free(encodedData);
+        return NULL; // Memory allocation failed
+    }
+
+    rc2d_data_encodeTo(data, dataSize, format, encoded, encodedSize, NULL);
+    if (extraChar)
+    {
+        encoded[encodedSize] = '\0'; // Assure la compatibilité avec les chaînes C pour les données textuelles
+    }
+
+    encodedData->data = encoded;
+    encodedData->originalSize = dataSize;
+    encodedData->encodedSize = encodedSize;
+    encodedData->encodeFormat = format;
+    encodedData->dataType = dataType;
+
+    return encodedData;
+}
+
+char* rc2d_data_encodeFrame(const unsigned char* data, size_t dataSize, const RC2D_EncodeFormat format, size_t* out_length)
+{
+    if (data == NULL || dataSize == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour l'encodage dans rc2d_data_encodeFrame().\n");
+        return NULL;
+    }
+
+    const size_t encodedSize = rc2d_data_getEncodedSize(dataSize, format);
+    if (encodedSize == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Format d'encodage non supporté dans rc2d_data_encodeFrame().\n");
+        return NULL;
+    }
+
+    char* encoded = (char*)rc2d_frame_alloc(encodedSize + 1, 1);
+    if (encoded == NULL)
+    {
+        return NULL;
+    }
+
+    rc2d_data_encodeTo(data, dataSize, format, encoded, encodedSize, NULL);
+    encoded[encodedSize] = '\0';
+
+    if (out_length != NULL)
+    {
+        *out_length = encodedSize;
+    }
+    return encoded;
+}
+
+unsigned char* rc2d_data_decode(const RC2D_EncodedData* encodedData)
+{
+    if (!encodedData || !encodedData->data)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le décodage dans rc2d_data_decode().\n");
+        return NULL; // Invalid data
+    }
+
+    // Allouer de l'espace supplémentaire pour le caractère nul uniquement si c'est du texte
+    const size_t extraChar = (encodedData->dataType == RC2D_DATA_TYPE_TEXT) ? 1 : 0;
+    const size_t maxSize = rc2d_data_getDecodedMaxSize(encodedData->encodedSize, encodedData->encodeFormat);
+    unsigned char* decodedData = RC2D_malloc(maxSize + extraChar);
+    if (decodedData == NULL)
+    {
+        return NULL;
+    }
+
+    size_t written = 0;
+    if (!rc2d_data_decodeTo(encodedData->data, encodedData->encodedSize, encodedData->encodeFormat, decodedData, maxSize, &written))
+    {
+        RC2D_safe_free(decodedData);
+        return NULL;
+    }
+
+    if (extraChar)
+    {
+        decodedData[written] = '\0';
+    }
+
+    // The caller is responsible for freeing the memory allocated for the decoded data
+    return decodedData;
+}
+
+/**
+ * Compresse des données en utilisant l'algorithme de compression LZ4.
+ *
+ * @param {const unsigned char*} data - Pointeur vers les données en clair à compresser.
+ * @param {size_t} dataSize - Taille des données en clair en octets.
+ * @param {RC2D_CompressFormat} format - Format de compression utilisé, défini par l'énumération RC2D_CompressFormat.
+ * @param {RC2D_DataType} dataType - Type de données fournies, influençant potentiellement l'optimisation de la compression.
+ * @return {RC2D_CompressedData*} - Pointeur vers un nouvel objet RC2D_CompressedData contenant les données compressées et les métadonnées, ou NULL en cas d'échec de la compression ou de problèmes d'allocation mémoire.
+ *
+ * Cette fonction calcule la taille maximale des données compressées, alloue dynamiquement de la mémoire pour le résultat de la compression, puis effectue la compression. En cas de succès, elle retourne un objet RC2D_CompressedData contenant les données compressées ainsi que des informations supplémentaires telles que la taille originale et compressée des données, le format de compression et le type de données.
+ *
+ * @note L'objet RC2D_CompressedData retourné doit être libéré par l'appelant pour éviter les fuites de mémoire.
+ * @warning La fonction vérifie la capacité d'allouer suffisamment de mémoire pour les données compressées et la structure RC2D_CompressedData. Elle retourne NULL en cas d'allocation mémoire échouée.
+ */
+static RC2D_CompressedData* compress_lz4(const unsigned char* data, size_t dataSize, RC2D_CompressFormat format, RC2D_DataType dataType) 
+{
+    if (!data || dataSize == 0) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la compression dans compress_lz4().\n");
+        return NULL; // Invalid input
+    }
+
+    // Un bloc LZ4 est limité à LZ4_MAX_INPUT_SIZE (~2 Go) : au-delà, les tailles en int débordent
+    if (dataSize > LZ4_MAX_INPUT_SIZE)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "compress_lz4(): %zu octets dépassent la limite d'un bloc LZ4, utilisez RC2D_COMPRESS_FORMAT_LZ4_STREAM.\n", dataSize);
+        return NULL;
+    }
+
+    // Calcul de la taille maximale des données compressées
+    int maxCompressedSize = LZ4_compressBound((int)dataSize);
+
+    // Allocation de mémoire pour les données compressées
+    unsigned char* compressedBuffer = (unsigned char*)RC2D_malloc(maxCompressedSize);
+    if (!compressedBuffer) 
+    {
+        // Échec de l'allocation mémoire
+        return NULL;
+    }
+
+    // Compression des données
+    int compressedDataSize = LZ4_compress_default((const char*)data, (char*)compressedBuffer, (int)dataSize, maxCompressedSize);
+    if (compressedDataSize <= 0) 
     {
         // Échec de la compression
         RC2D_safe_free(compressedBuffer);
@@ -440,6 +1066,12 @@ static unsigned char* decompress_lz4(const RC2D_CompressedData* compressedData)
         return NULL;
     }
 
+    if (compressedData->originalSize > LZ4_MAX_INPUT_SIZE || compressedData->compressedSize > (size_t)LZ4_COMPRESSBOUND(LZ4_MAX_INPUT_SIZE))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Tailles invalides pour un bloc LZ4 dans decompress_lz4().\n");
+        return NULL;
+    }
+
     // Détermine si un espace supplémentaire est nécessaire pour le caractère nul dans le cas des données textuelles
     size_t extraSpace = compressedData->dataType == RC2D_DATA_TYPE_TEXT ? 1 : 0;
 
@@ -453,8 +1085,8 @@ static unsigned char* decompress_lz4(const RC2D_CompressedData* compressedData)
     }
 
     // Décompression des données
-    int decompressedSize = LZ4_decompress_safe((const char*)compressedData->data, (char*)decompressedData, compressedData->compressedSize, compressedData->originalSize);
-    if (decompressedSize < 0) 
+    int decompressedSize = LZ4_decompress_safe((const char*)compressedData->data, (char*)decompressedData, (int)compressedData->compressedSize, (int)compressedData->originalSize);
+    if (decompressedSize != (int)compressedData->originalSize) 
     {
         // Échec de la décompression
         RC2D_safe_free(decompressedData);
@@ -470,65 +1102,1209 @@ static unsigned char* decompress_lz4(const RC2D_CompressedData* compressedData)
     return decompressedData;
 }
 
-RC2D_CompressedData* rc2d_data_compress(const unsigned char* data, const size_t dataSize, const RC2D_DataType dataType, const RC2D_CompressFormat format)
+/**
+ * Paramètres du compresseur LZ4 HC (chaînes de hachage), cf. format de bloc LZ4.
+ * Les blocs produits sont des blocs LZ4 standards : decompress_lz4() les décode sans changement.
+ */
+#define LZ4HC_MIN_MATCH 4          // Longueur minimale d'une correspondance
+#define LZ4HC_LAST_LITERALS 5      // Les 5 derniers octets sont toujours des littéraux
+#define LZ4HC_MF_LIMIT 12          // La dernière correspondance commence au plus 12 octets avant la fin
+#define LZ4HC_MAX_DISTANCE 65535   // Fenêtre maximale d'un offset LZ4
+#define LZ4HC_HASH_LOG 15
+#define LZ4HC_CHAIN_SIZE 65536     // Chaîne indexée par position & 0xFFFF (deltas sur 16 bits)
+
+/**
+ * Taille des blocs du format RC2D_COMPRESS_FORMAT_LZ4_STREAM (chaînés, 64 Ko d'historique).
+ */
+#define LZ4_STREAM_BLOCK_SIZE (4 * 1024 * 1024)
+
+/**
+ * Dictionnaire LZ4 préparé une fois et partagé (en lecture seule) par les compressions.
+ */
+struct RC2D_CompressDictionary {
+    char* data;            // Copie des 64 derniers Ko du dictionnaire (référencée par stream)
+    int size;
+    LZ4_stream_t* stream;  // Dictionnaire indexé par LZ4_loadDictSlow, attaché à chaque compression
+};
+
+/**
+ * Tables de recherche du compresseur HC, allouées par l'appelant (une par thread).
+ */
+typedef struct LZ4HC_Workspace {
+    Sint32 head[1 << LZ4HC_HASH_LOG];   // Dernière position de chaque hash, -1 si aucune
+    Uint16 chain[LZ4HC_CHAIN_SIZE];     // Distance vers l'occurrence précédente du même hash
+} LZ4HC_Workspace;
+
+static Uint32 lz4hc_read32(const Uint8* p)
 {
-    if (data == NULL || dataSize == 0) 
+    Uint32 value;
+    SDL_memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static Uint32 lz4hc_hash(Uint32 sequence)
+{
+    return (sequence * 2654435761u) >> (32 - LZ4HC_HASH_LOG);
+}
+
+/**
+ * Écrit une séquence LZ4 : littéraux [anchor, anchor + literalLength[ puis une correspondance.
+ * 
+ * @param {Uint8**} op - Position d'écriture, avancée après la séquence.
+ * @param {const Uint8*} oend - Fin du buffer de sortie.
+ * @param {int} matchLength - Longueur de la correspondance, 0 pour les littéraux de fin (sans offset).
+ * @return {bool} - false si la sortie est trop petite.
+ */
+static bool lz4hc_write_sequence(Uint8** op, const Uint8* oend, const Uint8* anchor, int literalLength, int offset, int matchLength)
+{
+    const size_t needed = 1 + (size_t)literalLength / 255 + 1 + (size_t)literalLength + 2 + (size_t)matchLength / 255 + 1;
+    if ((size_t)(oend - *op) < needed) return false;
+
+    Uint8* token = (*op)++;
+    if (literalLength >= 15)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la compression dans rc2d_data_compress().\n");
-        return NULL; // Données invalides
+        *token = 15 << 4;
+        int length = literalLength - 15;
+        for (; length >= 255; length -= 255) *(*op)++ = 255;
+        *(*op)++ = (Uint8)length;
+    }
+    else
+    {
+        *token = (Uint8)(literalLength << 4);
     }
 
-    switch (format) 
+    SDL_memcpy(*op, anchor, (size_t)literalLength);
+    *op += literalLength;
+
+    // Littéraux de fin de bloc : ni offset ni correspondance
+    if (matchLength == 0) return true;
+
+    *(*op)++ = (Uint8)(offset & 0xFF);
+    *(*op)++ = (Uint8)(offset >> 8);
+
+    int length = matchLength - LZ4HC_MIN_MATCH;
+    if (length >= 15)
     {
-        case RC2D_COMPRESS_FORMAT_LZ4:
-            return compress_lz4(data, dataSize, format, dataType);
-        default:
-            return NULL; // Format non supporté
+        *token |= 15;
+        length -= 15;
+        for (; length >= 255; length -= 255) *(*op)++ = 255;
+        *(*op)++ = (Uint8)length;
+    }
+    else
+    {
+        *token |= (Uint8)length;
     }
+
+    return true;
 }
 
-unsigned char* rc2d_data_decompress(const RC2D_CompressedData* compressedData)
+/**
+ * Compresse un bloc au format LZ4 en cherchant, pour chaque position, la plus longue correspondance
+ * parmi les 2^(level-1) dernières occurrences de la même séquence (équivalent de LZ4 HC, lz4hc.c
+ * n'étant pas embarqué). Plus lent que LZ4_compress_default, meilleur ratio, même décompression.
+ * 
+ * @param {const Uint8*} src - Données à compresser.
+ * @param {int} srcSize - Taille des données (au plus LZ4_MAX_INPUT_SIZE).
+ * @param {Uint8*} dst - Buffer de sortie.
+ * @param {int} dstCapacity - Taille du buffer de sortie (LZ4_compressBound(srcSize) suffit toujours).
+ * @param {int} level - Niveau entre RC2D_COMPRESS_LEVEL_HC_MIN et RC2D_COMPRESS_LEVEL_HC_MAX.
+ * @param {LZ4HC_Workspace*} workspace - Tables de recherche, réinitialisées par la fonction (aucune allocation).
+ * @return {int} - Taille compressée, ou 0 en cas d'échec.
+ */
+static int lz4hc_compress_block(const Uint8* src, int srcSize, Uint8* dst, int dstCapacity, int level, LZ4HC_Workspace* workspace)
 {
-    if (compressedData == NULL || compressedData->data == NULL) 
+    Sint32* head = workspace->head;
+    Uint16* chain = workspace->chain;
+    SDL_memset(head, 0xFF, sizeof(workspace->head));
+
+    const int maxAttempts = 1 << (level - 1);
+    const int matchLimit = srcSize - LZ4HC_LAST_LITERALS;
+    const int mfLimit = srcSize - LZ4HC_MF_LIMIT;
+
+    Uint8* op = dst;
+    const Uint8* oend = dst + dstCapacity;
+    int anchor = 0;
+    int ip = 0;
+    int nextToUpdate = 0;
+    bool ok = true;
+
+    while (ok && ip <= mfLimit)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la décompression dans rc2d_data_decompress().\n");
-        return NULL; // Données invalides
+        // Indexe les positions sautées (dans les correspondances précédentes) jusqu'à ip exclu
+        for (; nextToUpdate < ip; nextToUpdate++)
+        {
+            const Uint32 h = lz4hc_hash(lz4hc_read32(src + nextToUpdate));
+            const int delta = (head[h] < 0) ? 0 : nextToUpdate - head[h];
+            chain[nextToUpdate & (LZ4HC_CHAIN_SIZE - 1)] = (Uint16)((delta > LZ4HC_MAX_DISTANCE) ? 0 : delta);
+            head[h] = nextToUpdate;
+        }
+
+        // Parcourt la chaîne des occurrences précédentes de la séquence de 4 octets en ip
+        const Uint32 sequence = lz4hc_read32(src + ip);
+        int candidate = head[lz4hc_hash(sequence)];
+        int bestLength = 0;
+        int bestOffset = 0;
+        for (int attempts = maxAttempts; candidate >= 0 && ip - candidate <= LZ4HC_MAX_DISTANCE && attempts > 0; attempts--)
+        {
+            if (lz4hc_read32(src + candidate) == sequence)
+            {
+                int length = LZ4HC_MIN_MATCH;
+                while (ip + length < matchLimit && src[candidate + length] == src[ip + length]) length++;
+                if (length > bestLength)
+                {
+                    bestLength = length;
+                    bestOffset = ip - candidate;
+                }
+            }
+
+            const int delta = chain[candidate & (LZ4HC_CHAIN_SIZE - 1)];
+            if (delta == 0) break;
+            candidate -= delta;
+        }
+
+        if (bestLength < LZ4HC_MIN_MATCH)
+        {
+            ip++;
+            continue;
+        }
+
+        ok = lz4hc_write_sequence(&op, oend, src + anchor, ip - anchor, bestOffset, bestLength);
+        ip += bestLength;
+        anchor = ip;
     }
 
-    switch (compressedData->compressFormat) 
+    // Littéraux restants
+    ok = ok && lz4hc_write_sequence(&op, oend, src + anchor, srcSize - anchor, 0, 0);
+
+    return ok ? (int)(op - dst) : 0;
+}
+
+/**
+ * Construit l'objet RC2D_CompressedData, ou libère le buffer en cas d'échec d'allocation.
+ */
+static RC2D_CompressedData* make_compressed_data(unsigned char* buffer, size_t compressedSize, size_t dataSize, RC2D_CompressFormat format, RC2D_DataType dataType)
+{
+    RC2D_CompressedData* compressedData = (RC2D_CompressedData*)RC2D_malloc(sizeof(RC2D_CompressedData));
+    if (!compressedData) 
+    {
+        RC2D_safe_free(buffer);
+        return NULL;
+    }
+
+    compressedData->data = buffer;
+    compressedData->originalSize = dataSize;
+    compressedData->compressedSize = compressedSize;
+    compressedData->compressFormat = format;
+    compressedData->dataType = dataType;
+    return compressedData;
+}
+
+/**
+ * Alloue le buffer de sortie d'une décompression (+1 octet nul pour le texte).
+ */
+static unsigned char* alloc_decompressed(const RC2D_CompressedData* compressedData)
+{
+    const size_t extraSpace = compressedData->dataType == RC2D_DATA_TYPE_TEXT ? 1 : 0;
+    unsigned char* decompressedData = (unsigned char*)RC2D_malloc(compressedData->originalSize + extraSpace);
+    if (decompressedData && extraSpace) decompressedData[compressedData->originalSize] = '\0';
+    return decompressedData;
+}
+
+/**
+ * Compresse des données avec le compresseur LZ4 HC (voir lz4hc_compress_block).
+ * 
+ * @param {int} level - Niveau de compression HC, RC2D_COMPRESS_LEVEL_DEFAULT pour RC2D_COMPRESS_LEVEL_HC_DEFAULT.
+ * @return {RC2D_CompressedData*} - Données compressées, décodables par decompress_lz4(), ou NULL en cas d'échec.
+ */
+static RC2D_CompressedData* compress_lz4hc(const unsigned char* data, size_t dataSize, int level, RC2D_DataType dataType)
+{
+    if (dataSize > LZ4_MAX_INPUT_SIZE)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "compress_lz4hc(): %zu octets dépassent la limite d'un bloc LZ4, utilisez RC2D_COMPRESS_FORMAT_LZ4_STREAM.\n", dataSize);
+        return NULL;
+    }
+
+    if (level == RC2D_COMPRESS_LEVEL_DEFAULT) level = RC2D_COMPRESS_LEVEL_HC_DEFAULT;
+    level = SDL_clamp(level, RC2D_COMPRESS_LEVEL_HC_MIN, RC2D_COMPRESS_LEVEL_HC_MAX);
+
+    const int maxCompressedSize = LZ4_compressBound((int)dataSize);
+    unsigned char* compressedBuffer = (unsigned char*)RC2D_malloc(maxCompressedSize);
+    LZ4HC_Workspace* workspace = (LZ4HC_Workspace*)RC2D_malloc(sizeof(LZ4HC_Workspace));
+    if (!compressedBuffer || !workspace) 
+    {
+        RC2D_safe_free(compressedBuffer);
+        RC2D_safe_free(workspace);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire pour les données compressées dans compress_lz4hc().\n");
+        return NULL;
+    }
+
+    const int compressedDataSize = lz4hc_compress_block(data, (int)dataSize, compressedBuffer, maxCompressedSize, level, workspace);
+    RC2D_free(workspace);
+    if (compressedDataSize <= 0) 
+    {
+        RC2D_safe_free(compressedBuffer);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la compression LZ4 HC dans compress_lz4hc().\n");
+        return NULL;
+    }
+
+    return make_compressed_data(compressedBuffer, (size_t)compressedDataSize, dataSize, RC2D_COMPRESS_FORMAT_LZ4_HC, dataType);
+}
+
+/**
+ * Compresse des données de taille quelconque (au-delà de 2 Go) en blocs LZ4 chaînés de LZ4_STREAM_BLOCK_SIZE.
+ * Chaque bloc est précédé de sa taille compressée (Uint32 little-endian) et référence les 64 Ko qui le précèdent.
+ * 
+ * @return {RC2D_CompressedData*} - Données compressées, ou NULL en cas d'échec.
+ */
+static RC2D_CompressedData* compress_lz4_stream(const unsigned char* data, size_t dataSize, RC2D_DataType dataType)
+{
+    const size_t blockCount = (dataSize + LZ4_STREAM_BLOCK_SIZE - 1) / LZ4_STREAM_BLOCK_SIZE;
+    const size_t blockBound = (size_t)LZ4_COMPRESSBOUND(LZ4_STREAM_BLOCK_SIZE);
+    unsigned char* compressedBuffer = (unsigned char*)RC2D_malloc(blockCount * (sizeof(Uint32) + blockBound));
+    LZ4_stream_t* stream = LZ4_createStream();
+    if (!compressedBuffer || !stream)
+    {
+        RC2D_safe_free(compressedBuffer);
+        if (stream) LZ4_freeStream(stream);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans compress_lz4_stream().\n");
+        return NULL;
+    }
+
+    size_t outPos = 0;
+    for (size_t inPos = 0; inPos < dataSize; inPos += LZ4_STREAM_BLOCK_SIZE)
+    {
+        // L'entrée est contiguë : le bloc précédent reste en place et sert d'historique
+        const int blockSize = (int)SDL_min((size_t)LZ4_STREAM_BLOCK_SIZE, dataSize - inPos);
+        const int written = LZ4_compress_fast_continue(stream, (const char*)data + inPos, (char*)compressedBuffer + outPos + sizeof(Uint32), blockSize, (int)blockBound, 1);
+        if (written <= 0)
+        {
+            LZ4_freeStream(stream);
+            RC2D_safe_free(compressedBuffer);
+            RC2D_log(RC2D_LOG_ERROR, "Échec de la compression LZ4 dans compress_lz4_stream().\n");
+            return NULL;
+        }
+
+        const Uint32 blockHeader = SDL_Swap32LE((Uint32)written);
+        SDL_memcpy(compressedBuffer + outPos, &blockHeader, sizeof(blockHeader));
+        outPos += sizeof(Uint32) + (size_t)written;
+    }
+
+    LZ4_freeStream(stream);
+    return make_compressed_data(compressedBuffer, outPos, dataSize, RC2D_COMPRESS_FORMAT_LZ4_STREAM, dataType);
+}
+
+/**
+ * Décompresse des données produites par compress_lz4_stream().
+ * 
+ * @return {unsigned char*} - Données décompressées, ou NULL si un bloc est invalide ou tronqué.
+ */
+static unsigned char* decompress_lz4_stream(const RC2D_CompressedData* compressedData)
+{
+    unsigned char* decompressedData = alloc_decompressed(compressedData);
+    LZ4_streamDecode_t* stream = LZ4_createStreamDecode();
+    if (!decompressedData || !stream)
+    {
+        RC2D_safe_free(decompressedData);
+        if (stream) LZ4_freeStreamDecode(stream);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans decompress_lz4_stream().\n");
+        return NULL;
+    }
+
+    size_t inPos = 0;
+    size_t outPos = 0;
+    bool ok = true;
+    while (ok && outPos < compressedData->originalSize)
+    {
+        Uint32 blockHeader = 0;
+        ok = compressedData->compressedSize - inPos >= sizeof(Uint32);
+        if (ok) SDL_memcpy(&blockHeader, compressedData->data + inPos, sizeof(Uint32));
+
+        const size_t blockCompressed = SDL_Swap32LE(blockHeader);
+        const int blockSize = (int)SDL_min((size_t)LZ4_STREAM_BLOCK_SIZE, compressedData->originalSize - outPos);
+        inPos += sizeof(Uint32);
+        ok = ok && blockCompressed <= compressedData->compressedSize - inPos &&
+             LZ4_decompress_safe_continue(stream, (const char*)compressedData->data + inPos, (char*)decompressedData + outPos, (int)blockCompressed, blockSize) == blockSize;
+
+        inPos += blockCompressed;
+        outPos += (size_t)blockSize;
+    }
+
+    LZ4_freeStreamDecode(stream);
+    if (!ok)
+    {
+        RC2D_safe_free(decompressedData);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la décompression LZ4 dans decompress_lz4_stream().\n");
+        return NULL;
+    }
+
+    return decompressedData;
+}
+
+/**
+ * Compresse des données en s'appuyant sur un dictionnaire préparé (petits payloads similaires).
+ * 
+ * @return {RC2D_CompressedData*} - Données compressées, à décompresser avec le même dictionnaire, ou NULL en cas d'échec.
+ */
+static RC2D_CompressedData* compress_lz4_dict(const unsigned char* data, size_t dataSize, const RC2D_CompressDictionary* dictionary, RC2D_DataType dataType)
+{
+    if (dataSize > LZ4_MAX_INPUT_SIZE)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "compress_lz4_dict(): %zu octets dépassent la limite d'un bloc LZ4.\n", dataSize);
+        return NULL;
+    }
+
+    const int maxCompressedSize = LZ4_compressBound((int)dataSize);
+    unsigned char* compressedBuffer = (unsigned char*)RC2D_malloc(maxCompressedSize);
+    LZ4_stream_t* stream = LZ4_createStream();
+    if (!compressedBuffer || !stream)
+    {
+        RC2D_safe_free(compressedBuffer);
+        if (stream) LZ4_freeStream(stream);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans compress_lz4_dict().\n");
+        return NULL;
+    }
+
+    // Le dictionnaire est déjà indexé : on l'attache au lieu de le recharger à chaque payload
+    LZ4_attach_dictionary(stream, dictionary->stream);
+    const int compressedDataSize = LZ4_compress_fast_continue(stream, (const char*)data, (char*)compressedBuffer, (int)dataSize, maxCompressedSize, 1);
+    LZ4_freeStream(stream);
+
+    if (compressedDataSize <= 0)
+    {
+        RC2D_safe_free(compressedBuffer);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la compression LZ4 dans compress_lz4_dict().\n");
+        return NULL;
+    }
+
+    return make_compressed_data(compressedBuffer, (size_t)compressedDataSize, dataSize, RC2D_COMPRESS_FORMAT_LZ4_DICT, dataType);
+}
+
+/**
+ * Décompresse des données produites par compress_lz4_dict() avec le même dictionnaire.
+ */
+static unsigned char* decompress_lz4_dict(const RC2D_CompressedData* compressedData, const RC2D_CompressDictionary* dictionary)
+{
+    if (compressedData->originalSize > LZ4_MAX_INPUT_SIZE || compressedData->compressedSize > (size_t)LZ4_COMPRESSBOUND(LZ4_MAX_INPUT_SIZE))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Tailles invalides dans decompress_lz4_dict().\n");
+        return NULL;
+    }
+
+    unsigned char* decompressedData = alloc_decompressed(compressedData);
+    if (!decompressedData)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans decompress_lz4_dict().\n");
+        return NULL;
+    }
+
+    const int decompressedSize = LZ4_decompress_safe_usingDict((const char*)compressedData->data, (char*)decompressedData,
+                                                               (int)compressedData->compressedSize, (int)compressedData->originalSize,
+                                                               dictionary->data, dictionary->size);
+    if (decompressedSize != (int)compressedData->originalSize)
+    {
+        RC2D_safe_free(decompressedData);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la décompression LZ4 dans decompress_lz4_dict().\n");
+        return NULL;
+    }
+
+    return decompressedData;
+}
+
+/**
+ * Format RC2D_COMPRESS_FORMAT_LZ4_BLOCKS :
+ * [Uint32 blockSize][Uint32 blockCount][blockCount x Uint32 taille compressée][blocs...]
+ * Les blocs sont indépendants (aucun historique partagé) et compressés en parallèle.
+ * Un bloc incompressible est stocké tel quel, signalé par LZ4_BLOCKS_RAW_FLAG dans sa taille.
+ */
+#define LZ4_BLOCKS_DEFAULT_SIZE (1024 * 1024)
+#define LZ4_BLOCKS_MIN_SIZE (64 * 1024)
+#define LZ4_BLOCKS_MAX_SIZE (64 * 1024 * 1024)
+#define LZ4_BLOCKS_HEADER_SIZE (2 * sizeof(Uint32))
+#define LZ4_BLOCKS_RAW_FLAG 0x80000000u
+#define LZ4_BLOCKS_MAX_THREADS 64
+
+static void write_le32(unsigned char* dst, Uint32 value)
+{
+    value = SDL_Swap32LE(value);
+    SDL_memcpy(dst, &value, sizeof(value));
+}
+
+static Uint32 read_le32(const unsigned char* src)
+{
+    Uint32 value;
+    SDL_memcpy(&value, src, sizeof(value));
+    return SDL_Swap32LE(value);
+}
+
+/**
+ * Lot de blocs partagé entre les threads : chaque thread prend le prochain bloc libre.
+ * Tous les buffers sont alloués en amont : aucune allocation par bloc dans la boucle des threads.
+ */
+typedef struct LZ4_BlocksBatch {
+    const unsigned char* src;       // Compression : données en clair / Décompression : blocs compressés
+    unsigned char* dst;             // Compression : slots de taille blockBound / Décompression : données en clair
+    Uint32* table;                  // Taille compressée de chaque bloc (+ LZ4_BLOCKS_RAW_FLAG)
+    const size_t* offsets;          // Décompression : offset de chaque bloc dans src
+    size_t size;                    // Taille des données en clair
+    size_t blockSize;
+    size_t blockBound;
+    Uint32 blockCount;
+    int level;                      // RC2D_COMPRESS_LEVEL_DEFAULT : LZ4 rapide, sinon LZ4 HC
+    SDL_AtomicInt next;
+    SDL_AtomicInt failed;
+} LZ4_BlocksBatch;
+
+/**
+ * Contexte d'un thread : le lot partagé et ses tables HC.
+ */
+typedef struct LZ4_BlocksWorker {
+    LZ4_BlocksBatch* batch;
+    LZ4HC_Workspace* workspace;
+} LZ4_BlocksWorker;
+
+static int lz4_blocks_compress_worker(void* data)
+{
+    LZ4_BlocksWorker* worker = (LZ4_BlocksWorker*)data;
+    LZ4_BlocksBatch* batch = worker->batch;
+
+    for (;;)
+    {
+        const int index = SDL_AddAtomicInt(&batch->next, 1);
+        if (index < 0 || (Uint32)index >= batch->blockCount) break;
+
+        const size_t inPos = (size_t)index * batch->blockSize;
+        const int blockSize = (int)SDL_min(batch->blockSize, batch->size - inPos);
+        const char* src = (const char*)batch->src + inPos;
+        char* dst = (char*)batch->dst + (size_t)index * batch->blockBound;
+
+        const int written = batch->level == RC2D_COMPRESS_LEVEL_DEFAULT
+            ? LZ4_compress_default(src, dst, blockSize, (int)batch->blockBound)
+            : lz4hc_compress_block((const Uint8*)src, blockSize, (Uint8*)dst, (int)batch->blockBound, batch->level, worker->workspace);
+
+        if (written <= 0)
+        {
+            SDL_AddAtomicInt(&batch->failed, 1);
+        }
+        else if (written >= blockSize)
+        {
+            // Incompressible : le slot (blockBound >= blockSize) reçoit le bloc brut
+            SDL_memcpy(dst, src, (size_t)blockSize);
+            batch->table[index] = (Uint32)blockSize | LZ4_BLOCKS_RAW_FLAG;
+        }
+        else
+        {
+            batch->table[index] = (Uint32)written;
+        }
+    }
+
+    return 0;
+}
+
+static int lz4_blocks_decompress_worker(void* data)
+{
+    LZ4_BlocksWorker* worker = (LZ4_BlocksWorker*)data;
+    LZ4_BlocksBatch* batch = worker->batch;
+
+    for (;;)
+    {
+        const int index = SDL_AddAtomicInt(&batch->next, 1);
+        if (index < 0 || (Uint32)index >= batch->blockCount) break;
+
+        const size_t outPos = (size_t)index * batch->blockSize;
+        const int blockSize = (int)SDL_min(batch->blockSize, batch->size - outPos);
+        const Uint32 entry = batch->table[index];
+        const int storedSize = (int)(entry & ~LZ4_BLOCKS_RAW_FLAG);
+        const char* src = (const char*)batch->src + batch->offsets[index];
+        char* dst = (char*)batch->dst + outPos;
+
+        if (entry & LZ4_BLOCKS_RAW_FLAG)
+        {
+            if (storedSize == blockSize) SDL_memcpy(dst, src, (size_t)blockSize);
+            else SDL_AddAtomicInt(&batch->failed, 1);
+        }
+        else if (LZ4_decompress_safe(src, dst, storedSize, blockSize) != blockSize)
+        {
+            SDL_AddAtomicInt(&batch->failed, 1);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Exécute un lot sur threadCount threads (le thread appelant inclus).
+ * 
+ * @param {LZ4HC_Workspace*} workspaces - Une table HC par thread, ou NULL si le lot n'utilise pas HC.
+ * @return {bool} - true si tous les blocs ont été traités sans erreur.
+ */
+static bool lz4_blocks_run(LZ4_BlocksBatch* batch, RC2D_ThreadFunction fn, int threadCount, LZ4HC_Workspace* workspaces)
+{
+    SDL_SetAtomicInt(&batch->next, 0);
+    SDL_SetAtomicInt(&batch->failed, 0);
+
+    LZ4_BlocksWorker workers[LZ4_BLOCKS_MAX_THREADS];
+    RC2D_Thread* threads[LZ4_BLOCKS_MAX_THREADS] = { 0 };
+    for (int i = 0; i < threadCount; i++)
+    {
+        workers[i].batch = batch;
+        workers[i].workspace = workspaces ? &workspaces[i] : NULL;
+    }
+
+    // Le thread appelant participe : threadCount - 1 threads supplémentaires
+    for (int i = 1; i < threadCount; i++)
+    {
+        threads[i] = rc2d_thread_new(fn, "rc2d_data_blocks", &workers[i]);
+        if (threads[i] == NULL)
+        {
+            // Pas bloquant : les threads déjà lancés et l'appelant traitent le reste du lot
+            RC2D_log(RC2D_LOG_WARN, "lz4_blocks_run(): échec de création de thread, %d threads utilisés.\n", i);
+            break;
+        }
+    }
+
+    fn(&workers[0]);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        if (threads[i] != NULL) rc2d_thread_wait(threads[i], NULL);
+    }
+
+    return SDL_GetAtomicInt(&batch->failed) == 0;
+}
+
+/**
+ * Nombre de threads à utiliser : un par coeur logique par défaut, jamais plus que de blocs.
+ */
+static int lz4_blocks_thread_count(const RC2D_CompressOptions* options, Uint32 blockCount)
+{
+    int threadCount = options ? options->threadCount : 0;
+    if (threadCount <= 0) threadCount = SDL_GetNumLogicalCPUCores();
+    return SDL_clamp(threadCount, 1, (int)SDL_min(blockCount, (Uint32)LZ4_BLOCKS_MAX_THREADS));
+}
+
+/**
+ * Compresse des données en blocs indépendants, en parallèle. La sortie ne dépend que des données,
+ * de la taille de bloc et du niveau : elle est identique quel que soit le nombre de threads.
+ * 
+ * @return {RC2D_CompressedData*} - Données compressées, ou NULL en cas d'échec.
+ */
+static RC2D_CompressedData* compress_lz4_blocks(const unsigned char* data, size_t dataSize, const RC2D_CompressOptions* options, RC2D_DataType dataType)
+{
+    size_t blockSize = (options && options->blockSize) ? options->blockSize : LZ4_BLOCKS_DEFAULT_SIZE;
+    blockSize = SDL_clamp(blockSize, (size_t)LZ4_BLOCKS_MIN_SIZE, (size_t)LZ4_BLOCKS_MAX_SIZE);
+
+    const size_t blockCount = (dataSize + blockSize - 1) / blockSize;
+    if (blockCount > SDL_MAX_UINT32)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "compress_lz4_blocks(): trop de blocs, augmentez RC2D_CompressOptions::blockSize.\n");
+        return NULL;
+    }
+
+    int level = options ? options->level : RC2D_COMPRESS_LEVEL_DEFAULT;
+    if (level != RC2D_COMPRESS_LEVEL_DEFAULT) level = SDL_clamp(level, RC2D_COMPRESS_LEVEL_HC_MIN, RC2D_COMPRESS_LEVEL_HC_MAX);
+
+    const int threadCount = lz4_blocks_thread_count(options, (Uint32)blockCount);
+    const size_t blockBound = (size_t)LZ4_COMPRESSBOUND((int)blockSize);
+    const size_t tableSize = blockCount * sizeof(Uint32);
+
+    // Chaque bloc est compressé dans son propre slot, puis les slots sont compactés dans l'ordre
+    unsigned char* buffer = (unsigned char*)RC2D_malloc(LZ4_BLOCKS_HEADER_SIZE + tableSize + blockCount * blockBound);
+    Uint32* table = (Uint32*)RC2D_malloc(tableSize);
+    LZ4HC_Workspace* workspaces = level != RC2D_COMPRESS_LEVEL_DEFAULT ? (LZ4HC_Workspace*)RC2D_malloc(sizeof(LZ4HC_Workspace) * threadCount) : NULL;
+    if (!buffer || !table || (level != RC2D_COMPRESS_LEVEL_DEFAULT && !workspaces))
+    {
+        RC2D_safe_free(buffer);
+        RC2D_safe_free(table);
+        RC2D_safe_free(workspaces);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans compress_lz4_blocks().\n");
+        return NULL;
+    }
+
+    unsigned char* blocks = buffer + LZ4_BLOCKS_HEADER_SIZE + tableSize;
+    LZ4_BlocksBatch batch;
+    batch.src = data;
+    batch.dst = blocks;
+    batch.table = table;
+    batch.offsets = NULL;
+    batch.size = dataSize;
+    batch.blockSize = blockSize;
+    batch.blockBound = blockBound;
+    batch.blockCount = (Uint32)blockCount;
+    batch.level = level;
+
+    const bool ok = lz4_blocks_run(&batch, lz4_blocks_compress_worker, threadCount, workspaces);
+    RC2D_safe_free(workspaces);
+    if (!ok)
+    {
+        RC2D_safe_free(buffer);
+        RC2D_safe_free(table);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la compression LZ4 dans compress_lz4_blocks().\n");
+        return NULL;
+    }
+
+    // Compactage : la destination précède toujours la source, memmove dans l'ordre des blocs
+    write_le32(buffer, (Uint32)blockSize);
+    write_le32(buffer + sizeof(Uint32), (Uint32)blockCount);
+    size_t outPos = 0;
+    for (size_t i = 0; i < blockCount; i++)
+    {
+        const size_t storedSize = table[i] & ~LZ4_BLOCKS_RAW_FLAG;
+        write_le32(buffer + LZ4_BLOCKS_HEADER_SIZE + i * sizeof(Uint32), table[i]);
+        SDL_memmove(blocks + outPos, blocks + i * blockBound, storedSize);
+        outPos += storedSize;
+    }
+    RC2D_free(table);
+
+    const size_t compressedSize = LZ4_BLOCKS_HEADER_SIZE + tableSize + outPos;
+    unsigned char* shrunk = (unsigned char*)RC2D_realloc(buffer, compressedSize);
+    return make_compressed_data(shrunk ? shrunk : buffer, compressedSize, dataSize, RC2D_COMPRESS_FORMAT_LZ4_BLOCKS, dataType);
+}
+
+/**
+ * Décompresse des données produites par compress_lz4_blocks(), en parallèle.
+ * 
+ * @return {unsigned char*} - Données décompressées, ou NULL si l'en-tête, la table ou un bloc est invalide.
+ */
+static unsigned char* decompress_lz4_blocks(const RC2D_CompressedData* compressedData, const RC2D_CompressOptions* options)
+{
+    const size_t compressedSize = compressedData->compressedSize;
+    const size_t originalSize = compressedData->originalSize;
+    if (compressedSize < LZ4_BLOCKS_HEADER_SIZE)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "En-tête tronqué dans decompress_lz4_blocks().\n");
+        return NULL;
+    }
+
+    const size_t blockSize = read_le32(compressedData->data);
+    const size_t blockCount = read_le32(compressedData->data + sizeof(Uint32));
+    if (blockSize < LZ4_BLOCKS_MIN_SIZE || blockSize > LZ4_BLOCKS_MAX_SIZE ||
+        blockCount != (originalSize + blockSize - 1) / blockSize ||
+        blockCount > (compressedSize - LZ4_BLOCKS_HEADER_SIZE) / sizeof(Uint32))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "En-tête invalide dans decompress_lz4_blocks().\n");
+        return NULL;
+    }
+
+    unsigned char* decompressedData = alloc_decompressed(compressedData);
+    Uint32* table = (Uint32*)RC2D_malloc(blockCount * sizeof(Uint32) + 1);
+    size_t* offsets = (size_t*)RC2D_malloc(blockCount * sizeof(size_t) + 1);
+    if (!decompressedData || !table || !offsets)
+    {
+        RC2D_safe_free(decompressedData);
+        RC2D_safe_free(table);
+        RC2D_safe_free(offsets);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans decompress_lz4_blocks().\n");
+        return NULL;
+    }
+
+    // Offsets de chaque bloc par somme préfixe, bornés par la taille des données compressées
+    const size_t dataStart = LZ4_BLOCKS_HEADER_SIZE + blockCount * sizeof(Uint32);
+    size_t inPos = dataStart;
+    bool valid = true;
+    for (size_t i = 0; valid && i < blockCount; i++)
+    {
+        table[i] = read_le32(compressedData->data + LZ4_BLOCKS_HEADER_SIZE + i * sizeof(Uint32));
+        const size_t storedSize = table[i] & ~LZ4_BLOCKS_RAW_FLAG;
+        offsets[i] = inPos - dataStart;
+        valid = storedSize <= compressedSize - inPos;
+        inPos += storedSize;
+    }
+
+    bool ok = valid;
+    if (ok)
+    {
+        LZ4_BlocksBatch batch;
+        batch.src = compressedData->data + dataStart;
+        batch.dst = decompressedData;
+        batch.table = table;
+        batch.offsets = offsets;
+        batch.size = originalSize;
+        batch.blockSize = blockSize;
+        batch.blockBound = 0;
+        batch.blockCount = (Uint32)blockCount;
+        batch.level = RC2D_COMPRESS_LEVEL_DEFAULT;
+        ok = lz4_blocks_run(&batch, lz4_blocks_decompress_worker, lz4_blocks_thread_count(options, (Uint32)blockCount), NULL);
+    }
+
+    RC2D_free(table);
+    RC2D_free(offsets);
+    if (!ok)
+    {
+        RC2D_safe_free(decompressedData);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la décompression LZ4 dans decompress_lz4_blocks().\n");
+        return NULL;
+    }
+
+    return decompressedData;
+}
+
+RC2D_CompressDictionary* rc2d_data_createCompressDictionary(const void* data, size_t dataSize)
+{
+    if (data == NULL || dataSize == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides dans rc2d_data_createCompressDictionary().\n");
+        return NULL;
+    }
+
+    // LZ4 n'utilise que les 64 derniers Ko du dictionnaire
+    const size_t keep = SDL_min(dataSize, (size_t)LZ4HC_MAX_DISTANCE + 1);
+    RC2D_CompressDictionary* dictionary = (RC2D_CompressDictionary*)RC2D_calloc(1, sizeof(RC2D_CompressDictionary));
+    if (dictionary)
+    {
+        dictionary->data = (char*)RC2D_malloc(keep);
+        dictionary->stream = LZ4_createStream();
+    }
+    if (!dictionary || !dictionary->data || !dictionary->stream)
+    {
+        rc2d_data_destroyCompressDictionary(dictionary);
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans rc2d_data_createCompressDictionary().\n");
+        return NULL;
+    }
+
+    SDL_memcpy(dictionary->data, (const char*)data + (dataSize - keep), keep);
+    dictionary->size = (int)keep;
+    LZ4_loadDictSlow(dictionary->stream, dictionary->data, dictionary->size);
+    return dictionary;
+}
+
+void rc2d_data_destroyCompressDictionary(RC2D_CompressDictionary* dictionary)
+{
+    if (dictionary == NULL) return;
+
+    if (dictionary->stream) LZ4_freeStream(dictionary->stream);
+    RC2D_safe_free(dictionary->data);
+    RC2D_free(dictionary);
+}
+
+RC2D_CompressedData* rc2d_data_compress(const unsigned char* data, const size_t dataSize, const RC2D_DataType dataType, const RC2D_CompressFormat format)
+{
+    return rc2d_data_compressWithOptions(data, dataSize, dataType, format, NULL);
+}
+
+RC2D_CompressedData* rc2d_data_compressWithOptions(const unsigned char* data, const size_t dataSize, const RC2D_DataType dataType, const RC2D_CompressFormat format, const RC2D_CompressOptions* options)
+{
+    if (data == NULL || dataSize == 0) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la compression dans rc2d_data_compress().\n");
+        return NULL; // Données invalides
+    }
+
+    switch (format) 
+    {
+        case RC2D_COMPRESS_FORMAT_LZ4:
+            return compress_lz4(data, dataSize, format, dataType);
+        case RC2D_COMPRESS_FORMAT_LZ4_HC:
+            return compress_lz4hc(data, dataSize, options ? options->level : RC2D_COMPRESS_LEVEL_DEFAULT, dataType);
+        case RC2D_COMPRESS_FORMAT_LZ4_STREAM:
+            return compress_lz4_stream(data, dataSize, dataType);
+        case RC2D_COMPRESS_FORMAT_LZ4_BLOCKS:
+            return compress_lz4_blocks(data, dataSize, options, dataType);
+        case RC2D_COMPRESS_FORMAT_LZ4_DICT:
+            if (options == NULL || options->dictionary == NULL)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "RC2D_COMPRESS_FORMAT_LZ4_DICT nécessite un dictionnaire dans rc2d_data_compressWithOptions().\n");
+                return NULL;
+            }
+            return compress_lz4_dict(data, dataSize, options->dictionary, dataType);
+        default:
+            return NULL; // Format non supporté
+    }
+}
+
+unsigned char* rc2d_data_decompress(const RC2D_CompressedData* compressedData)
+{
+    return rc2d_data_decompressWithOptions(compressedData, NULL);
+}
+
+unsigned char* rc2d_data_decompressWithOptions(const RC2D_CompressedData* compressedData, const RC2D_CompressOptions* options)
+{
+    if (compressedData == NULL || compressedData->data == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la décompression dans rc2d_data_decompress().\n");
+        return NULL; // Données invalides
+    }
+
+    switch (compressedData->compressFormat) 
+    {
+        case RC2D_COMPRESS_FORMAT_LZ4:
+        case RC2D_COMPRESS_FORMAT_LZ4_HC:
+            // LZ4 HC produit des blocs LZ4 standards
+            return decompress_lz4(compressedData);
+        case RC2D_COMPRESS_FORMAT_LZ4_STREAM:
+            return decompress_lz4_stream(compressedData);
+        case RC2D_COMPRESS_FORMAT_LZ4_BLOCKS:
+            return decompress_lz4_blocks(compressedData, options);
+        case RC2D_COMPRESS_FORMAT_LZ4_DICT:
+            if (options == NULL || options->dictionary == NULL)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "RC2D_COMPRESS_FORMAT_LZ4_DICT nécessite un dictionnaire dans rc2d_data_decompressWithOptions().\n");
+                return NULL;
+            }
+            return decompress_lz4_dict(compressedData, options->dictionary);
+        default:
+            return NULL; // Format non supporté
+    }
+}
+
+/**
+ * Convertit un tableau d'octets en une chaîne hexadécimale.
+ * 
+ * @param {unsigned char*} hash - Le tableau d'octets à convertir.
+ * @param {size_t} size - La taille du tableau d'octets.
+ * @returns {char*} La chaîne hexadécimale résultante.
+ * @algorithm Conversion en hexadécimal pour l'affichage.
+ */
+static char* to_hex(unsigned char* hash, size_t size) 
+{
+    if (hash == NULL || size == 0) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la conversion en hexadécimal dans to_hex().\n");
+        return NULL; // Invalid input
+    }
+
+    char* output = RC2D_malloc((size * 2) + 1);
+    for (size_t i = 0; i < size; i++) 
+    {
+        sprintf(output + (i * 2), "%02x", hash[i]);
+    }
+
+    output[size * 2] = '\0';
+
+    return output;
+}
+
+/**
+ * Retourne l'algorithme OpenSSL correspondant à un format de hachage cryptographique.
+ *
+ * @param {RC2D_HashFormat} format - Le format de hachage.
+ * @returns {const EVP_MD*} L'algorithme, ou NULL pour les formats xxHash / non supportés.
+ */
+static const EVP_MD* md_for_format(const RC2D_HashFormat format)
+{
+    switch (format) 
+    {
+        case RC2D_HASHING_FORMAT_MD5:
+            return EVP_md5();
+        case RC2D_HASHING_FORMAT_SHA1:
+            return EVP_sha1();
+        case RC2D_HASHING_FORMAT_SHA224:
+            return EVP_sha224();
+        case RC2D_HASHING_FORMAT_SHA256:
+            return EVP_sha256();
+        case RC2D_HASHING_FORMAT_SHA384:
+            return EVP_sha384();
+        case RC2D_HASHING_FORMAT_SHA512:
+            return EVP_sha512();
+        case RC2D_HASHING_FORMAT_SHA3_224:
+            return EVP_sha3_224();
+        case RC2D_HASHING_FORMAT_SHA3_256:
+            return EVP_sha3_256();
+        case RC2D_HASHING_FORMAT_SHA3_384:
+            return EVP_sha3_384();
+        case RC2D_HASHING_FORMAT_SHA3_512:
+            return EVP_sha3_512();
+        default:
+            return NULL;
+    }
+}
+
+size_t rc2d_data_getHashSize(const RC2D_HashFormat format)
+{
+    switch (format)
+    {
+        case RC2D_HASHING_FORMAT_XXH64:
+        case RC2D_HASHING_FORMAT_XXH3_64:
+            return sizeof(XXH64_canonical_t);
+        case RC2D_HASHING_FORMAT_XXH3_128:
+            return sizeof(XXH128_canonical_t);
+        default:
+        {
+            const EVP_MD* md = md_for_format(format);
+            return md != NULL ? (size_t)EVP_MD_size(md) : 0;
+        }
+    }
+}
+
+struct RC2D_HashContext {
+    /**
+     * Format de hachage du contexte.
+     */
+    RC2D_HashFormat format;
+
+    /**
+     * Algorithme OpenSSL (NULL pour les formats xxHash).
+     */
+    const EVP_MD* md;
+
+    /**
+     * Etat du hash selon le format : EVP_MD_CTX, XXH64_state_t ou XXH3_state_t.
+     */
+    union {
+        EVP_MD_CTX* md;
+        XXH64_state_t* xxh64;
+        XXH3_state_t* xxh3;
+    } state;
+};
+
+/**
+ * (Ré)initialise l'état d'un contexte de hachage pour un nouveau hash.
+ *
+ * @param {RC2D_HashContext*} context - Le contexte de hachage.
+ * @returns {bool} true en cas de succès, false sinon.
+ */
+static bool hash_context_reset(RC2D_HashContext* context)
+{
+    switch (context->format)
+    {
+        case RC2D_HASHING_FORMAT_XXH64:
+            return XXH64_reset(context->state.xxh64, 0) == XXH_OK;
+        case RC2D_HASHING_FORMAT_XXH3_64:
+            return XXH3_64bits_reset(context->state.xxh3) == XXH_OK;
+        case RC2D_HASHING_FORMAT_XXH3_128:
+            return XXH3_128bits_reset(context->state.xxh3) == XXH_OK;
+        default:
+            return EVP_DigestInit_ex(context->state.md, context->md, NULL) == 1;
+    }
+}
+
+RC2D_HashContext* rc2d_data_createHashContext(const RC2D_HashFormat format)
+{
+    const EVP_MD* md = md_for_format(format);
+    if (md == NULL && rc2d_data_getHashSize(format) == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Format de hachage non supporté dans rc2d_data_createHashContext().\n");
+        return NULL;
+    }
+
+    RC2D_HashContext* context = RC2D_calloc(1, sizeof(RC2D_HashContext));
+    if (context == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire pour le contexte de hachage dans rc2d_data_createHashContext().\n");
+        return NULL;
+    }
+    context->format = format;
+    context->md = md;
+
+    bool created;
+    switch (format)
+    {
+        case RC2D_HASHING_FORMAT_XXH64:
+            created = (context->state.xxh64 = XXH64_createState()) != NULL;
+            break;
+        case RC2D_HASHING_FORMAT_XXH3_64:
+        case RC2D_HASHING_FORMAT_XXH3_128:
+            created = (context->state.xxh3 = XXH3_createState()) != NULL;
+            break;
+        default:
+            created = (context->state.md = EVP_MD_CTX_new()) != NULL;
+            break;
+    }
+
+    if (!created || !hash_context_reset(context))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'initialisation du contexte de hachage dans rc2d_data_createHashContext().\n");
+        rc2d_data_destroyHashContext(context);
+        return NULL;
+    }
+
+    return context;
+}
+
+bool rc2d_data_hashUpdate(RC2D_HashContext* context, const void* data, size_t dataSize)
+{
+    if (context == NULL || (data == NULL && dataSize > 0))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Paramètres invalides dans rc2d_data_hashUpdate().\n");
+        return false;
+    }
+
+    if (dataSize == 0)
+    {
+        return true;
+    }
+
+    switch (context->format)
+    {
+        case RC2D_HASHING_FORMAT_XXH64:
+            return XXH64_update(context->state.xxh64, data, dataSize) == XXH_OK;
+        case RC2D_HASHING_FORMAT_XXH3_64:
+            return XXH3_64bits_update(context->state.xxh3, data, dataSize) == XXH_OK;
+        case RC2D_HASHING_FORMAT_XXH3_128:
+            return XXH3_128bits_update(context->state.xxh3, data, dataSize) == XXH_OK;
+        default:
+            return EVP_DigestUpdate(context->state.md, data, dataSize) == 1;
+    }
+}
+
+size_t rc2d_data_hashFinal(RC2D_HashContext* context, unsigned char* out, size_t outSize)
+{
+    if (context == NULL || out == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Paramètres invalides dans rc2d_data_hashFinal().\n");
+        return 0;
+    }
+
+    const size_t hashSize = rc2d_data_getHashSize(context->format);
+    if (outSize < hashSize)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Buffer trop petit pour le hash (%zu < %zu) dans rc2d_data_hashFinal().\n", outSize, hashSize);
+        return 0;
+    }
+
+    switch (context->format)
+    {
+        case RC2D_HASHING_FORMAT_XXH64:
+            XXH64_canonicalFromHash((XXH64_canonical_t*)out, XXH64_digest(context->state.xxh64));
+            break;
+        case RC2D_HASHING_FORMAT_XXH3_64:
+            XXH64_canonicalFromHash((XXH64_canonical_t*)out, XXH3_64bits_digest(context->state.xxh3));
+            break;
+        case RC2D_HASHING_FORMAT_XXH3_128:
+            XXH128_canonicalFromHash((XXH128_canonical_t*)out, XXH3_128bits_digest(context->state.xxh3));
+            break;
+        default:
+        {
+            unsigned int length = 0;
+            if (EVP_DigestFinal_ex(context->state.md, out, &length) != 1)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "Échec de la finalisation du hash dans rc2d_data_hashFinal().\n");
+                return 0;
+            }
+            break;
+        }
+    }
+
+    // Le contexte est prêt pour le hash suivant, sans nouvelle allocation
+    if (!hash_context_reset(context))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la réinitialisation du contexte dans rc2d_data_hashFinal().\n");
+    }
+
+    return hashSize;
+}
+
+void rc2d_data_destroyHashContext(RC2D_HashContext* context)
+{
+    if (context == NULL)
+    {
+        return;
+    }
+
+    switch (context->format)
+    {
+        case RC2D_HASHING_FORMAT_XXH64:
+            XXH64_freeState(context->state.xxh64);
+            break;
+        case RC2D_HASHING_FORMAT_XXH3_64:
+        case RC2D_HASHING_FORMAT_XXH3_128:
+            XXH3_freeState(context->state.xxh3);
+            break;
+        default:
+            EVP_MD_CTX_free(context->state.md);
+            break;
+    }
+
+    RC2D_free(context);
+}
+
+size_t rc2d_data_hashBytes(const void* data, size_t dataSize, const RC2D_HashFormat format, unsigned char* out, size_t outSize)
+{
+    if ((data == NULL && dataSize > 0) || out == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Paramètres invalides dans rc2d_data_hashBytes().\n");
+        return 0;
+    }
+
+    const size_t hashSize = rc2d_data_getHashSize(format);
+    if (hashSize == 0 || outSize < hashSize)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Format non supporté ou buffer trop petit dans rc2d_data_hashBytes().\n");
+        return 0;
+    }
+
+    // Les formats xxHash ont une version one-shot sans état alloué
+    switch (format)
+    {
+        case RC2D_HASHING_FORMAT_XXH64:
+            XXH64_canonicalFromHash((XXH64_canonical_t*)out, XXH64(data, dataSize, 0));
+            return hashSize;
+        case RC2D_HASHING_FORMAT_XXH3_64:
+            XXH64_canonicalFromHash((XXH64_canonical_t*)out, XXH3_64bits(data, dataSize));
+            return hashSize;
+        case RC2D_HASHING_FORMAT_XXH3_128:
+            XXH128_canonicalFromHash((XXH128_canonical_t*)out, XXH3_128bits(data, dataSize));
+            return hashSize;
+        default:
+        {
+            unsigned int length = 0;
+            if (EVP_Digest(data, dataSize, out, &length, md_for_format(format), NULL) != 1)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "Échec du calcul du hash dans rc2d_data_hashBytes().\n");
+                return 0;
+            }
+            return (size_t)length;
+        }
+    }
+}
+
+/**
+ * Taille des morceaux lus par rc2d_data_hashStream().
+ */
+#define HASH_STREAM_CHUNK_SIZE (64 * 1024)
+
+size_t rc2d_data_hashStream(RC2D_StorageStream* stream, const RC2D_HashFormat format, unsigned char* out, size_t outSize)
+{
+    if (stream == NULL || out == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Paramètres invalides dans rc2d_data_hashStream().\n");
+        return 0;
+    }
+
+    RC2D_HashContext* context = rc2d_data_createHashContext(format);
+    if (context == NULL)
+    {
+        return 0;
+    }
+
+    unsigned char* chunk = RC2D_malloc(HASH_STREAM_CHUNK_SIZE);
+    if (chunk == NULL)
     {
-        case RC2D_COMPRESS_FORMAT_LZ4:
-            return decompress_lz4(compressedData);
-        default:
-            return NULL; // Format non supporté
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans rc2d_data_hashStream().\n");
+        rc2d_data_destroyHashContext(context);
+        return 0;
     }
-}
 
-/**
- * Convertit un tableau d'octets en une chaîne hexadécimale.
- * 
- * @param {unsigned char*} hash - Le tableau d'octets à convertir.
- * @param {size_t} size - La taille du tableau d'octets.
- * @returns {char*} La chaîne hexadécimale résultante.
- * @algorithm Conversion en hexadécimal pour l'affichage.
- */
-static char* to_hex(unsigned char* hash, size_t size) 
-{
-    if (hash == NULL || size == 0) 
+    bool ok = true;
+    size_t read;
+    while (ok && (read = rc2d_storage_streamRead(stream, chunk, HASH_STREAM_CHUNK_SIZE)) > 0)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour la conversion en hexadécimal dans to_hex().\n");
-        return NULL; // Invalid input
+        ok = rc2d_data_hashUpdate(context, chunk, read);
     }
 
-    char* output = RC2D_malloc((size * 2) + 1);
-    for (size_t i = 0; i < size; i++) 
+    // Une lecture qui renvoie 0 sans atteindre la fin du fichier est une erreur : pas de hash tronqué
+    if (ok && SDL_GetIOStatus(rc2d_storage_streamGetIO(stream)) != SDL_IO_STATUS_EOF)
     {
-        sprintf(output + (i * 2), "%02x", hash[i]);
+        RC2D_log(RC2D_LOG_ERROR, "Erreur de lecture du stream dans rc2d_data_hashStream() : %s\n", SDL_GetError());
+        ok = false;
     }
 
-    output[size * 2] = '\0';
+    const size_t hashSize = ok ? rc2d_data_hashFinal(context, out, outSize) : 0;
 
-    return output;
+    RC2D_free(chunk);
+    rc2d_data_destroyHashContext(context);
+    return hashSize;
+}
+
+Uint64 rc2d_data_hash64(const void* data, size_t dataSize, Uint64 seed)
+{
+    return (Uint64)XXH3_64bits_withSeed(data, dataSize, (XXH64_hash_t)seed);
+}
+
+RC2D_Hash128 rc2d_data_hash128(const void* data, size_t dataSize, Uint64 seed)
+{
+    const XXH128_hash_t hash = XXH3_128bits_withSeed(data, dataSize, (XXH64_hash_t)seed);
+    RC2D_Hash128 result = { (Uint64)hash.low64, (Uint64)hash.high64 };
+    return result;
 }
 
 char* rc2d_data_hash(const char* data, const RC2D_HashFormat format) 
@@ -539,66 +2315,13 @@ char* rc2d_data_hash(const char* data, const RC2D_HashFormat format)
         return NULL; // Invalid input
     }
 
-    EVP_MD_CTX* mdctx;
-    const EVP_MD* md_type;
-    unsigned char hash_result[EVP_MAX_MD_SIZE]; // Buffer pour le résultat du hash
-    unsigned int hash_len; // La longueur réelle du hash
-
-    switch (format) 
-    {
-        case RC2D_HASHING_FORMAT_MD5:
-            md_type = EVP_md5();
-            break;
-        case RC2D_HASHING_FORMAT_SHA1:
-            md_type = EVP_sha1();
-            break;
-        case RC2D_HASHING_FORMAT_SHA224:
-            md_type = EVP_sha224();
-            break;
-        case RC2D_HASHING_FORMAT_SHA256:
-            md_type = EVP_sha256();
-            break;
-        case RC2D_HASHING_FORMAT_SHA384:
-            md_type = EVP_sha384();
-            break;
-        case RC2D_HASHING_FORMAT_SHA512:
-            md_type = EVP_sha512();
-            break;
-        case RC2D_HASHING_FORMAT_SHA3_224:
-            md_type = EVP_sha3_224();
-            break;
-        case RC2D_HASHING_FORMAT_SHA3_256:
-            md_type = EVP_sha3_256();
-            break;
-        case RC2D_HASHING_FORMAT_SHA3_384:
-            md_type = EVP_sha3_384();
-            break;
-        case RC2D_HASHING_FORMAT_SHA3_512:
-            md_type = EVP_sha3_512();
-            break;
-        default:
-            return NULL; // Format de hachage non supporté
-    }
-
-    // Création du contexte de hachage
-    mdctx = EVP_MD_CTX_new();
-    if (!mdctx) 
-        return NULL;
-
-    // Initialisation du contexte de hachage
-    // Calcul du hash
-    // Finalisation du hash
-    if (1 != EVP_DigestInit_ex(mdctx, md_type, NULL) || 
-        1 != EVP_DigestUpdate(mdctx, data, SDL_strlen(data)) || 
-        1 != EVP_DigestFinal_ex(mdctx, hash_result, &hash_len)) 
+    unsigned char hash_result[RC2D_HASH_MAX_SIZE]; // Buffer pour le résultat du hash
+    const size_t hash_len = rc2d_data_hashBytes(data, SDL_strlen(data), format, hash_result, sizeof(hash_result));
+    if (hash_len == 0)
     {
-        EVP_MD_CTX_free(mdctx);
         return NULL;
     }
 
-    // Libération du contexte de hachage
-    EVP_MD_CTX_free(mdctx);
-
     return to_hex(hash_result, hash_len);
 }
 
@@ -687,50 +2410,47 @@ static int verify_hmac(const void *key, int keylen, const unsigned char *data, i
 }
 
 /**
- * Chiffre des données en utilisant le cipher spécifié, une clé et un vecteur d'initialisation (IV).
- *
- * @param plaintext Pointeur vers les données en clair à chiffrer.
- * @param plaintext_len Longueur des données en clair en octets.
- * @param key Clé de chiffrement utilisée.
- * @param iv Vecteur d'initialisation pour le chiffrement.
- * @param ciphertext Buffer destiné à recevoir les données chiffrées. Doit être alloué par l'appelant.
- * @param format Format de chiffrement spécifié par l'énumération RC2D_CipherFormat.
- * @return La longueur des données chiffrées en cas de succès, ou -1 en cas d'échec.
+ * Retourne le cipher OpenSSL correspondant au format de chiffrement.
  *
- * @note La taille du buffer `ciphertext` doit être au moins égale à `plaintext_len` + la taille du bloc de cipher.
- * @warning Les données chiffrées peuvent être plus longues que les données en clair en raison du padding.
+ * @param {RC2D_CipherFormat} format - Format de chiffrement.
+ * @return {const EVP_CIPHER*} - Le cipher, ou NULL si le format n'est pas un chiffrement symétrique supporté.
  */
-static int encrypt(const unsigned char *plaintext, int plaintext_len, const unsigned char *key, const unsigned char *iv, unsigned char *ciphertext, const RC2D_CipherFormat format) 
+static const EVP_CIPHER* cipher_for_format(const RC2D_CipherFormat format)
 {
-    if (plaintext == NULL || key == NULL || iv == NULL || ciphertext == NULL) 
-    {
-        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le chiffrement dans encrypt().\n");
-        return -1; // Invalid input
-    }
-
-    EVP_CIPHER_CTX *ctx;
-    int len, ciphertext_len;
-    const EVP_CIPHER *cipher;
-
     switch (format) 
     {
         case RC2D_CIPHER_FORMAT_AES:
-            cipher = EVP_aes_256_cbc();
-            break;
+            return EVP_aes_256_cbc();
         case RC2D_CIPHER_FORMAT_CHACHA20:
-            cipher = EVP_chacha20();
-            break;
+            return EVP_chacha20();
         case RC2D_CIPHER_FORMAT_CHACHA20_POLY1305:
-            cipher = EVP_chacha20_poly1305();
-            break;
+            return EVP_chacha20_poly1305();
         default:
-            return -1;
+            return NULL;
     }
+}
 
-    // Création du contexte de chiffrement
-    if(!(ctx = EVP_CIPHER_CTX_new())) 
+/**
+ * Chiffre des données avec un contexte OpenSSL fourni par l'appelant (réinitialisé avec la clé et l'IV).
+ * Permet de réutiliser le même EVP_CIPHER_CTX pour plusieurs messages (voir RC2D_CryptoKey).
+ *
+ * @param ctx Contexte de chiffrement, alloué par l'appelant.
+ * @return La longueur des données chiffrées en cas de succès, ou -1 en cas d'échec.
+ */
+static int encrypt_with_ctx(EVP_CIPHER_CTX *ctx, const unsigned char *plaintext, int plaintext_len, const unsigned char *key, const unsigned char *iv, unsigned char *ciphertext, const RC2D_CipherFormat format) 
+{
+    if (ctx == NULL || plaintext == NULL || key == NULL || iv == NULL || ciphertext == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le chiffrement dans encrypt().\n");
+        return -1; // Invalid input
+    }
+
+    const EVP_CIPHER *cipher = cipher_for_format(format);
+    if (cipher == NULL) 
         return -1;
 
+    int len, ciphertext_len;
+
     // Initialisation du contexte de chiffrement
     if(1 != EVP_EncryptInit_ex(ctx, cipher, NULL, key, iv)) 
         return -1;
@@ -745,58 +2465,30 @@ static int encrypt(const unsigned char *plaintext, int plaintext_len, const unsi
         return -1;
     ciphertext_len += len;
 
-    // Libération du contexte de chiffrement
-    EVP_CIPHER_CTX_free(ctx);
-
     return ciphertext_len;
 }
 
 /**
- * Déchiffre des données en utilisant le cipher spécifié, une clé et un vecteur d'initialisation (IV).
+ * Déchiffre des données avec un contexte OpenSSL fourni par l'appelant (réinitialisé avec la clé et l'IV).
  *
- * @param ciphertext Pointeur vers les données chiffrées à déchiffrer.
- * @param ciphertext_len Longueur des données chiffrées en octets.
- * @param key Clé de déchiffrement utilisée.
- * @param iv Vecteur d'initialisation utilisé lors du chiffrement.
- * @param plaintext Buffer destiné à recevoir les données déchiffrées. Doit être alloué par l'appelant.
- * @param format Format de déchiffrement spécifié par l'énumération RC2D_CipherFormat.
+ * @param ctx Contexte de déchiffrement, alloué par l'appelant.
  * @return La longueur des données déchiffrées en cas de succès, ou -1 en cas d'échec.
- *
- * @note La taille du buffer `plaintext` doit être au moins égale à `ciphertext_len`.
- * @warning Il est crucial que `key` et `iv` correspondent exactement à ceux utilisés lors du chiffrement.
  */
-static int decrypt(const unsigned char *ciphertext, int ciphertext_len, const unsigned char *key, const unsigned char *iv, unsigned char *plaintext, const RC2D_CipherFormat format) 
+static int decrypt_with_ctx(EVP_CIPHER_CTX *ctx, const unsigned char *ciphertext, int ciphertext_len, const unsigned char *key, const unsigned char *iv, unsigned char *plaintext, const RC2D_CipherFormat format) 
 {
-    if (ciphertext == NULL || key == NULL || iv == NULL || plaintext == NULL) 
+    if (ctx == NULL || ciphertext == NULL || key == NULL || iv == NULL || plaintext == NULL) 
     {
         RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le déchiffrement dans decrypt().\n");
         return -1; // Invalid input
     }
 
-    EVP_CIPHER_CTX *ctx;
-    int len, plaintext_len;
-    const EVP_CIPHER *cipher;
-
-    switch (format) 
-    {
-        case RC2D_CIPHER_FORMAT_AES:
-            cipher = EVP_aes_256_cbc();
-            break;
-        case RC2D_CIPHER_FORMAT_CHACHA20:
-            cipher = EVP_chacha20();
-            break;
-        case RC2D_CIPHER_FORMAT_CHACHA20_POLY1305:
-            cipher = EVP_chacha20_poly1305();
-            break;
-        default:
-            return -1;
-    }
-
-    // Création du contexte de chiffrement
-    if(!(ctx = EVP_CIPHER_CTX_new())) 
+    const EVP_CIPHER *cipher = cipher_for_format(format);
+    if (cipher == NULL) 
         return -1;
 
-    // Initialisation du contexte de chiffrement
+    int len, plaintext_len;
+
+    // Initialisation du contexte de déchiffrement
     if(1 != EVP_DecryptInit_ex(ctx, cipher, NULL, key, iv)) 
         return -1;
 
@@ -810,9 +2502,64 @@ static int decrypt(const unsigned char *ciphertext, int ciphertext_len, const un
         return -1;
     plaintext_len += len;
 
+    return plaintext_len;
+}
+
+/**
+ * Chiffre des données en utilisant le cipher spécifié, une clé et un vecteur d'initialisation (IV).
+ *
+ * @param plaintext Pointeur vers les données en clair à chiffrer.
+ * @param plaintext_len Longueur des données en clair en octets.
+ * @param key Clé de chiffrement utilisée.
+ * @param iv Vecteur d'initialisation pour le chiffrement.
+ * @param ciphertext Buffer destiné à recevoir les données chiffrées. Doit être alloué par l'appelant.
+ * @param format Format de chiffrement spécifié par l'énumération RC2D_CipherFormat.
+ * @return La longueur des données chiffrées en cas de succès, ou -1 en cas d'échec.
+ *
+ * @note La taille du buffer `ciphertext` doit être au moins égale à `plaintext_len` + la taille du bloc de cipher.
+ * @warning Les données chiffrées peuvent être plus longues que les données en clair en raison du padding.
+ */
+static int encrypt(const unsigned char *plaintext, int plaintext_len, const unsigned char *key, const unsigned char *iv, unsigned char *ciphertext, const RC2D_CipherFormat format) 
+{
+    // Création du contexte de chiffrement
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    if (!ctx) 
+        return -1;
+
+    const int ciphertext_len = encrypt_with_ctx(ctx, plaintext, plaintext_len, key, iv, ciphertext, format);
+
     // Libération du contexte de chiffrement
     EVP_CIPHER_CTX_free(ctx);
 
+    return ciphertext_len;
+}
+
+/**
+ * Déchiffre des données en utilisant le cipher spécifié, une clé et un vecteur d'initialisation (IV).
+ *
+ * @param ciphertext Pointeur vers les données chiffrées à déchiffrer.
+ * @param ciphertext_len Longueur des données chiffrées en octets.
+ * @param key Clé de déchiffrement utilisée.
+ * @param iv Vecteur d'initialisation utilisé lors du chiffrement.
+ * @param plaintext Buffer destiné à recevoir les données déchiffrées. Doit être alloué par l'appelant.
+ * @param format Format de déchiffrement spécifié par l'énumération RC2D_CipherFormat.
+ * @return La longueur des données déchiffrées en cas de succès, ou -1 en cas d'échec.
+ *
+ * @note La taille du buffer `plaintext` doit être au moins égale à `ciphertext_len`.
+ * @warning Il est crucial que `key` et `iv` correspondent exactement à ceux utilisés lors du chiffrement.
+ */
+static int decrypt(const unsigned char *ciphertext, int ciphertext_len, const unsigned char *key, const unsigned char *iv, unsigned char *plaintext, const RC2D_CipherFormat format) 
+{
+    // Création du contexte de déchiffrement
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    if (!ctx) 
+        return -1;
+
+    const int plaintext_len = decrypt_with_ctx(ctx, ciphertext, ciphertext_len, key, iv, plaintext, format);
+
+    // Libération du contexte de déchiffrement
+    EVP_CIPHER_CTX_free(ctx);
+
     return plaintext_len;
 }
 
@@ -1040,4 +2787,178 @@ unsigned char* rc2d_data_decrypt(const RC2D_EncryptedData* encryptedData)
     }
 }
 
+/**
+ * Clé dérivée une seule fois (PBKDF2) et réutilisée pour chiffrer / déchiffrer plusieurs messages.
+ */
+struct RC2D_CryptoKey {
+    unsigned char key[EVP_MAX_KEY_LENGTH];  // Clé dérivée (chiffrement + HMAC, comme rc2d_data_encrypt)
+    unsigned char salt[SALT_SIZE];          // Sel de la dérivation, recopié en tête de chaque message
+    RC2D_CipherFormat format;
+    EVP_CIPHER_CTX* ctx;                    // Réinitialisé avec un nouvel IV à chaque message
+};
+
+RC2D_CryptoKey* rc2d_data_createCryptoKey(const char* passphrase, const unsigned char* salt, const RC2D_CipherFormat format)
+{
+    if (passphrase == NULL || cipher_for_format(format) == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Passphrase ou format invalide dans rc2d_data_createCryptoKey().\n");
+        return NULL;
+    }
+
+    RC2D_CryptoKey* cryptoKey = (RC2D_CryptoKey*)RC2D_calloc(1, sizeof(RC2D_CryptoKey));
+    if (cryptoKey == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans rc2d_data_createCryptoKey().\n");
+        return NULL;
+    }
+    cryptoKey->format = format;
+
+    // Sel fourni (messages existants) ou nouveau sel aléatoire
+    if (salt != NULL) 
+    {
+        SDL_memcpy(cryptoKey->salt, salt, SALT_SIZE);
+    }
+    else if (!RAND_bytes(cryptoKey->salt, SALT_SIZE)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la génération du sel dans rc2d_data_createCryptoKey().\n");
+        rc2d_data_destroyCryptoKey(cryptoKey);
+        return NULL;
+    }
+
+    // La seule dérivation PBKDF2 de la session
+    if (!PKCS5_PBKDF2_HMAC(passphrase, -1, cryptoKey->salt, SALT_SIZE, ITERATIONS, EVP_sha3_512(), EVP_MAX_KEY_LENGTH, cryptoKey->key)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la dérivation de la clé dans rc2d_data_createCryptoKey().\n");
+        rc2d_data_destroyCryptoKey(cryptoKey);
+        return NULL;
+    }
+
+    cryptoKey->ctx = EVP_CIPHER_CTX_new();
+    if (cryptoKey->ctx == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de la création du contexte de chiffrement dans rc2d_data_createCryptoKey().\n");
+        rc2d_data_destroyCryptoKey(cryptoKey);
+        return NULL;
+    }
+
+    return cryptoKey;
+}
+
+const unsigned char* rc2d_data_getCryptoKeySalt(const RC2D_CryptoKey* cryptoKey)
+{
+    return cryptoKey ? cryptoKey->salt : NULL;
+}
+
+void rc2d_data_destroyCryptoKey(RC2D_CryptoKey* cryptoKey)
+{
+    if (cryptoKey == NULL) return;
+
+    if (cryptoKey->ctx != NULL) EVP_CIPHER_CTX_free(cryptoKey->ctx);
+    secure_zeroize(cryptoKey, sizeof(RC2D_CryptoKey));
+    RC2D_free(cryptoKey);
+}
+
+RC2D_EncryptedData* rc2d_data_encryptWithKey(RC2D_CryptoKey* cryptoKey, const unsigned char* data, size_t dataSize, const RC2D_DataType dataType)
+{
+    if (cryptoKey == NULL || data == NULL || dataSize == 0 || dataSize > INT_MAX - EVP_MAX_BLOCK_LENGTH) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le chiffrement dans rc2d_data_encryptWithKey().\n");
+        return NULL;
+    }
+
+    // Même disposition que rc2d_data_encrypt : sel + IV + ciphertext, chiffré directement en place
+    const size_t headerSize = SALT_SIZE + EVP_MAX_IV_LENGTH;
+    unsigned char* encryptedData = (unsigned char*)RC2D_malloc(headerSize + dataSize + EVP_MAX_BLOCK_LENGTH);
+    RC2D_EncryptedData* encryptedDataStruct = (RC2D_EncryptedData*)RC2D_calloc(1, sizeof(RC2D_EncryptedData));
+    unsigned char* hmac = (unsigned char*)RC2D_malloc(EVP_MAX_MD_SIZE);
+    if (encryptedData == NULL || encryptedDataStruct == NULL || hmac == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire dans rc2d_data_encryptWithKey().\n");
+        RC2D_safe_free(encryptedData);
+        RC2D_safe_free(encryptedDataStruct);
+        RC2D_safe_free(hmac);
+        return NULL;
+    }
+
+    // Seul l'IV est nouveau pour chaque message
+    unsigned char* iv = encryptedData + SALT_SIZE;
+    SDL_memcpy(encryptedData, cryptoKey->salt, SALT_SIZE);
+    int ciphertext_len = -1;
+    if (RAND_bytes(iv, EVP_MAX_IV_LENGTH)) 
+    {
+        ciphertext_len = encrypt_with_ctx(cryptoKey->ctx, data, (int)dataSize, cryptoKey->key, iv, encryptedData + headerSize, cryptoKey->format);
+    }
+
+    unsigned int hmac_len = 0;
+    const size_t totalSize = headerSize + (size_t)(ciphertext_len > 0 ? ciphertext_len : 0);
+    if (ciphertext_len < 0 || !generate_hmac(cryptoKey->key, EVP_MAX_KEY_LENGTH, encryptedData, (int)totalSize, hmac, &hmac_len)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec du chiffrement dans rc2d_data_encryptWithKey().\n");
+        RC2D_safe_free(encryptedData);
+        RC2D_safe_free(encryptedDataStruct);
+        RC2D_safe_free(hmac);
+        return NULL;
+    }
+
+    encryptedDataStruct->data = encryptedData;
+    encryptedDataStruct->passphrase = NULL;             // La passphrase n'est pas conservée par la clé
+    encryptedDataStruct->hmac = hmac;
+    encryptedDataStruct->originalSize = dataSize;
+    encryptedDataStruct->encryptedSize = totalSize;
+    encryptedDataStruct->hmacSize = hmac_len;
+    encryptedDataStruct->cipherFormat = cryptoKey->format;
+    encryptedDataStruct->dataType = dataType;
+
+    return encryptedDataStruct;
+}
+
+unsigned char* rc2d_data_decryptWithKey(RC2D_CryptoKey* cryptoKey, const RC2D_EncryptedData* encryptedData)
+{
+    const size_t headerSize = SALT_SIZE + EVP_MAX_IV_LENGTH;
+    if (cryptoKey == NULL || encryptedData == NULL || encryptedData->data == NULL || encryptedData->hmac == NULL ||
+        encryptedData->encryptedSize < headerSize || encryptedData->encryptedSize - headerSize > INT_MAX) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Données invalides pour le déchiffrement dans rc2d_data_decryptWithKey().\n");
+        return NULL;
+    }
+
+    if (encryptedData->cipherFormat != cryptoKey->format || CRYPTO_memcmp(encryptedData->data, cryptoKey->salt, SALT_SIZE) != 0) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Message chiffré avec un autre sel ou un autre format que la clé dans rc2d_data_decryptWithKey().\n");
+        return NULL;
+    }
+
+    // Vérification de l'intégrité des données avant tout déchiffrement
+    if (!verify_hmac(cryptoKey->key, EVP_MAX_KEY_LENGTH, encryptedData->data, (int)encryptedData->encryptedSize, encryptedData->hmac, (unsigned int)encryptedData->hmacSize)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Intégrité des données altérée pour le déchiffrement dans rc2d_data_decryptWithKey().\n");
+        return NULL;
+    }
+
+    // +1 pour le caractère nul éventuel des données texte
+    const size_t ciphertext_len = encryptedData->encryptedSize - headerSize;
+    unsigned char* plaintext = (unsigned char*)RC2D_malloc(ciphertext_len + 1);
+    if (plaintext == NULL) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec de l'allocation mémoire pour le plaintext dans rc2d_data_decryptWithKey().\n");
+        return NULL;
+    }
+
+    const int plaintext_len = decrypt_with_ctx(cryptoKey->ctx, encryptedData->data + headerSize, (int)ciphertext_len, cryptoKey->key,
+                                               encryptedData->data + SALT_SIZE, plaintext, cryptoKey->format);
+    if (plaintext_len < 0) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Échec du déchiffrement dans rc2d_data_decryptWithKey().\n");
+        RC2D_safe_free(plaintext);
+        return NULL;
+    }
+
+    if (encryptedData->dataType == RC2D_DATA_TYPE_TEXT) 
+    {
+        plaintext[plaintext_len] = '\0';
+    }
+
+    return plaintext;
+}
+
 #endif // RC2D_DATA_MODULE_ENABLED
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <RC2D/RC2D_engine.h>
 #include <RC2D/RC2D_gpu.h>
 #include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_rres.h>
 
 #include <SDL3/SDL_init.h>
 #include <SDL3/SDL_events.h>
@@ -2084,7 +2085,14 @@ void rc2d_engine_quit(void)
 
     /**
      * Détruire les ressources internes des modules de la lib RC2D.
+     * Les workers des asset loaders et le thread des sauvegardes utilisent le storage : ils sont arrêtés en premier.
      */
+    rc2d_assetloader_destroyAll();
+    rc2d_assetcache_destroyAll();
+#if RC2D_DATA_MODULE_ENABLED
+    rc2d_save_shutdown();
+#endif
+    rc2d_rres_clearKeyCache();
 	rc2d_filesystem_quit();
     rc2d_storage_closeAll();
     rc2d_graphics_destroyRendererTextEngine();
@@ -2147,9 +2155,15 @@ void rc2d_engine_quit(void)
         rc2d_engine_state.window = NULL;
     }
 
+    // Vider la file du logger asynchrone et fermer le fichier de log avant SDL_Quit()
+    rc2d_logger_quit();
+
     // Cleanup SDL3
 	rc2d_engine_cleanup_sdl();
 
+    // Libérer les arènes de frame (avant le rapport mémoire : leurs blocs sont suivis)
+    rc2d_frame_quit();
+
     /**
      * Affiche un rapport des fuites mémoire détectées.
      * Cela est utile pour identifier les fuites de mémoire dans l'application.
@@ -13,6 +13,7 @@
 #include <RC2D/RC2D_logger.h>
 #include <RC2D/RC2D_memory.h>
 #include <RC2D/RC2D_graphics.h>
+#include <RC2D/RC2D_save.h>
 #include <RC2D/RC2D_platform_defines.h>
 
 static bool title_storage_is_ready = false;  // SDL_OpenTitleStorage est prêt ?
@@ -237,26 +238,50 @@ SDL_AppResult SDL_AppIterate(void *appstate)
      * Ordre de la boucle principale de l'application :
      * 1. Calculer le delta time pour la frame actuelle.
      * 2. Appeler les fonctions internes de hot reload des shaders.
-     * 3. Appeler la fonction de mise à jour du jeu.
-     * 4. Appeler la fonction de dessin du jeu.
-     * 5. Présenter le rendu à l'écran.
-     * 6. Terminer le calcul du delta time pour la frame actuelle.
+     * 3. Finaliser les assets chargés en asynchrone (dans le budget par frame des loaders)
+     *    et appeler les callbacks des sauvegardes asynchrones terminées.
+     * 4. Appeler la fonction de mise à jour du jeu.
+     * 5. Appeler la fonction de dessin du jeu.
+     * 6. Présenter le rendu à l'écran.
+     * 7. Remettre à zéro les arènes de frame (rc2d_frame_alloc).
+     * 8. Échantillonner la télémétrie mémoire de la frame.
+     * 9. Terminer le calcul du delta time pour la frame actuelle.
+     *
+     * Les allocations sont attribuées au tag de télémétrie du module qui les fait.
      */
     rc2d_engine_deltatime_start();
+    rc2d_memory_pushTag(RC2D_MEMORY_TAG_ASSETS);
+    rc2d_assetloader_updateAll();
+    rc2d_memory_popTag();
+#if RC2D_DATA_MODULE_ENABLED
+    rc2d_memory_pushTag(RC2D_MEMORY_TAG_DATA);
+    rc2d_save_update();
+    rc2d_memory_popTag();
+#endif
+    rc2d_memory_pushTag(RC2D_MEMORY_TAG_GAME);
     if (rc2d_engine_state.config != NULL && 
         rc2d_engine_state.config->callbacks != NULL && 
         rc2d_engine_state.config->callbacks->rc2d_update != NULL) 
     {
         rc2d_engine_state.config->callbacks->rc2d_update(rc2d_engine_state.delta_time);
     }
+    rc2d_memory_popTag();
+    rc2d_memory_pushTag(RC2D_MEMORY_TAG_GRAPHICS);
     rc2d_graphics_clear();
+    rc2d_memory_popTag();
+    rc2d_memory_pushTag(RC2D_MEMORY_TAG_GAME);
     if (rc2d_engine_state.config != NULL && 
         rc2d_engine_state.config->callbacks != NULL && 
         rc2d_engine_state.config->callbacks->rc2d_draw != NULL) 
     {
         rc2d_engine_state.config->callbacks->rc2d_draw();
     }
+    rc2d_memory_popTag();
+    rc2d_memory_pushTag(RC2D_MEMORY_TAG_GRAPHICS);
     rc2d_graphics_present();
+    rc2d_memory_popTag();
+    rc2d_frame_endFrame();
+    rc2d_memory_sampleFrame();
     rc2d_engine_deltatime_end();
 
     /**
@@ -0,0 +1,297 @@
+#include <RC2D/RC2D_frame.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_stdinc.h>
+
+/*
+ * Arènes linéaires : chaque arène est une liste de blocs, le bloc courant en tête.
+ * Une allocation incrémente l'offset du bloc courant ; si le bloc est plein, un nouveau
+ * bloc est alloué et placé en tête. À la remise à zéro, une arène qui a débordé sur
+ * plusieurs blocs les remplace par un seul bloc de la capacité cumulée.
+ */
+typedef struct RC2D_FrameBlock {
+    struct RC2D_FrameBlock* next;
+    size_t capacity;
+    size_t offset;
+} RC2D_FrameBlock;
+
+/* Les données commencent après l'en-tête, arrondi à RC2D_FRAME_DEFAULT_ALIGN */
+#define RC2D_FRAME_BLOCK_HEADER_SIZE \
+    ((sizeof(RC2D_FrameBlock) + RC2D_FRAME_DEFAULT_ALIGN - 1) & ~((size_t)RC2D_FRAME_DEFAULT_ALIGN - 1))
+
+typedef struct RC2D_FrameArena {
+    RC2D_FrameBlock* head;
+    size_t used;        // octets consommés dans tous les blocs (padding d'alignement compris)
+    size_t capacity;    // capacité cumulée de tous les blocs
+} RC2D_FrameArena;
+
+/* Toutes les arènes sont protégées par rc2d_frame_lock */
+static SDL_SpinLock rc2d_frame_lock = 0;
+
+/* Arène remise à zéro à chaque frame */
+static RC2D_FrameArena rc2d_frame_arena = { 0 };
+
+/* Arènes double-buffer : rc2d_frame_doubleArenas[rc2d_frame_doubleCurrent] reçoit les allocations de la frame */
+static RC2D_FrameArena rc2d_frame_doubleArenas[2] = { { 0 }, { 0 } };
+static int rc2d_frame_doubleCurrent = 0;
+
+static size_t rc2d_frame_peakBytes = 0;
+static size_t rc2d_frame_index = 0;
+
+static unsigned char* rc2d_frame_blockData(RC2D_FrameBlock* block)
+{
+    return (unsigned char*)block + RC2D_FRAME_BLOCK_HEADER_SIZE;
+}
+
+static RC2D_FrameBlock* rc2d_frame_newBlock(size_t capacity)
+{
+    RC2D_FrameBlock* block = (RC2D_FrameBlock*)RC2D_malloc(RC2D_FRAME_BLOCK_HEADER_SIZE + capacity);
+    if (block == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Impossible d'allouer un bloc de %zu octets pour l'arène de frame.", capacity);
+        return NULL;
+    }
+
+    block->next = NULL;
+    block->capacity = capacity;
+    block->offset = 0;
+    return block;
+}
+
+/**
+ * Tente l'allocation dans le bloc courant de l'arène.
+ *
+ * @param block Bloc courant (peut être NULL).
+ * @param size Taille demandée.
+ * @param align Alignement (puissance de 2).
+ * @param out_consumed [out] Octets consommés dans le bloc (padding compris).
+ * @return Le pointeur aligné, ou NULL si le bloc ne peut pas contenir la demande.
+ */
+static void* rc2d_frame_tryBlock(RC2D_FrameBlock* block, size_t size, size_t align, size_t* out_consumed)
+{
+    if (block == NULL)
+    {
+        return NULL;
+    }
+
+    const uintptr_t base = (uintptr_t)rc2d_frame_blockData(block);
+    const uintptr_t start = (base + block->offset + (align - 1)) & ~((uintptr_t)align - 1);
+    const size_t startOffset = (size_t)(start - base);
+    if (startOffset > block->capacity || size > block->capacity - startOffset)
+    {
+        return NULL;
+    }
+
+    *out_consumed = startOffset + size - block->offset;
+    block->offset = startOffset + size;
+    return (void*)start;
+}
+
+static void* rc2d_frame_arenaAlloc(RC2D_FrameArena* arena, size_t size, size_t align)
+{
+    size_t consumed = 0;
+    void* ptr = rc2d_frame_tryBlock(arena->head, size, align, &consumed);
+    if (ptr == NULL)
+    {
+        // Le bloc courant est plein : nouveau bloc assez grand pour la demande même dans le pire alignement
+        if (size > SIZE_MAX - RC2D_FRAME_BLOCK_HEADER_SIZE - align)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "Taille demandée trop grande pour l'arène de frame (%zu octets).", size);
+            return NULL;
+        }
+
+        size_t capacity = size + align;
+        if (capacity < RC2D_FRAME_ARENA_BLOCK_SIZE)
+        {
+            capacity = RC2D_FRAME_ARENA_BLOCK_SIZE;
+        }
+
+        RC2D_FrameBlock* block = rc2d_frame_newBlock(capacity);
+        if (block == NULL)
+        {
+            return NULL;
+        }
+
+        block->next = arena->head;
+        arena->head = block;
+        arena->capacity += capacity;
+        ptr = rc2d_frame_tryBlock(block, size, align, &consumed);
+    }
+
+    arena->used += consumed;
+    return ptr;
+}
+
+static void rc2d_frame_arenaFree(RC2D_FrameArena* arena)
+{
+    RC2D_FrameBlock* block = arena->head;
+    while (block != NULL)
+    {
+        RC2D_FrameBlock* next = block->next;
+        RC2D_free(block);
+        block = next;
+    }
+
+    arena->head = NULL;
+    arena->used = 0;
+    arena->capacity = 0;
+}
+
+static void rc2d_frame_arenaReset(RC2D_FrameArena* arena)
+{
+    if (arena->head != NULL && arena->head->next != NULL)
+    {
+        // L'arène a débordé : un seul bloc de la capacité cumulée pour les frames suivantes
+        const size_t capacity = arena->capacity;
+        rc2d_frame_arenaFree(arena);
+        arena->head = rc2d_frame_newBlock(capacity);
+        arena->capacity = arena->head != NULL ? capacity : 0;
+    }
+    else if (arena->head != NULL)
+    {
+        arena->head->offset = 0;
+    }
+
+    arena->used = 0;
+}
+
+static bool rc2d_frame_arenaOwns(const RC2D_FrameArena* arena, uintptr_t address)
+{
+    for (const RC2D_FrameBlock* block = arena->head; block != NULL; block = block->next)
+    {
+        const uintptr_t base = (uintptr_t)block + RC2D_FRAME_BLOCK_HEADER_SIZE;
+        if (address >= base && address < base + block->capacity)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool rc2d_frame_checkAlign(size_t* align)
+{
+    if (*align == 0)
+    {
+        *align = RC2D_FRAME_DEFAULT_ALIGN;
+    }
+
+    if ((*align & (*align - 1)) != 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Alignement invalide pour l'arène de frame : %zu (puissance de 2 attendue).", *align);
+        return false;
+    }
+    return true;
+}
+
+void* rc2d_frame_alloc(size_t size, size_t align)
+{
+    if (!rc2d_frame_checkAlign(&align))
+    {
+        return NULL;
+    }
+
+    SDL_LockSpinlock(&rc2d_frame_lock);
+    void* ptr = rc2d_frame_arenaAlloc(&rc2d_frame_arena, size, align);
+    SDL_UnlockSpinlock(&rc2d_frame_lock);
+    return ptr;
+}
+
+void* rc2d_frame_allocDoubleBuffered(size_t size, size_t align)
+{
+    if (!rc2d_frame_checkAlign(&align))
+    {
+        return NULL;
+    }
+
+    SDL_LockSpinlock(&rc2d_frame_lock);
+    void* ptr = rc2d_frame_arenaAlloc(&rc2d_frame_doubleArenas[rc2d_frame_doubleCurrent], size, align);
+    SDL_UnlockSpinlock(&rc2d_frame_lock);
+    return ptr;
+}
+
+char* rc2d_frame_strdup(const char* str)
+{
+    if (str == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Chaîne NULL passée à rc2d_frame_strdup.");
+        return NULL;
+    }
+
+    const size_t length = SDL_strlen(str);
+    char* copy = (char*)rc2d_frame_alloc(length + 1, 1);
+    if (copy != NULL)
+    {
+        SDL_memcpy(copy, str, length + 1);
+    }
+    return copy;
+}
+
+bool rc2d_frame_owns(const void* ptr)
+{
+    if (ptr == NULL)
+    {
+        return false;
+    }
+
+    const uintptr_t address = (uintptr_t)ptr;
+    SDL_LockSpinlock(&rc2d_frame_lock);
+    const bool owned = rc2d_frame_arenaOwns(&rc2d_frame_arena, address) ||
+                       rc2d_frame_arenaOwns(&rc2d_frame_doubleArenas[0], address) ||
+                       rc2d_frame_arenaOwns(&rc2d_frame_doubleArenas[1], address);
+    SDL_UnlockSpinlock(&rc2d_frame_lock);
+    return owned;
+}
+
+void rc2d_frame_getStats(RC2D_FrameArenaStats* out_stats)
+{
+    if (out_stats == NULL)
+    {
+        return;
+    }
+
+    SDL_LockSpinlock(&rc2d_frame_lock);
+    out_stats->usedBytes = rc2d_frame_arena.used;
+    out_stats->doubleBufferedUsedBytes = rc2d_frame_doubleArenas[rc2d_frame_doubleCurrent].used;
+    out_stats->capacityBytes = rc2d_frame_arena.capacity +
+                               rc2d_frame_doubleArenas[0].capacity +
+                               rc2d_frame_doubleArenas[1].capacity;
+    out_stats->peakBytes = rc2d_frame_peakBytes;
+    out_stats->frameIndex = rc2d_frame_index;
+    SDL_UnlockSpinlock(&rc2d_frame_lock);
+}
+
+void rc2d_frame_endFrame(void)
+{
+    SDL_LockSpinlock(&rc2d_frame_lock);
+
+    // Pic : arène de la frame + les deux arènes double-buffer, toutes vivantes à cet instant
+    const size_t inFlight = rc2d_frame_arena.used + rc2d_frame_doubleArenas[0].used + rc2d_frame_doubleArenas[1].used;
+    if (inFlight > rc2d_frame_peakBytes)
+    {
+        rc2d_frame_peakBytes = inFlight;
+    }
+
+    rc2d_frame_arenaReset(&rc2d_frame_arena);
+
+    // L'arène double-buffer qui devient courante contient les données de la frame précédente : elles expirent
+    rc2d_frame_doubleCurrent ^= 1;
+    rc2d_frame_arenaReset(&rc2d_frame_doubleArenas[rc2d_frame_doubleCurrent]);
+
+    rc2d_frame_index++;
+    SDL_UnlockSpinlock(&rc2d_frame_lock);
+}
+
+void rc2d_frame_quit(void)
+{
+    SDL_LockSpinlock(&rc2d_frame_lock);
+    rc2d_frame_arenaFree(&rc2d_frame_arena);
+    rc2d_frame_arenaFree(&rc2d_frame_doubleArenas[0]);
+    rc2d_frame_arenaFree(&rc2d_frame_doubleArenas[1]);
+    rc2d_frame_doubleCurrent = 0;
+    rc2d_frame_peakBytes = 0;
+    rc2d_frame_index = 0;
+    SDL_UnlockSpinlock(&rc2d_frame_lock);
+}
@@ -120,7 +120,7 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShaderFromStorage(const char* storage_path,
             RC2D_GPUShader* graphicsShader = rc2d_engine_state.gpu_graphics_shaders_cache[i].shader;
             SDL_UnlockMutex(rc2d_engine_state.gpu_graphics_shader_mutex);
 
-            RC2D_log(RC2D_LOG_INFO, "Graphics Shader already loaded from cache: %s", storage_path);
+            RC2D_log(RC2D_LOG_DEBUG, "Graphics Shader already loaded from cache: %s", storage_path);
             return graphicsShader;
         }
     }
@@ -303,14 +303,14 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShaderFromStorage(const char* storage_path,
      * Charger le fichier du shader compilé
      * On utilise l’API Storage (Title/User) pour lire le binaire en mémoire
      */
-    void* codeShaderCompiled = NULL;
-    Uint64 codeShaderCompiledSize = 0;
+    RC2D_StorageMapping codeShaderCompiled = { 0 };
     if (!((storage_kind == RC2D_STORAGE_TITLE)
-            ? rc2d_storage_titleReadFile(fullPath, &codeShaderCompiled, &codeShaderCompiledSize)
-            : rc2d_storage_userReadFile (fullPath, &codeShaderCompiled, &codeShaderCompiledSize))
-        || !codeShaderCompiled || codeShaderCompiledSize == 0)
+            ? rc2d_storage_titleMapFile(fullPath, &codeShaderCompiled)
+            : rc2d_storage_userMapFile (fullPath, &codeShaderCompiled))
+        || !codeShaderCompiled.data || codeShaderCompiled.len == 0)
     {
         RC2D_log(RC2D_LOG_ERROR, "Failed to load compiled shader from storage: %s", fullPath);
+        rc2d_storage_unmapFile(&codeShaderCompiled);
         return NULL;
     }
 
@@ -341,17 +341,16 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShaderFromStorage(const char* storage_path,
     Uint32 numUniformBuffers = 0;
     Uint32 numStorageBuffers = 0;
     Uint32 numStorageTextures = 0;
-    void* jsonContent = NULL;
-    Uint64 jsonLen = 0;
+    RC2D_StorageMapping jsonContent = { 0 };
     if (((storage_kind == RC2D_STORAGE_TITLE)
-            ? rc2d_storage_titleReadFile(jsonPath, &jsonContent, &jsonLen)
-            : rc2d_storage_userReadFile (jsonPath, &jsonContent, &jsonLen))
-        && jsonContent && jsonLen > 0)
+            ? rc2d_storage_titleMapFile(jsonPath, &jsonContent)
+            : rc2d_storage_userMapFile (jsonPath, &jsonContent))
+        && jsonContent.data && jsonContent.len > 0)
     {
         // Cast le contenu du fichier JSON en chaîne de caractères (NUL-terminée)
-        char* content = (char*)RC2D_malloc(jsonLen+1);
-        SDL_memcpy(content, jsonContent, jsonLen);
-        content[jsonLen] = '\0';
+        char* content = (char*)RC2D_malloc(jsonContent.len+1);
+        SDL_memcpy(content, jsonContent.data, jsonContent.len);
+        content[jsonContent.len] = '\0';
 
         json_read_uint(content, "\"samplers\"",          &numSamplers);
         json_read_uint(content, "\"uniform_buffers\"",   &numUniformBuffers);
@@ -360,12 +359,12 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShaderFromStorage(const char* storage_path,
 
         // Libérer le contenu JSON après la lecture
         RC2D_safe_free(content);
-        RC2D_safe_free(jsonContent);
+        rc2d_storage_unmapFile(&jsonContent);
     }
     else 
     {
         RC2D_log(RC2D_LOG_WARN, "Shader reflection file not found in storage: %s", jsonPath);
-         if (jsonContent) RC2D_safe_free(jsonContent);
+        rc2d_storage_unmapFile(&jsonContent);
     }
 
     RC2D_log(RC2D_LOG_INFO, "Loading graphics shader from storage: %s (format=%d, samplers=%u, uniform_buffers=%u, storage_buffers=%u, storage_textures=%u)",
@@ -373,8 +372,8 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShaderFromStorage(const char* storage_path,
 
     // Création du shader GPU avec les informations de réflexion récupérées depuis le fichier JSON
     SDL_GPUShaderCreateInfo info = {
-        .code = codeShaderCompiled,
-        .code_size = (size_t)codeShaderCompiledSize,
+        .code = (const Uint8*)codeShaderCompiled.data,
+        .code_size = (size_t)codeShaderCompiled.len,
         .entrypoint = entrypoint,
         .format = format,
         .stage = stage,
@@ -388,8 +387,8 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShaderFromStorage(const char* storage_path,
     // Créer le shader graphique à partir du code compilé du shader
     SDL_GPUShader* graphicsShader = SDL_CreateGPUShader(rc2d_gpu_getDevice(), &info);
 
-    // Libérer le code du shader compilé après la création du shader
-    RC2D_safe_free(codeShaderCompiled);
+    // Rendre la vue sur le shader compilé après la création du shader
+    rc2d_storage_unmapFile(&codeShaderCompiled);
 
     // Vérifier si la création du shader graphique a réussi
     if (graphicsShader == NULL) 
@@ -409,23 +408,23 @@ RC2D_GPUShader* rc2d_gpu_loadGraphicsShaderFromStorage(const char* storage_path,
      * Charger le fichier HLSL source
      * On utilise l’API Storage pour charger le fichier HLSL source.
      */
-    void* codeHLSLSourceBytes = NULL;
-    Uint64 codeHLSLSourceLen = 0;
+    RC2D_StorageMapping codeHLSLSourceFile = { 0 };
     if (!((storage_kind == RC2D_STORAGE_TITLE)
-            ? rc2d_storage_titleReadFile(fullPath, &codeHLSLSourceBytes, &codeHLSLSourceLen)
-            : rc2d_storage_userReadFile (fullPath, &codeHLSLSourceBytes, &codeHLSLSourceLen))
-        || !codeHLSLSourceBytes || codeHLSLSourceLen == 0)
+            ? rc2d_storage_titleMapFile(fullPath, &codeHLSLSourceFile)
+            : rc2d_storage_userMapFile (fullPath, &codeHLSLSourceFile))
+        || !codeHLSLSourceFile.data || codeHLSLSourceFile.len == 0)
     {
         RC2D_log(RC2D_LOG_ERROR, "Failed to load HLSL shader source from storage: %s", fullPath); 
+        rc2d_storage_unmapFile(&codeHLSLSourceFile);
         return NULL;
     }
 
     // Préparer les informations pour la compilation HLSL vers SPIR-V
     // (on s’assure d’une chaîne NUL-terminée)
-    char* codeHLSLSource = (char*)RC2D_malloc((size_t)codeHLSLSourceLen + 1);
-    SDL_memcpy(codeHLSLSource, codeHLSLSourceBytes, (size_t)codeHLSLSourceLen);
-    codeHLSLSource[codeHLSLSourceLen] = '\0';
-    RC2D_safe_free(codeHLSLSourceBytes);
+    char* codeHLSLSource = (char*)RC2D_malloc((size_t)codeHLSLSourceFile.len + 1);
+    SDL_memcpy(codeHLSLSource, codeHLSLSourceFile.data, (size_t)codeHLSLSourceFile.len);
+    codeHLSLSource[codeHLSLSourceFile.len] = '\0';
+    rc2d_storage_unmapFile(&codeHLSLSourceFile);
 
     SDL_ShaderCross_HLSL_Info hlslInfo = {
         .source = codeHLSLSource,
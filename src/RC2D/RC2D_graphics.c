@@ -11,6 +11,38 @@
 */
 static RC2D_Color rc2d_graphics_currentRenderColor = {0, 0, 0, 255};
 
+/**
+* Lot de sprites actif (NULL = dessin immédiat).
+*/
+static RC2D_SpriteBatch* rc2d_graphics_activeSpriteBatch = NULL;
+
+/**
+* Capacité par défaut d'un lot de sprites (en sprites).
+*/
+#define RC2D_SPRITEBATCH_DEFAULT_CAPACITY 1024
+
+/**
+ * Lot de sprites : un tampon de sommets/indices pour UNE texture à la fois.
+ * Les indices suivent toujours le même motif (0,1,2, 0,2,3) et sont pré-remplis
+ * à chaque agrandissement, le flush n'a donc qu'un SDL_RenderGeometry à faire.
+ */
+struct RC2D_SpriteBatch {
+    SDL_Texture* texture;   /* Texture des sprites en attente (NULL si vide) */
+    SDL_Vertex* vertices;   /* 4 sommets par sprite */
+    int* indices;           /* 6 indices par sprite */
+    int count;              /* Nombre de sprites en attente */
+    int capacity;           /* Capacité en sprites */
+};
+
+/* Flush le lot actif avant un dessin immédiat ou un changement d'état du renderer (cf. RC2D_internal.h). */
+void rc2d_graphics_flushActiveSpriteBatch(void)
+{
+    if (rc2d_graphics_activeSpriteBatch && rc2d_graphics_activeSpriteBatch->count > 0)
+    {
+        rc2d_graphics_flushSpriteBatch(rc2d_graphics_activeSpriteBatch);
+    }
+}
+
 /* ========================================================================= */
 /*                     Isometric diamond (tile) drawing                      */
 /* ========================================================================= */
@@ -34,6 +66,8 @@ bool rc2d_graphics_drawTileIsometric(const char* mode, float cx, float cy, float
         return false;
     }
 
+    rc2d_graphics_flushActiveSpriteBatch();
+
     SDL_FPoint top, right, bottom, left;
     rc2d__iso_corners(cx, cy, tile_w, tile_h, &top, &right, &bottom, &left);
 
@@ -155,6 +189,16 @@ void rc2d_graphics_drawQuad(RC2D_Image* image, const RC2D_Quad* quad,
         return;
     }
 
+    // Si un lot est actif, on y ajoute le sprite au lieu de dessiner immédiatement
+    if (rc2d_graphics_activeSpriteBatch)
+    {
+        rc2d_graphics_addToSpriteBatch(rc2d_graphics_activeSpriteBatch, image, quad,
+                                       x, y, angle, scaleX, scaleY, offsetX, offsetY,
+                                       flipHorizontal, flipVertical,
+                                       (RC2D_Color){255, 255, 255, 255});
+        return;
+    }
+
     // Appliquer l’échelle directement dans le dst (PAS de SetRenderScale global)
     SDL_FRect dst = {
         x,
@@ -191,6 +235,9 @@ void rc2d_graphics_clear(void)
 {
     if (rc2d_engine_state.renderer) 
     {
+        // Dessiner les sprites encore en attente avant d'effacer (ordre de dessin)
+        rc2d_graphics_flushActiveSpriteBatch();
+
         // Effacer avec la couleur noire par défaut
         SDL_SetRenderDrawColor(rc2d_engine_state.renderer, 0, 0, 0, 255);
 
@@ -203,6 +250,9 @@ void rc2d_graphics_present(void)
 {
     if (rc2d_engine_state.renderer) 
     {
+        // Dessiner les sprites encore en attente dans le lot actif
+        rc2d_graphics_flushActiveSpriteBatch();
+
         // Présenter le rendu à l'écran
         SDL_RenderPresent(rc2d_engine_state.renderer);
     }
@@ -211,48 +261,30 @@ void rc2d_graphics_present(void)
 void rc2d_graphics_drawImage(RC2D_Image* image, float x, float y, double angle, float scaleX, float scaleY, float offsetX, float offsetY, bool flipHorizontal, bool flipVertical) 
 {
     // Vérifier que la texture est valide
-    if (!image->sdl_texture) 
+    if (!image || !image->sdl_texture) 
     {
         RC2D_log(RC2D_LOG_ERROR, "Invalid texture in rc2d_graphics_draw\n");
         return;
     }
 
-    // Destination rectangle avec position, taille et scale
-    SDL_FRect rectDest = {x, y, (float)image->sdl_texture->w * scaleX, (float)image->sdl_texture->h * scaleY};
-
-    // Savoir si on doit faire un flip horizontal et/ou vertical
-    SDL_FlipMode flip = SDL_FLIP_NONE;
-    if (flipHorizontal) flip |= SDL_FLIP_HORIZONTAL;
-    if (flipVertical) flip |= SDL_FLIP_VERTICAL;
-
-    // Point d'origine pour la rotation (offsetX, offsetY)
-    SDL_FPoint pointOffset = {(float)offsetX, (float)offsetY};
-
-    // Appliquer le scale avant de dessiner (si scaleX et/ou scaleY != 1.0)
-    SDL_SetRenderScale(rc2d_engine_state.renderer, scaleX, scaleY);
-
-    // Si offsetX et offsetY sont valides, on les utilise, sinon on centre la rotation
-    if (offsetX >= 0 && offsetY >= 0) 
-    {
-        if (!SDL_RenderTextureRotated(rc2d_engine_state.renderer, image->sdl_texture, NULL, &rectDest, angle, &pointOffset, flip)) 
-        {
-            RC2D_log(RC2D_LOG_ERROR, "SDL_RenderTextureRotated failed in rc2d_graphics_draw: %s\n", SDL_GetError());
-        }
-    }
-    else 
-    {
-        if (!SDL_RenderTextureRotated(rc2d_engine_state.renderer, image->sdl_texture, NULL, &rectDest, angle, NULL, flip)) 
-        {
-            RC2D_log(RC2D_LOG_ERROR, "SDL_RenderTextureRotated failed in rc2d_graphics_draw: %s\n", SDL_GetError());
-        }
-    }
+    /**
+     * L'image entière est un Quad couvrant toute la texture : on passe par le même chemin
+     * que rc2d_graphics_drawQuad (échelle appliquée dans le dst, pas de SetRenderScale global),
+     * ce qui permet aussi de router vers le lot de sprites actif.
+     */
+    RC2D_Quad fullQuad;
+    fullQuad.src.x = 0.0f;
+    fullQuad.src.y = 0.0f;
+    fullQuad.src.w = (float)image->sdl_texture->w;
+    fullQuad.src.h = (float)image->sdl_texture->h;
 
-    // Remettre le scale à 1.0 après le dessin
-    SDL_SetRenderScale(rc2d_engine_state.renderer, 1.0f, 1.0f);
+    rc2d_graphics_drawQuad(image, &fullQuad, x, y, angle, scaleX, scaleY, offsetX, offsetY, flipHorizontal, flipVertical);
 }
 
 bool rc2d_graphics_rectangle(const char* mode, const SDL_FRect *rect) 
 {
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Dessin du rectangle avec le mode spécifié (fill ou line)
     if (strcmp(mode, "fill") == 0) 
     {
@@ -279,6 +311,8 @@ bool rc2d_graphics_rectangle(const char* mode, const SDL_FRect *rect)
 
 bool rc2d_graphics_rectangles(const char* mode, const int numRects, const SDL_FRect *rects) 
 {
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Dessin des rectangles avec le mode spécifié (fill ou line)
     if (strcmp(mode, "fill") == 0) 
     {
@@ -305,6 +339,8 @@ bool rc2d_graphics_rectangles(const char* mode, const int numRects, const SDL_FR
 
 bool rc2d_graphics_line(const float x1, const float y1, const float x2, const float y2)
 {
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Dessin une ligne
     if (!SDL_RenderLine(rc2d_engine_state.renderer, x1, y1, x2, y2)) 
     {
@@ -319,6 +355,8 @@ bool rc2d_graphics_line(const float x1, const float y1, const float x2, const fl
 
 bool rc2d_graphics_lines(const int numPoints, const SDL_FPoint *points) 
 {
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Dessin des lignes
     if (!SDL_RenderLines(rc2d_engine_state.renderer, points, numPoints)) 
     {
@@ -332,6 +370,8 @@ bool rc2d_graphics_lines(const int numPoints, const SDL_FPoint *points)
 
 bool rc2d_graphics_point(const float x, const float y)
 {
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Dessin un point
     if (!SDL_RenderPoint(rc2d_engine_state.renderer, x, y)) 
     {
@@ -346,6 +386,8 @@ bool rc2d_graphics_point(const float x, const float y)
 
 bool rc2d_graphics_points(const int numPoints, const SDL_FPoint *points) 
 {
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Dessin des points
     if (!SDL_RenderPoints(rc2d_engine_state.renderer, points, numPoints)) 
     {
@@ -382,12 +424,11 @@ RC2D_ImageData rc2d_graphics_loadImageDataFromStorage(const char *storage_path,
         return imageData;
     }
 
-    // Lire le fichier depuis le stockage Title
-    void *bytes = NULL; 
-    Uint64 len = 0;
+    // Accès au fichier : mapping mémoire (Title, sans copie) ou lecture complète (User)
+    RC2D_StorageMapping file = { 0 };
     if (storage_kind == RC2D_STORAGE_TITLE) 
     {
-        if (!rc2d_storage_titleReadFile(storage_path, &bytes, &len)) 
+        if (!rc2d_storage_titleMapFile(storage_path, &file)) 
         {
             RC2D_log(RC2D_LOG_ERROR, "Failed to read '%s' from Title storage", storage_path);
             return imageData;
@@ -395,7 +436,7 @@ RC2D_ImageData rc2d_graphics_loadImageDataFromStorage(const char *storage_path,
     }
     else if (storage_kind == RC2D_STORAGE_USER) 
     {
-        if (!rc2d_storage_userReadFile(storage_path, &bytes, &len)) 
+        if (!rc2d_storage_userMapFile(storage_path, &file)) 
         {
             RC2D_log(RC2D_LOG_ERROR, "Failed to read '%s' from User storage", storage_path);
             return imageData;
@@ -403,17 +444,18 @@ RC2D_ImageData rc2d_graphics_loadImageDataFromStorage(const char *storage_path,
     }
 
     // Vérifier que le fichier n'est pas vide
-    if (len == 0 || !bytes) 
+    if (file.len == 0 || !file.data) 
     {
+        rc2d_storage_unmapFile(&file);
         RC2D_log(RC2D_LOG_ERROR, "File '%s' is empty in %s storage", storage_path, (storage_kind == RC2D_STORAGE_TITLE) ? "Title" : "User");
         return imageData;
     }
 
-    // Crée un IO stream en lecture sur le buffer (pas de copie).
-    SDL_IOStream *ioStream = SDL_IOFromConstMem(bytes, (size_t)len);
+    // Crée un IO stream en lecture sur le contenu (pas de copie).
+    SDL_IOStream *ioStream = SDL_IOFromConstMem(file.data, (size_t)file.len);
     if (!ioStream) 
     {
-        RC2D_safe_free(bytes);
+        rc2d_storage_unmapFile(&file);
         RC2D_log(RC2D_LOG_ERROR, "SDL_IOFromConstMem failed for '%s': %s", storage_path, SDL_GetError());
         return imageData;
     }
@@ -424,8 +466,8 @@ RC2D_ImageData rc2d_graphics_loadImageDataFromStorage(const char *storage_path,
      */
     SDL_Surface *surface = IMG_Load_IO(ioStream, /*closeio=*/true);
 
-    // Libération du buffer mémoire
-    RC2D_safe_free(bytes);
+    // Libération de la vue sur le fichier
+    rc2d_storage_unmapFile(&file);
 
     // Vérification de la surface
     if (!surface) 
@@ -476,12 +518,11 @@ RC2D_Image rc2d_graphics_loadImageFromStorage(const char *storage_path, RC2D_Sto
         return image;
     }
 
-    // Lire le fichier depuis le stockage Title
-    void *bytes = NULL; 
-    Uint64 len = 0;
+    // Accès au fichier : mapping mémoire (Title, sans copie) ou lecture complète (User)
+    RC2D_StorageMapping file = { 0 };
     if (storage_kind == RC2D_STORAGE_TITLE) 
     {
-        if (!rc2d_storage_titleReadFile(storage_path, &bytes, &len)) 
+        if (!rc2d_storage_titleMapFile(storage_path, &file)) 
         {
             RC2D_log(RC2D_LOG_ERROR, "Failed to read '%s' from Title storage", storage_path);
             return image;
@@ -489,7 +530,7 @@ RC2D_Image rc2d_graphics_loadImageFromStorage(const char *storage_path, RC2D_Sto
     }
     else if (storage_kind == RC2D_STORAGE_USER) 
     {
-        if (!rc2d_storage_userReadFile(storage_path, &bytes, &len)) 
+        if (!rc2d_storage_userMapFile(storage_path, &file)) 
         {
             RC2D_log(RC2D_LOG_ERROR, "Failed to read '%s' from User storage", storage_path);
             return image;
@@ -497,17 +538,18 @@ RC2D_Image rc2d_graphics_loadImageFromStorage(const char *storage_path, RC2D_Sto
     }
 
     // Vérifier que le fichier n'est pas vide
-    if (len == 0 || !bytes) 
+    if (file.len == 0 || !file.data) 
     {
+        rc2d_storage_unmapFile(&file);
         RC2D_log(RC2D_LOG_ERROR, "File '%s' is empty in %s storage", storage_path, (storage_kind == RC2D_STORAGE_TITLE) ? "Title" : "User");
         return image;
     }
 
-    // Crée un IO stream en lecture sur le buffer (pas de copie).
-    SDL_IOStream *ioStream = SDL_IOFromConstMem(bytes, (size_t)len);
+    // Crée un IO stream en lecture sur le contenu (pas de copie).
+    SDL_IOStream *ioStream = SDL_IOFromConstMem(file.data, (size_t)file.len);
     if (!ioStream) 
     {
-        RC2D_safe_free(bytes);
+        rc2d_storage_unmapFile(&file);
         RC2D_log(RC2D_LOG_ERROR, "SDL_IOFromConstMem failed for '%s': %s", storage_path, SDL_GetError());
         return image;
     }
@@ -518,8 +560,8 @@ RC2D_Image rc2d_graphics_loadImageFromStorage(const char *storage_path, RC2D_Sto
      */
     SDL_Texture *texture = IMG_LoadTexture_IO(rc2d_engine_state.renderer, ioStream, /*closeio=*/true);
 
-    // Libération du buffer mémoire
-    RC2D_safe_free(bytes);
+    // Libération de la vue sur le fichier
+    rc2d_storage_unmapFile(&file);
 
     // Vérification de la texture
     if (!texture) 
@@ -546,8 +588,120 @@ void rc2d_graphics_freeImage(RC2D_Image* image)
     }
 }
 
+bool rc2d_graphics_newHitMaskFromImageData(const RC2D_ImageData* imageData, Uint8 alphaThreshold, RC2D_HitMask* hitMask)
+{
+    if (!hitMask) return false;
+    SDL_zerop(hitMask);
+
+    if (!imageData || !imageData->sdl_surface)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_newHitMaskFromImageData: invalid imageData");
+        return false;
+    }
+
+    // Lecture de l'alpha sur 32 bits : conversion uniquement si le format source ne le permet pas
+    SDL_Surface* source = imageData->sdl_surface;
+    SDL_Surface* converted = NULL;
+    const SDL_PixelFormatDetails* details = SDL_GetPixelFormatDetails(source->format);
+    if (!details || details->bytes_per_pixel != 4 || details->Abits != 8)
+    {
+        converted = SDL_ConvertSurface(source, SDL_PIXELFORMAT_ARGB8888);
+        if (!converted)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_newHitMaskFromImageData: SDL_ConvertSurface failed: %s", SDL_GetError());
+            return false;
+        }
+        source = converted;
+        details = SDL_GetPixelFormatDetails(source->format);
+    }
+
+    const int stride = (source->w + 7) / 8;
+    Uint8* bits = (Uint8*)RC2D_calloc((size_t)stride * (size_t)source->h, 1);
+    if (!bits)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_newHitMaskFromImageData: failed to allocate %dx%d mask", source->w, source->h);
+        if (converted) SDL_DestroySurface(converted);
+        return false;
+    }
+
+    if (SDL_MUSTLOCK(source)) SDL_LockSurface(source);
+    for (int y = 0; y < source->h; ++y)
+    {
+        const Uint32* row = (const Uint32*)((const Uint8*)source->pixels + (size_t)y * (size_t)source->pitch);
+        Uint8* out = bits + (size_t)y * (size_t)stride;
+        for (int x = 0; x < source->w; ++x)
+        {
+            const Uint8 alpha = (Uint8)((row[x] & details->Amask) >> details->Ashift);
+            if (alpha > alphaThreshold) out[x >> 3] |= (Uint8)(1u << (x & 7));
+        }
+    }
+    if (SDL_MUSTLOCK(source)) SDL_UnlockSurface(source);
+
+    if (converted) SDL_DestroySurface(converted);
+
+    hitMask->bits = bits;
+    hitMask->w = imageData->sdl_surface->w;
+    hitMask->h = imageData->sdl_surface->h;
+    hitMask->stride = stride;
+    return true;
+}
+
+RC2D_Image rc2d_graphics_loadImageWithHitMaskFromStorage(const char* storage_path, RC2D_StorageKind storage_kind,
+                                                         Uint8 alphaThreshold, RC2D_HitMask* hitMask)
+{
+    RC2D_Image image = { NULL };
+    if (!hitMask)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_loadImageWithHitMaskFromStorage: hitMask is NULL");
+        return image;
+    }
+    SDL_zerop(hitMask);
+
+    // Une seule lecture + un seul décodage : la surface sert au masque puis à la texture
+    RC2D_ImageData imageData = rc2d_graphics_loadImageDataFromStorage(storage_path, storage_kind);
+    if (!imageData.sdl_surface)
+    {
+        return image;
+    }
+
+    if (!rc2d_graphics_newHitMaskFromImageData(&imageData, alphaThreshold, hitMask))
+    {
+        rc2d_graphics_freeImageData(&imageData);
+        return image;
+    }
+
+    image.sdl_texture = SDL_CreateTextureFromSurface(rc2d_engine_state.renderer, imageData.sdl_surface);
+    rc2d_graphics_freeImageData(&imageData);
+    if (!image.sdl_texture)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "SDL_CreateTextureFromSurface('%s') failed: %s", storage_path, SDL_GetError());
+        rc2d_graphics_freeHitMask(hitMask);
+    }
+
+    return image;
+}
+
+bool rc2d_graphics_hitMaskTest(const RC2D_HitMask* hitMask, int x, int y)
+{
+    if (!hitMask || !hitMask->bits) return false;
+    if (x < 0 || y < 0 || x >= hitMask->w || y >= hitMask->h) return false;
+
+    return (hitMask->bits[(size_t)y * (size_t)hitMask->stride + (size_t)(x >> 3)] >> (x & 7)) & 1u;
+}
+
+void rc2d_graphics_freeHitMask(RC2D_HitMask* hitMask)
+{
+    if (!hitMask) return;
+
+    RC2D_safe_free(hitMask->bits);
+    SDL_zerop(hitMask);
+}
+
 bool rc2d_graphics_setColor(const RC2D_Color color)
 {
+    // Les sprites déjà batchés doivent partir avec l'ancienne couleur
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Mise à jour de la couleur courante
     rc2d_graphics_currentRenderColor = color;
 
@@ -599,6 +753,9 @@ bool rc2d_graphics_setBlendMode(const RC2D_BlendMode blendMode)
             break;
     }
 
+    // Les sprites déjà batchés doivent partir avec l'ancien mode de blend
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Vérification de la validité du mode de blend et application
     if(!SDL_SetRenderDrawBlendMode(rc2d_engine_state.renderer, sdlBlendMode)) 
     {
@@ -613,6 +770,9 @@ bool rc2d_graphics_setBlendMode(const RC2D_BlendMode blendMode)
 
 bool rc2d_graphics_scale(float scaleX, float scaleY) 
 {
+    // Les sprites déjà batchés doivent partir avec l'ancien scale
+    rc2d_graphics_flushActiveSpriteBatch();
+
     // Application du scale au renderer
     if(!SDL_SetRenderScale(rc2d_engine_state.renderer, scaleX, scaleY)) 
     {
@@ -625,6 +785,213 @@ bool rc2d_graphics_scale(float scaleX, float scaleY)
     return true;
 }
 
+/* ------------------------------------------------------------------------- */
+/*                               Sprite batch                                */
+/* ------------------------------------------------------------------------- */
+
+/* Agrandit le lot pour contenir au moins `needed` sprites (indices pré-remplis). */
+static bool rc2d_graphics_growSpriteBatch(RC2D_SpriteBatch* batch, int needed)
+{
+    int newCapacity = batch->capacity > 0 ? batch->capacity : RC2D_SPRITEBATCH_DEFAULT_CAPACITY;
+    while (newCapacity < needed) newCapacity *= 2;
+
+    SDL_Vertex* vertices = (SDL_Vertex*)RC2D_realloc(batch->vertices, (size_t)newCapacity * 4 * sizeof(SDL_Vertex));
+    if (!vertices)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_growSpriteBatch: out of memory (vertices)");
+        return false;
+    }
+    batch->vertices = vertices;
+
+    int* indices = (int*)RC2D_realloc(batch->indices, (size_t)newCapacity * 6 * sizeof(int));
+    if (!indices)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_growSpriteBatch: out of memory (indices)");
+        return false;
+    }
+    batch->indices = indices;
+
+    // Motif d'indices constant : 2 triangles (0,1,2) et (0,2,3) par sprite
+    for (int i = batch->capacity; i < newCapacity; ++i)
+    {
+        const int v = i * 4;
+        int* idx = &batch->indices[i * 6];
+        idx[0] = v + 0; idx[1] = v + 1; idx[2] = v + 2;
+        idx[3] = v + 0; idx[4] = v + 2; idx[5] = v + 3;
+    }
+
+    batch->capacity = newCapacity;
+    return true;
+}
+
+RC2D_SpriteBatch* rc2d_graphics_newSpriteBatch(int capacity)
+{
+    RC2D_SpriteBatch* batch = (RC2D_SpriteBatch*)RC2D_calloc(1, sizeof(RC2D_SpriteBatch));
+    if (!batch)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_newSpriteBatch: out of memory");
+        return NULL;
+    }
+
+    if (!rc2d_graphics_growSpriteBatch(batch, capacity > 0 ? capacity : RC2D_SPRITEBATCH_DEFAULT_CAPACITY))
+    {
+        rc2d_graphics_freeSpriteBatch(batch);
+        return NULL;
+    }
+
+    return batch;
+}
+
+void rc2d_graphics_freeSpriteBatch(RC2D_SpriteBatch* batch)
+{
+    if (!batch) return;
+
+    if (rc2d_graphics_activeSpriteBatch == batch)
+    {
+        rc2d_graphics_activeSpriteBatch = NULL;
+    }
+
+    RC2D_safe_free(batch->vertices);
+    RC2D_safe_free(batch->indices);
+    RC2D_free(batch);
+}
+
+bool rc2d_graphics_addToSpriteBatch(RC2D_SpriteBatch* batch, RC2D_Image* image, const RC2D_Quad* quad,
+                                    float x, float y,
+                                    double angle,
+                                    float scaleX, float scaleY,
+                                    float offsetX, float offsetY,
+                                    bool flipHorizontal, bool flipVertical,
+                                    RC2D_Color color)
+{
+    if (!batch || !image || !image->sdl_texture)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_addToSpriteBatch: invalid batch or image/texture");
+        return false;
+    }
+
+    SDL_Texture* texture = image->sdl_texture;
+    const float texW = (float)texture->w;
+    const float texH = (float)texture->h;
+    if (texW <= 0.0f || texH <= 0.0f) return false;
+
+    // Rectangle source (texture entière si quad == NULL)
+    SDL_FRect src = { 0.0f, 0.0f, texW, texH };
+    if (quad)
+    {
+        if (quad->src.w <= 0.0f || quad->src.h <= 0.0f)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_graphics_addToSpriteBatch: invalid quad");
+            return false;
+        }
+        src = quad->src;
+    }
+
+    // Un lot = une texture : changer de texture flushe les sprites en attente
+    if (batch->count > 0 && batch->texture != texture)
+    {
+        rc2d_graphics_flushSpriteBatch(batch);
+    }
+    if (batch->count >= batch->capacity && !rc2d_graphics_growSpriteBatch(batch, batch->count + 1))
+    {
+        return false;
+    }
+    batch->texture = texture;
+
+    // Taille destination et centre de rotation (mêmes règles que rc2d_graphics_drawQuad)
+    const float w = src.w * scaleX;
+    const float h = src.h * scaleY;
+    float cx = w * 0.5f;
+    float cy = h * 0.5f;
+    if (offsetX >= 0.0f && offsetY >= 0.0f)
+    {
+        cx = offsetX * scaleX;
+        cy = offsetY * scaleY;
+    }
+
+    // Coins relatifs au centre de rotation, dans l'ordre : haut-gauche, haut-droit, bas-droit, bas-gauche
+    const float lx[4] = { -cx, w - cx, w - cx, -cx };
+    const float ly[4] = { -cy, -cy, h - cy, h - cy };
+
+    float c = 1.0f, s = 0.0f;
+    if (angle != 0.0)
+    {
+        const double rad = angle * (SDL_PI_D / 180.0);
+        c = (float)SDL_cos(rad);
+        s = (float)SDL_sin(rad);
+    }
+
+    // Coordonnées de texture normalisées (le retournement échange les bords)
+    float u0 = src.x / texW, u1 = (src.x + src.w) / texW;
+    float v0 = src.y / texH, v1 = (src.y + src.h) / texH;
+    if (flipHorizontal) { const float t = u0; u0 = u1; u1 = t; }
+    if (flipVertical)   { const float t = v0; v0 = v1; v1 = t; }
+    const float us[4] = { u0, u1, u1, u0 };
+    const float vs[4] = { v0, v0, v1, v1 };
+
+    const SDL_FColor fcolor = {
+        color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f
+    };
+
+    SDL_Vertex* v = &batch->vertices[batch->count * 4];
+    for (int i = 0; i < 4; ++i)
+    {
+        v[i].position.x = x + cx + lx[i] * c - ly[i] * s;
+        v[i].position.y = y + cy + lx[i] * s + ly[i] * c;
+        v[i].color = fcolor;
+        v[i].tex_coord.x = us[i];
+        v[i].tex_coord.y = vs[i];
+    }
+
+    batch->count++;
+    return true;
+}
+
+bool rc2d_graphics_flushSpriteBatch(RC2D_SpriteBatch* batch)
+{
+    if (!batch || batch->count == 0) return true;
+
+    bool ok = SDL_RenderGeometry(rc2d_engine_state.renderer, batch->texture,
+                                 batch->vertices, batch->count * 4,
+                                 batch->indices, batch->count * 6);
+    if (!ok)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "SDL_RenderGeometry (sprite batch) failed: %s", SDL_GetError());
+    }
+
+    rc2d_graphics_clearSpriteBatch(batch);
+    return ok;
+}
+
+void rc2d_graphics_clearSpriteBatch(RC2D_SpriteBatch* batch)
+{
+    if (!batch) return;
+
+    batch->count = 0;
+    batch->texture = NULL;
+}
+
+int rc2d_graphics_getSpriteBatchCount(const RC2D_SpriteBatch* batch)
+{
+    return batch ? batch->count : 0;
+}
+
+void rc2d_graphics_setSpriteBatch(RC2D_SpriteBatch* batch)
+{
+    // Dessiner ce qui reste dans l'ancien lot avant de le remplacer
+    if (rc2d_graphics_activeSpriteBatch != batch)
+    {
+        rc2d_graphics_flushActiveSpriteBatch();
+    }
+
+    rc2d_graphics_activeSpriteBatch = batch;
+}
+
+RC2D_SpriteBatch* rc2d_graphics_getSpriteBatch(void)
+{
+    return rc2d_graphics_activeSpriteBatch;
+}
+
 RC2D_Font rc2d_graphics_openFontFromStorage(const char* storage_path, RC2D_StorageKind storage_kind, float fontSize)
 {
     // Initialisation de la police vide
@@ -974,6 +1341,8 @@ bool rc2d_graphics_drawText(RC2D_Text* text, float x, float y)
     // Vérification des paramètres
     if (!text || !text->sdl_text) return false;
 
+    rc2d_graphics_flushActiveSpriteBatch();
+
     if(!TTF_DrawRendererText(text->sdl_text, x, y))
     {
         RC2D_log(RC2D_LOG_ERROR, "Failed to draw text: %s\n", SDL_GetError());
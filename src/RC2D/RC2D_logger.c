@@ -1,6 +1,28 @@
 #include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_thread.h>
 
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
 #include <SDL3/SDL_log.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_timer.h>
+
+#if (RC2D_LOGGER_RING_CAPACITY & (RC2D_LOGGER_RING_CAPACITY - 1)) != 0
+#error "RC2D_LOGGER_RING_CAPACITY doit être une puissance de 2"
+#endif
+
+#define RC2D_LOGGER_RING_MASK ((Uint32)RC2D_LOGGER_RING_CAPACITY - 1)
+
+/* Délai maximal de sommeil du thread du logger, filet de sécurité si un réveil est manqué */
+#define RC2D_LOGGER_IDLE_TIMEOUT_MS 100
+
+#if defined(_MSC_VER)
+#define RC2D_THREAD_LOCAL __declspec(thread)
+#else
+#define RC2D_THREAD_LOCAL __thread
+#endif
 
 /**
  * Définities le niveau de log par défaut à RC2D_LOG_DEBUG
@@ -8,19 +30,62 @@
  */
 static RC2D_LogLevel currentLogLevel = RC2D_LOG_DEBUG;
 
+/*
+ * File circulaire bornée à plusieurs producteurs (file de D. Vyukov) : chaque case porte un
+ * numéro de séquence. Un producteur réserve la position 'pos' par CAS quand sequence == pos,
+ * écrit le message puis publie sequence = pos + 1. Le thread du logger (unique consommateur)
+ * lit la case quand sequence == pos + 1 et la rend avec sequence = pos + capacité.
+ */
+typedef struct RC2D_LogRecord {
+    SDL_AtomicU32 sequence;
+    RC2D_LogLevel level;
+    size_t length;
+    char text[RC2D_LOGGER_RECORD_SIZE];
+} RC2D_LogRecord;
+
+static RC2D_LogRecord rc2d_logger_ring[RC2D_LOGGER_RING_CAPACITY];
+static bool rc2d_logger_ringReady = false;
+static SDL_AtomicU32 rc2d_logger_enqueuePos;
+static Uint32 rc2d_logger_dequeuePos = 0;   // uniquement lu/écrit par le consommateur
+
+static SDL_AtomicInt rc2d_logger_asyncEnabled;
+static SDL_AtomicInt rc2d_logger_quitRequested;
+static SDL_AtomicInt rc2d_logger_sleeping;
+static SDL_AtomicInt rc2d_logger_dropped;
+static int rc2d_logger_droppedReported = 0;  // consommateur
+static RC2D_Thread* rc2d_logger_thread = NULL;
+static SDL_Semaphore* rc2d_logger_wakeup = NULL;
+static RC2D_THREAD_LOCAL bool rc2d_logger_isDrainThread = false;
+
+/*
+ * rc2d_logger_mutex protège les sorties (fichier) et rc2d_logger_drainedPos.
+ * Il n'existe qu'une fois le mode asynchrone ou le fichier de log activé : sans eux,
+ * le log SDL (thread-safe) est la seule sortie et aucun verrou n'est pris.
+ */
+static SDL_Mutex* rc2d_logger_mutex = NULL;
+static SDL_Condition* rc2d_logger_drained = NULL;
+static Uint32 rc2d_logger_drainedPos = 0;
+
+static SDL_AtomicInt rc2d_logger_consoleDisabled;
+static SDL_IOStream* rc2d_logger_file = NULL;
+static char rc2d_logger_filePath[1024];
+static Sint64 rc2d_logger_fileBytes = 0;
+static Sint64 rc2d_logger_fileMaxBytes = 0;
+static int rc2d_logger_fileMaxCount = 0;
+
 /**
  * Convertit le niveau de log RC2D en chaîne de caractères.
  *
  * @param {RC2D_LogLevel} level - Le niveau de log à convertir.
  * @return {const char*} - La chaîne de caractères représentant le niveau de log.
- * 
+ *
  * \threadsafety Cette fonction peut être appelée depuis n'importe quel thread.
- * 
+ *
  * \since Cette fonction est disponible depuis RC2D 1.0.0.
  */
-static const char* rc2d_logger_log_level_to_string(RC2D_LogLevel level) 
+static const char* rc2d_logger_log_level_to_string(RC2D_LogLevel level)
 {
-    switch (level) 
+    switch (level)
     {
         case RC2D_LOG_TRACE:     return "trace";
         case RC2D_LOG_VERBOSE:   return "verbose";
@@ -33,32 +98,455 @@ static const char* rc2d_logger_log_level_to_string(RC2D_LogLevel level)
     }
 }
 
+/**
+ * Convertit le niveau de log RC2D en priorité SDL correspondante.
+ *
+ * @param {RC2D_LogLevel} level - Le niveau de log à convertir.
+ * @return {SDL_LogPriority} - La priorité SDL.
+ */
+static SDL_LogPriority rc2d_logger_log_level_to_sdl(RC2D_LogLevel level)
+{
+    switch (level)
+    {
+        case RC2D_LOG_TRACE:     return SDL_LOG_PRIORITY_TRACE;
+        case RC2D_LOG_VERBOSE:   return SDL_LOG_PRIORITY_VERBOSE;
+        case RC2D_LOG_DEBUG:     return SDL_LOG_PRIORITY_DEBUG;
+        case RC2D_LOG_INFO:      return SDL_LOG_PRIORITY_INFO;
+        case RC2D_LOG_WARN:      return SDL_LOG_PRIORITY_WARN;
+        case RC2D_LOG_ERROR:     return SDL_LOG_PRIORITY_ERROR;
+        case RC2D_LOG_CRITICAL:  return SDL_LOG_PRIORITY_CRITICAL;
+        default:                 return SDL_LOG_PRIORITY_INFO;
+    }
+}
+
+/**
+ * Formate "[niveau:fichier:ligne:fonction] message" dans un seul buffer.
+ *
+ * @param buffer Buffer de destination.
+ * @param size Taille du buffer.
+ * @param args Arguments du format (consommés).
+ * @return Longueur du texte écrit (sans le '\0'), tronquée à size - 1.
+ */
+static size_t rc2d_logger_format(char* buffer, size_t size, RC2D_LogLevel logLevel, const char* file, int line,
+                                 const char* function, const char* format, va_list args)
+{
+    const char* filename = SDL_strrchr(file, '/');
+    if (!filename) filename = SDL_strrchr(file, '\\');
+    filename = filename ? filename + 1 : file;
+
+    int prefixLength = SDL_snprintf(buffer, size, "[%s:%s:%d:%s] ",
+                                    rc2d_logger_log_level_to_string(logLevel), filename, line, function);
+    if (prefixLength < 0)
+    {
+        prefixLength = 0;
+        buffer[0] = '\0';
+    }
+    if ((size_t)prefixLength >= size)
+    {
+        return size - 1;
+    }
+
+    const int messageLength = SDL_vsnprintf(buffer + prefixLength, size - (size_t)prefixLength, format, args);
+    if (messageLength < 0)
+    {
+        buffer[prefixLength] = '\0';
+        return (size_t)prefixLength;
+    }
+
+    const size_t length = (size_t)prefixLength + (size_t)messageLength;
+    return length < size ? length : size - 1;
+}
+
+/**
+ * Archive le fichier de log : <path>.N est supprimé, <path>.i devient <path>.(i+1), <path> devient <path>.1.
+ * Appelée avec rc2d_logger_mutex verrouillé. Les erreurs sont ignorées (le logger ne peut pas se journaliser).
+ */
+static void rc2d_logger_rotateFile(void)
+{
+    SDL_CloseIO(rc2d_logger_file);
+    rc2d_logger_file = NULL;
+
+    char from[sizeof(rc2d_logger_filePath) + 16];
+    char to[sizeof(rc2d_logger_filePath) + 16];
+    if (rc2d_logger_fileMaxCount > 0)
+    {
+        SDL_snprintf(from, sizeof(from), "%s.%d", rc2d_logger_filePath, rc2d_logger_fileMaxCount);
+        SDL_RemovePath(from);
+        for (int i = rc2d_logger_fileMaxCount - 1; i >= 1; i--)
+        {
+            SDL_snprintf(from, sizeof(from), "%s.%d", rc2d_logger_filePath, i);
+            SDL_snprintf(to, sizeof(to), "%s.%d", rc2d_logger_filePath, i + 1);
+            SDL_RenamePath(from, to);
+        }
+        SDL_snprintf(to, sizeof(to), "%s.1", rc2d_logger_filePath);
+        SDL_RenamePath(rc2d_logger_filePath, to);
+    }
+
+    rc2d_logger_file = SDL_IOFromFile(rc2d_logger_filePath, "wb");
+    rc2d_logger_fileBytes = 0;
+}
+
+/**
+ * Écrit un message dans les sorties actives.
+ * Appelée avec rc2d_logger_mutex verrouillé s'il existe.
+ */
+static void rc2d_logger_writeSinks(RC2D_LogLevel logLevel, const char* text, size_t length)
+{
+    if (!SDL_GetAtomicInt(&rc2d_logger_consoleDisabled))
+    {
+        SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, rc2d_logger_log_level_to_sdl(logLevel), "%s", text);
+    }
+
+    if (rc2d_logger_file)
+    {
+        SDL_WriteIO(rc2d_logger_file, text, length);
+        SDL_WriteIO(rc2d_logger_file, "\n", 1);
+        rc2d_logger_fileBytes += (Sint64)length + 1;
+        if (rc2d_logger_fileMaxBytes > 0 && rc2d_logger_fileBytes >= rc2d_logger_fileMaxBytes)
+        {
+            rc2d_logger_rotateFile();
+        }
+    }
+}
+
+static bool rc2d_logger_createMutex(void)
+{
+    if (!rc2d_logger_mutex) rc2d_logger_mutex = SDL_CreateMutex();
+    if (!rc2d_logger_drained) rc2d_logger_drained = SDL_CreateCondition();
+    return rc2d_logger_mutex && rc2d_logger_drained;
+}
+
+/**
+ * Réserve une case de la file.
+ *
+ * @param out_pos [out] Position réservée, à passer à rc2d_logger_commit().
+ * @return La case réservée, ou NULL si la file est pleine.
+ */
+static RC2D_LogRecord* rc2d_logger_reserve(Uint32* out_pos)
+{
+    Uint32 pos = SDL_GetAtomicU32(&rc2d_logger_enqueuePos);
+    for (;;)
+    {
+        RC2D_LogRecord* record = &rc2d_logger_ring[pos & RC2D_LOGGER_RING_MASK];
+        const Sint32 diff = (Sint32)(SDL_GetAtomicU32(&record->sequence) - pos);
+        if (diff == 0)
+        {
+            if (SDL_CompareAndSwapAtomicU32(&rc2d_logger_enqueuePos, pos, pos + 1))
+            {
+                *out_pos = pos;
+                return record;
+            }
+        }
+        else if (diff < 0)
+        {
+            // La case n'a pas encore été rendue par le consommateur : file pleine
+            return NULL;
+        }
+        pos = SDL_GetAtomicU32(&rc2d_logger_enqueuePos);
+    }
+}
+
+static void rc2d_logger_commit(RC2D_LogRecord* record, Uint32 pos)
+{
+    SDL_SetAtomicU32(&record->sequence, pos + 1);
+
+    // Réveille le thread du logger seulement s'il s'est endormi : pas d'appel système sinon
+    if (SDL_CompareAndSwapAtomicInt(&rc2d_logger_sleeping, 1, 0))
+    {
+        SDL_SignalSemaphore(rc2d_logger_wakeup);
+    }
+}
+
+/**
+ * Vide la file vers les sorties. Seul le consommateur courant (thread du logger, ou le thread
+ * principal une fois le thread arrêté) peut l'appeler.
+ *
+ * @return Nombre de messages écrits.
+ */
+static int rc2d_logger_drain(void)
+{
+    int written = 0;
+
+    SDL_LockMutex(rc2d_logger_mutex);
+    for (;;)
+    {
+        RC2D_LogRecord* record = &rc2d_logger_ring[rc2d_logger_dequeuePos & RC2D_LOGGER_RING_MASK];
+        if ((Sint32)(SDL_GetAtomicU32(&record->sequence) - (rc2d_logger_dequeuePos + 1)) < 0)
+        {
+            // Case vide, ou réservée mais pas encore publiée par son producteur
+            break;
+        }
+
+        rc2d_logger_writeSinks(record->level, record->text, record->length);
+        SDL_SetAtomicU32(&record->sequence, rc2d_logger_dequeuePos + RC2D_LOGGER_RING_CAPACITY);
+        rc2d_logger_dequeuePos++;
+        written++;
+    }
+
+    const int dropped = SDL_GetAtomicInt(&rc2d_logger_dropped);
+    if (dropped != rc2d_logger_droppedReported)
+    {
+        char text[128];
+        const int length = SDL_snprintf(text, sizeof(text), "[warn:RC2D_logger.c] %d message(s) de log perdu(s) : file du logger pleine",
+                                        dropped - rc2d_logger_droppedReported);
+        rc2d_logger_writeSinks(RC2D_LOG_WARN, text, length > 0 ? (size_t)length : 0);
+        rc2d_logger_droppedReported = dropped;
+    }
+
+    if (written > 0 && rc2d_logger_file)
+    {
+        SDL_FlushIO(rc2d_logger_file);
+    }
+
+    rc2d_logger_drainedPos = rc2d_logger_dequeuePos;
+    SDL_BroadcastCondition(rc2d_logger_drained);
+    SDL_UnlockMutex(rc2d_logger_mutex);
+
+    return written;
+}
+
+static bool rc2d_logger_ringIsEmpty(void)
+{
+    RC2D_LogRecord* record = &rc2d_logger_ring[rc2d_logger_dequeuePos & RC2D_LOGGER_RING_MASK];
+    return (Sint32)(SDL_GetAtomicU32(&record->sequence) - (rc2d_logger_dequeuePos + 1)) < 0;
+}
+
+static int rc2d_logger_worker(void* data)
+{
+    (void)data;
+    rc2d_logger_isDrainThread = true;
+
+    while (!SDL_GetAtomicInt(&rc2d_logger_quitRequested))
+    {
+        if (rc2d_logger_drain() > 0)
+        {
+            continue;
+        }
+
+        // Se déclare endormi PUIS revérifie la file : un producteur qui publie entre les deux nous réveille
+        SDL_SetAtomicInt(&rc2d_logger_sleeping, 1);
+        if (rc2d_logger_ringIsEmpty() && !SDL_GetAtomicInt(&rc2d_logger_quitRequested))
+        {
+            SDL_WaitSemaphoreTimeout(rc2d_logger_wakeup, RC2D_LOGGER_IDLE_TIMEOUT_MS);
+        }
+        SDL_SetAtomicInt(&rc2d_logger_sleeping, 0);
+    }
+
+    rc2d_logger_drain();
+    return 0;
+}
+
 RC2D_LogLevel rc2d_logger_get_priority(void)
 {
     return currentLogLevel;
 }
 
-void rc2d_logger_set_priority(const RC2D_LogLevel logLevel) 
+void rc2d_logger_set_priority(const RC2D_LogLevel logLevel)
 {
     // Enregistre le niveau de log actuel
     currentLogLevel = logLevel;
 
-    // Convertit le niveau de log de RC2D en priorite SDL correspondante.
-    SDL_LogPriority logPriority;
-    switch(logLevel) 
+    // Definit la priorite de log pour toutes les categories
+    SDL_SetLogPriorities(rc2d_logger_log_level_to_sdl(logLevel));
+}
+
+bool rc2d_logger_should_log_throttled(SDL_AtomicU32* lastTicks, Uint32 intervalMs)
+{
+    // 0 est réservé à "jamais affiché" ; les différences non signées restent justes après le rebouclage (~49 jours)
+    Uint32 now = (Uint32)SDL_GetTicks();
+    if (now == 0) now = 1;
+
+    const Uint32 last = SDL_GetAtomicU32(lastTicks);
+    if (last != 0 && now - last < intervalMs)
     {
-        case RC2D_LOG_TRACE:     logPriority = SDL_LOG_PRIORITY_TRACE;     break;
-        case RC2D_LOG_VERBOSE:   logPriority = SDL_LOG_PRIORITY_VERBOSE;   break;
-        case RC2D_LOG_DEBUG:     logPriority = SDL_LOG_PRIORITY_DEBUG;     break;
-        case RC2D_LOG_INFO:      logPriority = SDL_LOG_PRIORITY_INFO;      break;
-        case RC2D_LOG_WARN:      logPriority = SDL_LOG_PRIORITY_WARN;      break;
-        case RC2D_LOG_ERROR:     logPriority = SDL_LOG_PRIORITY_ERROR;     break;
-        case RC2D_LOG_CRITICAL:  logPriority = SDL_LOG_PRIORITY_CRITICAL;  break;
-        default:                 logPriority = SDL_LOG_PRIORITY_INFO;       break;
+        return false;
     }
 
-    // Definit la priorite de log pour toutes les categories
-    SDL_SetLogPriorities(logPriority);
+    // Plusieurs threads peuvent arriver en même temps : seul celui qui avance l'instant affiche le message
+    return SDL_CompareAndSwapAtomicU32(lastTicks, last, now);
+}
+
+bool rc2d_logger_set_async(bool enabled)
+{
+    if (enabled == (rc2d_logger_thread != NULL))
+    {
+        return true;
+    }
+
+    if (enabled)
+    {
+        if (!rc2d_logger_createMutex() || (!rc2d_logger_wakeup && !(rc2d_logger_wakeup = SDL_CreateSemaphore(0))))
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_logger_set_async: failed to create synchronization primitives: %s", SDL_GetError());
+            return false;
+        }
+
+        // Les positions ne sont jamais remises à zéro : la file n'est initialisée qu'une fois
+        if (!rc2d_logger_ringReady)
+        {
+            for (Uint32 i = 0; i < RC2D_LOGGER_RING_CAPACITY; i++)
+            {
+                SDL_SetAtomicU32(&rc2d_logger_ring[i].sequence, i);
+            }
+            rc2d_logger_ringReady = true;
+        }
+
+        SDL_SetAtomicInt(&rc2d_logger_quitRequested, 0);
+        rc2d_logger_thread = rc2d_thread_new(rc2d_logger_worker, "rc2d_logger", NULL);
+        if (!rc2d_logger_thread)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_logger_set_async: failed to start logger thread");
+            return false;
+        }
+
+        SDL_SetAtomicInt(&rc2d_logger_asyncEnabled, 1);
+        return true;
+    }
+
+    // Les nouveaux messages repassent en synchrone ; le thread vide la file avant de s'arrêter
+    SDL_SetAtomicInt(&rc2d_logger_asyncEnabled, 0);
+    SDL_SetAtomicInt(&rc2d_logger_quitRequested, 1);
+    SDL_SignalSemaphore(rc2d_logger_wakeup);
+    rc2d_thread_wait(rc2d_logger_thread, NULL);
+    rc2d_logger_thread = NULL;
+
+    // Un producteur qui a vu le mode asynchrone juste avant l'arrêt a pu publier après le dernier vidage
+    rc2d_logger_drain();
+    return true;
+}
+
+void rc2d_logger_set_console_enabled(bool enabled)
+{
+    SDL_SetAtomicInt(&rc2d_logger_consoleDisabled, enabled ? 0 : 1);
+}
+
+bool rc2d_logger_set_file_sink(const char* path, Sint64 maxBytes, int maxFiles)
+{
+    SDL_IOStream* file = NULL;
+    Sint64 size = 0;
+
+    if (path)
+    {
+        // Même règle que le storage : pas de chemin absolu ni de remontée hors du storage user
+        const char* root = rc2d_storage_getUserRoot();
+        if (!root || path[0] == '/' || SDL_strstr(path, "..") != NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_logger_set_file_sink: user storage not open or invalid path '%s'", path);
+            return false;
+        }
+        if (maxBytes < 0 || maxFiles < 0)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_logger_set_file_sink: maxBytes and maxFiles must be positive");
+            return false;
+        }
+
+        char fullPath[sizeof(rc2d_logger_filePath)];
+        if (SDL_snprintf(fullPath, sizeof(fullPath), "%s%s", root, path) >= (int)sizeof(fullPath))
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_logger_set_file_sink: path too long '%s'", path);
+            return false;
+        }
+
+        if (!rc2d_logger_createMutex())
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_logger_set_file_sink: failed to create synchronization primitives: %s", SDL_GetError());
+            return false;
+        }
+
+        // SDL_Storage ne sait pas ajouter à un fichier : le fichier est ouvert directement dans la racine du storage user
+        file = SDL_IOFromFile(fullPath, "ab");
+        if (!file)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_logger_set_file_sink: cannot open '%s': %s", path, SDL_GetError());
+            return false;
+        }
+        size = SDL_GetIOSize(file);
+
+        SDL_LockMutex(rc2d_logger_mutex);
+        SDL_strlcpy(rc2d_logger_filePath, fullPath, sizeof(rc2d_logger_filePath));
+    }
+    else if (rc2d_logger_mutex)
+    {
+        SDL_LockMutex(rc2d_logger_mutex);
+    }
+    else
+    {
+        // Aucun fichier n'a jamais été ouvert
+        return true;
+    }
+
+    if (rc2d_logger_file)
+    {
+        SDL_CloseIO(rc2d_logger_file);
+    }
+    rc2d_logger_file = file;
+    rc2d_logger_fileBytes = size > 0 ? size : 0;
+    rc2d_logger_fileMaxBytes = maxBytes;
+    rc2d_logger_fileMaxCount = maxFiles;
+    SDL_UnlockMutex(rc2d_logger_mutex);
+
+    return true;
+}
+
+void rc2d_logger_flush(void)
+{
+    if (!rc2d_logger_mutex)
+    {
+        return;
+    }
+
+    if (!SDL_GetAtomicInt(&rc2d_logger_asyncEnabled) || rc2d_logger_isDrainThread)
+    {
+        SDL_LockMutex(rc2d_logger_mutex);
+        if (rc2d_logger_file) SDL_FlushIO(rc2d_logger_file);
+        SDL_UnlockMutex(rc2d_logger_mutex);
+        return;
+    }
+
+    // Attend que le consommateur ait dépassé tout ce qui a été réservé jusqu'ici
+    const Uint32 target = SDL_GetAtomicU32(&rc2d_logger_enqueuePos);
+    if (SDL_CompareAndSwapAtomicInt(&rc2d_logger_sleeping, 1, 0))
+    {
+        SDL_SignalSemaphore(rc2d_logger_wakeup);
+    }
+
+    SDL_LockMutex(rc2d_logger_mutex);
+    while ((Sint32)(rc2d_logger_drainedPos - target) < 0 && SDL_GetAtomicInt(&rc2d_logger_asyncEnabled))
+    {
+        SDL_WaitConditionTimeout(rc2d_logger_drained, rc2d_logger_mutex, RC2D_LOGGER_IDLE_TIMEOUT_MS);
+    }
+    SDL_UnlockMutex(rc2d_logger_mutex);
+}
+
+int rc2d_logger_get_dropped_count(void)
+{
+    return SDL_GetAtomicInt(&rc2d_logger_dropped);
+}
+
+void rc2d_logger_quit(void)
+{
+    if (rc2d_logger_thread)
+    {
+        rc2d_logger_set_async(false);
+    }
+
+    rc2d_logger_set_file_sink(NULL, 0, 0);
+
+    if (rc2d_logger_wakeup)
+    {
+        SDL_DestroySemaphore(rc2d_logger_wakeup);
+        rc2d_logger_wakeup = NULL;
+    }
+    if (rc2d_logger_drained)
+    {
+        SDL_DestroyCondition(rc2d_logger_drained);
+        rc2d_logger_drained = NULL;
+    }
+    if (rc2d_logger_mutex)
+    {
+        SDL_DestroyMutex(rc2d_logger_mutex);
+        rc2d_logger_mutex = NULL;
+    }
 }
 
 void rc2d_logger_log(const RC2D_LogLevel logLevel, const char* file, int line, const char* function, const char* format, ...)
@@ -69,40 +557,53 @@ void rc2d_logger_log(const RC2D_LogLevel logLevel, const char* file, int line, c
      */
     if (logLevel < currentLogLevel) return;
 
-    // Convertit le niveau de log de RC2D en priorite SDL correspondante.
-    SDL_LogPriority sdlPriority;
-    switch (logLevel) 
+    va_list args;
+
+    // Mode asynchrone : le message est formaté directement dans la file (jamais depuis le thread du logger)
+    if (SDL_GetAtomicInt(&rc2d_logger_asyncEnabled) && !rc2d_logger_isDrainThread)
     {
-        case RC2D_LOG_TRACE:     sdlPriority = SDL_LOG_PRIORITY_TRACE;     break;
-        case RC2D_LOG_VERBOSE:   sdlPriority = SDL_LOG_PRIORITY_VERBOSE;   break;
-        case RC2D_LOG_DEBUG:     sdlPriority = SDL_LOG_PRIORITY_DEBUG;     break;
-        case RC2D_LOG_INFO:      sdlPriority = SDL_LOG_PRIORITY_INFO;      break;
-        case RC2D_LOG_WARN:      sdlPriority = SDL_LOG_PRIORITY_WARN;      break;
-        case RC2D_LOG_ERROR:     sdlPriority = SDL_LOG_PRIORITY_ERROR;     break;
-        case RC2D_LOG_CRITICAL:  sdlPriority = SDL_LOG_PRIORITY_CRITICAL;  break;
-        default:                 sdlPriority = SDL_LOG_PRIORITY_INFO;       break;
-    }
+        Uint32 pos = 0;
+        RC2D_LogRecord* record = rc2d_logger_reserve(&pos);
+        if (!record && logLevel >= RC2D_LOG_CRITICAL)
+        {
+            // Un message critique n'est jamais perdu : on attend que la file se vide
+            rc2d_logger_flush();
+            record = rc2d_logger_reserve(&pos);
+        }
 
-    // Convertit le niveau de log de RC2D en chaîne de caractères
-    const char* levelStr = rc2d_logger_log_level_to_string(logLevel);
+        if (!record)
+        {
+            SDL_AddAtomicInt(&rc2d_logger_dropped, 1);
+            return;
+        }
 
-    // Préparer le message de log
-    const char* filename = SDL_strrchr(file, '/');
-    if (!filename) filename = SDL_strrchr(file, '\\');
-    filename = filename ? filename + 1 : file;
+        va_start(args, format);
+        record->length = rc2d_logger_format(record->text, sizeof(record->text), logLevel, file, line, function, format, args);
+        va_end(args);
+        record->level = logLevel;
+        rc2d_logger_commit(record, pos);
 
-    char prefix[256];
-    SDL_snprintf(prefix, sizeof(prefix), "[%s:%s:%d:%s] ", levelStr, filename, line, function);
+        if (logLevel >= RC2D_LOG_CRITICAL)
+        {
+            rc2d_logger_flush();
+        }
+        return;
+    }
 
-    char message[1024];
-    va_list args;
+    // Mode synchrone : un seul buffer pour le préfixe et le message
+    char text[RC2D_LOGGER_RECORD_SIZE];
     va_start(args, format);
-    SDL_vsnprintf(message, sizeof(message), format, args);
+    const size_t length = rc2d_logger_format(text, sizeof(text), logLevel, file, line, function, format, args);
     va_end(args);
 
-    char fullMessage[1280];
-    SDL_snprintf(fullMessage, sizeof(fullMessage), "%s%s", prefix, message);
+    if (!rc2d_logger_mutex)
+    {
+        rc2d_logger_writeSinks(logLevel, text, length);
+        return;
+    }
 
-    // Utiliser SDL_LogMessageV pour les plateformes natives
-    SDL_LogMessage(SDL_LOG_CATEGORY_APPLICATION, sdlPriority, "%s", fullMessage);
-}
\ No newline at end of file
+    SDL_LockMutex(rc2d_logger_mutex);
+    rc2d_logger_writeSinks(logLevel, text, length);
+    if (logLevel >= RC2D_LOG_CRITICAL && rc2d_logger_file) SDL_FlushIO(rc2d_logger_file);
+    SDL_UnlockMutex(rc2d_logger_mutex);
+}
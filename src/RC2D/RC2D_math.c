@@ -1,6 +1,7 @@
 #include <RC2D/RC2D_math.h>
 #include <RC2D/RC2D_logger.h>
 #include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_frame.h>
 
 #include <SDL3/SDL_stdinc.h> // Require for : SDL_memcpy
 
@@ -145,6 +146,9 @@ static RC2D_RandomGenerator* rc2d_math_newRandomGeneratorSingle(uint32_t seed)
     return NULL;
 }
 
+/* Nombre de points de contrôle traités sans allocation par deCasteljau */
+#define RC2D_BEZIER_STACK_POINTS 32
+
 /**
  * Calcule un point sur une courbe de Bézier en utilisant l'algorithme de De Casteljau.
  *
@@ -161,7 +165,13 @@ static RC2D_Point deCasteljau(RC2D_Point* points, int count, double t)
         return (RC2D_Point){0, 0}; // Les points de contrôle de la courbe sont NULL
     }
 
-    RC2D_Point* tempPoints = RC2D_malloc(sizeof(RC2D_Point) * count);
+    // Les courbes usuelles tiennent dans la pile : pas d'allocation par point échantillonné
+    RC2D_Point stackPoints[RC2D_BEZIER_STACK_POINTS];
+    RC2D_Point* tempPoints = count <= RC2D_BEZIER_STACK_POINTS ? stackPoints : RC2D_malloc(sizeof(RC2D_Point) * count);
+    if (tempPoints == NULL)
+    {
+        return (RC2D_Point){0, 0};
+    }
     SDL_memcpy(tempPoints, points, sizeof(RC2D_Point) * count);
 
     for (int r = 1; r < count; ++r) 
@@ -174,7 +184,10 @@ static RC2D_Point deCasteljau(RC2D_Point* points, int count, double t)
     }
 
     RC2D_Point result = tempPoints[0];
-    RC2D_safe_free(tempPoints);
+    if (tempPoints != stackPoints)
+    {
+        RC2D_free(tempPoints);
+    }
 
     return result;
 }
@@ -765,6 +778,79 @@ RC2D_BezierCurve* rc2d_math_subdivideBezierCurve(RC2D_BezierCurve* curve, double
 	return segmentCurve;
 }
 
+/**
+ * Nombre de points générés pour une profondeur de subdivision donnée.
+ *
+ * @param depth La profondeur de récursion.
+ * @return Le nombre de points (2^depth + 1), ou 0 si la profondeur est invalide.
+ */
+static int bezierPointCount(int depth)
+{
+    if (depth < 0 || depth > 24)
+    {
+        RC2D_log(RC2D_LOG_WARN, "Profondeur de subdivision invalide (%d) pour le rendu de la courbe de Bézier\n", depth);
+        return 0;
+    }
+    return (1 << depth) + 1;
+}
+
+/**
+ * Remplit la liste des points de la courbe complète.
+ *
+ * @param curve La courbe de Bézier.
+ * @param depth La profondeur de récursion.
+ * @param points La liste des points à remplir (2^depth + 1 points).
+ * @param countPoints Le nombre de points de la liste.
+ */
+static void fillBezierCurve(RC2D_BezierCurve* curve, int depth, RC2D_Point* points, int countPoints)
+{
+    int index = 0;
+    subdivideBezier(curve, depth, 0.0, 1.0, points, &index);
+
+    // subdivideBezier produit le début de chaque sous-intervalle : il reste le point final t = 1
+    points[countPoints - 1] = deCasteljau(curve->points, curve->count, 1.0);
+}
+
+/**
+ * Remplit la liste des points d'un segment de la courbe.
+ *
+ * @param curve La courbe de Bézier.
+ * @param startpoint Le point de départ du segment.
+ * @param endpoint Le point de fin du segment.
+ * @param points La liste des points à remplir.
+ * @param countPoints Le nombre de points de la liste.
+ */
+static void fillSegmentBezierCurve(RC2D_BezierCurve* curve, double startpoint, double endpoint, RC2D_Point* points, int countPoints)
+{
+    double tStep = (endpoint - startpoint) / (countPoints - 1);
+    for (int i = 0; i < countPoints; i++) 
+    {
+        double t = startpoint + tStep * i;
+        points[i] = deCasteljau(curve->points, curve->count, t);
+    }
+}
+
+/**
+ * Vérifie les paramètres d'un rendu de segment de courbe de Bézier.
+ */
+static bool checkSegmentBezierCurve(RC2D_BezierCurve* curve, double startpoint, double endpoint, int* numPoints)
+{
+    if (curve == NULL || curve->points == NULL || numPoints == NULL) 
+    {
+        RC2D_log(RC2D_LOG_WARN, "La courbe de Bézier est NULL dans rc2d_math_renderSegment_BezierCurve\n");
+        return false;
+    }
+
+    if (startpoint < 0 || startpoint > 1 || endpoint <= startpoint || endpoint > 1) 
+    {
+        // Gestion d'erreurs pour des points de début ou de fin invalides
+        RC2D_log(RC2D_LOG_WARN, "Les points de début/fin sont invalides dans rc2d_math_renderSegment_BezierCurve\n");
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * Génère une liste de coordonnées pour être utilisée avec une fonction de dessin.
  * 
@@ -775,43 +861,79 @@ RC2D_BezierCurve* rc2d_math_subdivideBezierCurve(RC2D_BezierCurve* curve, double
  */
 RC2D_Point* rc2d_math_renderBezierCurve(RC2D_BezierCurve* curve, int depth, int* numPoints) 
 {
-    if (curve == NULL || curve->points == NULL) 
+    if (curve == NULL || curve->points == NULL || numPoints == NULL) 
     {
         RC2D_log(RC2D_LOG_WARN, "La courbe de Bézier est NULL dans rc2d_math_render_BezierCurve\n");
         return NULL; // La courbe doit avoir au moins deux points de contrôle pour être rendue.
     }
 
-    int countPoints = SDL_pow(2, depth) + 1; // Calcul du nombre de points basé sur la profondeur de récursion
-    RC2D_Point* points = RC2D_malloc(sizeof(RC2D_Point) * countPoints);
+    int countPoints = bezierPointCount(depth); // Calcul du nombre de points basé sur la profondeur de récursion
+    RC2D_Point* points = countPoints > 0 ? RC2D_malloc(sizeof(RC2D_Point) * countPoints) : NULL;
+    if (points == NULL)
+    {
+        return NULL;
+    }
+
+    fillBezierCurve(curve, depth, points, countPoints);
     *numPoints = countPoints; // Stocker le nombre de points dans la variable de sortie
+    return points;
+}
 
-    int index = 0;
-    subdivideBezier(curve, depth, 0.0, 1.0, points, &index);
+RC2D_Point* rc2d_math_renderBezierCurveFrame(RC2D_BezierCurve* curve, int depth, int* numPoints) 
+{
+    if (curve == NULL || curve->points == NULL || numPoints == NULL) 
+    {
+        RC2D_log(RC2D_LOG_WARN, "La courbe de Bézier est NULL dans rc2d_math_renderBezierCurveFrame\n");
+        return NULL;
+    }
+
+    int countPoints = bezierPointCount(depth);
+    RC2D_Point* points = countPoints > 0 ? rc2d_frame_alloc(sizeof(RC2D_Point) * countPoints, 0) : NULL;
+    if (points == NULL)
+    {
+        return NULL;
+    }
 
+    fillBezierCurve(curve, depth, points, countPoints);
+    *numPoints = countPoints;
     return points;
 }
 
 RC2D_Point* rc2d_math_renderSegmentBezierCurve(RC2D_BezierCurve* curve, double startpoint, double endpoint, int depth, int* numPoints) 
 {
-    if (startpoint < 0 || startpoint > 1 || endpoint <= startpoint || endpoint > 1) 
+    if (!checkSegmentBezierCurve(curve, startpoint, endpoint, numPoints))
+    {
+        return NULL;
+    }
+
+    int countPoints = bezierPointCount(depth); // Calcul du nombre de points basé sur la profondeur de récursion
+    RC2D_Point* points = countPoints > 0 ? RC2D_malloc(sizeof(RC2D_Point) * countPoints) : NULL;
+    if (points == NULL)
     {
-        // Gestion d'erreurs pour des points de début ou de fin invalides
-        RC2D_log(RC2D_LOG_WARN, "Les points de début/fin sont invalides dans rc2d_math_renderSegment_BezierCurve\n");
         return NULL;
     }
 
-    int countPoints = SDL_pow(2, depth) + 1; // Calcul du nombre de points basé sur la profondeur de récursion
-    RC2D_Point* points = RC2D_malloc(sizeof(RC2D_Point) * countPoints);
+    fillSegmentBezierCurve(curve, startpoint, endpoint, points, countPoints);
     *numPoints = countPoints; // Stocker le nombre de points dans la variable de sortie
+    return points;
+}
 
-    int index = 0;
-    double tStep = (endpoint - startpoint) / (countPoints - 1);
-    for (int i = 0; i < countPoints; i++) 
+RC2D_Point* rc2d_math_renderSegmentBezierCurveFrame(RC2D_BezierCurve* curve, double startpoint, double endpoint, int depth, int* numPoints) 
+{
+    if (!checkSegmentBezierCurve(curve, startpoint, endpoint, numPoints))
     {
-        double t = startpoint + tStep * i;
-        points[index++] = deCasteljau(curve->points, curve->count, t);
+        return NULL;
+    }
+
+    int countPoints = bezierPointCount(depth);
+    RC2D_Point* points = countPoints > 0 ? rc2d_frame_alloc(sizeof(RC2D_Point) * countPoints, 0) : NULL;
+    if (points == NULL)
+    {
+        return NULL;
     }
 
+    fillSegmentBezierCurve(curve, startpoint, endpoint, points, countPoints);
+    *numPoints = countPoints;
     return points;
 }
 
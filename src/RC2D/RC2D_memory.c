@@ -1,135 +1,680 @@
 #include <RC2D/RC2D_memory.h>
 #include <RC2D/RC2D_logger.h>
 
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_thread.h>
+
+#if RC2D_MEMORY_TELEMETRY_ENABLED && !RC2D_MEMORY_DEBUG_ENABLED
+/* Sans le tracker, la télémétrie demande la taille d'un bloc libéré à l'allocateur système */
+#include <stdlib.h>
+#if defined(_WIN32)
+#include <malloc.h>
+#define TELEMETRY_USABLE_SIZE(ptr) _msize(ptr)
+#elif defined(__APPLE__)
+#include <malloc/malloc.h>
+#define TELEMETRY_USABLE_SIZE(ptr) malloc_size(ptr)
+#elif defined(__GLIBC__) || defined(__ANDROID__) || defined(__EMSCRIPTEN__)
+#include <malloc.h>
+#define TELEMETRY_USABLE_SIZE(ptr) malloc_usable_size(ptr)
+#endif
+#endif
+
+/*
+Pool d'objets : les slabs sont alloués avec SDL_aligned_alloc, alignés sur une ligne de cache,
+un en-tête d'une ligne de cache puis les objets. Les objets libres sont chaînés entre eux
+(le lien est stocké dans l'objet lui-même). Avec le cache de thread, chaque thread garde jusqu'à
+POOL_CACHE_MAX objets et n'échange avec la liste partagée que par lots de POOL_CACHE_BATCH.
+*/
+#define POOL_CACHE_LINE_SIZE 64
+#define POOL_OBJECT_ALIGN 16
+#define POOL_DEFAULT_SLAB_BYTES (16 * 1024)
+#define POOL_MIN_OBJECTS_PER_SLAB 8
+#define POOL_CACHE_BATCH 32
+#define POOL_CACHE_MAX (2 * POOL_CACHE_BATCH)
+
+typedef struct PoolNode {
+    struct PoolNode* next;
+} PoolNode;
+
+typedef struct PoolSlab {
+    struct PoolSlab* next;
+} PoolSlab;
+
+/* Cache d'un thread pour un pool, libéré à la fin du thread (destructeur TLS) */
+typedef struct PoolCache {
+    PoolNode* head;
+    int count;
+    struct RC2D_Pool* pool;     /* NULL une fois le pool détruit (protégé par pool_caches_lock) */
+    struct PoolCache* next;     /* Cache suivant du pool (protégé par pool_caches_lock) */
+} PoolCache;
+
+struct RC2D_Pool {
+    char* name;
+    size_t objectSize;          /* Taille demandée */
+    size_t stride;              /* Taille réelle d'un objet (alignée) */
+    size_t objectsPerSlab;
+
+    SDL_SpinLock lock;          /* Protège les champs ci-dessous */
+    PoolNode* freeList;
+    PoolSlab* slabs;
+    size_t slabCount;
+    size_t outstanding;         /* Objets sortis de la liste partagée */
+    size_t peakOutstanding;
+
+    bool threadCache;
+    SDL_TLSID tls;              /* PoolCache* du thread courant */
+    PoolCache* caches;          /* Caches des threads vivants (protégé par pool_caches_lock) */
+};
+
+/* Ordre des verrous : pool_caches_lock puis pool->lock */
+static SDL_SpinLock pool_caches_lock = 0;
+
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+/*
+Télémétrie : les compteurs sont répartis en TELEMETRY_SHARD_COUNT shards, chaque thread écrit
+toujours dans le même shard (attribué à sa première allocation), si bien que les verrous ne sont
+presque jamais disputés. rc2d_memory_sampleFrame() additionne les shards à la fin de chaque frame
+et range la différence avec l'échantillon précédent dans un historique circulaire.
+*/
+#define TELEMETRY_SHARD_COUNT 16
+#define TELEMETRY_TAG_STACK_DEPTH 16
+
+#if defined(_MSC_VER)
+#define RC2D_THREAD_LOCAL __declspec(thread)
+#else
+#define RC2D_THREAD_LOCAL __thread
+#endif
+
+typedef struct TelemetryShard {
+    SDL_SpinLock lock;
+    RC2D_MemoryCounters counters;
+    Uint8 padding[64];      /* Sépare les shards voisins sur des lignes de cache distinctes */
+} TelemetryShard;
+
+static TelemetryShard telemetry_shards[TELEMETRY_SHARD_COUNT];
+static SDL_AtomicInt telemetry_next_shard;
+
+static RC2D_THREAD_LOCAL int telemetry_shard_index = -1;
+static RC2D_THREAD_LOCAL Uint8 telemetry_tag_stack[TELEMETRY_TAG_STACK_DEPTH];
+static RC2D_THREAD_LOCAL int telemetry_tag_depth = 0;
+
+/* Historique circulaire, protégé par telemetry_history_lock */
+static SDL_SpinLock telemetry_history_lock = 0;
+static RC2D_MemoryFrameStats telemetry_history[RC2D_MEMORY_TELEMETRY_HISTORY];
+static int telemetry_history_next = 0;
+static int telemetry_history_count = 0;
+static RC2D_MemoryCounters telemetry_last_totals;
+static Uint64 telemetry_frame_index = 0;
+static Sint64 telemetry_peak_in_flight = 0;
+
+static RC2D_MemoryTag telemetry_current_tag(void)
+{
+    // Au-delà de la profondeur maximale, le dernier tag mémorisé reste le tag courant
+    const int depth = telemetry_tag_depth < TELEMETRY_TAG_STACK_DEPTH ? telemetry_tag_depth : TELEMETRY_TAG_STACK_DEPTH;
+    return depth > 0 ? (RC2D_MemoryTag)telemetry_tag_stack[depth - 1] : RC2D_MEMORY_TAG_GENERAL;
+}
+
+static TelemetryShard* telemetry_shard(void)
+{
+    if (telemetry_shard_index < 0)
+    {
+        telemetry_shard_index = SDL_AddAtomicInt(&telemetry_next_shard, 1) & (TELEMETRY_SHARD_COUNT - 1);
+    }
+    return &telemetry_shards[telemetry_shard_index];
+}
+
+static void telemetry_on_alloc(size_t size)
+{
+    const RC2D_MemoryTag tag = telemetry_current_tag();
+    TelemetryShard* shard = telemetry_shard();
+    SDL_LockSpinlock(&shard->lock);
+    shard->counters.allocCount++;
+    shard->counters.bytesAllocated += size;
+    shard->counters.tagAllocCount[tag]++;
+    shard->counters.tagBytesAllocated[tag] += size;
+    SDL_UnlockSpinlock(&shard->lock);
+}
+
+static void telemetry_on_free(size_t size)
+{
+    TelemetryShard* shard = telemetry_shard();
+    SDL_LockSpinlock(&shard->lock);
+    shard->counters.freeCount++;
+    shard->counters.bytesFreed += size;
+    SDL_UnlockSpinlock(&shard->lock);
+}
+
+static void telemetry_sum(RC2D_MemoryCounters* out_totals)
+{
+    SDL_zerop(out_totals);
+    for (int s = 0; s < TELEMETRY_SHARD_COUNT; s++)
+    {
+        TelemetryShard* shard = &telemetry_shards[s];
+        SDL_LockSpinlock(&shard->lock);
+        out_totals->allocCount += shard->counters.allocCount;
+        out_totals->freeCount += shard->counters.freeCount;
+        out_totals->bytesAllocated += shard->counters.bytesAllocated;
+        out_totals->bytesFreed += shard->counters.bytesFreed;
+        for (int t = 0; t < RC2D_MEMORY_TAG_COUNT; t++)
+        {
+            out_totals->tagAllocCount[t] += shard->counters.tagAllocCount[t];
+            out_totals->tagBytesAllocated[t] += shard->counters.tagBytesAllocated[t];
+        }
+        SDL_UnlockSpinlock(&shard->lock);
+    }
+}
+
+#if !RC2D_MEMORY_DEBUG_ENABLED
+/* 1 si SDL utilise toujours l'allocateur système (taille lisible), 0 sinon, -1 pas encore vérifié */
+static SDL_AtomicInt telemetry_sizes_readable = { -1 };
+
+static size_t telemetry_block_size(void* ptr)
+{
+#ifdef TELEMETRY_USABLE_SIZE
+    int readable = SDL_GetAtomicInt(&telemetry_sizes_readable);
+    if (readable < 0)
+    {
+        SDL_malloc_func original_malloc, current_malloc;
+        SDL_calloc_func original_calloc, current_calloc;
+        SDL_realloc_func original_realloc, current_realloc;
+        SDL_free_func original_free, current_free;
+        SDL_GetOriginalMemoryFunctions(&original_malloc, &original_calloc, &original_realloc, &original_free);
+        SDL_GetMemoryFunctions(&current_malloc, &current_calloc, &current_realloc, &current_free);
+        readable = (original_malloc == current_malloc && original_calloc == current_calloc &&
+                    original_realloc == current_realloc && original_free == current_free) ? 1 : 0;
+        SDL_SetAtomicInt(&telemetry_sizes_readable, readable);
+    }
+    return readable ? (size_t)TELEMETRY_USABLE_SIZE(ptr) : 0;
+#else
+    (void)ptr;
+    return 0;
+#endif
+}
+#endif /* !RC2D_MEMORY_DEBUG_ENABLED */
+
+#define TELEMETRY_ON_ALLOC(size) telemetry_on_alloc(size)
+#define TELEMETRY_ON_FREE(size) telemetry_on_free(size)
+#else
+#define TELEMETRY_ON_ALLOC(size) ((void)0)
+#define TELEMETRY_ON_FREE(size) ((void)0)
+#endif /* RC2D_MEMORY_TELEMETRY_ENABLED */
+
 #if RC2D_MEMORY_DEBUG_ENABLED
 
-/* Structure pour stocker les informations d'une allocation */
-typedef struct Allocation {
-    void* ptr;              /* Pointeur alloué */
-    size_t size;            /* Taille de l'allocation */
+/*
+Le suivi est réparti en SHARD_COUNT tables de hachage à adressage ouvert (sondage linéaire),
+chacune protégée par son propre spinlock : les sections critiques sont en O(1) et des threads
+différents touchent rarement la même table. Les statistiques par site d'appel (fichier + ligne)
+sont dans une table chaînée séparée, protégée par LOCK_COUNT spinlocks. Les tables du tracker
+sont allouées avec SDL_malloc : elles ne sont jamais elles-mêmes suivies.
+*/
+#define ALLOCATION_SHARD_COUNT 16
+#define ALLOCATION_SHARD_INITIAL_CAPACITY 1024
+#define CALLSITE_BUCKET_COUNT 4096
+#define CALLSITE_LOCK_COUNT 16
+
+/* Nombre maximum de fuites listées individuellement par rc2d_memory_report() */
+#define MEMORY_REPORT_MAX_LEAKS 64
+
+/* Statistiques agrégées d'un site d'appel */
+typedef struct CallSite {
     const char* file;       /* Fichier source */
     int line;               /* Ligne dans le fichier */
     const char* func;       /* Fonction appelante */
-    struct Allocation* next; /* Prochaine allocation */
+    Uint32 bucket;          /* Index du bucket (et donc du verrou) */
+    Uint64 liveCount;       /* Allocations encore vivantes */
+    Uint64 liveBytes;       /* Octets encore vivants */
+    Uint64 peakBytes;       /* Maximum atteint par liveBytes */
+    Uint64 totalCount;      /* Allocations cumulées */
+    struct CallSite* next;  /* Site suivant dans le bucket */
+} CallSite;
+
+/* Allocation vivante, ptr == NULL pour un emplacement libre */
+typedef struct Allocation {
+    void* ptr;              /* Pointeur alloué */
+    size_t size;            /* Taille de l'allocation */
+    CallSite* site;         /* Site d'appel de l'allocation */
+    const RC2D_Pool* pool;  /* Pool d'origine, NULL pour RC2D_malloc & co */
 } Allocation;
 
-/* Liste chaînée des allocations */
-static Allocation* allocations = NULL;
+/* Table d'allocations d'un shard */
+typedef struct AllocationShard {
+    SDL_SpinLock lock;
+    Allocation* entries;    /* Capacité puissance de 2 */
+    Uint32 capacity;
+    Uint32 count;
+} AllocationShard;
+
+static AllocationShard allocation_shards[ALLOCATION_SHARD_COUNT];
+
+static CallSite* callsite_buckets[CALLSITE_BUCKET_COUNT];
+static SDL_SpinLock callsite_locks[CALLSITE_LOCK_COUNT];
+
+/* Mélange les bits d'un pointeur (finaliseur splitmix64) */
+static Uint64 hash_pointer(const void* ptr)
+{
+    Uint64 h = (Uint64)(uintptr_t)ptr;
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return h;
+}
+
+static AllocationShard* shard_for(Uint64 hash)
+{
+    return &allocation_shards[hash >> 60 & (ALLOCATION_SHARD_COUNT - 1)];
+}
+
+/* Insère sans vérifier la capacité (appelant : verrou pris, place disponible) */
+static void shard_insert_entry(AllocationShard* shard, const Allocation* entry)
+{
+    const Uint32 mask = shard->capacity - 1;
+    Uint32 i = (Uint32)hash_pointer(entry->ptr) & mask;
+    while (shard->entries[i].ptr != NULL)
+    {
+        i = (i + 1) & mask;
+    }
+    shard->entries[i] = *entry;
+    shard->count++;
+}
+
+/* Double la capacité du shard (verrou pris). Retourne false si la mémoire manque. */
+static bool shard_grow(AllocationShard* shard)
+{
+    const Uint32 capacity = shard->capacity ? shard->capacity * 2 : ALLOCATION_SHARD_INITIAL_CAPACITY;
+    Allocation* entries = (Allocation*)SDL_calloc(capacity, sizeof(Allocation));
+    if (!entries)
+    {
+        return false;
+    }
+
+    Allocation* old_entries = shard->entries;
+    const Uint32 old_capacity = shard->capacity;
+    shard->entries = entries;
+    shard->capacity = capacity;
+    shard->count = 0;
+    for (Uint32 i = 0; i < old_capacity; i++)
+    {
+        if (old_entries[i].ptr)
+        {
+            shard_insert_entry(shard, &old_entries[i]);
+        }
+    }
+
+    SDL_free(old_entries);
+    return true;
+}
+
+/* Retire l'entrée i par décalage arrière (pas de pierres tombales, verrou pris) */
+static void shard_remove_at(AllocationShard* shard, Uint32 i)
+{
+    const Uint32 mask = shard->capacity - 1;
+    Uint32 j = i;
+    for (;;)
+    {
+        j = (j + 1) & mask;
+        if (shard->entries[j].ptr == NULL)
+        {
+            break;
+        }
+
+        // L'entrée j reste si sa position idéale est (cycliquement) dans ]i, j]
+        const Uint32 home = (Uint32)hash_pointer(shard->entries[j].ptr) & mask;
+        const bool stays = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+        if (!stays)
+        {
+            shard->entries[i] = shard->entries[j];
+            i = j;
+        }
+    }
+
+    shard->entries[i].ptr = NULL;
+    shard->count--;
+}
 
-/* Ajouter une allocation à la liste */
-static void add_allocation(void* ptr, size_t size, const char* file, int line, const char* func) 
+/* Trouve (ou crée) le site d'appel et y comptabilise une allocation de 'size' octets */
+static CallSite* callsite_add(const char* file, int line, const char* func, size_t size)
+{
+    const Uint32 bucket = (Uint32)(hash_pointer(file) ^ (Uint64)line * 0x9E3779B97F4A7C15ULL) & (CALLSITE_BUCKET_COUNT - 1);
+    SDL_SpinLock* lock = &callsite_locks[bucket & (CALLSITE_LOCK_COUNT - 1)];
+
+    SDL_LockSpinlock(lock);
+    CallSite* site = callsite_buckets[bucket];
+    while (site && (site->line != line || site->file != file))
+    {
+        site = site->next;
+    }
+
+    if (!site)
+    {
+        site = (CallSite*)SDL_calloc(1, sizeof(CallSite));
+        if (!site)
+        {
+            SDL_UnlockSpinlock(lock);
+            return NULL;
+        }
+        site->file = file;
+        site->line = line;
+        site->func = func;
+        site->bucket = bucket;
+        site->next = callsite_buckets[bucket];
+        callsite_buckets[bucket] = site;
+    }
+
+    site->liveCount++;
+    site->liveBytes += size;
+    site->totalCount++;
+    if (site->liveBytes > site->peakBytes)
+    {
+        site->peakBytes = site->liveBytes;
+    }
+    SDL_UnlockSpinlock(lock);
+
+    return site;
+}
+
+/* Décompte une allocation libérée de son site d'appel */
+static void callsite_remove(CallSite* site, size_t size)
+{
+    if (!site) return;
+
+    SDL_SpinLock* lock = &callsite_locks[site->bucket & (CALLSITE_LOCK_COUNT - 1)];
+    SDL_LockSpinlock(lock);
+    site->liveCount--;
+    site->liveBytes -= size;
+    SDL_UnlockSpinlock(lock);
+}
+
+/* Ajouter une allocation au suivi */
+static void add_allocation(void* ptr, size_t size, const char* file, int line, const char* func, const RC2D_Pool* pool)
 {
     if (!ptr) return;
 
-    Allocation* alloc = (Allocation*)SDL_malloc(sizeof(Allocation));
-    if (!alloc) 
+    Allocation entry;
+    entry.ptr = ptr;
+    entry.size = size;
+    entry.site = callsite_add(file, line, func, size);
+    entry.pool = pool;
+
+    AllocationShard* shard = shard_for(hash_pointer(ptr));
+    SDL_LockSpinlock(&shard->lock);
+
+    // Facteur de charge maximum : 3/4
+    bool tracked = true;
+    if ((shard->count + 1) * 4 > shard->capacity * 3 && !shard_grow(shard))
     {
-        RC2D_log(RC2D_LOG_ERROR, "Impossible d'allouer la structure Allocation");
-        return;
+        tracked = (shard->count + 1 < shard->capacity);
+    }
+    if (tracked)
+    {
+        shard_insert_entry(shard, &entry);
     }
+    SDL_UnlockSpinlock(&shard->lock);
 
-    alloc->ptr = ptr;
-    alloc->size = size;
-    alloc->file = file;
-    alloc->line = line;
-    alloc->func = func;
-    alloc->next = allocations;
-    allocations = alloc;
+    if (!tracked)
+    {
+        callsite_remove(entry.site, size);
+        RC2D_log(RC2D_LOG_ERROR, "Impossible d'agrandir la table de suivi des allocations");
+    }
 }
 
-/* Supprimer une allocation de la liste */
-static void remove_allocation(void* ptr) 
+/* Retirer une allocation du suivi. Retourne false si le pointeur n'était pas suivi. */
+static bool remove_allocation(void* ptr, Allocation* out_removed)
 {
-    Allocation* current = allocations;
-    Allocation* prev = NULL;
+    AllocationShard* shard = shard_for(hash_pointer(ptr));
+    SDL_LockSpinlock(&shard->lock);
 
-    while (current) 
+    if (shard->capacity > 0)
     {
-        if (current->ptr == ptr) 
+        const Uint32 mask = shard->capacity - 1;
+        for (Uint32 i = (Uint32)hash_pointer(ptr) & mask; shard->entries[i].ptr != NULL; i = (i + 1) & mask)
         {
-            if (prev) 
-            {
-                prev->next = current->next;
-            } 
-            else 
+            if (shard->entries[i].ptr == ptr)
             {
-                allocations = current->next;
-            }
+                const Allocation removed = shard->entries[i];
+                shard_remove_at(shard, i);
+                SDL_UnlockSpinlock(&shard->lock);
 
-            /* Libérer la mémoire de l'allocation */
-            SDL_free(current);
-            return;
-        
+                callsite_remove(removed.site, removed.size);
+                if (out_removed) *out_removed = removed;
+                return true;
+            }
         }
-        prev = current;
-        current = current->next;
     }
+
+    SDL_UnlockSpinlock(&shard->lock);
+    return false;
 }
 
-void* rc2d_malloc_debug(size_t size, const char* file, int line, const char* func) 
+void* rc2d_malloc_debug(size_t size, const char* file, int line, const char* func)
 {
     void* ptr = SDL_malloc(size);
-    if (ptr) 
+    if (ptr)
     {
-        add_allocation(ptr, size, file, line, func);
+        add_allocation(ptr, size, file, line, func, NULL);
+        TELEMETRY_ON_ALLOC(size);
     }
 
     return ptr;
 }
 
-void* rc2d_calloc_debug(size_t nmemb, size_t size, const char* file, int line, const char* func) 
+void* rc2d_calloc_debug(size_t nmemb, size_t size, const char* file, int line, const char* func)
 {
     void* ptr = SDL_calloc(nmemb, size);
-    if (ptr) 
+    if (ptr)
+    {
+        add_allocation(ptr, nmemb * size, file, line, func, NULL);
+        TELEMETRY_ON_ALLOC(nmemb * size);
+    }
+
+    return ptr;
+}
+
+void* rc2d_realloc_debug(void* ptr, size_t size, const char* file, int line, const char* func)
+{
+    /**
+     * Le pointeur est retiré du suivi avant SDL_realloc : une fois libéré, son adresse peut être
+     * réutilisée par un autre thread. En cas d'échec, le bloc d'origine reste valide et est remis.
+     */
+    Allocation previous;
+    const bool was_tracked = ptr && remove_allocation(ptr, &previous);
+
+    void* new_ptr = SDL_realloc(ptr, size);
+    if (new_ptr)
     {
-        add_allocation(ptr, nmemb * size, file, line, func);
+        add_allocation(new_ptr, size, file, line, func, NULL);
+        if (ptr)
+        {
+            TELEMETRY_ON_FREE(was_tracked ? previous.size : 0);
+        }
+        TELEMETRY_ON_ALLOC(size);
+    }
+    else if (was_tracked)
+    {
+        add_allocation(ptr, previous.size, previous.site ? previous.site->file : file,
+                       previous.site ? previous.site->line : line, previous.site ? previous.site->func : func, NULL);
+    }
+
+    return new_ptr;
+}
+
+void rc2d_free_debug(void* ptr, const char* file, int line, const char* func)
+{
+    if (ptr)
+    {
+        Allocation removed;
+        const bool was_tracked = remove_allocation(ptr, &removed);
+        TELEMETRY_ON_FREE(was_tracked ? removed.size : 0);
+        SDL_free(ptr);
+    }
+}
+
+char* rc2d_strdup_debug(const char* str, const char* file, int line, const char* func)
+{
+    char* ptr = SDL_strdup(str);
+    if (ptr)
+    {
+        add_allocation(ptr, strlen(str) + 1, file, line, func, NULL);
+        TELEMETRY_ON_ALLOC(strlen(str) + 1);
     }
 
     return ptr;
 }
 
-void* rc2d_realloc_debug(void* ptr, size_t size, const char* file, int line, const char* func) 
+char* rc2d_strndup_debug(const char* str, size_t n, const char* file, int line, const char* func)
 {
-    if (ptr) 
+    char* ptr = SDL_strndup(str, n);
+    if (ptr)
     {
-        remove_allocation(ptr);
+        add_allocation(ptr, strlen(ptr) + 1, file, line, func, NULL);
+        TELEMETRY_ON_ALLOC(strlen(ptr) + 1);
     }
 
+    return ptr;
+}
+
+/* Signale puis retire du suivi les objets encore alloués d'un pool détruit */
+static void report_pool_leaks(const RC2D_Pool* pool)
+{
+    size_t total_leaked = 0;
+    int leak_count = 0;
+    for (int s = 0; s < ALLOCATION_SHARD_COUNT; s++)
+    {
+        AllocationShard* shard = &allocation_shards[s];
+        SDL_LockSpinlock(&shard->lock);
+        Uint32 i = 0;
+        while (i < shard->capacity)
+        {
+            const Allocation current = shard->entries[i];
+            if (!current.ptr || current.pool != pool)
+            {
+                i++;
+                continue;
+            }
+
+            if (leak_count < MEMORY_REPORT_MAX_LEAKS)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "Pool '%s' - Fuite: %p, Fichier: %s, Ligne: %d, Fonction: %s",
+                         pool->name, current.ptr,
+                         current.site ? current.site->file : "?", current.site ? current.site->line : 0,
+                         current.site ? current.site->func : "?");
+            }
+            total_leaked += current.size;
+            leak_count++;
+
+            // Le décalage arrière peut ramener une autre entrée en i : on ne l'incrémente pas
+            shard_remove_at(shard, i);
+            callsite_remove(current.site, current.size);
+        }
+        SDL_UnlockSpinlock(&shard->lock);
+    }
+
+    if (leak_count > 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Pool '%s' détruit avec %d objets non libérés (%zu octets)", pool->name, leak_count, total_leaked);
+    }
+}
+
+void* rc2d_memory_poolAllocDebug(RC2D_Pool* pool, const char* file, int line, const char* func)
+{
+    void* ptr = rc2d_memory_poolAlloc(pool);
+    if (ptr)
+    {
+        add_allocation(ptr, pool->objectSize, file, line, func, pool);
+    }
+
+    return ptr;
+}
+
+void rc2d_memory_poolFreeDebug(RC2D_Pool* pool, void* ptr, const char* file, int line, const char* func)
+{
+    if (!ptr || !pool)
+    {
+        return;
+    }
+
+    Allocation removed;
+    if (remove_allocation(ptr, &removed) && removed.pool != pool)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "%s:%d (%s) : l'objet %p n'appartient pas au pool '%s', il n'est pas libéré",
+                 file, line, func, ptr, pool->name);
+        add_allocation(ptr, removed.size, removed.site ? removed.site->file : file,
+                       removed.site ? removed.site->line : line, removed.site ? removed.site->func : func, removed.pool);
+        return;
+    }
+
+    rc2d_memory_poolFree(pool, ptr);
+}
+
+#elif RC2D_MEMORY_TELEMETRY_ENABLED
+
+void* rc2d_malloc_telemetry(size_t size)
+{
+    void* ptr = SDL_malloc(size);
+    if (ptr)
+    {
+        telemetry_on_alloc(telemetry_block_size(ptr));
+    }
+
+    return ptr;
+}
+
+void* rc2d_calloc_telemetry(size_t nmemb, size_t size)
+{
+    void* ptr = SDL_calloc(nmemb, size);
+    if (ptr)
+    {
+        telemetry_on_alloc(telemetry_block_size(ptr));
+    }
+
+    return ptr;
+}
+
+void* rc2d_realloc_telemetry(void* ptr, size_t size)
+{
+    // La taille de l'ancien bloc doit être lue avant SDL_realloc, qui peut le libérer
+    const size_t previous_size = ptr ? telemetry_block_size(ptr) : 0;
     void* new_ptr = SDL_realloc(ptr, size);
-    if (new_ptr) 
+    if (new_ptr)
     {
-        add_allocation(new_ptr, size, file, line, func);
+        if (ptr)
+        {
+            telemetry_on_free(previous_size);
+        }
+        telemetry_on_alloc(telemetry_block_size(new_ptr));
     }
 
     return new_ptr;
 }
 
-void rc2d_free_debug(void* ptr, const char* file, int line, const char* func) 
+void rc2d_free_telemetry(void* ptr)
 {
-    if (ptr) 
+    if (ptr)
     {
-        remove_allocation(ptr);
+        telemetry_on_free(telemetry_block_size(ptr));
         SDL_free(ptr);
     }
 }
 
-char* rc2d_strdup_debug(const char* str, const char* file, int line, const char* func) 
+char* rc2d_strdup_telemetry(const char* str)
 {
     char* ptr = SDL_strdup(str);
-    if (ptr) 
+    if (ptr)
     {
-        add_allocation(ptr, strlen(str) + 1, file, line, func);
+        telemetry_on_alloc(telemetry_block_size(ptr));
     }
 
     return ptr;
 }
 
-char* rc2d_strndup_debug(const char* str, size_t n, const char* file, int line, const char* func) 
+char* rc2d_strndup_telemetry(const char* str, size_t n)
 {
     char* ptr = SDL_strndup(str, n);
-    if (ptr) 
+    if (ptr)
     {
-        add_allocation(ptr, strlen(ptr) + 1, file, line, func);
+        telemetry_on_alloc(telemetry_block_size(ptr));
     }
 
     return ptr;
@@ -137,44 +682,542 @@ char* rc2d_strndup_debug(const char* str, size_t n, const char* file, int line,
 
 #endif /* RC2D_MEMORY_DEBUG_ENABLED */
 
-void rc2d_memory_report(void) 
+void rc2d_memory_pushTag(RC2D_MemoryTag tag)
 {
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+    if ((int)tag < 0 || tag >= RC2D_MEMORY_TAG_COUNT)
+    {
+        tag = RC2D_MEMORY_TAG_GENERAL;
+    }
+    if (telemetry_tag_depth < TELEMETRY_TAG_STACK_DEPTH)
+    {
+        telemetry_tag_stack[telemetry_tag_depth] = (Uint8)tag;
+    }
+    telemetry_tag_depth++;
+#else
+    (void)tag;
+#endif
+}
+
+void rc2d_memory_popTag(void)
+{
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+    if (telemetry_tag_depth > 0)
+    {
+        telemetry_tag_depth--;
+    }
+#endif
+}
+
+void* rc2d_memory_popTagPassthrough(void* ptr)
+{
+    rc2d_memory_popTag();
+    return ptr;
+}
+
+RC2D_MemoryTag rc2d_memory_getCurrentTag(void)
+{
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+    return telemetry_current_tag();
+#else
+    return RC2D_MEMORY_TAG_GENERAL;
+#endif
+}
+
+const char* rc2d_memory_getTagName(RC2D_MemoryTag tag)
+{
+    static const char* const names[RC2D_MEMORY_TAG_COUNT] = {
+        "general", "engine", "graphics", "audio", "text", "assets", "data", "storage",
+        "net", "math", "ui", "game", "user0", "user1", "user2", "user3"
+    };
+    return ((int)tag >= 0 && tag < RC2D_MEMORY_TAG_COUNT) ? names[tag] : "?";
+}
+
+void rc2d_memory_getCounters(RC2D_MemoryCounters* out_counters)
+{
+    if (!out_counters)
+    {
+        return;
+    }
+
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+    telemetry_sum(out_counters);
+#else
+    SDL_zerop(out_counters);
+#endif
+}
+
+int rc2d_memory_getFrameHistory(RC2D_MemoryFrameStats* out_stats, int max_stats)
+{
+    if (!out_stats || max_stats <= 0)
+    {
+        return 0;
+    }
+
+    int count = 0;
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+    SDL_LockSpinlock(&telemetry_history_lock);
+    count = telemetry_history_count < max_stats ? telemetry_history_count : max_stats;
+    for (int i = 0; i < count; i++)
+    {
+        const int index = (telemetry_history_next - 1 - i + RC2D_MEMORY_TELEMETRY_HISTORY) % RC2D_MEMORY_TELEMETRY_HISTORY;
+        out_stats[i] = telemetry_history[index];
+    }
+    SDL_UnlockSpinlock(&telemetry_history_lock);
+#endif
+
+    return count;
+}
+
+void rc2d_memory_sampleFrame(void)
+{
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+    RC2D_MemoryCounters totals;
+    telemetry_sum(&totals);
+
+    SDL_LockSpinlock(&telemetry_history_lock);
+    RC2D_MemoryFrameStats* stats = &telemetry_history[telemetry_history_next];
+    stats->frameIndex = telemetry_frame_index++;
+    stats->allocCount = totals.allocCount - telemetry_last_totals.allocCount;
+    stats->freeCount = totals.freeCount - telemetry_last_totals.freeCount;
+    stats->bytesAllocated = totals.bytesAllocated - telemetry_last_totals.bytesAllocated;
+    stats->bytesFreed = totals.bytesFreed - telemetry_last_totals.bytesFreed;
+    for (int t = 0; t < RC2D_MEMORY_TAG_COUNT; t++)
+    {
+        stats->tagAllocCount[t] = totals.tagAllocCount[t] - telemetry_last_totals.tagAllocCount[t];
+        stats->tagBytesAllocated[t] = totals.tagBytesAllocated[t] - telemetry_last_totals.tagBytesAllocated[t];
+    }
+
+    stats->bytesInFlight = (Sint64)(totals.bytesAllocated - totals.bytesFreed);
+    if (stats->bytesInFlight > telemetry_peak_in_flight)
+    {
+        telemetry_peak_in_flight = stats->bytesInFlight;
+    }
+    stats->peakBytesInFlight = telemetry_peak_in_flight;
+
+    telemetry_last_totals = totals;
+    telemetry_history_next = (telemetry_history_next + 1) % RC2D_MEMORY_TELEMETRY_HISTORY;
+    if (telemetry_history_count < RC2D_MEMORY_TELEMETRY_HISTORY)
+    {
+        telemetry_history_count++;
+    }
+    SDL_UnlockSpinlock(&telemetry_history_lock);
+#endif
+}
+
+/* Ajoute un slab à la liste libre partagée (verrou du pool pris) */
+static bool pool_grow(RC2D_Pool* pool)
+{
+    PoolSlab* slab = (PoolSlab*)SDL_aligned_alloc(POOL_CACHE_LINE_SIZE, POOL_CACHE_LINE_SIZE + pool->objectsPerSlab * pool->stride);
+    if (!slab)
+    {
+        return false;
+    }
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    pool->slabCount++;
+    TELEMETRY_ON_ALLOC(POOL_CACHE_LINE_SIZE + pool->objectsPerSlab * pool->stride);
+
+    // Chaînage en ordre décroissant : les premiers objets servis sont ceux du début du slab
+    unsigned char* objects = (unsigned char*)slab + POOL_CACHE_LINE_SIZE;
+    for (size_t i = pool->objectsPerSlab; i-- > 0;)
+    {
+        PoolNode* node = (PoolNode*)(objects + i * pool->stride);
+        node->next = pool->freeList;
+        pool->freeList = node;
+    }
+
+    return true;
+}
+
+/**
+ * Retire jusqu'à 'count' objets de la liste partagée (un slab est ajouté si elle est vide).
+ *
+ * @param pool Pool d'objets.
+ * @param count Nombre d'objets voulus.
+ * @param out_count [out] Nombre d'objets retirés.
+ * @return La chaîne des objets retirés, ou NULL si la mémoire manque.
+ */
+static PoolNode* pool_take(RC2D_Pool* pool, int count, int* out_count)
+{
+    SDL_LockSpinlock(&pool->lock);
+    if (!pool->freeList && !pool_grow(pool))
+    {
+        SDL_UnlockSpinlock(&pool->lock);
+        RC2D_log(RC2D_LOG_ERROR, "Impossible d'allouer un slab pour le pool '%s'", pool->name);
+        *out_count = 0;
+        return NULL;
+    }
+
+    PoolNode* head = pool->freeList;
+    PoolNode* tail = head;
+    int taken = 1;
+    while (taken < count && tail->next)
+    {
+        tail = tail->next;
+        taken++;
+    }
+    pool->freeList = tail->next;
+    tail->next = NULL;
+
+    pool->outstanding += (size_t)taken;
+    if (pool->outstanding > pool->peakOutstanding)
+    {
+        pool->peakOutstanding = pool->outstanding;
+    }
+    SDL_UnlockSpinlock(&pool->lock);
+
+    *out_count = taken;
+    return head;
+}
+
+/* Rend une chaîne de 'count' objets à la liste partagée */
+static void pool_give(RC2D_Pool* pool, PoolNode* head, PoolNode* tail, int count)
+{
+    SDL_LockSpinlock(&pool->lock);
+    tail->next = pool->freeList;
+    pool->freeList = head;
+    pool->outstanding -= (size_t)count;
+    SDL_UnlockSpinlock(&pool->lock);
+}
+
+/* Destructeur TLS : rend la réserve du thread à son pool (s'il existe encore) et libère le cache */
+static void SDLCALL pool_cache_release(void* data)
+{
+    PoolCache* cache = (PoolCache*)data;
+
+    SDL_LockSpinlock(&pool_caches_lock);
+    RC2D_Pool* pool = cache->pool;
+    if (pool)
+    {
+        if (cache->head)
+        {
+            PoolNode* tail = cache->head;
+            while (tail->next)
+            {
+                tail = tail->next;
+            }
+            pool_give(pool, cache->head, tail, cache->count);
+        }
+
+        PoolCache** link = &pool->caches;
+        while (*link != cache)
+        {
+            link = &(*link)->next;
+        }
+        *link = cache->next;
+    }
+    SDL_UnlockSpinlock(&pool_caches_lock);
+
+    SDL_free(cache);
+}
+
+static PoolCache* pool_get_cache(RC2D_Pool* pool)
+{
+    PoolCache* cache = (PoolCache*)SDL_GetTLS(&pool->tls);
+    if (cache)
+    {
+        return cache;
+    }
+
+    cache = (PoolCache*)SDL_calloc(1, sizeof(PoolCache));
+    if (!cache)
+    {
+        return NULL;
+    }
+    cache->pool = pool;
+
+    SDL_LockSpinlock(&pool_caches_lock);
+    cache->next = pool->caches;
+    pool->caches = cache;
+    SDL_UnlockSpinlock(&pool_caches_lock);
+
+    if (!SDL_SetTLS(&pool->tls, cache, pool_cache_release))
+    {
+        pool_cache_release(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+RC2D_Pool* rc2d_memory_createPool(const char* name, size_t objectSize, size_t objectsPerSlab, bool threadCache)
+{
+    if (objectSize == 0 || objectSize > SDL_SIZE_MAX / 2)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "Taille d'objet invalide pour rc2d_memory_createPool : %zu", objectSize);
+        return NULL;
+    }
+
+    RC2D_Pool* pool = (RC2D_Pool*)SDL_calloc(1, sizeof(RC2D_Pool));
+    if (!pool)
+    {
+        return NULL;
+    }
+
+    pool->name = SDL_strdup(name ? name : "RC2D_Pool");
+    if (!pool->name)
+    {
+        SDL_free(pool);
+        return NULL;
+    }
+
+    // Au moins un pointeur (lien de la liste libre), arrondi à POOL_OBJECT_ALIGN
+    const size_t size = objectSize < sizeof(PoolNode) ? sizeof(PoolNode) : objectSize;
+    pool->objectSize = objectSize;
+    pool->stride = (size + POOL_OBJECT_ALIGN - 1) & ~((size_t)POOL_OBJECT_ALIGN - 1);
+    if (objectsPerSlab == 0)
+    {
+        objectsPerSlab = POOL_DEFAULT_SLAB_BYTES / pool->stride;
+    }
+    pool->objectsPerSlab = objectsPerSlab < POOL_MIN_OBJECTS_PER_SLAB ? POOL_MIN_OBJECTS_PER_SLAB : objectsPerSlab;
+    pool->threadCache = threadCache;
+
+    return pool;
+}
+
+void rc2d_memory_destroyPool(RC2D_Pool* pool)
+{
+    if (!pool)
+    {
+        return;
+    }
+
 #if RC2D_MEMORY_DEBUG_ENABLED
-    // Si aucune allocation n'a été faite, on affiche qu'il n'y a pas de fuite mémoire
-    if (!allocations) 
+    report_pool_leaks(pool);
+#endif
+
+    if (pool->threadCache)
+    {
+        // Le cache du thread courant est libéré tout de suite, ceux des autres threads à leur fin
+        PoolCache* own = (PoolCache*)SDL_GetTLS(&pool->tls);
+        SDL_LockSpinlock(&pool_caches_lock);
+        for (PoolCache* cache = pool->caches; cache; cache = cache->next)
+        {
+            cache->pool = NULL;
+        }
+        pool->caches = NULL;
+        SDL_UnlockSpinlock(&pool_caches_lock);
+
+        if (own)
+        {
+            SDL_SetTLS(&pool->tls, NULL, NULL);
+            SDL_free(own);
+        }
+    }
+
+    PoolSlab* slab = pool->slabs;
+    while (slab)
+    {
+        PoolSlab* next = slab->next;
+        SDL_aligned_free(slab);
+        TELEMETRY_ON_FREE(POOL_CACHE_LINE_SIZE + pool->objectsPerSlab * pool->stride);
+        slab = next;
+    }
+
+    SDL_free(pool->name);
+    SDL_free(pool);
+}
+
+void* rc2d_memory_poolAlloc(RC2D_Pool* pool)
+{
+    if (!pool)
+    {
+        return NULL;
+    }
+
+    int count = 0;
+    if (pool->threadCache)
+    {
+        PoolCache* cache = pool_get_cache(pool);
+        if (cache)
+        {
+            if (!cache->head)
+            {
+                cache->head = pool_take(pool, POOL_CACHE_BATCH, &cache->count);
+                if (!cache->head)
+                {
+                    return NULL;
+                }
+            }
+
+            PoolNode* node = cache->head;
+            cache->head = node->next;
+            cache->count--;
+            return node;
+        }
+    }
+
+    return pool_take(pool, 1, &count);
+}
+
+void rc2d_memory_poolFree(RC2D_Pool* pool, void* ptr)
+{
+    if (!pool || !ptr)
     {
-        RC2D_log(RC2D_LOG_INFO, "RC2D Memory: Aucune fuite mémoire détectée.");
         return;
     }
 
-    // Affichage du rapport de fuites mémoire
-    RC2D_log(RC2D_LOG_ERROR, "RC2D Memory - Rapport des fuites mémoire:");
-    RC2D_log(RC2D_LOG_ERROR, "----------------------------------------");
+    PoolNode* node = (PoolNode*)ptr;
+    if (pool->threadCache)
+    {
+        PoolCache* cache = pool_get_cache(pool);
+        if (cache)
+        {
+            node->next = cache->head;
+            cache->head = node;
+            if (++cache->count < POOL_CACHE_MAX)
+            {
+                return;
+            }
+
+            // Réserve pleine : la moitié la plus ancienne (fin de chaîne) retourne au pool
+            PoolNode* keepTail = cache->head;
+            for (int i = 1; i < POOL_CACHE_MAX - POOL_CACHE_BATCH; i++)
+            {
+                keepTail = keepTail->next;
+            }
+            PoolNode* head = keepTail->next;
+            PoolNode* tail = head;
+            while (tail->next)
+            {
+                tail = tail->next;
+            }
+            keepTail->next = NULL;
+            cache->count = POOL_CACHE_MAX - POOL_CACHE_BATCH;
+            pool_give(pool, head, tail, POOL_CACHE_BATCH);
+            return;
+        }
+    }
+
+    pool_give(pool, node, node, 1);
+}
+
+void rc2d_memory_getPoolStats(RC2D_Pool* pool, RC2D_PoolStats* out_stats)
+{
+    if (!pool || !out_stats)
+    {
+        return;
+    }
+
+    SDL_LockSpinlock(&pool->lock);
+    out_stats->objectSize = pool->objectSize;
+    out_stats->slabCount = pool->slabCount;
+    out_stats->capacity = pool->slabCount * pool->objectsPerSlab;
+    out_stats->liveCount = pool->outstanding;
+    out_stats->peakCount = pool->peakOutstanding;
+    SDL_UnlockSpinlock(&pool->lock);
+}
+
+int rc2d_memory_getTopCallsites(RC2D_MemoryCallsiteStats* out_stats, int max_stats)
+{
+    if (!out_stats || max_stats <= 0)
+    {
+        return 0;
+    }
+
+    int count = 0;
+#if RC2D_MEMORY_DEBUG_ENABLED
+    for (int lock = 0; lock < CALLSITE_LOCK_COUNT; lock++)
+    {
+        SDL_LockSpinlock(&callsite_locks[lock]);
+        for (int bucket = lock; bucket < CALLSITE_BUCKET_COUNT; bucket += CALLSITE_LOCK_COUNT)
+        {
+            for (const CallSite* site = callsite_buckets[bucket]; site; site = site->next)
+            {
+                // Insertion triée par pic décroissant, en ne gardant que les max_stats premiers
+                int pos = count;
+                while (pos > 0 && out_stats[pos - 1].peakBytes < site->peakBytes)
+                {
+                    pos--;
+                }
+                if (pos >= max_stats)
+                {
+                    continue;
+                }
 
-    // Parcourir la liste des allocations et afficher les informations
+                const int last = (count < max_stats) ? count : max_stats - 1;
+                SDL_memmove(&out_stats[pos + 1], &out_stats[pos], (size_t)(last - pos) * sizeof(RC2D_MemoryCallsiteStats));
+                out_stats[pos].file = site->file;
+                out_stats[pos].line = site->line;
+                out_stats[pos].func = site->func;
+                out_stats[pos].liveCount = site->liveCount;
+                out_stats[pos].liveBytes = site->liveBytes;
+                out_stats[pos].peakBytes = site->peakBytes;
+                out_stats[pos].totalCount = site->totalCount;
+                if (count < max_stats) count++;
+            }
+        }
+        SDL_UnlockSpinlock(&callsite_locks[lock]);
+    }
+#endif
+
+    return count;
+}
+
+void rc2d_memory_report(void)
+{
+#if RC2D_MEMORY_DEBUG_ENABLED
+    // Parcourir les shards et afficher les fuites (les premières seulement si elles sont nombreuses)
     size_t total_leaked = 0;
     int leak_count = 0;
-    Allocation* current = allocations;
-    while (current) 
+    for (int s = 0; s < ALLOCATION_SHARD_COUNT; s++)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Fuite: %p, Taille: %zu octets, Fichier: %s, Ligne: %d, Fonction: %s",
-                 current->ptr, current->size, current->file, current->line, current->func);
-        total_leaked += current->size;
-        leak_count++;
-        current = current->next;
+        AllocationShard* shard = &allocation_shards[s];
+        SDL_LockSpinlock(&shard->lock);
+        for (Uint32 i = 0; i < shard->capacity; i++)
+        {
+            const Allocation* current = &shard->entries[i];
+            if (!current->ptr) continue;
+
+            if (leak_count == 0)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "RC2D Memory - Rapport des fuites mémoire:");
+                RC2D_log(RC2D_LOG_ERROR, "----------------------------------------");
+            }
+            if (leak_count < MEMORY_REPORT_MAX_LEAKS)
+            {
+                RC2D_log(RC2D_LOG_ERROR, "Fuite: %p, Taille: %zu octets, Fichier: %s, Ligne: %d, Fonction: %s%s%s",
+                         current->ptr, current->size,
+                         current->site ? current->site->file : "?", current->site ? current->site->line : 0,
+                         current->site ? current->site->func : "?",
+                         current->pool ? ", Pool: " : "", current->pool ? current->pool->name : "");
+            }
+            total_leaked += current->size;
+            leak_count++;
+        }
+        SDL_UnlockSpinlock(&shard->lock);
     }
 
-    RC2D_log(RC2D_LOG_ERROR, "----------------------------------------");
-    RC2D_log(RC2D_LOG_ERROR, "Total: %d fuites, %zu octets non libérés", leak_count, total_leaked);
+    if (leak_count == 0)
+    {
+        RC2D_log(RC2D_LOG_INFO, "RC2D Memory: Aucune fuite mémoire détectée.");
+    }
+    else
+    {
+        if (leak_count > MEMORY_REPORT_MAX_LEAKS)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "... et %d autres fuites", leak_count - MEMORY_REPORT_MAX_LEAKS);
+        }
+        RC2D_log(RC2D_LOG_ERROR, "----------------------------------------");
+        RC2D_log(RC2D_LOG_ERROR, "Total: %d fuites, %zu octets non libérés", leak_count, total_leaked);
+    }
 
-    /* Libérer la liste des allocations */
-    while (allocations) 
+    // Sites d'appel les plus gourmands, triés par pic d'octets vivants
+    RC2D_MemoryCallsiteStats top[RC2D_MEMORY_REPORT_TOP_N];
+    const int top_count = rc2d_memory_getTopCallsites(top, RC2D_MEMORY_REPORT_TOP_N);
+    if (top_count > 0)
     {
-        Allocation* temp = allocations;
-        allocations = allocations->next;
-        SDL_free(temp);
+        RC2D_log(RC2D_LOG_INFO, "RC2D Memory - Top %d des sites d'allocation (pic d'octets vivants):", top_count);
+        for (int i = 0; i < top_count; i++)
+        {
+            RC2D_log(RC2D_LOG_INFO, "#%d %s:%d (%s) pic: %llu octets, allocations: %llu, vivantes: %llu (%llu octets)",
+                     i + 1, top[i].file, top[i].line, top[i].func,
+                     (unsigned long long)top[i].peakBytes, (unsigned long long)top[i].totalCount,
+                     (unsigned long long)top[i].liveCount, (unsigned long long)top[i].liveBytes);
+        }
     }
 #else
     /* Ne rien faire si le suivi de mémoire est désactivé */
 #endif
-}
\ No newline at end of file
+}
@@ -4,10 +4,14 @@
 #include <RC2D/RC2D_logger.h>
 #include <RC2D/RC2D_internal.h>
 #include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_thread.h>
 
 #include <SDL3/SDL_stdinc.h>
 #include <SDL3/SDL_iostream.h>
 #include <SDL3/SDL_gpu.h>
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3/SDL_cpuinfo.h>
 
 /**
  * Remarque : Les algorithmes pour encrypter/compresser sont utilisés de base via l'outil rrespacker
@@ -27,11 +31,62 @@ static const char *rc2d_rres_password = NULL;
  */ 
 static char rc2d_rres_passwordBuffer[16];
 
+/**
+ * Protège rc2d_rres_password / rc2d_rres_passwordBuffer : les threads qui déchiffrent
+ * en copient le contenu sous ce verrou (voir rc2d_rres_copyCipherPassword).
+ */
+static SDL_SpinLock rc2d_rres_passwordLock = 0;
+
 /**
  * Password par défaut utilisé par l'outil rrespacker pour empaqueter les ressources
  */
 static const char *passwordDefaultInRrespacker = "password12345";
 
+/**
+ * Paramètres Argon2i utilisés par l'outil rrespacker pour dériver la clé de chiffrement
+ */
+#define RC2D_RRES_ARGON2_BLOCKS 16384 // Blocks: 16 MB
+#define RC2D_RRES_ARGON2_PASSES 3 // Iterations
+
+/**
+ * Nombre maximal de threads utilisés par rc2d_rres_unpackChunksParallel (thread appelant compris)
+ */
+#define RC2D_RRES_UNPACK_MAX_THREADS 16
+
+/**
+ * Nombre de clés dérivées conservées dans le cache (couples mot de passe + salt)
+ */
+#define RC2D_RRES_KEY_CACHE_CAPACITY 32
+
+/**
+ * Marque un slot libre dans les tables de hachage d'un RC2D_RresPack.
+ */
+#define RC2D_RRES_PACK_EMPTY_SLOT 0xFFFFFFFFu
+
+/**
+ * Clé dérivée par Argon2i pour un couple (mot de passe, salt)
+ */
+typedef struct RC2D_RresCachedKey {
+    uint8_t pass[16];
+    uint8_t salt[16];
+    uint8_t key[32];
+    Uint64 lastUse; // 0 = entrée libre
+} RC2D_RresCachedKey;
+
+/**
+ * Cache des clés dérivées : la dérivation (16 MB, 3 passes) ne tourne qu'une fois par
+ * couple (mot de passe, salt), donc une seule fois par pack si le packer partage le salt.
+ * La zone de travail d'Argon2 est allouée une fois puis réutilisée.
+ */
+static RC2D_RresCachedKey rc2d_rres_keyCache[RC2D_RRES_KEY_CACHE_CAPACITY];
+static Uint64 rc2d_rres_keyCacheClock = 0;
+static bool rc2d_rres_keyCacheEnabled = true;
+static void *rc2d_rres_workArea = NULL;
+static bool rc2d_rres_workAreaBusy = false;
+static uint8_t rc2d_rres_inflightPass[16];  // Couple en cours de dérivation dans la zone partagée
+static uint8_t rc2d_rres_inflightSalt[16];
+static SDL_SpinLock rc2d_rres_keyCacheLock = 0;
+
 /**
  * Calcule le hachage MD5 pour une séquence de données.
  *
@@ -40,24 +95,23 @@ static const char *passwordDefaultInRrespacker = "password12345";
  * (16 octets) utilisé pour vérifier l'intégrité des données.
  *
  * La fonction utilise une série de transformations et opérations bit à bit sur les données
- * d'entrée pour produire le hachage final. Le résultat est un tableau statique de 4 entiers
- * non signés (représentant les 128 bits du hachage MD5) qui doit être utilisé immédiatement
- * ou copié ailleurs car il sera écrasé lors du prochain appel à cette fonction.
+ * d'entrée pour produire le hachage final. Le résultat (4 entiers non signés représentant les
+ * 128 bits du hachage MD5) est écrit dans le tableau fourni par l'appelant : la fonction est
+ * réentrante et peut être appelée depuis plusieurs threads.
  *
  * @param data Pointeur vers les données à hacher.
  * @param size Taille des données en octets.
- * @return Un pointeur vers un tableau statique de 4 entiers non signés représentant le hachage MD5.
+ * @param hash Tableau de 4 entiers non signés qui reçoit le hachage MD5.
+ * @return false si le buffer de travail n'a pas pu être alloué (hash non défini), true sinon.
  */
-static unsigned int *ComputeMD5(const unsigned char *data, int size)
+static bool ComputeMD5(const unsigned char *data, int size, unsigned int hash[4])
 {
 #define LEFTROTATE(x, c) (((x) << (c)) | ((x) >> (32 - (c))))
 
-    static unsigned int hash[4] = { 0 };
-
     // NOTE: All variables are unsigned 32 bit and wrap modulo 2^32 when calculating
 
     // r specifies the per-round shift amounts
-    unsigned int r[] = {
+    static const unsigned int r[] = {
         7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22, 7, 12, 17, 22,
         5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20, 5,  9, 14, 20,
         4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23, 4, 11, 16, 23,
@@ -65,7 +119,7 @@ static unsigned int *ComputeMD5(const unsigned char *data, int size)
     };
 
     // Use binary integer part of the sines of integers (in radians) as constants// Initialize variables:
-    unsigned int k[] = {
+    static const unsigned int k[] = {
         0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee,
         0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
         0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be,
@@ -101,6 +155,7 @@ static unsigned int *ComputeMD5(const unsigned char *data, int size)
     int newDataSize = ((((size + 8)/64) + 1)*64) - 8;
 
     unsigned char *msg = (unsigned char *)RC2D_calloc(newDataSize + 64, 1);   // Also appends "0" bits (we alloc also 64 extra bytes...)
+    if (msg == NULL) return false;
     SDL_memcpy(msg, data, size);
     msg[size] = 128;                 // Write the "1" bit
 
@@ -160,7 +215,7 @@ static unsigned int *ComputeMD5(const unsigned char *data, int size)
 
     RC2D_safe_free(msg);
 
-    return hash;
+    return true;
 }
 
 void rc2d_rres_setCipherPassword(const char *pass)
@@ -177,6 +232,8 @@ void rc2d_rres_setCipherPassword(const char *pass)
         return;
     }
 
+    SDL_LockSpinlock(&rc2d_rres_passwordLock);
+
     // Initialise le buffer à zéro
     SDL_memset(rc2d_rres_passwordBuffer, 0, sizeof(rc2d_rres_passwordBuffer));
 
@@ -185,23 +242,668 @@ void rc2d_rres_setCipherPassword(const char *pass)
 
     // Définit le mot de passe pour le décryptage
     rc2d_rres_password = rc2d_rres_passwordBuffer;
+
+    SDL_UnlockSpinlock(&rc2d_rres_passwordLock);
 }
 
 const char *rc2d_rres_getCipherPassword(void)
 {
-    if (rc2d_rres_password == NULL) 
-    {   
-        rc2d_rres_password = passwordDefaultInRrespacker;
-    }
+    SDL_LockSpinlock(&rc2d_rres_passwordLock);
+    const char *password = (rc2d_rres_password != NULL) ? rc2d_rres_password : passwordDefaultInRrespacker;
+    SDL_UnlockSpinlock(&rc2d_rres_passwordLock);
 
-    return rc2d_rres_password;
+    return password;
 }
 
 void rc2d_rres_cleanCipherPassword(void)
 {
     // Efface le mot de passe
-    SDL_memset(rc2d_rres_passwordBuffer, 0, sizeof(rc2d_rres_passwordBuffer));
+    SDL_LockSpinlock(&rc2d_rres_passwordLock);
+    crypto_wipe(rc2d_rres_passwordBuffer, sizeof(rc2d_rres_passwordBuffer));
     rc2d_rres_password = NULL;
+    SDL_UnlockSpinlock(&rc2d_rres_passwordLock);
+
+    // Efface aussi les clés dérivées de ce mot de passe
+    rc2d_rres_clearKeyCache();
+}
+
+/**
+ * Copie le mot de passe courant sur 16 octets complétés par des zéros (format attendu par rrespacker).
+ * La copie est faite sous verrou : un autre thread peut changer le mot de passe pendant un déchiffrement.
+ */
+static void rc2d_rres_copyCipherPassword(uint8_t pass[16])
+{
+    SDL_memset(pass, 0, 16);
+
+    SDL_LockSpinlock(&rc2d_rres_passwordLock);
+    const char *password = (rc2d_rres_password != NULL) ? rc2d_rres_password : passwordDefaultInRrespacker;
+    SDL_memcpy(pass, password, SDL_min(SDL_strlen(password), 15));
+    SDL_UnlockSpinlock(&rc2d_rres_passwordLock);
+}
+
+rresResourceChunk rc2d_rres_loadResourceChunkFromStorage(const char *storage_path, RC2D_StorageKind storage_kind, int rresId)
+{
+    rresResourceChunk chunk = { 0 };
+
+    // Ouvre le pack en streaming : les chunks non demandés sont sautés, jamais lus
+    RC2D_StorageStream *stream = NULL;
+    if (storage_kind == RC2D_STORAGE_TITLE)
+    {
+        stream = rc2d_storage_titleOpenStream(storage_path);
+    }
+    else if (storage_kind == RC2D_STORAGE_USER)
+    {
+        stream = rc2d_storage_userOpenStream(storage_path);
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadResourceChunkFromStorage: invalid storage kind");
+        return chunk;
+    }
+
+    if (stream == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadResourceChunkFromStorage: cannot open '%s'", storage_path);
+        return chunk;
+    }
+
+    chunk = rresLoadResourceChunkFromIO(rc2d_storage_streamGetIO(stream), rresId);
+    rc2d_storage_closeStream(stream);
+
+    return chunk;
+}
+
+/**
+ * Entrée de l'index d'un pack : infos du chunk et position de ses données dans le fichier.
+ */
+typedef struct RC2D_RresPackEntry {
+    rresResourceChunkInfo info;
+    Uint64 dataOffset;
+    rresResourceChunk *cached;  // Copie dépaquetée en cache, NULL si absente
+    Uint64 cachedBytes;
+    Uint64 lastUse;
+} RC2D_RresPackEntry;
+
+/**
+ * Slot des tables de hachage du pack (adressage ouvert, sondage linéaire).
+ */
+typedef struct RC2D_RresPackSlot {
+    Uint32 hash;
+    Uint32 index;  // Index dans entries/names, RC2D_RRES_PACK_EMPTY_SLOT si libre
+} RC2D_RresPackSlot;
+
+/**
+ * Nom de fichier du répertoire central (CDIR), identifiant et offset du chunk associés.
+ */
+typedef struct RC2D_RresPackName {
+    char *fileName;
+    int id;
+    Uint32 offset;
+} RC2D_RresPackName;
+
+struct RC2D_RresPack {
+    RC2D_StorageMapping mapping;  // Pack mappé (storage title avec mmap)
+    RC2D_StorageStream *stream;   // Sinon : lectures à l'offset via ce flux
+    Uint64 size;
+    SDL_Mutex *mutex;             // Protège le flux (seek + read) et le cache
+
+    RC2D_RresPackEntry *entries;
+    int entryCount;
+    RC2D_RresPackSlot *idSlots;
+    Uint32 idCapacity;
+
+    RC2D_RresPackName *names;
+    int nameCount;
+    RC2D_RresPackSlot *nameSlots;
+    Uint32 nameCapacity;
+
+    Uint64 cacheBudget;
+    Uint64 cacheBytes;
+    Uint64 cacheClock;
+};
+
+static Uint32 rc2d_rres_hashName(const char *s)
+{
+    Uint32 h = 2166136261u;
+    while (*s)
+    {
+        h ^= (Uint8)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+/* Les ids rres sont déjà des CRC32, on les mélange seulement pour casser les motifs */
+static Uint32 rc2d_rres_hashId(int id)
+{
+    return (Uint32)id * 2654435761u;
+}
+
+/* Capacité puissance de 2 pour une charge <= 0.5 */
+static Uint32 rc2d_rres_packIndexCapacity(int count)
+{
+    Uint32 capacity = 16;
+    while ((Uint64)capacity < (Uint64)count * 2) capacity <<= 1;
+    return capacity;
+}
+
+static RC2D_RresPackSlot *rc2d_rres_packNewSlots(Uint32 capacity)
+{
+    RC2D_RresPackSlot *slots = (RC2D_RresPackSlot *)RC2D_malloc(capacity * sizeof(RC2D_RresPackSlot));
+    if (slots == NULL) return NULL;
+    for (Uint32 i = 0; i < capacity; i++) slots[i].index = RC2D_RRES_PACK_EMPTY_SLOT;
+    return slots;
+}
+
+static RC2D_RresPackEntry *rc2d_rres_packFindEntry(const RC2D_RresPack *pack, int rresId)
+{
+    if (pack->idSlots == NULL) return NULL;
+
+    const Uint32 hash = rc2d_rres_hashId(rresId);
+    const Uint32 mask = pack->idCapacity - 1;
+    for (Uint32 i = hash & mask; pack->idSlots[i].index != RC2D_RRES_PACK_EMPTY_SLOT; i = (i + 1) & mask)
+    {
+        // rc2d_rres_hashId est bijectif : même hash <=> même id (y compris pour les alias du CDIR)
+        if (pack->idSlots[i].hash == hash) return &pack->entries[pack->idSlots[i].index];
+    }
+    return NULL;
+}
+
+/**
+ * Donne accès à [offset, offset + size[ du pack : pointeur direct dans le mapping,
+ * ou buffer lu depuis le flux (*owned, à libérer par l'appelant).
+ */
+static const void *rc2d_rres_packBytes(RC2D_RresPack *pack, Uint64 offset, Uint64 size, void **owned)
+{
+    *owned = NULL;
+    if (offset > pack->size || size > pack->size - offset) return NULL;
+
+    if (pack->mapping.data != NULL) return (const Uint8 *)pack->mapping.data + offset;
+
+    void *buffer = RC2D_malloc(size > 0 ? (size_t)size : 1);
+    if (buffer == NULL) return NULL;
+
+    SDL_LockMutex(pack->mutex);
+    const bool ok = rc2d_storage_streamSeek(pack->stream, (Sint64)offset, SDL_IO_SEEK_SET) == (Sint64)offset &&
+                    rc2d_storage_streamRead(pack->stream, buffer, (size_t)size) == (size_t)size;
+    SDL_UnlockMutex(pack->mutex);
+
+    if (!ok)
+    {
+        RC2D_free(buffer);
+        return NULL;
+    }
+
+    *owned = buffer;
+    return buffer;
+}
+
+/* Taille de data.raw d'un chunk dépaqueté : baseSize moins propCount et les props */
+static unsigned int rc2d_rres_chunkRawSize(const rresResourceChunk *chunk)
+{
+    const unsigned int header = (unsigned int)sizeof(int) * (1 + chunk->data.propCount);
+    return (chunk->info.baseSize > header) ? chunk->info.baseSize - header : 0;
+}
+
+static bool rc2d_rres_copyChunk(const rresResourceChunk *src, rresResourceChunk *dst)
+{
+    rresResourceChunk copy = { 0 };
+    copy.info = src->info;
+    copy.data.propCount = src->data.propCount;
+
+    if (src->data.propCount > 0)
+    {
+        copy.data.props = (unsigned int *)RC2D_malloc(src->data.propCount * sizeof(unsigned int));
+        if (copy.data.props == NULL) return false;
+        SDL_memcpy(copy.data.props, src->data.props, src->data.propCount * sizeof(unsigned int));
+    }
+
+    const unsigned int rawSize = rc2d_rres_chunkRawSize(src);
+    copy.data.raw = RC2D_malloc(rawSize > 0 ? rawSize : 1);
+    if (copy.data.raw == NULL)
+    {
+        RC2D_safe_free(copy.data.props);
+        return false;
+    }
+    SDL_memcpy(copy.data.raw, src->data.raw, rawSize);
+
+    *dst = copy;
+    return true;
+}
+
+/* Retire du cache l'entrée la moins récemment utilisée (appelé sous pack->mutex) */
+static bool rc2d_rres_packEvictOne(RC2D_RresPack *pack)
+{
+    RC2D_RresPackEntry *lru = NULL;
+    for (int i = 0; i < pack->entryCount; i++)
+    {
+        RC2D_RresPackEntry *entry = &pack->entries[i];
+        if (entry->cached != NULL && (lru == NULL || entry->lastUse < lru->lastUse)) lru = entry;
+    }
+    if (lru == NULL) return false;
+
+    rresUnloadResourceChunk(*lru->cached);
+    RC2D_free(lru->cached);
+    lru->cached = NULL;
+    pack->cacheBytes -= lru->cachedBytes;
+    lru->cachedBytes = 0;
+    return true;
+}
+
+static bool rc2d_rres_packIndexChunks(RC2D_RresPack *pack, const rresFileHeader *header)
+{
+    pack->entries = (RC2D_RresPackEntry *)RC2D_calloc(header->chunkCount > 0 ? header->chunkCount : 1, sizeof(RC2D_RresPackEntry));
+    if (pack->entries == NULL) return false;
+
+    // Seules les infos (32 octets) de chaque chunk sont lues, les données sont sautées
+    Uint64 offset = sizeof(rresFileHeader);
+    for (int i = 0; i < header->chunkCount; i++)
+    {
+        void *owned = NULL;
+        const void *bytes = rc2d_rres_packBytes(pack, offset, sizeof(rresResourceChunkInfo), &owned);
+        if (bytes == NULL)
+        {
+            RC2D_log(RC2D_LOG_WARN, "rc2d_rres_openPack: truncated pack, %d/%d chunks indexed", i, header->chunkCount);
+            break;
+        }
+
+        RC2D_RresPackEntry *entry = &pack->entries[pack->entryCount];
+        SDL_memcpy(&entry->info, bytes, sizeof(rresResourceChunkInfo));
+        RC2D_safe_free(owned);
+
+        entry->dataOffset = offset + sizeof(rresResourceChunkInfo);
+        if (entry->dataOffset + entry->info.packedSize > pack->size)
+        {
+            RC2D_log(RC2D_LOG_WARN, "rc2d_rres_openPack: truncated pack, %d/%d chunks indexed", i, header->chunkCount);
+            break;
+        }
+
+        offset = entry->dataOffset + entry->info.packedSize;
+        pack->entryCount++;
+    }
+
+    return true;
+}
+
+static void rc2d_rres_packInsertId(RC2D_RresPack *pack, int id, int entryIndex)
+{
+    const Uint32 hash = rc2d_rres_hashId(id);
+    const Uint32 mask = pack->idCapacity - 1;
+    Uint32 i = hash & mask;
+    while (pack->idSlots[i].index != RC2D_RRES_PACK_EMPTY_SLOT) i = (i + 1) & mask;
+    pack->idSlots[i].hash = hash;
+    pack->idSlots[i].index = (Uint32)entryIndex;
+}
+
+/* Chunk dont les infos commencent à 'offset' (entries est trié par offset croissant) */
+static int rc2d_rres_packFindEntryAt(const RC2D_RresPack *pack, Uint64 offset)
+{
+    int lo = 0;
+    int hi = pack->entryCount - 1;
+    while (lo <= hi)
+    {
+        const int mid = lo + (hi - lo) / 2;
+        const Uint64 infoOffset = pack->entries[mid].dataOffset - sizeof(rresResourceChunkInfo);
+        if (infoOffset == offset) return mid;
+        if (infoOffset < offset) lo = mid + 1;
+        else hi = mid - 1;
+    }
+    return -1;
+}
+
+static bool rc2d_rres_packIndexIds(RC2D_RresPack *pack)
+{
+    pack->idCapacity = rc2d_rres_packIndexCapacity(pack->entryCount + pack->nameCount);
+    pack->idSlots = rc2d_rres_packNewSlots(pack->idCapacity);
+    if (pack->idSlots == NULL) return false;
+
+    for (int e = 0; e < pack->entryCount; e++)
+    {
+        // Ressource multi-chunks : seul le premier chunk est indexé (comme rresLoadResourceChunk)
+        const int id = pack->entries[e].info.id;
+        if (rc2d_rres_packFindEntry(pack, id) == NULL) rc2d_rres_packInsertId(pack, id, e);
+    }
+
+    // Contenus dédoublonnés : plusieurs entrées du CDIR pointent sur le même chunk. rc2d_rrespack
+    // leur donne l'id de ce chunk, les packs plus anciens l'id de leur propre nom (résolu par l'offset)
+    for (int n = 0; n < pack->nameCount; n++)
+    {
+        const RC2D_RresPackName *name = &pack->names[n];
+        if (rc2d_rres_packFindEntry(pack, name->id) != NULL) continue;
+
+        const int e = rc2d_rres_packFindEntryAt(pack, name->offset);
+        if (e >= 0) rc2d_rres_packInsertId(pack, name->id, e);
+    }
+
+    return true;
+}
+
+static bool rc2d_rres_packIndexNames(RC2D_RresPack *pack)
+{
+    const RC2D_RresPackEntry *cdir = NULL;
+    for (int e = 0; e < pack->entryCount && cdir == NULL; e++)
+    {
+        if (SDL_memcmp(pack->entries[e].info.type, "CDIR", 4) == 0) cdir = &pack->entries[e];
+    }
+
+    // Pas de répertoire central : le pack reste utilisable par identifiant
+    if (cdir == NULL) return true;
+
+    void *owned = NULL;
+    const void *bytes = rc2d_rres_packBytes(pack, cdir->dataOffset, cdir->info.packedSize, &owned);
+    if (bytes == NULL) return false;
+
+    rresResourceChunkData data = rresLoadResourceChunkData(cdir->info, (void *)bytes);
+    RC2D_safe_free(owned);
+
+    // Nombre d'entrées (props[0]) borné par la taille des données : une entrée fait au moins 16 octets
+    const unsigned int rawSize = (data.propCount >= 1 && cdir->info.baseSize > sizeof(int) * (1 + data.propCount)) ?
+                                 cdir->info.baseSize - (unsigned int)sizeof(int) * (1 + data.propCount) : 0;
+    if (data.props == NULL || data.raw == NULL || data.propCount < 1 || data.props[0] > rawSize / 16)
+    {
+        RC2D_log(RC2D_LOG_WARN, "rc2d_rres_openPack: unreadable central directory, lookups by name disabled");
+        RC2D_safe_free(data.props);
+        RC2D_safe_free(data.raw);
+        return true;
+    }
+
+    const int count = (int)data.props[0];
+    pack->names = (RC2D_RresPackName *)RC2D_calloc(count > 0 ? count : 1, sizeof(RC2D_RresPackName));
+    pack->nameCapacity = rc2d_rres_packIndexCapacity(count);
+    pack->nameSlots = (pack->names != NULL) ? rc2d_rres_packNewSlots(pack->nameCapacity) : NULL;
+    if (pack->names == NULL || pack->nameSlots == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: out of memory for %d names", count);
+        RC2D_safe_free(data.props);
+        RC2D_safe_free(data.raw);
+        return false;
+    }
+
+    bool ok = true;
+    const unsigned char *ptr = (const unsigned char *)data.raw;
+    const unsigned char *end = ptr + rawSize;
+    const Uint32 mask = pack->nameCapacity - 1;
+
+    for (int n = 0; ok && n < count; n++)
+    {
+        // Entrée : id, offset, reserved, fileNameSize puis le nom (complété par des zéros)
+        if (end - ptr < 16) break;
+        const int id = ((const int *)ptr)[0];
+        const unsigned int offset = ((const unsigned int *)ptr)[1];
+        const unsigned int fileNameSize = ((const unsigned int *)ptr)[3];
+        if ((Uint64)(end - ptr - 16) < fileNameSize) break;
+
+        char *fileName = RC2D_strndup((const char *)ptr + 16, SDL_min(fileNameSize, RRES_MAX_FILENAME_SIZE - 1));
+        ptr += 16 + fileNameSize;
+        if (fileName == NULL)
+        {
+            ok = false;
+            break;
+        }
+
+        pack->names[pack->nameCount].fileName = fileName;
+        pack->names[pack->nameCount].id = id;
+        pack->names[pack->nameCount].offset = offset;
+
+        const Uint32 hash = rc2d_rres_hashName(fileName);
+        Uint32 i = hash & mask;
+        while (pack->nameSlots[i].index != RC2D_RRES_PACK_EMPTY_SLOT) i = (i + 1) & mask;
+        pack->nameSlots[i].hash = hash;
+        pack->nameSlots[i].index = (Uint32)pack->nameCount;
+        pack->nameCount++;
+    }
+
+    if (ok && pack->nameCount < count)
+    {
+        RC2D_log(RC2D_LOG_WARN, "rc2d_rres_openPack: truncated central directory, %d/%d names indexed", pack->nameCount, count);
+    }
+
+    RC2D_safe_free(data.props);
+    RC2D_safe_free(data.raw);
+    return ok;
+}
+
+RC2D_RresPack *rc2d_rres_openPack(const char *storage_path, RC2D_StorageKind storage_kind)
+{
+    if (storage_path == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: storage_path is NULL");
+        return NULL;
+    }
+    if (storage_kind != RC2D_STORAGE_TITLE && storage_kind != RC2D_STORAGE_USER)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: invalid storage kind");
+        return NULL;
+    }
+
+    RC2D_RresPack *pack = (RC2D_RresPack *)RC2D_calloc(1, sizeof(RC2D_RresPack));
+    if (pack == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: out of memory");
+        return NULL;
+    }
+
+    pack->mutex = SDL_CreateMutex();
+    if (pack->mutex == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: SDL_CreateMutex failed: %s", SDL_GetError());
+        RC2D_free(pack);
+        return NULL;
+    }
+
+    // Mapping si possible (le noyau ne charge que les pages lues), sinon lectures à l'offset
+    if (storage_kind == RC2D_STORAGE_TITLE && rc2d_storage_titleTryMapFile(storage_path, &pack->mapping))
+    {
+        pack->size = pack->mapping.len;
+    }
+    else
+    {
+        pack->stream = (storage_kind == RC2D_STORAGE_TITLE) ? rc2d_storage_titleOpenStream(storage_path)
+                                                            : rc2d_storage_userOpenStream(storage_path);
+        if (pack->stream == NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: cannot open '%s'", storage_path);
+            rc2d_rres_closePack(pack);
+            return NULL;
+        }
+        pack->size = rc2d_storage_streamSize(pack->stream);
+    }
+
+    void *owned = NULL;
+    const void *bytes = rc2d_rres_packBytes(pack, 0, sizeof(rresFileHeader), &owned);
+    rresFileHeader header = { 0 };
+    if (bytes != NULL) SDL_memcpy(&header, bytes, sizeof(rresFileHeader));
+    RC2D_safe_free(owned);
+
+    if (bytes == NULL || SDL_memcmp(header.id, "rres", 4) != 0 || header.version != 100)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: '%s' is not a valid rres file", storage_path);
+        rc2d_rres_closePack(pack);
+        return NULL;
+    }
+
+    if (!rc2d_rres_packIndexChunks(pack, &header) || !rc2d_rres_packIndexNames(pack) || !rc2d_rres_packIndexIds(pack))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_openPack: failed to index '%s'", storage_path);
+        rc2d_rres_closePack(pack);
+        return NULL;
+    }
+
+    RC2D_log(RC2D_LOG_DEBUG, "RRES: Pack '%s' opened: %d chunks, %d names (%s)", storage_path,
+             pack->entryCount, pack->nameCount, pack->mapping.data != NULL ? "mapped" : "stream");
+    return pack;
+}
+
+void rc2d_rres_closePack(RC2D_RresPack *pack)
+{
+    if (pack == NULL) return;
+
+    if (pack->entries != NULL)
+    {
+        for (int i = 0; i < pack->entryCount; i++)
+        {
+            if (pack->entries[i].cached == NULL) continue;
+            rresUnloadResourceChunk(*pack->entries[i].cached);
+            RC2D_free(pack->entries[i].cached);
+        }
+        RC2D_free(pack->entries);
+    }
+    if (pack->names != NULL)
+    {
+        for (int i = 0; i < pack->nameCount; i++) RC2D_free(pack->names[i].fileName);
+        RC2D_free(pack->names);
+    }
+    RC2D_safe_free(pack->idSlots);
+    RC2D_safe_free(pack->nameSlots);
+
+    if (pack->mapping.data != NULL) rc2d_storage_unmapFile(&pack->mapping);
+    if (pack->stream != NULL) rc2d_storage_closeStream(pack->stream);
+    if (pack->mutex != NULL) SDL_DestroyMutex(pack->mutex);
+
+    RC2D_free(pack);
+}
+
+int rc2d_rres_getPackChunkCount(const RC2D_RresPack *pack)
+{
+    return (pack != NULL) ? pack->entryCount : 0;
+}
+
+bool rc2d_rres_getPackChunkInfo(const RC2D_RresPack *pack, int rresId, rresResourceChunkInfo *info)
+{
+    if (pack == NULL || info == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_getPackChunkInfo: invalid arguments");
+        return false;
+    }
+
+    const RC2D_RresPackEntry *entry = rc2d_rres_packFindEntry(pack, rresId);
+    if (entry == NULL) return false;
+
+    *info = entry->info;
+    return true;
+}
+
+int rc2d_rres_getPackResourceId(const RC2D_RresPack *pack, const char *fileName)
+{
+    if (pack == NULL || fileName == NULL || pack->nameSlots == NULL) return 0;
+
+    const Uint32 hash = rc2d_rres_hashName(fileName);
+    const Uint32 mask = pack->nameCapacity - 1;
+    for (Uint32 i = hash & mask; pack->nameSlots[i].index != RC2D_RRES_PACK_EMPTY_SLOT; i = (i + 1) & mask)
+    {
+        const RC2D_RresPackName *name = &pack->names[pack->nameSlots[i].index];
+        if (pack->nameSlots[i].hash == hash && SDL_strcmp(name->fileName, fileName) == 0) return name->id;
+    }
+    return 0;
+}
+
+rresResourceChunk rc2d_rres_loadPackChunk(RC2D_RresPack *pack, int rresId)
+{
+    rresResourceChunk chunk = { 0 };
+
+    if (pack == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadPackChunk: pack is NULL");
+        return chunk;
+    }
+
+    RC2D_RresPackEntry *entry = rc2d_rres_packFindEntry(pack, rresId);
+    if (entry == NULL)
+    {
+        RC2D_log(RC2D_LOG_WARN, "rc2d_rres_loadPackChunk: resource id 0x%08x not found", (unsigned int)rresId);
+        return chunk;
+    }
+
+    // Cache : copie du chunk déjà dépaqueté, aucun accès au fichier
+    SDL_LockMutex(pack->mutex);
+    if (entry->cached != NULL)
+    {
+        entry->lastUse = ++pack->cacheClock;
+        const bool copied = rc2d_rres_copyChunk(entry->cached, &chunk);
+        SDL_UnlockMutex(pack->mutex);
+        if (!copied) RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadPackChunk: out of memory");
+        return chunk;
+    }
+    SDL_UnlockMutex(pack->mutex);
+
+    // Seuls les octets de ce chunk sont lus (ou touchés dans le mapping)
+    void *owned = NULL;
+    const void *bytes = rc2d_rres_packBytes(pack, entry->dataOffset, entry->info.packedSize, &owned);
+    if (bytes == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadPackChunk: failed to read resource id 0x%08x", (unsigned int)rresId);
+        return chunk;
+    }
+
+    chunk.info = entry->info;
+    chunk.data = rresLoadResourceChunkData(entry->info, (void *)bytes);
+    RC2D_safe_free(owned);
+
+    if (chunk.data.raw == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadPackChunk: invalid data for resource id 0x%08x", (unsigned int)rresId);
+        rresUnloadResourceChunk(chunk);
+        SDL_zero(chunk);
+        return chunk;
+    }
+
+    if (chunk.info.compType != RRES_COMP_NONE || chunk.info.cipherType != RRES_CIPHER_NONE)
+    {
+        const int result = rc2d_rres_unpackResourceChunk(&chunk);
+        if (result != 0)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadPackChunk: failed to unpack resource id 0x%08x (error %d)", (unsigned int)rresId, result);
+            rresUnloadResourceChunk(chunk);
+            SDL_zero(chunk);
+            return chunk;
+        }
+    }
+
+    // Mise en cache d'une copie si le budget le permet
+    const Uint64 bytesCost = rc2d_rres_chunkRawSize(&chunk) + chunk.data.propCount * sizeof(unsigned int);
+    SDL_LockMutex(pack->mutex);
+    if (entry->cached == NULL && pack->cacheBudget > 0 && bytesCost <= pack->cacheBudget)
+    {
+        while (pack->cacheBytes + bytesCost > pack->cacheBudget && rc2d_rres_packEvictOne(pack)) {}
+
+        rresResourceChunk *cached = (rresResourceChunk *)RC2D_malloc(sizeof(rresResourceChunk));
+        if (cached != NULL && rc2d_rres_copyChunk(&chunk, cached))
+        {
+            entry->cached = cached;
+            entry->cachedBytes = bytesCost;
+            entry->lastUse = ++pack->cacheClock;
+            pack->cacheBytes += bytesCost;
+        }
+        else
+        {
+            RC2D_safe_free(cached);
+        }
+    }
+    SDL_UnlockMutex(pack->mutex);
+
+    return chunk;
+}
+
+rresResourceChunk rc2d_rres_loadPackChunkByName(RC2D_RresPack *pack, const char *fileName)
+{
+    const int rresId = rc2d_rres_getPackResourceId(pack, fileName);
+    if (rresId == 0)
+    {
+        rresResourceChunk chunk = { 0 };
+        RC2D_log(RC2D_LOG_WARN, "rc2d_rres_loadPackChunkByName: '%s' not found in central directory", fileName ? fileName : "(null)");
+        return chunk;
+    }
+    return rc2d_rres_loadPackChunk(pack, rresId);
+}
+
+void rc2d_rres_setPackCacheBudget(RC2D_RresPack *pack, Uint64 budget_bytes)
+{
+    if (pack == NULL) return;
+
+    SDL_LockMutex(pack->mutex);
+    pack->cacheBudget = budget_bytes;
+    while (pack->cacheBytes > pack->cacheBudget && rc2d_rres_packEvictOne(pack)) {}
+    SDL_UnlockMutex(pack->mutex);
 }
 
 void *rc2d_rres_loadDataRawFromChunk(rresResourceChunk chunk, unsigned int *size)
@@ -280,18 +982,267 @@ char *rc2d_rres_loadDataTextFromChunk(rresResourceChunk chunk)
     return NULL;
 }
 
-void freeImage(Image *image)
+/*
+ * Couleurs 565 d'un bloc couleur BC -> palette RGBA de 4 entrées.
+ * BC1 : mode 3 couleurs dès que c0 <= c1 (index 3 noir, transparent seulement si le format porte l'alpha).
+ * BC2/BC3 : la partie couleur est toujours décodée en mode 4 couleurs.
+ */
+static void rc2d_rres_decodeBC1Palette(const Uint8 *block, bool isBC1, bool hasAlpha, Uint8 palette[4][4])
+{
+    const Uint16 c0 = (Uint16)(block[0] | (block[1] << 8));
+    const Uint16 c1 = (Uint16)(block[2] | (block[3] << 8));
+    const Uint16 colors[2] = { c0, c1 };
+    const bool threeColors = isBC1 && c0 <= c1;
+
+    for (int i = 0; i < 2; i++)
+    {
+        palette[i][0] = (Uint8)(((colors[i] >> 11) & 0x1F) * 255 / 31);
+        palette[i][1] = (Uint8)(((colors[i] >> 5) & 0x3F) * 255 / 63);
+        palette[i][2] = (Uint8)((colors[i] & 0x1F) * 255 / 31);
+        palette[i][3] = 255;
+    }
+
+    for (int c = 0; c < 3; c++)
+    {
+        if (!threeColors)
+        {
+            palette[2][c] = (Uint8)((2 * palette[0][c] + palette[1][c]) / 3);
+            palette[3][c] = (Uint8)((palette[0][c] + 2 * palette[1][c]) / 3);
+        }
+        else
+        {
+            palette[2][c] = (Uint8)((palette[0][c] + palette[1][c]) / 2);
+            palette[3][c] = 0;
+        }
+    }
+    palette[2][3] = 255;
+    palette[3][3] = (threeColors && hasAlpha) ? 0 : 255;
+}
+
+/* Canal alpha interpolé d'un bloc BC3 (2 extrémités 8 bits + 16 index de 3 bits) */
+static void rc2d_rres_decodeBC3Alpha(const Uint8 *block, Uint8 alpha[16])
 {
-    if (image->texture != NULL)
+    Uint8 values[8];
+    values[0] = block[0];
+    values[1] = block[1];
+    if (values[0] > values[1])
+    {
+        for (int i = 1; i < 7; i++) values[i + 1] = (Uint8)(((7 - i) * values[0] + i * values[1]) / 7);
+    }
+    else
     {
-        SDL_ReleaseGPUTexture(rc2d_gpu_getDevice(), image->texture);
-        image->texture = NULL;
+        for (int i = 1; i < 5; i++) values[i + 1] = (Uint8)(((5 - i) * values[0] + i * values[1]) / 5);
+        values[6] = 0;
+        values[7] = 255;
     }
+
+    Uint64 bits = 0;
+    for (int i = 0; i < 6; i++) bits |= (Uint64)block[2 + i] << (8 * i);
+    for (int p = 0; p < 16; p++) alpha[p] = values[(bits >> (3 * p)) & 0x7];
 }
 
-Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
+/**
+ * Décompresse sur le CPU des données BC1/BC2/BC3 (DXT1/3/5) vers un buffer RGBA32.
+ * Repli utilisé quand le renderer ne sait pas échantillonner le format compressé.
+ */
+static Uint8 *rc2d_rres_decodeBCToRGBA32(int format, Uint32 width, Uint32 height, const Uint8 *data)
 {
-    Image image = { 0 };
+    Uint8 *pixels = (Uint8 *)RC2D_malloc((size_t)width * height * 4);
+    if (pixels == NULL) return NULL;
+
+    const bool isBC1 = (format == RRES_PIXELFORMAT_COMP_DXT1_RGB || format == RRES_PIXELFORMAT_COMP_DXT1_RGBA);
+    const Uint32 blockSize = isBC1 ? 8 : 16;
+    const Uint32 blocksX = (width + 3) / 4;
+    const Uint32 blocksY = (height + 3) / 4;
+
+    for (Uint32 by = 0; by < blocksY; by++)
+    {
+        for (Uint32 bx = 0; bx < blocksX; bx++)
+        {
+            const Uint8 *block = data + ((size_t)by * blocksX + bx) * blockSize;
+            const Uint8 *colorBlock = isBC1 ? block : block + 8;
+
+            Uint8 palette[4][4];
+            rc2d_rres_decodeBC1Palette(colorBlock, isBC1, format == RRES_PIXELFORMAT_COMP_DXT1_RGBA, palette);
+
+            Uint8 alpha[16];
+            if (format == RRES_PIXELFORMAT_COMP_DXT3_RGBA)
+            {
+                for (int p = 0; p < 16; p++) alpha[p] = (Uint8)(((block[p / 2] >> (4 * (p & 1))) & 0xF) * 17);
+            }
+            else if (format == RRES_PIXELFORMAT_COMP_DXT5_RGBA)
+            {
+                rc2d_rres_decodeBC3Alpha(block, alpha);
+            }
+
+            const Uint32 indices = (Uint32)colorBlock[4] | ((Uint32)colorBlock[5] << 8) | ((Uint32)colorBlock[6] << 16) | ((Uint32)colorBlock[7] << 24);
+            for (int p = 0; p < 16; p++)
+            {
+                const Uint32 x = bx * 4 + (p & 3);
+                const Uint32 y = by * 4 + (p >> 2);
+                if (x >= width || y >= height) continue;
+
+                Uint8 *out = pixels + ((size_t)y * width + x) * 4;
+                SDL_memcpy(out, palette[(indices >> (2 * p)) & 0x3], 4);
+                if (!isBC1) out[3] = alpha[p];
+            }
+        }
+    }
+
+    return pixels;
+}
+
+/* Étend les formats sans équivalent SDL_PixelFormat (gris, gris + alpha, R32) en RGBA32 */
+static Uint8 *rc2d_rres_expandToRGBA32(int format, Uint32 width, Uint32 height, const Uint8 *data)
+{
+    const size_t count = (size_t)width * height;
+    Uint8 *pixels = (Uint8 *)RC2D_malloc(count * 4);
+    if (pixels == NULL) return NULL;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Uint8 gray = 0;
+        Uint8 alpha = 255;
+        if (format == RRES_PIXELFORMAT_UNCOMP_GRAYSCALE)
+        {
+            gray = data[i];
+        }
+        else if (format == RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA)
+        {
+            gray = data[i * 2];
+            alpha = data[i * 2 + 1];
+        }
+        else
+        {
+            float value;
+            SDL_memcpy(&value, data + i * 4, sizeof(float));
+            gray = (Uint8)(SDL_clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+        }
+
+        pixels[i * 4 + 0] = gray;
+        pixels[i * 4 + 1] = gray;
+        pixels[i * 4 + 2] = gray;
+        pixels[i * 4 + 3] = alpha;
+    }
+
+    return pixels;
+}
+
+static SDL_Texture *rc2d_rres_createStaticTexture(SDL_PixelFormat pixelFormat, Uint32 width, Uint32 height, const void *pixels, int pitch)
+{
+    SDL_Texture *texture = SDL_CreateTexture(rc2d_engine_state.renderer, pixelFormat, SDL_TEXTUREACCESS_STATIC, (int)width, (int)height);
+    if (texture == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: SDL_CreateTexture failed: %s", SDL_GetError());
+        return NULL;
+    }
+
+    if (!SDL_UpdateTexture(texture, NULL, pixels, pitch))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: SDL_UpdateTexture failed: %s", SDL_GetError());
+        SDL_DestroyTexture(texture);
+        return NULL;
+    }
+
+    return texture;
+}
+
+#ifdef SDL_PROP_TEXTURE_CREATE_GPU_TEXTURE_POINTER
+static void SDLCALL rc2d_rres_releaseGPUTexture(void *userdata, void *value)
+{
+    SDL_ReleaseGPUTexture((SDL_GPUDevice *)userdata, (SDL_GPUTexture *)value);
+}
+#endif
+
+/**
+ * Transmet des blocs compressés tels quels au GPU du renderer et les enveloppe dans une SDL_Texture.
+ * Renvoie NULL (sans log) si le renderer n'est pas adossé à un SDL_GPUDevice qui supporte le format.
+ */
+static SDL_Texture *rc2d_rres_createCompressedTexture(SDL_GPUTextureFormat gpuFormat, Uint32 width, Uint32 height, const void *data, Uint32 dataSize)
+{
+#ifdef SDL_PROP_TEXTURE_CREATE_GPU_TEXTURE_POINTER
+    SDL_GPUDevice *device = rc2d_engine_state.gpu_device;
+    if (device == NULL || !SDL_GPUTextureSupportsFormat(device, gpuFormat, SDL_GPU_TEXTURETYPE_2D, SDL_GPU_TEXTUREUSAGE_SAMPLER))
+    {
+        return NULL;
+    }
+
+    SDL_GPUTextureCreateInfo textureInfo = { 0 };
+    textureInfo.type = SDL_GPU_TEXTURETYPE_2D;
+    textureInfo.format = gpuFormat;
+    textureInfo.usage = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+    textureInfo.width = width;
+    textureInfo.height = height;
+    textureInfo.layer_count_or_depth = 1;
+    textureInfo.num_levels = 1;
+    textureInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
+    SDL_GPUTexture *gpuTexture = SDL_CreateGPUTexture(device, &textureInfo);
+    if (gpuTexture == NULL) return NULL;
+
+    SDL_GPUTransferBufferCreateInfo transferInfo = { 0 };
+    transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transferInfo.size = dataSize;
+    SDL_GPUTransferBuffer *transfer = SDL_CreateGPUTransferBuffer(device, &transferInfo);
+    void *mapped = (transfer != NULL) ? SDL_MapGPUTransferBuffer(device, transfer, false) : NULL;
+    SDL_GPUCommandBuffer *cmd = (mapped != NULL) ? SDL_AcquireGPUCommandBuffer(device) : NULL;
+    if (cmd == NULL)
+    {
+        if (mapped != NULL) SDL_UnmapGPUTransferBuffer(device, transfer);
+        if (transfer != NULL) SDL_ReleaseGPUTransferBuffer(device, transfer);
+        SDL_ReleaseGPUTexture(device, gpuTexture);
+        return NULL;
+    }
+
+    // Les blocs sont copiés tels quels : aucune décompression
+    SDL_memcpy(mapped, data, dataSize);
+    SDL_UnmapGPUTransferBuffer(device, transfer);
+
+    SDL_GPUCopyPass *copyPass = SDL_BeginGPUCopyPass(cmd);
+    SDL_GPUTextureTransferInfo source = { 0 };
+    source.transfer_buffer = transfer;
+    SDL_GPUTextureRegion destination = { 0 };
+    destination.texture = gpuTexture;
+    destination.w = width;
+    destination.h = height;
+    destination.d = 1;
+    SDL_UploadToGPUTexture(copyPass, &source, &destination, false);
+    SDL_EndGPUCopyPass(copyPass);
+    const bool submitted = SDL_SubmitGPUCommandBuffer(cmd);
+    SDL_ReleaseGPUTransferBuffer(device, transfer);
+    if (!submitted)
+    {
+        SDL_ReleaseGPUTexture(device, gpuTexture);
+        return NULL;
+    }
+
+    // Le renderer échantillonne la texture GPU ; le format SDL n'est que nominal (texture statique)
+    SDL_PropertiesID props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_TEXTURE_CREATE_GPU_TEXTURE_POINTER, gpuTexture);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_FORMAT_NUMBER, SDL_PIXELFORMAT_RGBA32);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_ACCESS_NUMBER, SDL_TEXTUREACCESS_STATIC);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_WIDTH_NUMBER, width);
+    SDL_SetNumberProperty(props, SDL_PROP_TEXTURE_CREATE_HEIGHT_NUMBER, height);
+    SDL_Texture *texture = SDL_CreateTextureWithProperties(rc2d_engine_state.renderer, props);
+    SDL_DestroyProperties(props);
+
+    if (texture == NULL)
+    {
+        SDL_ReleaseGPUTexture(device, gpuTexture);
+        return NULL;
+    }
+
+    // Texture externe : le renderer ne la libère pas, on la rattache à la durée de vie de la SDL_Texture
+    SDL_SetPointerPropertyWithCleanup(SDL_GetTextureProperties(texture), "RC2D.rres.gpu_texture", gpuTexture, rc2d_rres_releaseGPUTexture, device);
+    return texture;
+#else
+    (void)gpuFormat; (void)width; (void)height; (void)data; (void)dataSize;
+    return NULL;
+#endif
+}
+
+RC2D_Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
+{
+    RC2D_Image image = { NULL };
 
     // Vérifier que le chunk est de type RRES_DATA_IMAGE
     if (rresGetDataType(chunk.info.type) != RRES_DATA_IMAGE)
@@ -307,60 +1258,68 @@ Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
         return image;
     }
 
-    // Extraire les dimensions de l'image
+    if (chunk.data.propCount < 3 || chunk.data.props == NULL || chunk.data.raw == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: invalid image chunk\n");
+        return image;
+    }
+
+    if (rc2d_engine_state.renderer == NULL)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: renderer is NULL\n");
+        return image;
+    }
+
+    // Extraire les dimensions de l'image (seul le premier niveau de mipmap est utilisé)
     Uint32 width = chunk.data.props[0];
     Uint32 height = chunk.data.props[1];
     int format = chunk.data.props[2];
 
-    // Mapper rresPixelFormat à SDL_GPUTextureFormat
+    if (width == 0 || height == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: invalid size %ux%u\n", width, height);
+        return image;
+    }
+
+    // Mapper rresPixelFormat vers un SDL_PixelFormat (téléversement direct) ou un format GPU compressé
+    SDL_PixelFormat pixelFormat = SDL_PIXELFORMAT_UNKNOWN;
     SDL_GPUTextureFormat gpuFormat = SDL_GPU_TEXTUREFORMAT_INVALID;
+    Uint32 bytesPerPixel = 0;
+    Uint32 blockSize = 0;
+    Uint32 blockDim = 4;
     switch (format)
     {
-        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8_UNORM; // 8 bits, niveaux de gris
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8_UNORM; // 16 bits, gris + alpha
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R5G6B5:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_B5G6R5_UNORM; // 5 bits rouge, 6 vert, 5 bleu
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R8G8B8:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM; // RGB 8 bits par canal, alpha inutilisé
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_B5G5R5A1_UNORM; // RGBA avec 1 bit alpha
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_B4G4R4A4_UNORM; // RGBA 4 bits chacun
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM; // RGBA 8 bits par canal
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R32:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32_FLOAT; // 32 bits flottant, canal unique
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R32G32B32:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32G32B32A32_FLOAT; // RGB flottant, alpha inutilisé
-            break;
-        case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_R32G32B32A32_FLOAT; // RGBA 32 bits flottant
-            break;
+        case RRES_PIXELFORMAT_UNCOMP_GRAYSCALE: bytesPerPixel = 1; break;  // Étendu en RGBA32
+        case RRES_PIXELFORMAT_UNCOMP_GRAY_ALPHA: bytesPerPixel = 2; break; // Étendu en RGBA32
+        case RRES_PIXELFORMAT_UNCOMP_R32: bytesPerPixel = 4; break;        // Étendu en RGBA32
+        case RRES_PIXELFORMAT_UNCOMP_R5G6B5: pixelFormat = SDL_PIXELFORMAT_RGB565; bytesPerPixel = 2; break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8: pixelFormat = SDL_PIXELFORMAT_RGB24; bytesPerPixel = 3; break;
+        case RRES_PIXELFORMAT_UNCOMP_R5G5B5A1: pixelFormat = SDL_PIXELFORMAT_RGBA5551; bytesPerPixel = 2; break;
+        case RRES_PIXELFORMAT_UNCOMP_R4G4B4A4: pixelFormat = SDL_PIXELFORMAT_RGBA4444; bytesPerPixel = 2; break;
+        case RRES_PIXELFORMAT_UNCOMP_R8G8B8A8: pixelFormat = SDL_PIXELFORMAT_RGBA32; bytesPerPixel = 4; break;
+        case RRES_PIXELFORMAT_UNCOMP_R32G32B32: pixelFormat = SDL_PIXELFORMAT_RGB96_FLOAT; bytesPerPixel = 12; break;
+        case RRES_PIXELFORMAT_UNCOMP_R32G32B32A32: pixelFormat = SDL_PIXELFORMAT_RGBA128_FLOAT; bytesPerPixel = 16; break;
         case RRES_PIXELFORMAT_COMP_DXT1_RGB:
         case RRES_PIXELFORMAT_COMP_DXT1_RGBA:
             gpuFormat = SDL_GPU_TEXTUREFORMAT_BC1_RGBA_UNORM; // DXT1, alpha binaire
+            blockSize = 8;
             break;
         case RRES_PIXELFORMAT_COMP_DXT3_RGBA:
             gpuFormat = SDL_GPU_TEXTUREFORMAT_BC2_RGBA_UNORM; // DXT3
+            blockSize = 16;
             break;
         case RRES_PIXELFORMAT_COMP_DXT5_RGBA:
             gpuFormat = SDL_GPU_TEXTUREFORMAT_BC3_RGBA_UNORM; // DXT5
+            blockSize = 16;
             break;
         case RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA:
             gpuFormat = SDL_GPU_TEXTUREFORMAT_ASTC_4x4_UNORM; // ASTC 4x4
+            blockSize = 16;
             break;
         case RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA:
-            gpuFormat = SDL_GPU_TEXTUREFORMAT_ASTC_8x8_UNORM; // ASTC 8x8
+            gpuFormat = SDL_GPU_TEXTUREFORMAT_ASTC_8x8_UNORM; // ASTC 8x8 (16 octets par bloc de 8x8)
+            blockSize = 16;
+            blockDim = 8;
             break;
         case RRES_PIXELFORMAT_COMP_ETC1_RGB:
         case RRES_PIXELFORMAT_COMP_ETC2_RGB:
@@ -374,55 +1333,56 @@ Image rc2d_rres_loadImageFromChunk(rresResourceChunk chunk)
             return image;
     }
 
-    // Vérifier si le format est supporté par le matériel
-    if (!SDL_GPUTextureSupportsFormat(rc2d_gpu_getDevice(), gpuFormat, SDL_GPU_TEXTURETYPE_2D, SDL_GPU_TEXTUREUSAGE_SAMPLER))
+    // Calculer la taille du premier niveau et vérifier que le chunk la contient
+    const Uint64 dataSize = (blockSize > 0) ?
+        (Uint64)((width + blockDim - 1) / blockDim) * ((height + blockDim - 1) / blockDim) * blockSize :
+        (Uint64)width * height * bytesPerPixel;
+    if (rc2d_rres_chunkRawSize(&chunk) < dataSize)
     {
-        RC2D_log(RC2D_LOG_ERROR, "Format GPU %d non supporté par le matériel\n", gpuFormat);
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: truncated image data (%u bytes, %llu expected)\n",
+                 rc2d_rres_chunkRawSize(&chunk), (unsigned long long)dataSize);
         return image;
     }
 
-    // Calculer la taille des données en fonction du format
-    Uint32 dataSize;
-    if (format >= RRES_PIXELFORMAT_COMP_DXT1_RGB && format <= RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA)
-    {
-        // Formats compressés : calculer la taille en fonction des blocs
-        Uint32 blockWidth = (width + 3) / 4; // Blocs de 4x4 pixels
-        Uint32 blockHeight = (height + 3) / 4;
-        Uint32 blockSize;
-        if (format == RRES_PIXELFORMAT_COMP_DXT1_RGB || format == RRES_PIXELFORMAT_COMP_DXT1_RGBA)
-            blockSize = 8; // BC1: 8 octets par bloc
-        else if (format == RRES_PIXELFORMAT_COMP_DXT3_RGBA || format == RRES_PIXELFORMAT_COMP_DXT5_RGBA)
-            blockSize = 16; // BC2/BC3: 16 octets par bloc
-        else if (format == RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA)
-            blockSize = 16; // ASTC 4x4: 16 octets par bloc
-        else if (format == RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA)
-            blockSize = 16; // ASTC 8x8: 16 octets par bloc (1 bit/pixel)
-        dataSize = blockWidth * blockHeight * blockSize;
+    const Uint8 *data = (const Uint8 *)chunk.data.raw;
+    if (pixelFormat != SDL_PIXELFORMAT_UNKNOWN)
+    {
+        // Téléversement direct depuis les données du chunk, sans surface intermédiaire
+        image.sdl_texture = rc2d_rres_createStaticTexture(pixelFormat, width, height, data, (int)(width * bytesPerPixel));
     }
-    else
+    else if (gpuFormat == SDL_GPU_TEXTUREFORMAT_INVALID)
     {
-        // Formats non compressés : calculer la taille en fonction des octets par pixel
-        Uint32 bytesPerPixel;
-        switch (gpuFormat)
+        Uint8 *pixels = rc2d_rres_expandToRGBA32(format, width, height, data);
+        if (pixels == NULL)
         {
-            case SDL_GPU_TEXTUREFORMAT_R8_UNORM: bytesPerPixel = 1; break;
-            case SDL_GPU_TEXTUREFORMAT_R8G8_UNORM: bytesPerPixel = 2; break;
-            case SDL_GPU_TEXTUREFORMAT_B5G6R5_UNORM: bytesPerPixel = 2; break;
-            case SDL_GPU_TEXTUREFORMAT_B5G5R5A1_UNORM: bytesPerPixel = 2; break;
-            case SDL_GPU_TEXTUREFORMAT_B4G4R4A4_UNORM: bytesPerPixel = 2; break;
-            case SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM: bytesPerPixel = 4; break;
-            case SDL_GPU_TEXTUREFORMAT_R32_FLOAT: bytesPerPixel = 4; break;
-            case SDL_GPU_TEXTUREFORMAT_R32G32B32A32_FLOAT: bytesPerPixel = 16; break;
-            default: bytesPerPixel = 4; break; // Par défaut, suppose 4 octets
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: out of memory\n");
+            return image;
         }
-        dataSize = width * height * bytesPerPixel;
+        image.sdl_texture = rc2d_rres_createStaticTexture(SDL_PIXELFORMAT_RGBA32, width, height, pixels, (int)(width * 4));
+        RC2D_free(pixels);
     }
+    else
+    {
+        // Blocs compressés transmis tels quels si le GPU du renderer les supporte
+        image.sdl_texture = rc2d_rres_createCompressedTexture(gpuFormat, width, height, data, (Uint32)dataSize);
+        if (image.sdl_texture != NULL) return image;
 
-    // FIXME: Récupérer le code d'avant pour le renderer
-
+        // Sinon : décompression CPU (BC uniquement, pas de décodeur ASTC embarqué)
+        if (format == RRES_PIXELFORMAT_COMP_ASTC_4x4_RGBA || format == RRES_PIXELFORMAT_COMP_ASTC_8x8_RGBA)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: ASTC non supporté par le renderer et sans décodeur CPU\n");
+            return image;
+        }
 
-    // Assigner la texture à la structure Image
-    //image.texture = texture;
+        Uint8 *pixels = rc2d_rres_decodeBCToRGBA32(format, width, height, data);
+        if (pixels == NULL)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_loadImageFromChunk: out of memory\n");
+            return image;
+        }
+        image.sdl_texture = rc2d_rres_createStaticTexture(SDL_PIXELFORMAT_RGBA32, width, height, pixels, (int)(width * 4));
+        RC2D_free(pixels);
+    }
 
     return image;
 }
@@ -549,6 +1509,157 @@ Font rc2d_rres_loadFontFromChunk(rresResourceChunk chunk, float ptsize)
     return font;
 }
 
+void rc2d_rres_setKeyCacheEnabled(bool enabled)
+{
+    if (!enabled) rc2d_rres_clearKeyCache();
+
+    SDL_LockSpinlock(&rc2d_rres_keyCacheLock);
+    rc2d_rres_keyCacheEnabled = enabled;
+    SDL_UnlockSpinlock(&rc2d_rres_keyCacheLock);
+}
+
+void rc2d_rres_clearKeyCache(void)
+{
+    SDL_LockSpinlock(&rc2d_rres_keyCacheLock);
+
+    // Efface les clés dérivées
+    crypto_wipe(rc2d_rres_keyCache, sizeof(rc2d_rres_keyCache));
+
+    // La zone de travail en cours d'utilisation sera libérée au prochain appel
+    void *workArea = NULL;
+    if (!rc2d_rres_workAreaBusy)
+    {
+        workArea = rc2d_rres_workArea;
+        rc2d_rres_workArea = NULL;
+    }
+
+    SDL_UnlockSpinlock(&rc2d_rres_keyCacheLock);
+
+    RC2D_safe_free(workArea);
+}
+
+/**
+ * Dérive la clé de chiffrement (Argon2i, 256 bits) du mot de passe courant et du salt du chunk.
+ *
+ * La clé est servie depuis le cache si le couple (mot de passe, salt) a déjà été dérivé.
+ * Sinon Argon2 tourne sur la zone de travail partagée (ou une zone temporaire si un autre
+ * thread l'utilise déjà), puis la clé est ajoutée au cache en remplaçant la moins récente.
+ *
+ * @param salt Salt de 16 octets stocké dans le chunk.
+ * @param key Clé dérivée (32 octets).
+ * @return true si la clé a été obtenue, false si la zone de travail n'a pas pu être allouée.
+ */
+static bool rc2d_rres_deriveKey(const uint8_t salt[16], uint8_t key[32])
+{
+    // Mot de passe sur 16 octets, complété par des zéros (comme rrespacker)
+    uint8_t pass[16];
+    rc2d_rres_copyCipherPassword(pass);
+
+    RC2D_RresCachedKey *lru = NULL;
+    bool ownsSharedArea = false;
+    void *workArea = NULL;
+
+    for (;;)
+    {
+        SDL_LockSpinlock(&rc2d_rres_keyCacheLock);
+
+        if (rc2d_rres_keyCacheEnabled)
+        {
+            lru = &rc2d_rres_keyCache[0];
+            for (int i = 0; i < RC2D_RRES_KEY_CACHE_CAPACITY; i++)
+            {
+                RC2D_RresCachedKey *entry = &rc2d_rres_keyCache[i];
+
+                if ((entry->lastUse != 0) && (SDL_memcmp(entry->pass, pass, 16) == 0) && (SDL_memcmp(entry->salt, salt, 16) == 0))
+                {
+                    entry->lastUse = ++rc2d_rres_keyCacheClock;
+                    SDL_memcpy(key, entry->key, 32);
+                    SDL_UnlockSpinlock(&rc2d_rres_keyCacheLock);
+                    crypto_wipe(pass, 16);
+                    return true;
+                }
+
+                if (entry->lastUse < lru->lastUse) lru = entry;
+            }
+        }
+
+        // Réserve la zone de travail partagée si elle est libre
+        if (!rc2d_rres_workAreaBusy)
+        {
+            rc2d_rres_workAreaBusy = true;
+            ownsSharedArea = true;
+            workArea = rc2d_rres_workArea;
+            SDL_memcpy(rc2d_rres_inflightPass, pass, 16);
+            SDL_memcpy(rc2d_rres_inflightSalt, salt, 16);
+            break;
+        }
+
+        // Un autre thread dérive déjà cette clé : attendre qu'elle arrive dans le cache plutôt que la dériver en double
+        const bool sameKeyInFlight = rc2d_rres_keyCacheEnabled &&
+            (SDL_memcmp(rc2d_rres_inflightPass, pass, 16) == 0) && (SDL_memcmp(rc2d_rres_inflightSalt, salt, 16) == 0);
+        if (!sameKeyInFlight) break;
+
+        SDL_UnlockSpinlock(&rc2d_rres_keyCacheLock);
+        SDL_Delay(1);
+    }
+
+    SDL_UnlockSpinlock(&rc2d_rres_keyCacheLock);
+
+    if (workArea == NULL) workArea = RC2D_malloc(RC2D_RRES_ARGON2_BLOCKS*1024);    // Key stretching work area
+    if (ownsSharedArea) rc2d_rres_workArea = workArea;
+
+    const bool derived = (workArea != NULL);
+    if (derived)
+    {
+        // Key stretching configuration
+        crypto_argon2_config config;
+        config.algorithm = CRYPTO_ARGON2_I; // Algorithm: Argon2i
+        config.nb_blocks = RC2D_RRES_ARGON2_BLOCKS;
+        config.nb_passes = RC2D_RRES_ARGON2_PASSES;
+        config.nb_lanes = 1; // Single-threaded
+
+        crypto_argon2_inputs inputs;
+        inputs.pass = pass; // User password
+        inputs.pass_size = 16; // Password length
+        inputs.salt = salt; // Salt for the password
+        inputs.salt_size = 16;
+
+        crypto_argon2_extras extras = { 0 };
+
+        // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
+        crypto_argon2(key, 32, workArea, config, inputs, extras);
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_ERROR, "RRES: Failed to allocate key stretching work area\n");
+    }
+
+    SDL_LockSpinlock(&rc2d_rres_keyCacheLock);
+
+    if (ownsSharedArea)
+    {
+        rc2d_rres_workAreaBusy = false;
+        crypto_wipe(rc2d_rres_inflightPass, 16);
+    }
+
+    // Remplace l'entrée la moins récemment utilisée (lru peut avoir été réutilisée entre-temps, sans conséquence)
+    if (derived && (lru != NULL) && rc2d_rres_keyCacheEnabled)
+    {
+        SDL_memcpy(lru->pass, pass, 16);
+        SDL_memcpy(lru->salt, salt, 16);
+        SDL_memcpy(lru->key, key, 32);
+        lru->lastUse = ++rc2d_rres_keyCacheClock;
+    }
+
+    SDL_UnlockSpinlock(&rc2d_rres_keyCacheLock);
+
+    // Zone temporaire : un autre thread utilisait la zone partagée
+    if (!ownsSharedArea) RC2D_safe_free(workArea);
+
+    crypto_wipe(pass, 16);
+    return derived;
+}
+
 int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
 {
     int result = 0;
@@ -591,29 +1702,18 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             // salt is stored at the end of packed data, before nonce and MAC: salt[16] + MD5[16]
             SDL_memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 16), 16);
             
-            // Key stretching configuration
-            crypto_argon2_config config;
-            config.algorithm = CRYPTO_ARGON2_I; // Algorithm: Argon2i
-            config.nb_blocks = 16384; // Blocks: 16 MB
-            config.nb_passes = 3; // Iterations
-            config.nb_lanes = 1; // Single-threaded
-
-            crypto_argon2_inputs inputs;
-            inputs.pass = (const uint8_t *)rc2d_rres_getCipherPassword(); // User password
-            inputs.pass_size = 16; // Password length
-            inputs.salt = salt; // Salt for the password
-            inputs.salt_size = 16;
-
-            crypto_argon2_extras extras = { 0 };  
-
-            void *workArea = RC2D_malloc(config.nb_blocks*1024);    // Key stretching work area
-
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
+            // Generate strong encryption key from user password and salt (cached per password + salt)
+            bool keyDerived = rc2d_rres_deriveKey(salt, key);
 
             // Wipe key generation secrets, they are no longer needed
             crypto_wipe(salt, 16);
-            RC2D_safe_free(workArea);
+
+            if (!keyDerived)
+            {
+                result = 2;    // Key could not be derived, data stays encrypted
+                RC2D_safe_free(decryptedData);
+                break;
+            }
 
             // Required variables for decryption and message authentication
             unsigned int md5[4] = { 0 };                // Message Authentication Code generated on encryption
@@ -629,13 +1729,12 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
 
             // Verify MD5 to check if data decryption worked
             unsigned int decryptMD5[4] = { 0 };
-            unsigned int *md5Ptr = ComputeMD5(decryptedData, chunk->info.packedSize - 16 - 16);
-            for (int i = 0; i < 4; i++) decryptMD5[i] = md5Ptr[i];
+            bool md5Computed = ComputeMD5(decryptedData, chunk->info.packedSize - 16 - 16, decryptMD5);
 
             // Wipe secrets if they are no longer needed
             crypto_wipe(key, 32);
 
-            if (SDL_memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0)    // Decrypted successfully!
+            if (md5Computed && (SDL_memcmp(decryptMD5, md5, 4*sizeof(unsigned int)) == 0))    // Decrypted successfully!
             {
                 chunk->info.packedSize -= (16 + 16);    // We remove additional data size from packed size (salt[16] + MD5[16])
                 RC2D_log(RC2D_LOG_DEBUG, "RRES: %c%c%c%c: Data decrypted successfully (AES)\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
@@ -643,6 +1742,7 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             else
             {
                 result = 2;    // Data was not decrypted as expected, wrong password or message corrupted
+                RC2D_safe_free(decryptedData);
                 RC2D_log(RC2D_LOG_WARN, "RRES: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
             }
 
@@ -664,29 +1764,18 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             // salt is stored at the end of packed data, before nonce and MAC: salt[16] + nonce[24] + MAC[16]
             SDL_memcpy(salt, ((unsigned char *)chunk->data.raw) + (chunk->info.packedSize - 16 - 24 - 16), 16);
             
-            // Key stretching configuration
-            crypto_argon2_config config;
-            config.algorithm = CRYPTO_ARGON2_I; // Algorithm: Argon2i
-            config.nb_blocks = 16384; // Blocks: 16 MB
-            config.nb_passes = 3; // Iterations
-            config.nb_lanes = 1; // Single-threaded
-
-            crypto_argon2_inputs inputs;
-            inputs.pass = (const uint8_t *)rc2d_rres_getCipherPassword(); // User password
-            inputs.pass_size = 16; // Password length
-            inputs.salt = salt; // Salt for the password
-            inputs.salt_size = 16;
-
-            crypto_argon2_extras extras = { 0 };  
-
-            void *workArea = RC2D_malloc(config.nb_blocks*1024);    // Key stretching work area
-
-            // Generate strong encryption key, generated from user password using Argon2i algorithm (256 bit)
-            crypto_argon2(key, 32, workArea, config, inputs, extras);
+            // Generate strong encryption key from user password and salt (cached per password + salt)
+            bool keyDerived = rc2d_rres_deriveKey(salt, key);
 
             // Wipe key generation secrets, they are no longer needed
             crypto_wipe(salt, 16);
-            RC2D_safe_free(workArea);
+
+            if (!keyDerived)
+            {
+                result = 2;    // Key could not be derived, data stays encrypted
+                RC2D_safe_free(decryptedData);
+                break;
+            }
 
             // Required variables for decryption and message authentication
             uint8_t nonce[24] = { 0 };                  // nonce used on encryption, unique to processed file
@@ -712,6 +1801,7 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             else if (decryptResult == -1)
             {
                 result = 2;   // Wrong password or message corrupted
+                RC2D_safe_free(decryptedData);
                 RC2D_log(RC2D_LOG_WARN, "RRES: %c%c%c%c: Data decryption failed, wrong password or corrupted data\n", chunk->info.type[0], chunk->info.type[1], chunk->info.type[2], chunk->info.type[3]);
             }
         } break;
@@ -787,13 +1877,89 @@ int rc2d_rres_unpackResourceChunk(rresResourceChunk *chunk)
             for (unsigned int i = 0; i < chunk->data.propCount; i++) chunk->data.props[i] = ((int *)unpackedData)[1 + i];
         }
 
-        // Move chunk->data.raw pointer (chunk->data.propCount*sizeof(int)) positions
-        void *raw = RC2D_calloc(chunk->info.baseSize - 20, 1);
-        if (raw != NULL) SDL_memcpy(raw, ((unsigned char *)unpackedData) + 20, chunk->info.baseSize - 20);
+        // Move chunk->data.raw pointer (sizeof(int) + chunk->data.propCount*sizeof(int)) positions
+        const unsigned int rawOffset = (unsigned int)sizeof(int) + chunk->data.propCount * (unsigned int)sizeof(int);
+        const unsigned int rawSize = (chunk->info.baseSize > rawOffset) ? chunk->info.baseSize - rawOffset : 0;
+        void *raw = RC2D_calloc(rawSize > 0 ? rawSize : 1, 1);
+        if (raw != NULL) SDL_memcpy(raw, ((unsigned char *)unpackedData) + rawOffset, rawSize);
         RC2D_safe_free(chunk->data.raw);
         chunk->data.raw = raw;
         RC2D_safe_free(unpackedData);
     }
 
     return result;
-}
\ No newline at end of file
+}
+
+/**
+ * Lot de chunks partagé entre les threads de rc2d_rres_unpackChunksParallel :
+ * chaque thread prend le prochain chunk libre jusqu'à épuisement du lot.
+ */
+typedef struct RC2D_RresUnpackBatch {
+    rresResourceChunk *chunks;
+    int *results;
+    int count;
+    SDL_AtomicInt next;
+    SDL_AtomicInt failed;
+} RC2D_RresUnpackBatch;
+
+static int rc2d_rres_unpackWorker(void *data)
+{
+    RC2D_RresUnpackBatch *batch = (RC2D_RresUnpackBatch *)data;
+
+    for (;;)
+    {
+        const int index = SDL_AddAtomicInt(&batch->next, 1);
+        if (index >= batch->count) break;
+
+        const int result = rc2d_rres_unpackResourceChunk(&batch->chunks[index]);
+        if (batch->results != NULL) batch->results[index] = result;
+        if (result != 0) SDL_AddAtomicInt(&batch->failed, 1);
+    }
+
+    return 0;
+}
+
+int rc2d_rres_unpackChunksParallel(rresResourceChunk *chunks, int count, int threadCount, int *results)
+{
+    if ((chunks == NULL) || (count < 0))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rres_unpackChunksParallel: invalid arguments");
+        return -1;
+    }
+
+    if (count == 0) return 0;
+
+    RC2D_RresUnpackBatch batch;
+    batch.chunks = chunks;
+    batch.results = results;
+    batch.count = count;
+    SDL_SetAtomicInt(&batch.next, 0);
+    SDL_SetAtomicInt(&batch.failed, 0);
+
+    // Un thread par coeur logique par défaut, jamais plus de threads que de chunks
+    if (threadCount <= 0) threadCount = SDL_GetNumLogicalCPUCores();
+    threadCount = SDL_clamp(threadCount, 1, SDL_min(count, RC2D_RRES_UNPACK_MAX_THREADS));
+
+    // Le thread appelant participe : threadCount - 1 threads supplémentaires
+    RC2D_Thread *threads[RC2D_RRES_UNPACK_MAX_THREADS] = { 0 };
+    for (int i = 1; i < threadCount; i++)
+    {
+        threads[i] = rc2d_thread_new(rc2d_rres_unpackWorker, "rc2d_rres_unpack", &batch);
+        if (threads[i] == NULL)
+        {
+            // Pas bloquant : les threads déjà lancés et l'appelant traitent le reste du lot
+            RC2D_log(RC2D_LOG_WARN, "rc2d_rres_unpackChunksParallel: thread creation failed, using %d threads", i);
+            break;
+        }
+    }
+
+    rc2d_rres_unpackWorker(&batch);
+
+    for (int i = 1; i < threadCount; i++)
+    {
+        if (threads[i] != NULL) rc2d_thread_wait(threads[i], NULL);
+    }
+
+    return SDL_GetAtomicInt(&batch.failed);
+}
+
@@ -0,0 +1,561 @@
+#if RC2D_DATA_MODULE_ENABLED
+
+#include <RC2D/RC2D_save.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_thread.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_endian.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_stdinc.h>
+
+#include <openssl/evp.h>
+
+/*
+ * Format d'une sauvegarde (little-endian) :
+ * [magic "RC2DSAVE"][Uint32 version][Uint32 flags][Uint32 compressFormat][Uint32 cipherFormat]
+ * [Uint64 originalSize][Uint64 compressedSize][Uint32 hmacSize][hmac][payload]
+ * payload = données brutes, compressées, ou (sel + IV + ciphertext) de rc2d_data_encrypt.
+ */
+#define RC2D_SAVE_MAGIC "RC2DSAVE"
+#define RC2D_SAVE_MAGIC_SIZE 8
+#define RC2D_SAVE_VERSION 1
+#define RC2D_SAVE_HEADER_SIZE (RC2D_SAVE_MAGIC_SIZE + 4 * sizeof(Uint32) + 2 * sizeof(Uint64) + sizeof(Uint32))
+#define RC2D_SAVE_FLAG_COMPRESSED 0x1u
+#define RC2D_SAVE_FLAG_ENCRYPTED 0x2u
+
+/* Sel + IV en tête du payload chiffré par rc2d_data_encrypt */
+#define RC2D_SAVE_CIPHER_HEADER_SIZE (RC2D_CRYPTO_SALT_SIZE + EVP_MAX_IV_LENGTH)
+
+/* Taux de compression maximal de LZ4 (~255, arrondi) : borne originalSize avant l'allocation du buffer décompressé */
+#define RC2D_SAVE_LZ4_MAX_RATIO 256
+
+/* Suffixe du fichier temporaire, renommé sur le fichier final une fois entièrement écrit */
+#define RC2D_SAVE_TEMP_SUFFIX ".tmp"
+
+typedef struct RC2D_SaveJob {
+    char* path;
+    void* data;
+    size_t size;
+    RC2D_SaveOptions options;   // passphrase copiée, possédée par le job
+    bool success;
+    struct RC2D_SaveJob* next;
+} RC2D_SaveJob;
+
+/* Thread d'écriture unique : les sauvegardes sont écrites dans l'ordre de soumission */
+static RC2D_Thread* rc2d_save_thread = NULL;
+static SDL_Mutex* rc2d_save_mutex = NULL;
+static SDL_Condition* rc2d_save_jobAvailable = NULL;
+static SDL_Condition* rc2d_save_jobDone = NULL;
+static bool rc2d_save_quit = false;
+
+/* Files protégées par rc2d_save_mutex */
+static RC2D_SaveJob* rc2d_save_jobsHead = NULL;
+static RC2D_SaveJob* rc2d_save_jobsTail = NULL;
+static RC2D_SaveJob* rc2d_save_doneHead = NULL;
+static RC2D_SaveJob* rc2d_save_doneTail = NULL;
+
+/* Sauvegardes en file ou en cours d'écriture (protégé par rc2d_save_mutex) */
+static int rc2d_save_unwritten = 0;
+
+/* Sauvegardes soumises dont la callback n'a pas encore été appelée */
+static SDL_AtomicInt rc2d_save_pending;
+
+static void rc2d_save_zeroize(void* v, size_t n)
+{
+    volatile unsigned char* p = (volatile unsigned char*)v;
+    while (n--) *p++ = 0;
+}
+
+static void rc2d_save_writeLE32(unsigned char** dst, Uint32 value)
+{
+    value = SDL_Swap32LE(value);
+    SDL_memcpy(*dst, &value, sizeof(value));
+    *dst += sizeof(value);
+}
+
+static void rc2d_save_writeLE64(unsigned char** dst, Uint64 value)
+{
+    value = SDL_Swap64LE(value);
+    SDL_memcpy(*dst, &value, sizeof(value));
+    *dst += sizeof(value);
+}
+
+static Uint32 rc2d_save_readLE32(const unsigned char** src)
+{
+    Uint32 value;
+    SDL_memcpy(&value, *src, sizeof(value));
+    *src += sizeof(value);
+    return SDL_Swap32LE(value);
+}
+
+static Uint64 rc2d_save_readLE64(const unsigned char** src)
+{
+    Uint64 value;
+    SDL_memcpy(&value, *src, sizeof(value));
+    *src += sizeof(value);
+    return SDL_Swap64LE(value);
+}
+
+/* Compression + chiffrement + en-tête : construit le contenu complet du fichier. */
+static bool rc2d_save_encode(const void* data, size_t size, const RC2D_SaveOptions* options, unsigned char** out_file, size_t* out_size)
+{
+    Uint32 flags = 0;
+    const unsigned char* payload = (const unsigned char*)data;
+    size_t payloadSize = size;
+    size_t compressedSize = size;
+    RC2D_CompressedData* compressed = NULL;
+    RC2D_EncryptedData* encrypted = NULL;
+
+    if (options->compress)
+    {
+        RC2D_CompressOptions compressOptions = { options->compressLevel, NULL, 0, 0 };
+        compressed = rc2d_data_compressWithOptions(payload, payloadSize, RC2D_DATA_TYPE_RAW_DATA, options->compressFormat, &compressOptions);
+        if (!compressed)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_save: compression failed");
+            return false;
+        }
+        flags |= RC2D_SAVE_FLAG_COMPRESSED;
+        payload = compressed->data;
+        payloadSize = compressedSize = compressed->compressedSize;
+    }
+
+    if (options->passphrase)
+    {
+        encrypted = rc2d_data_encrypt(payload, payloadSize, options->passphrase, RC2D_DATA_TYPE_RAW_DATA, options->cipherFormat);
+        if (!encrypted)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_save: encryption failed");
+            if (compressed)
+            {
+                RC2D_safe_free(compressed->data);
+                RC2D_free(compressed);
+            }
+            return false;
+        }
+        flags |= RC2D_SAVE_FLAG_ENCRYPTED;
+        payload = encrypted->data;
+        payloadSize = encrypted->encryptedSize;
+    }
+
+    const size_t hmacSize = encrypted ? encrypted->hmacSize : 0;
+    const size_t fileSize = RC2D_SAVE_HEADER_SIZE + hmacSize + payloadSize;
+    unsigned char* file = (unsigned char*)RC2D_malloc(fileSize);
+    if (file)
+    {
+        unsigned char* p = file;
+        SDL_memcpy(p, RC2D_SAVE_MAGIC, RC2D_SAVE_MAGIC_SIZE);
+        p += RC2D_SAVE_MAGIC_SIZE;
+        rc2d_save_writeLE32(&p, RC2D_SAVE_VERSION);
+        rc2d_save_writeLE32(&p, flags);
+        rc2d_save_writeLE32(&p, (Uint32)options->compressFormat);
+        rc2d_save_writeLE32(&p, (Uint32)options->cipherFormat);
+        rc2d_save_writeLE64(&p, (Uint64)size);
+        rc2d_save_writeLE64(&p, (Uint64)compressedSize);
+        rc2d_save_writeLE32(&p, (Uint32)hmacSize);
+        if (hmacSize) SDL_memcpy(p, encrypted->hmac, hmacSize);
+        SDL_memcpy(p + hmacSize, payload, payloadSize);
+    }
+    else
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save: out of memory");
+    }
+
+    if (encrypted) rc2d_data_freeSecurity(encrypted);
+    if (compressed)
+    {
+        RC2D_safe_free(compressed->data);
+        RC2D_free(compressed);
+    }
+
+    *out_file = file;
+    *out_size = fileSize;
+    return file != NULL;
+}
+
+/* Écriture atomique : fichier temporaire complet, puis renommage sur le fichier final. */
+static bool rc2d_save_writeAtomic(const char* path, const void* bytes, size_t size)
+{
+    const size_t tempSize = SDL_strlen(path) + sizeof(RC2D_SAVE_TEMP_SUFFIX);
+    char* tempPath = (char*)RC2D_malloc(tempSize);
+    if (!tempPath)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save: out of memory");
+        return false;
+    }
+    SDL_snprintf(tempPath, tempSize, "%s%s", path, RC2D_SAVE_TEMP_SUFFIX);
+
+    bool ok = rc2d_storage_userWriteFile(tempPath, bytes, (Uint64)size);
+    if (ok)
+    {
+        ok = rc2d_storage_userRenamePath(tempPath, path);
+        if (!ok) rc2d_storage_userRemovePath(tempPath);
+    }
+
+    RC2D_free(tempPath);
+    return ok;
+}
+
+bool rc2d_save_write(const char* path, const void* data, size_t size, const RC2D_SaveOptions* options)
+{
+    if (!path || !data || size == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_write: invalid arguments");
+        return false;
+    }
+
+    RC2D_SaveOptions defaults;
+    SDL_zero(defaults);
+    if (!options) options = &defaults;
+
+    unsigned char* file = NULL;
+    size_t fileSize = 0;
+    if (!rc2d_save_encode(data, size, options, &file, &fileSize)) return false;
+
+    const bool ok = rc2d_save_writeAtomic(path, file, fileSize);
+    if (!ok) RC2D_log(RC2D_LOG_ERROR, "rc2d_save: failed to write '%s'", path);
+
+    RC2D_free(file);
+    return ok;
+}
+
+bool rc2d_save_read(const char* path, const char* passphrase, void** out_data, size_t* out_size)
+{
+    if (!path || !out_data || !out_size)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_read: invalid arguments");
+        return false;
+    }
+    *out_data = NULL;
+    *out_size = 0;
+
+    void* bytes = NULL;
+    Uint64 len = 0;
+    if (!rc2d_storage_userReadFile(path, &bytes, &len)) return false;
+
+    const unsigned char* p = (const unsigned char*)bytes;
+    Uint32 version = 0, flags = 0, compressFormat = 0, cipherFormat = 0, hmacSize = 0;
+    Uint64 originalSize = 0, compressedSize = 0;
+    bool ok = len >= RC2D_SAVE_HEADER_SIZE && SDL_memcmp(p, RC2D_SAVE_MAGIC, RC2D_SAVE_MAGIC_SIZE) == 0;
+    if (ok)
+    {
+        p += RC2D_SAVE_MAGIC_SIZE;
+        version = rc2d_save_readLE32(&p);
+        flags = rc2d_save_readLE32(&p);
+        compressFormat = rc2d_save_readLE32(&p);
+        cipherFormat = rc2d_save_readLE32(&p);
+        originalSize = rc2d_save_readLE64(&p);
+        compressedSize = rc2d_save_readLE64(&p);
+        hmacSize = rc2d_save_readLE32(&p);
+        ok = version == RC2D_SAVE_VERSION && originalSize > 0 && originalSize <= SDL_SIZE_MAX && hmacSize < len - RC2D_SAVE_HEADER_SIZE;
+    }
+    if (!ok)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_read: '%s' is not a valid save file", path);
+        RC2D_free(bytes);
+        return false;
+    }
+
+    const unsigned char* hmac = p;
+    unsigned char* payload = (unsigned char*)p + hmacSize;
+    size_t payloadSize = (size_t)(len - RC2D_SAVE_HEADER_SIZE - hmacSize);
+
+    /*
+     * Le HMAC ne couvre que le payload : les tailles de l'en-tête ne sont pas authentifiées
+     * et doivent être bornées par ce que le fichier contient réellement avant d'être utilisées.
+     */
+    Uint64 storedSize = payloadSize;
+    if (flags & RC2D_SAVE_FLAG_ENCRYPTED)
+    {
+        storedSize = payloadSize > RC2D_SAVE_CIPHER_HEADER_SIZE ? payloadSize - RC2D_SAVE_CIPHER_HEADER_SIZE : 0;
+    }
+    ok = compressedSize > 0 && compressedSize <= storedSize;
+    if (ok && (flags & RC2D_SAVE_FLAG_COMPRESSED))
+    {
+        ok = originalSize <= compressedSize * RC2D_SAVE_LZ4_MAX_RATIO;
+    }
+    else if (ok)
+    {
+        ok = originalSize == compressedSize;
+    }
+    if (!ok)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_read: '%s' has an inconsistent header", path);
+        RC2D_free(bytes);
+        return false;
+    }
+    unsigned char* decrypted = NULL;
+    unsigned char* result = NULL;
+
+    if (flags & RC2D_SAVE_FLAG_ENCRYPTED)
+    {
+        if (!passphrase)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_save_read: '%s' is encrypted, a passphrase is required", path);
+            RC2D_free(bytes);
+            return false;
+        }
+
+        RC2D_EncryptedData encrypted;
+        SDL_zero(encrypted);
+        encrypted.data = payload;
+        encrypted.passphrase = (char*)passphrase;
+        encrypted.hmac = (unsigned char*)hmac;
+        encrypted.originalSize = (size_t)compressedSize;
+        encrypted.encryptedSize = payloadSize;
+        encrypted.hmacSize = hmacSize;
+        encrypted.cipherFormat = (RC2D_CipherFormat)cipherFormat;
+        encrypted.dataType = RC2D_DATA_TYPE_RAW_DATA;
+
+        decrypted = rc2d_data_decrypt(&encrypted);
+        if (!decrypted)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_save_read: failed to decrypt '%s' (wrong passphrase or corrupted file)", path);
+            RC2D_free(bytes);
+            return false;
+        }
+        payload = decrypted;
+        payloadSize = (size_t)compressedSize;
+    }
+
+    if (flags & RC2D_SAVE_FLAG_COMPRESSED)
+    {
+        RC2D_CompressedData compressed;
+        compressed.data = payload;
+        compressed.originalSize = (size_t)originalSize;
+        compressed.compressedSize = payloadSize;
+        compressed.compressFormat = (RC2D_CompressFormat)compressFormat;
+        compressed.dataType = RC2D_DATA_TYPE_RAW_DATA;
+        result = rc2d_data_decompress(&compressed);
+    }
+    else if (payloadSize == originalSize)
+    {
+        result = (unsigned char*)RC2D_malloc(payloadSize);
+        if (result) SDL_memcpy(result, payload, payloadSize);
+    }
+
+    if (decrypted)
+    {
+        rc2d_save_zeroize(decrypted, (size_t)compressedSize);
+        RC2D_free(decrypted);
+    }
+    RC2D_free(bytes);
+
+    if (!result)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_read: failed to decode '%s'", path);
+        return false;
+    }
+
+    *out_data = result;
+    *out_size = (size_t)originalSize;
+    return true;
+}
+
+/* ========================================================================= */
+/*                                  ASYNC                                     */
+/* ========================================================================= */
+
+static void rc2d_save_freeJob(RC2D_SaveJob* job)
+{
+    if (job->options.passphrase)
+    {
+        char* passphrase = (char*)job->options.passphrase;
+        rc2d_save_zeroize(passphrase, SDL_strlen(passphrase));
+        RC2D_free(passphrase);
+    }
+    if (job->data)
+    {
+        rc2d_save_zeroize(job->data, job->size);
+        RC2D_free(job->data);
+    }
+    RC2D_safe_free(job->path);
+    RC2D_free(job);
+}
+
+static int rc2d_save_worker(void* data)
+{
+    (void)data;
+
+    for (;;)
+    {
+        SDL_LockMutex(rc2d_save_mutex);
+        while (!rc2d_save_quit && !rc2d_save_jobsHead)
+        {
+            SDL_WaitCondition(rc2d_save_jobAvailable, rc2d_save_mutex);
+        }
+        RC2D_SaveJob* job = rc2d_save_jobsHead;
+        if (!job)
+        {
+            // Arrêt demandé et file vide : les sauvegardes en file sont toujours écrites avant
+            SDL_UnlockMutex(rc2d_save_mutex);
+            break;
+        }
+        rc2d_save_jobsHead = job->next;
+        if (!rc2d_save_jobsHead) rc2d_save_jobsTail = NULL;
+        job->next = NULL;
+        SDL_UnlockMutex(rc2d_save_mutex);
+
+        job->success = rc2d_save_write(job->path, job->data, job->size, &job->options);
+
+        // Les données en clair ne sont plus utiles : libérées dès maintenant
+        rc2d_save_zeroize(job->data, job->size);
+        RC2D_safe_free(job->data);
+
+        SDL_LockMutex(rc2d_save_mutex);
+        if (rc2d_save_doneTail) rc2d_save_doneTail->next = job;
+        else rc2d_save_doneHead = job;
+        rc2d_save_doneTail = job;
+        rc2d_save_unwritten--;
+        SDL_BroadcastCondition(rc2d_save_jobDone);
+        SDL_UnlockMutex(rc2d_save_mutex);
+    }
+
+    return 0;
+}
+
+/* Démarre le thread d'écriture à la première sauvegarde asynchrone. */
+static bool rc2d_save_start(void)
+{
+    if (rc2d_save_thread) return true;
+
+    if (!rc2d_save_mutex) rc2d_save_mutex = SDL_CreateMutex();
+    if (!rc2d_save_jobAvailable) rc2d_save_jobAvailable = SDL_CreateCondition();
+    if (!rc2d_save_jobDone) rc2d_save_jobDone = SDL_CreateCondition();
+    if (!rc2d_save_mutex || !rc2d_save_jobAvailable || !rc2d_save_jobDone)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save: failed to create synchronization primitives: %s", SDL_GetError());
+        return false;
+    }
+
+    rc2d_save_quit = false;
+    rc2d_save_thread = rc2d_thread_new(rc2d_save_worker, "rc2d_save", NULL);
+    if (!rc2d_save_thread)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save: failed to start writer thread");
+        return false;
+    }
+
+    return true;
+}
+
+bool rc2d_save_writeAsync(const char* path, const void* data, size_t size, const RC2D_SaveOptions* options)
+{
+    if (!path || !data || size == 0)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_writeAsync: invalid arguments");
+        return false;
+    }
+
+    if (!rc2d_save_start()) return false;
+
+    RC2D_SaveJob* job = (RC2D_SaveJob*)RC2D_calloc(1, sizeof(RC2D_SaveJob));
+    if (!job)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_writeAsync: out of memory");
+        return false;
+    }
+
+    if (options) job->options = *options;
+    job->options.passphrase = NULL;
+    job->path = RC2D_strdup(path);
+    job->data = RC2D_malloc(size);
+    job->size = size;
+    char* passphrase = (options && options->passphrase) ? RC2D_strdup(options->passphrase) : NULL;
+    job->options.passphrase = passphrase;
+    if (!job->path || !job->data || (options && options->passphrase && !passphrase))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_save_writeAsync: out of memory");
+        rc2d_save_freeJob(job);
+        return false;
+    }
+    SDL_memcpy(job->data, data, size);
+
+    SDL_AddAtomicInt(&rc2d_save_pending, 1);
+    SDL_LockMutex(rc2d_save_mutex);
+    if (rc2d_save_jobsTail) rc2d_save_jobsTail->next = job;
+    else rc2d_save_jobsHead = job;
+    rc2d_save_jobsTail = job;
+    rc2d_save_unwritten++;
+    SDL_SignalCondition(rc2d_save_jobAvailable);
+    SDL_UnlockMutex(rc2d_save_mutex);
+
+    return true;
+}
+
+int rc2d_save_update(void)
+{
+    if (!rc2d_save_mutex) return 0;
+
+    // Détache toute la file des terminées : les callbacks peuvent relancer une sauvegarde
+    SDL_LockMutex(rc2d_save_mutex);
+    RC2D_SaveJob* job = rc2d_save_doneHead;
+    rc2d_save_doneHead = rc2d_save_doneTail = NULL;
+    SDL_UnlockMutex(rc2d_save_mutex);
+
+    int completed = 0;
+    while (job)
+    {
+        RC2D_SaveJob* next = job->next;
+        SDL_AddAtomicInt(&rc2d_save_pending, -1);
+        if (job->options.callback)
+        {
+            job->options.callback(job->path, job->success, job->options.userdata);
+        }
+        rc2d_save_freeJob(job);
+        job = next;
+        completed++;
+    }
+
+    return completed;
+}
+
+int rc2d_save_getPendingCount(void)
+{
+    return SDL_GetAtomicInt(&rc2d_save_pending);
+}
+
+void rc2d_save_waitAll(void)
+{
+    if (!rc2d_save_mutex) return;
+
+    SDL_LockMutex(rc2d_save_mutex);
+    while (rc2d_save_unwritten > 0)
+    {
+        SDL_WaitCondition(rc2d_save_jobDone, rc2d_save_mutex);
+    }
+    SDL_UnlockMutex(rc2d_save_mutex);
+
+    rc2d_save_update();
+}
+
+void rc2d_save_shutdown(void)
+{
+    if (!rc2d_save_thread && !rc2d_save_mutex) return;
+
+    // Le thread termine la file avant de s'arrêter : aucune sauvegarde soumise n'est perdue
+    if (rc2d_save_thread)
+    {
+        SDL_LockMutex(rc2d_save_mutex);
+        rc2d_save_quit = true;
+        SDL_SignalCondition(rc2d_save_jobAvailable);
+        SDL_UnlockMutex(rc2d_save_mutex);
+        rc2d_thread_wait(rc2d_save_thread, NULL);
+        rc2d_save_thread = NULL;
+    }
+
+    rc2d_save_update();
+
+    if (rc2d_save_jobDone) SDL_DestroyCondition(rc2d_save_jobDone);
+    if (rc2d_save_jobAvailable) SDL_DestroyCondition(rc2d_save_jobAvailable);
+    if (rc2d_save_mutex) SDL_DestroyMutex(rc2d_save_mutex);
+    rc2d_save_jobDone = NULL;
+    rc2d_save_jobAvailable = NULL;
+    rc2d_save_mutex = NULL;
+}
+
+#endif // RC2D_DATA_MODULE_ENABLED
@@ -1,12 +1,46 @@
 #include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_internal.h>
 #include <RC2D/RC2D_logger.h>
 #include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_platform_defines.h>
 
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
 #include <SDL3/SDL_storage.h>
 
+/* Mapping mémoire des fichiers du storage title (Linux desktop uniquement) */
+#if defined(RC2D_PLATFORM_LINUX) && !defined(RC2D_PLATFORM_ANDROID)
+    #define RC2D_STORAGE_HAS_MMAP 1
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
 static SDL_Storage *storage_title = NULL;
 static SDL_Storage *storage_user  = NULL;
 
+/* Dossier racine du storage title (override_path ou dossier de l'exécutable) */
+static char *storage_title_root = NULL;
+
+/* Dossier racine du storage user (SDL_GetPrefPath(org, app)) */
+static char *storage_user_root = NULL;
+
+/* Stream de lecture sur un fichier du storage (voir rc2d_storage_titleOpenStream) */
+struct RC2D_StorageStream {
+    /** Stream exposé à l'appelant (SDL_OpenIO sur l'interface ci-dessous). */
+    SDL_IOStream *io;
+
+    /** Source réelle : fichier ouvert en lecture, ou mémoire sur 'mapping' en fallback. */
+    SDL_IOStream *source;
+
+    /** Fallback : vue sur le fichier entier quand il n'est pas accessible par le système de fichiers. */
+    RC2D_StorageMapping mapping;
+
+    /** Taille du fichier en octets. */
+    Uint64 size;
+};
+
 /* --------------------- Open / Close --------------------- */
 
 bool rc2d_storage_openTitle(const char *override_path)
@@ -28,6 +62,22 @@ bool rc2d_storage_openTitle(const char *override_path)
         return false;
     }
 
+    // Mémorise la racine pour rc2d_storage_titleMapFile (même règle que SDL_OpenTitleStorage)
+    const char *root = override_path ? override_path : SDL_GetBasePath();
+    if (root)
+    {
+        // SDL ajoute le séparateur final à override_path s'il manque (SDL_GetBasePath en a déjà un)
+        size_t len = SDL_strlen(root);
+        const bool needs_sep = len == 0 || root[len - 1] != '/';
+        storage_title_root = (char *)RC2D_malloc(len + (needs_sep ? 2 : 1));
+        if (storage_title_root)
+        {
+            SDL_memcpy(storage_title_root, root, len);
+            if (needs_sep) storage_title_root[len++] = '/';
+            storage_title_root[len] = '\0';
+        }
+    }
+
     // Succès
     return true;
 }
@@ -57,6 +107,11 @@ bool rc2d_storage_openUser(const char *org, const char *app)
         return false;
     }
 
+    // Mémorise la racine pour rc2d_storage_userOpenStream (même règle que SDL_OpenUserStorage)
+    char *root = SDL_GetPrefPath(org, app);
+    storage_user_root = root ? RC2D_strdup(root) : NULL;
+    SDL_free(root);
+
     // Succès
     return true;
 }
@@ -81,6 +136,7 @@ void rc2d_storage_closeTitle(void)
 
         // Marque le storage title comme fermé
         storage_title = NULL;
+        RC2D_safe_free(storage_title_root);
     }
 }
 
@@ -97,9 +153,15 @@ void rc2d_storage_closeUser(void)
 
         // Marque le storage user comme fermé
         storage_user = NULL;
+        RC2D_safe_free(storage_user_root);
     }
 }
 
+const char *rc2d_storage_getUserRoot(void)
+{
+    return storage_user ? storage_user_root : NULL;
+}
+
 /* --------------------- Ready flags --------------------- */
 
 bool rc2d_storage_titleReady(void)
@@ -135,6 +197,94 @@ bool rc2d_storage_userMkdir(const char *path)
     return SDL_CreateStorageDirectory(storage_user, path);
 }
 
+bool rc2d_storage_userRenamePath(const char *oldpath, const char *newpath)
+{
+    // Vérifie si le storage user est ouvert et prêt
+    if (!storage_user || !SDL_StorageReady(storage_user)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_storage_userRenamePath: user storage non ouvert ou non prêt");
+        return false;
+    }
+
+    if (!SDL_RenameStoragePath(storage_user, oldpath, newpath))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_storage_userRenamePath: SDL_RenameStoragePath failed: %s", SDL_GetError());
+        return false;
+    }
+
+    return true;
+}
+
+bool rc2d_storage_userRemovePath(const char *path)
+{
+    // Vérifie si le storage user est ouvert et prêt
+    if (!storage_user || !SDL_StorageReady(storage_user)) 
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_storage_userRemovePath: user storage non ouvert ou non prêt");
+        return false;
+    }
+
+    if (!SDL_RemoveStoragePath(storage_user, path))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_storage_userRemovePath: SDL_RemoveStoragePath failed: %s", SDL_GetError());
+        return false;
+    }
+
+    return true;
+}
+
+/* ------------------ Exists (title / user) ------------- */
+
+static bool file_exists(SDL_Storage *storage, const char *path)
+{
+    // Storage absent ou pas encore prêt : le fichier est considéré comme absent
+    if (!storage || !path || !SDL_StorageReady(storage))
+    {
+        return false;
+    }
+
+    // Pas de log d'erreur : l'absence du fichier est un cas normal ici
+    SDL_PathInfo info;
+    if (!SDL_GetStoragePathInfo(storage, path, &info))
+    {
+        return false;
+    }
+
+    return info.type == SDL_PATHTYPE_FILE;
+}
+
+bool rc2d_storage_titleFileExists(const char *path)
+{
+    return file_exists(storage_title, path);
+}
+
+bool rc2d_storage_userFileExists(const char *path)
+{
+    return file_exists(storage_user, path);
+}
+
+static Uint64 file_size(SDL_Storage *storage, const char *path)
+{
+    // Même contrat que file_exists() : pas de log, 0 si absent ou storage non prêt
+    Uint64 size = 0;
+    if (!file_exists(storage, path) || !SDL_GetStorageFileSize(storage, path, &size))
+    {
+        return 0;
+    }
+
+    return size;
+}
+
+Uint64 rc2d_storage_titleFileSize(const char *path)
+{
+    return file_size(storage_title, path);
+}
+
+Uint64 rc2d_storage_userFileSize(const char *path)
+{
+    return file_size(storage_user, path);
+}
+
 /* -------------- Read helpers (title / user) ------------ */
 
 static bool read_all(SDL_Storage *storage, const char *path, void **out_data, Uint64 *out_len)
@@ -200,6 +350,300 @@ bool rc2d_storage_userReadFile(const char *path, void **out_data, Uint64 *out_le
     return read_all(storage_user, path, out_data, out_len);
 }
 
+/* ------------------ Map helpers (title / user) ----------------- */
+
+/* Lecture complète emballée dans une vue (fallback quand le mapping n'est pas possible). */
+static bool map_by_reading(SDL_Storage *storage, const char *path, RC2D_StorageMapping *out_mapping)
+{
+    void *buffer = NULL;
+    Uint64 len = 0;
+    if (!read_all(storage, path, &buffer, &len))
+    {
+        return false;
+    }
+
+    out_mapping->data = buffer;
+    out_mapping->len = len;
+    out_mapping->_buffer = buffer;
+    return true;
+}
+
+/*
+ * Chemin réel de <root><path> (à libérer avec SDL_free), ou NULL si le chemin ne peut pas
+ * être résolu sans passer par SDL_Storage. Pas de log : l'appelant a toujours un fallback.
+ */
+static char *full_path_of(const char *root, const char *path)
+{
+    // Chemins absolus ou remontant l'arborescence : laissés à SDL_Storage (qui les valide)
+    if (!root || !path || path[0] == '/' || SDL_strstr(path, "..") != NULL)
+    {
+        return NULL;
+    }
+
+    // SDL_OpenTitleStorage / SDL_OpenUserStorage concatènent la racine et le chemin : on fait de même
+    char *full_path = NULL;
+    if (SDL_asprintf(&full_path, "%s%s", root, path) < 0)
+    {
+        return NULL;
+    }
+
+    return full_path;
+}
+
+#if RC2D_STORAGE_HAS_MMAP
+/* mmap en lecture seule de <racine title><path>. Pas de log : l'appelant retombe sur read_all. */
+static bool map_title_file(const char *path, RC2D_StorageMapping *out_mapping)
+{
+    char *full_path = full_path_of(storage_title_root, path);
+    if (!full_path)
+    {
+        return false;
+    }
+
+    const int fd = open(full_path, O_RDONLY | O_CLOEXEC);
+    SDL_free(full_path);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0)
+    {
+        close(fd);
+        return false;
+    }
+
+    // Le mapping reste valide après la fermeture du descripteur
+    void *addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+    {
+        return false;
+    }
+
+    // Les décodeurs lisent le fichier d'un bout à l'autre (une valeur de conseil par appel, elles ne se combinent pas)
+    madvise(addr, (size_t)st.st_size, MADV_SEQUENTIAL);
+    madvise(addr, (size_t)st.st_size, MADV_WILLNEED);
+
+    out_mapping->data = addr;
+    out_mapping->len = (Uint64)st.st_size;
+    out_mapping->_map_addr = addr;
+    out_mapping->_map_len = (size_t)st.st_size;
+    return true;
+}
+#endif
+
+bool rc2d_storage_titleMapFile(const char *path, RC2D_StorageMapping *out_mapping)
+{
+    if (!out_mapping)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_storage_titleMapFile: out_mapping is NULL");
+        return false;
+    }
+    SDL_zerop(out_mapping);
+
+    if (rc2d_storage_titleTryMapFile(path, out_mapping))
+    {
+        return true;
+    }
+
+    return map_by_reading(storage_title, path, out_mapping);
+}
+
+bool rc2d_storage_titleTryMapFile(const char *path, RC2D_StorageMapping *out_mapping)
+{
+    if (!out_mapping)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_storage_titleTryMapFile: out_mapping is NULL");
+        return false;
+    }
+    SDL_zerop(out_mapping);
+
+#if RC2D_STORAGE_HAS_MMAP
+    if (storage_title && SDL_StorageReady(storage_title) && map_title_file(path, out_mapping))
+    {
+        return true;
+    }
+#endif
+
+    // Pas de log : le mapping n'est qu'une optimisation, l'appelant a un autre chemin de lecture
+    (void)path;
+    return false;
+}
+
+bool rc2d_storage_userMapFile(const char *path, RC2D_StorageMapping *out_mapping)
+{
+    if (!out_mapping)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_storage_userMapFile: out_mapping is NULL");
+        return false;
+    }
+    SDL_zerop(out_mapping);
+
+    return map_by_reading(storage_user, path, out_mapping);
+}
+
+void rc2d_storage_unmapFile(RC2D_StorageMapping *mapping)
+{
+    if (!mapping) return;
+
+#if RC2D_STORAGE_HAS_MMAP
+    if (mapping->_map_addr)
+    {
+        munmap(mapping->_map_addr, mapping->_map_len);
+    }
+#endif
+    RC2D_safe_free(mapping->_buffer);
+    SDL_zerop(mapping);
+}
+
+/* ------------------ Streams (title / user) ----------------- */
+
+static Sint64 SDLCALL stream_size(void *userdata)
+{
+    return (Sint64)((RC2D_StorageStream *)userdata)->size;
+}
+
+static Sint64 SDLCALL stream_seek(void *userdata, Sint64 offset, SDL_IOWhence whence)
+{
+    return SDL_SeekIO(((RC2D_StorageStream *)userdata)->source, offset, whence);
+}
+
+static size_t SDLCALL stream_read(void *userdata, void *ptr, size_t size, SDL_IOStatus *status)
+{
+    RC2D_StorageStream *stream = (RC2D_StorageStream *)userdata;
+    const size_t n = SDL_ReadIO(stream->source, ptr, size);
+
+    // Propage EOF / erreur de la source vers le stream exposé
+    if (n < size)
+    {
+        *status = SDL_GetIOStatus(stream->source);
+    }
+    return n;
+}
+
+static bool SDLCALL stream_close(void *userdata)
+{
+    RC2D_StorageStream *stream = (RC2D_StorageStream *)userdata;
+    const bool ok = stream->source ? SDL_CloseIO(stream->source) : true;
+
+    rc2d_storage_unmapFile(&stream->mapping);
+    RC2D_free(stream);
+    return ok;
+}
+
+static RC2D_StorageStream *open_stream(SDL_Storage *storage, const char *root, const char *path, const char *fn)
+{
+    // Vérifie que le storage est ouvert et prêt : même contrat que les lectures complètes
+    if (!storage || !path || !SDL_StorageReady(storage))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "%s: storage not ready or invalid path", fn);
+        return NULL;
+    }
+
+    // Passe par SDL_Storage pour valider le chemin (et écarter les dossiers) avant d'ouvrir
+    if (!file_exists(storage, path))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "%s: file '%s' not found", fn, path);
+        return NULL;
+    }
+
+    RC2D_StorageStream *stream = (RC2D_StorageStream *)RC2D_calloc(1, sizeof(*stream));
+    if (!stream)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "%s: allocation failed", fn);
+        return NULL;
+    }
+
+    // Storage sur le système de fichiers : lecture par morceaux directement depuis le fichier
+    char *full_path = full_path_of(root, path);
+    if (full_path)
+    {
+        stream->source = SDL_IOFromFile(full_path, "rb");
+        SDL_free(full_path);
+    }
+
+    if (stream->source)
+    {
+        const Sint64 size = SDL_GetIOSize(stream->source);
+        stream->size = (size > 0) ? (Uint64)size : 0;
+    }
+    else
+    {
+        // Backend sans accès fichier (ou chemin non résolu) : le fichier entier passe par SDL_Storage
+        const bool mapped = (storage == storage_title)
+            ? rc2d_storage_titleMapFile(path, &stream->mapping)
+            : rc2d_storage_userMapFile(path, &stream->mapping);
+        if (!mapped || !(stream->source = SDL_IOFromConstMem(stream->mapping.data, (size_t)stream->mapping.len)))
+        {
+            RC2D_log(RC2D_LOG_ERROR, "%s: cannot open '%s'", fn, path);
+            rc2d_storage_unmapFile(&stream->mapping);
+            RC2D_free(stream);
+            return NULL;
+        }
+        stream->size = stream->mapping.len;
+    }
+
+    SDL_IOStreamInterface iface;
+    SDL_INIT_INTERFACE(&iface);
+    iface.size  = stream_size;
+    iface.seek  = stream_seek;
+    iface.read  = stream_read;
+    iface.close = stream_close;
+
+    stream->io = SDL_OpenIO(&iface, stream);
+    if (!stream->io)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "%s: SDL_OpenIO failed: %s", fn, SDL_GetError());
+        stream_close(stream);
+        return NULL;
+    }
+
+    return stream;
+}
+
+RC2D_StorageStream *rc2d_storage_titleOpenStream(const char *path)
+{
+    return open_stream(storage_title, storage_title_root, path, "rc2d_storage_titleOpenStream");
+}
+
+RC2D_StorageStream *rc2d_storage_userOpenStream(const char *path)
+{
+    return open_stream(storage_user, storage_user_root, path, "rc2d_storage_userOpenStream");
+}
+
+size_t rc2d_storage_streamRead(RC2D_StorageStream *stream, void *dst, size_t size)
+{
+    return stream ? SDL_ReadIO(stream->io, dst, size) : 0;
+}
+
+Sint64 rc2d_storage_streamSeek(RC2D_StorageStream *stream, Sint64 offset, SDL_IOWhence whence)
+{
+    return stream ? SDL_SeekIO(stream->io, offset, whence) : -1;
+}
+
+Sint64 rc2d_storage_streamTell(RC2D_StorageStream *stream)
+{
+    return stream ? SDL_TellIO(stream->io) : -1;
+}
+
+Uint64 rc2d_storage_streamSize(RC2D_StorageStream *stream)
+{
+    return stream ? stream->size : 0;
+}
+
+SDL_IOStream *rc2d_storage_streamGetIO(RC2D_StorageStream *stream)
+{
+    return stream ? stream->io : NULL;
+}
+
+void rc2d_storage_closeStream(RC2D_StorageStream *stream)
+{
+    // SDL_CloseIO appelle stream_close, qui libère la source et le stream
+    if (stream) SDL_CloseIO(stream->io);
+}
+
 /* ---------------------- Write (user) -------------------- */
 
 bool rc2d_storage_userWriteFile(const char *path, const void *src, Uint64 len)
@@ -7,6 +7,7 @@
 #include <RC2D/RC2D_platform_defines.h>
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_endian.h>
 
 #include <cjson/cJSON.h>
 
@@ -24,6 +25,16 @@ static char* tp_strdup(const char* s) {
     return r;
 }
 
+/* Hash FNV-1a 32 bits d'un nom de frame. */
+static Uint32 tp_hash_name(const char* s) {
+    Uint32 h = 2166136261u;
+    while (*s) {
+        h ^= (Uint8)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
 /* Renvoie le dossier de `path` dans `out` (inclut le slash final si présent). */
 static bool tp_dirname(const char* path, char* out, size_t cap) {
     if (!path || !*path) return false;
@@ -80,13 +91,21 @@ static bool tp_read_wh_f(const cJSON* obj, const char* name, SDL_FPoint* out) {
     return true;
 }
 
-/* Parse une entrée de "frames" en RC2D_TP_Frame. */
-static bool tp_parse_frame(const cJSON* fobj, RC2D_TP_Frame* out) {
+/*
+ * Parse une entrée de "frames" en RC2D_TP_Frame.
+ * Le nom est interné dans le bloc `*pool` (avancé d'autant), pas de strdup par frame.
+ */
+static bool tp_parse_frame(const cJSON* fobj, RC2D_TP_Frame* out, char** pool) {
     SDL_memset(out, 0, sizeof(*out));
 
     const cJSON* jname = cJSON_GetObjectItemCaseSensitive(fobj, "filename");
     if (!cJSON_IsString(jname)) return false;
-    out->filename = tp_strdup(jname->valuestring);
+    {
+        const size_t n = SDL_strlen(jname->valuestring) + 1;
+        SDL_memcpy(*pool, jname->valuestring, n);
+        out->filename = *pool;
+        *pool += n;
+    }
 
     if (!tp_read_rect_f(fobj, "frame", &out->frame)) return false;
 
@@ -113,48 +132,209 @@ static bool tp_parse_frame(const cJSON* fobj, RC2D_TP_Frame* out) {
     return true;
 }
 
-/* Libère le contenu d'une frame (nom). */
-static void tp_free_frame(RC2D_TP_Frame* f) {
-    if (!f) return;
-    if (f->filename) { RC2D_free(f->filename); f->filename = NULL; }
+/* Taille totale des noms de frames (NUL inclus), pour le bloc de noms internés. */
+static size_t tp_names_pool_size(const cJSON* jframes) {
+    size_t total = 0;
+    const cJSON* fobj = NULL;
+    cJSON_ArrayForEach(fobj, jframes) {
+        const cJSON* jname = cJSON_GetObjectItemCaseSensitive(fobj, "filename");
+        if (cJSON_IsString(jname)) total += SDL_strlen(jname->valuestring) + 1;
+    }
+    return total;
+}
+
+/* Recherche d'un nom dans l'index de hachage (sondage linéaire). */
+static RC2D_TP_FrameHandle tp_index_find(const RC2D_TP_Atlas* atlas, const char* filename, Uint32 hash) {
+    const Uint32 mask = (Uint32)atlas->_name_index_capacity - 1;
+    for (Uint32 i = hash & mask; ; i = (i + 1) & mask) {
+        const RC2D_TP_NameSlot* slot = &atlas->_name_index[i];
+        if (slot->frame == RC2D_TP_INVALID_FRAME) return RC2D_TP_INVALID_FRAME;
+        if (slot->hash == hash && SDL_strcmp(atlas->frames[slot->frame].filename, filename) == 0)
+            return slot->frame;
+    }
 }
 
 /* ========================================================================= */
-/*                               API PUBLIQUE                                 */
+/*                         FORMAT BINAIRE (.rc2datlas)                        */
 /* ========================================================================= */
 
-RC2D_TP_Atlas rc2d_tp_loadAtlasFromStorage(const char* json_path, RC2D_StorageKind storage_kind)
-{
-    RC2D_TP_Atlas atlas = (RC2D_TP_Atlas){0};
+#define TP_BAKED_MAGIC        "RTPA"
+#define TP_BAKED_HEADER_SIZE  32u
+#define TP_BAKED_FRAME_SIZE   44u
+#define TP_BAKED_SLOT_SIZE    8u
 
-    if (!json_path || !*json_path) 
-    {
-        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: invalid json_path");
-        return atlas;
+/* L'index du fichier est utilisé tel quel : même layout que RC2D_TP_NameSlot */
+SDL_COMPILE_TIME_ASSERT(tp_baked_slot_size, sizeof(RC2D_TP_NameSlot) == TP_BAKED_SLOT_SIZE);
+
+static Uint32 tp_get_u32(const Uint8* p) {
+    Uint32 v;
+    SDL_memcpy(&v, p, sizeof(v));
+    return SDL_Swap32LE(v);
+}
+
+static float tp_get_f32(const Uint8* p) {
+    float v;
+    SDL_memcpy(&v, p, sizeof(v));
+    return SDL_SwapFloatLE(v);
+}
+
+static void tp_put_u32(Uint8* p, Uint32 v) {
+    v = SDL_Swap32LE(v);
+    SDL_memcpy(p, &v, sizeof(v));
+}
+
+static void tp_put_f32(Uint8* p, float v) {
+    v = SDL_SwapFloatLE(v);
+    SDL_memcpy(p, &v, sizeof(v));
+}
+
+/* true si `path` se termine par RC2D_TP_BAKED_EXTENSION. */
+static bool tp_is_baked_path(const char* path) {
+    const size_t lp = SDL_strlen(path);
+    const size_t le = SDL_strlen(RC2D_TP_BAKED_EXTENSION);
+    return lp > le && SDL_strcmp(path + lp - le, RC2D_TP_BAKED_EXTENSION) == 0;
+}
+
+/* Chemin de l'atlas binaire voisin : "dir/name.json" -> "dir/name.rc2datlas". */
+static bool tp_baked_sibling(const char* json_path, char* out, size_t cap) {
+    const char* slash = SDL_strrchr(json_path, '/');
+    const char* dot = SDL_strrchr(json_path, '.');
+    const size_t stem = (dot && (!slash || dot > slash)) ? (size_t)(dot - json_path) : SDL_strlen(json_path);
+    const size_t le = SDL_strlen(RC2D_TP_BAKED_EXTENSION);
+    if (stem + le >= cap) return false;
+    SDL_memcpy(out, json_path, stem);
+    SDL_memcpy(out + stem, RC2D_TP_BAKED_EXTENSION, le + 1);
+    return true;
+}
+
+/* Pointeur vers l'index stocké dans le buffer binaire de l'atlas (NULL si atlas JSON). */
+static const RC2D_TP_NameSlot* tp_baked_index(const RC2D_TP_Atlas* atlas) {
+    if (!atlas->_baked_data) return NULL;
+    const Uint8* base = (const Uint8*)atlas->_baked_data;
+    return (const RC2D_TP_NameSlot*)(base + TP_BAKED_HEADER_SIZE + (size_t)tp_get_u32(base + 8) * TP_BAKED_FRAME_SIZE);
+}
+
+/*
+ * Interprète un buffer .rc2datlas (frames, index, noms) dans `atlas`.
+ * En cas de succès l'atlas devient propriétaire de `bytes` ; seul `frames` est alloué.
+ */
+static bool tp_parse_baked(void* bytes, Uint64 len, RC2D_TP_Atlas* atlas, const char* path) {
+    Uint8* base = (Uint8*)bytes;
+    if (len < TP_BAKED_HEADER_SIZE || SDL_memcmp(base, TP_BAKED_MAGIC, 4) != 0) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: '%s' is not a baked atlas", path);
+        return false;
     }
 
-    /* 1) Charger le JSON depuis le storage RC2D */
-    void* bytes = NULL; Uint64 len = 0;
+    const Uint32 version      = tp_get_u32(base + 4);
+    const Uint32 frame_count  = tp_get_u32(base + 8);
+    const Uint32 capacity     = tp_get_u32(base + 12);
+    const Uint32 strings_size = tp_get_u32(base + 16);
+    const Uint32 image_name   = tp_get_u32(base + 20);
+    if (version != RC2D_TP_BAKED_VERSION) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: '%s' has baked version %u (expected %d), rebake it",
+                 path, version, RC2D_TP_BAKED_VERSION);
+        return false;
+    }
+
+    /* Index : puissance de 2 avec au moins une entrée vide (fin de sondage garantie) */
+    const Uint64 frames_off  = TP_BAKED_HEADER_SIZE;
+    const Uint64 index_off   = frames_off + (Uint64)frame_count * TP_BAKED_FRAME_SIZE;
+    const Uint64 strings_off = index_off + (Uint64)capacity * TP_BAKED_SLOT_SIZE;
+    if (frame_count > (Uint32)SDL_MAX_SINT32 ||
+        (capacity != 0 && ((capacity & (capacity - 1)) != 0 || capacity <= frame_count)) ||
+        (capacity == 0 && frame_count != 0) ||
+        strings_size == 0 || strings_off + strings_size != len ||
+        base[strings_off + strings_size - 1] != '\0' || image_name >= strings_size) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: corrupted baked atlas '%s'", path);
+        return false;
+    }
+
+    char* strings = (char*)(base + strings_off);
+    RC2D_TP_NameSlot* slots = (RC2D_TP_NameSlot*)(base + index_off);
+    Uint32 empty_slots = 0;
+    for (Uint32 i = 0; i < capacity; ++i) {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        slots[i].hash  = SDL_Swap32LE(slots[i].hash);
+        slots[i].frame = (RC2D_TP_FrameHandle)SDL_Swap32LE((Uint32)slots[i].frame);
+#endif
+        if (slots[i].frame < RC2D_TP_INVALID_FRAME || slots[i].frame >= (RC2D_TP_FrameHandle)frame_count) {
+            RC2D_log(RC2D_LOG_ERROR, "TexturePacker: corrupted name index in '%s'", path);
+            return false;
+        }
+        if (slots[i].frame == RC2D_TP_INVALID_FRAME) ++empty_slots;
+    }
+    /* Sans entrée vide, tp_index_find ne terminerait pas sur un nom absent */
+    if (capacity != 0 && empty_slots == 0) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: corrupted name index in '%s'", path);
+        return false;
+    }
+
+    if (frame_count > 0) {
+        atlas->frames = (RC2D_TP_Frame*)RC2D_malloc((size_t)frame_count * sizeof(RC2D_TP_Frame));
+        if (!atlas->frames) {
+            RC2D_log(RC2D_LOG_ERROR, "TexturePacker: out of memory for frames");
+            return false;
+        }
+    }
+
+    const Uint8* rec = base + frames_off;
+    for (Uint32 i = 0; i < frame_count; ++i, rec += TP_BAKED_FRAME_SIZE) {
+        const Uint32 name = tp_get_u32(rec);
+        if (name >= strings_size) {
+            RC2D_log(RC2D_LOG_ERROR, "TexturePacker: corrupted frame %u in '%s'", i, path);
+            RC2D_safe_free(atlas->frames);
+            return false;
+        }
+        RC2D_TP_Frame* f = &atlas->frames[i];
+        f->filename = strings + name;
+        f->frame            = (SDL_FRect){ tp_get_f32(rec + 4),  tp_get_f32(rec + 8),  tp_get_f32(rec + 12), tp_get_f32(rec + 16) };
+        f->spriteSourceSize = (SDL_FRect){ tp_get_f32(rec + 20), tp_get_f32(rec + 24), tp_get_f32(rec + 28), tp_get_f32(rec + 32) };
+        f->sourceSize       = (SDL_FPoint){ tp_get_f32(rec + 36), tp_get_f32(rec + 40) };
+    }
+
+    atlas->frame_count = (int)frame_count;
+    atlas->atlas_image_name = strings[image_name] ? strings + image_name : NULL;
+    atlas->atlas_size.x = tp_get_f32(base + 24);
+    atlas->atlas_size.y = tp_get_f32(base + 28);
+    atlas->_name_pool = strings;
+    atlas->_name_index = capacity ? slots : NULL;
+    atlas->_name_index_capacity = (int)capacity;
+    atlas->_baked_data = bytes;
+    return true;
+}
+
+/* ========================================================================= */
+/*                               CHARGEMENT                                   */
+/* ========================================================================= */
+
+/* Lit entièrement `path` depuis le storage demandé. */
+static bool tp_read_storage(const char* path, RC2D_StorageKind storage_kind, void** bytes, Uint64* len) {
     bool ok = false;
     if (storage_kind == RC2D_STORAGE_TITLE) {
-        ok = rc2d_storage_titleReadFile(json_path, &bytes, &len);
+        ok = rc2d_storage_titleReadFile(path, bytes, len);
     } else if (storage_kind == RC2D_STORAGE_USER) {
-        ok = rc2d_storage_userReadFile(json_path, &bytes, &len);
+        ok = rc2d_storage_userReadFile(path, bytes, len);
     } else {
         RC2D_log(RC2D_LOG_ERROR, "TexturePacker: invalid storage_kind");
-        return atlas;
+        return false;
     }
-    if (!ok || !bytes || len == 0) {
-        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: failed to read '%s' from storage", json_path);
-        return atlas;
+    if (!ok || !*bytes || *len == 0) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: failed to read '%s' from storage", path);
+        RC2D_safe_free(*bytes);
+        return false;
     }
+    return true;
+}
 
-    /* 2) Parser le JSON */
-    cJSON* root = cJSON_ParseWithLength((const char*)bytes, (size_t)len);
-    RC2D_free(bytes); bytes = NULL;
+/*
+ * Parse un JSON TexturePacker (méta + frames + noms internés) dans `atlas`, sans texture.
+ * En cas d'échec, l'appelant libère l'atlas partiellement rempli.
+ */
+static bool tp_parse_json(const char* bytes, Uint64 len, RC2D_TP_Atlas* atlas, const char* path) {
+    cJSON* root = cJSON_ParseWithLength(bytes, (size_t)len);
     if (!root) {
-        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: JSON parse failed for '%s'", json_path);
-        return atlas;
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: JSON parse failed for '%s'", path);
+        return false;
     }
 
     const cJSON* jframes = cJSON_GetObjectItemCaseSensitive(root, "frames");
@@ -162,13 +342,13 @@ RC2D_TP_Atlas rc2d_tp_loadAtlasFromStorage(const char* json_path, RC2D_StorageKi
     if (!cJSON_IsArray(jframes) || !cJSON_IsObject(jmeta)) {
         RC2D_log(RC2D_LOG_ERROR, "TexturePacker: invalid JSON (frames/meta)");
         cJSON_Delete(root);
-        return atlas;
+        return false;
     }
 
-    /* 3) Méta (image + size) */
+    /* Méta (image + size) */
     const cJSON* jimage = cJSON_GetObjectItemCaseSensitive(jmeta, "image");
     if (cJSON_IsString(jimage)) {
-        atlas.atlas_image_name = tp_strdup(jimage->valuestring);
+        atlas->atlas_image_name = tp_strdup(jimage->valuestring);
     }
 
     {
@@ -177,83 +357,316 @@ RC2D_TP_Atlas rc2d_tp_loadAtlasFromStorage(const char* json_path, RC2D_StorageKi
             const cJSON* jw = cJSON_GetObjectItemCaseSensitive(jsize, "w");
             const cJSON* jh = cJSON_GetObjectItemCaseSensitive(jsize, "h");
             if (cJSON_IsNumber(jw) && cJSON_IsNumber(jh)) {
-                atlas.atlas_size.x = (float)jw->valuedouble;
-                atlas.atlas_size.y = (float)jh->valuedouble;
+                atlas->atlas_size.x = (float)jw->valuedouble;
+                atlas->atlas_size.y = (float)jh->valuedouble;
             }
         }
     }
 
-    /* 4) Charger l'image d'atlas (dans le même dossier que le JSON) */
-    char dir[512]; dir[0] = '\0';
-    tp_dirname(json_path, dir, sizeof(dir));
+    /* Allouer les frames et parser */
+    const int n = cJSON_GetArraySize(jframes);
+    if (n <= 0) {
+        RC2D_log(RC2D_LOG_WARN, "TexturePacker: no frames in '%s'", path);
+        cJSON_Delete(root);
+        return true;
+    }
 
-    if (atlas.atlas_image_name) {
-        char img_path[1024];
-        if (!tp_join2(dir, atlas.atlas_image_name, img_path, sizeof(img_path))) {
-            RC2D_log(RC2D_LOG_ERROR, "TexturePacker: path join failed for atlas image");
+    atlas->frames = (RC2D_TP_Frame*)RC2D_calloc((size_t)n, sizeof(RC2D_TP_Frame));
+    if (!atlas->frames) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: out of memory for frames");
+        cJSON_Delete(root);
+        return false;
+    }
+    atlas->frame_count = n;
+
+    /* Un seul bloc pour tous les noms (internés), au lieu d'un strdup par frame */
+    const size_t pool_size = tp_names_pool_size(jframes);
+    if (pool_size > 0) {
+        atlas->_name_pool = (char*)RC2D_malloc(pool_size);
+        if (!atlas->_name_pool) {
+            RC2D_log(RC2D_LOG_ERROR, "TexturePacker: out of memory for frame names");
             cJSON_Delete(root);
-            rc2d_tp_freeAtlas(&atlas);
-            return (RC2D_TP_Atlas){0};
+            return false;
         }
-        atlas.atlas_image = rc2d_graphics_loadImageFromStorage(img_path, storage_kind);
-        if (!atlas.atlas_image.sdl_texture) {
-            RC2D_log(RC2D_LOG_ERROR, "TexturePacker: failed to load atlas image '%s'", img_path);
-            cJSON_Delete(root);
-            rc2d_tp_freeAtlas(&atlas);
-            return (RC2D_TP_Atlas){0};
+    }
+    char* pool = atlas->_name_pool;
+
+    /* Itération directe sur la liste chaînée cJSON (cJSON_GetArrayItem est en O(i)) */
+    int i = 0;
+    const cJSON* fobj = NULL;
+    cJSON_ArrayForEach(fobj, jframes) {
+        if (!cJSON_IsObject(fobj)) {
+            RC2D_log(RC2D_LOG_WARN, "TexturePacker: skipping non-object frame at index %d", i);
         }
-    } else {
+        else if (!tp_parse_frame(fobj, &atlas->frames[i], &pool)) {
+            RC2D_log(RC2D_LOG_WARN, "TexturePacker: failed parsing frame at index %d", i);
+        }
+        ++i;
+    }
+
+    cJSON_Delete(root);
+
+    /* Index de hachage nom -> frame, construit une seule fois */
+    if (!rc2d_tp_buildFrameIndex(atlas)) {
+        RC2D_log(RC2D_LOG_WARN, "TexturePacker: frame index not built for '%s', falling back to linear lookups", path);
+    }
+    return true;
+}
+
+/* Chemin (dans le storage) de l'image d'atlas (meta.image), cherchée dans le même dossier que `path`. */
+static bool tp_image_path(const RC2D_TP_Atlas* atlas, const char* path, char* out, size_t cap) {
+    if (!atlas->atlas_image_name) {
         RC2D_log(RC2D_LOG_ERROR, "TexturePacker: meta.image missing");
-        cJSON_Delete(root);
+        return false;
+    }
+
+    char dir[512]; dir[0] = '\0';
+    tp_dirname(path, dir, sizeof(dir));
+
+    if (!tp_join2(dir, atlas->atlas_image_name, out, cap)) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: path join failed for atlas image");
+        return false;
+    }
+    return true;
+}
+
+/* Charge la texture d'atlas depuis `image_path` ; libère l'atlas en cas d'échec. */
+static RC2D_TP_Atlas tp_load_image(RC2D_TP_Atlas atlas, const char* image_path, RC2D_StorageKind storage_kind) {
+    atlas.atlas_image = rc2d_graphics_loadImageFromStorage(image_path, storage_kind);
+    if (!atlas.atlas_image.sdl_texture) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: failed to load atlas image '%s'", image_path);
         rc2d_tp_freeAtlas(&atlas);
         return (RC2D_TP_Atlas){0};
     }
+    return atlas;
+}
 
-    /* 5) Allouer les frames et parser */
-    const int n = cJSON_GetArraySize(jframes);
-    if (n <= 0) {
-        RC2D_log(RC2D_LOG_WARN, "TexturePacker: no frames in '%s'", json_path);
-        cJSON_Delete(root);
+/* Lit et interprète un .rc2datlas (une seule lecture, le buffer est conservé par l'atlas). */
+static bool tp_load_baked_frames(const char* path, RC2D_StorageKind storage_kind, RC2D_TP_Atlas* atlas) {
+    void* bytes = NULL; Uint64 len = 0;
+    if (!tp_read_storage(path, storage_kind, &bytes, &len)) {
+        return false;
+    }
+
+    if (!tp_parse_baked(bytes, len, atlas, path)) {
+        RC2D_free(bytes);
+        return false;
+    }
+    return true;
+}
+
+/* JSON TexturePacker, ou son .rc2datlas voisin s'il a été généré au build. */
+static bool tp_load_json_frames(const char* json_path, RC2D_StorageKind storage_kind, RC2D_TP_Atlas* atlas) {
+    char baked_path[1024];
+    if (tp_baked_sibling(json_path, baked_path, sizeof(baked_path))) {
+        const bool baked_exists = storage_kind == RC2D_STORAGE_TITLE ? rc2d_storage_titleFileExists(baked_path)
+                                : storage_kind == RC2D_STORAGE_USER  ? rc2d_storage_userFileExists(baked_path)
+                                : false;
+        if (baked_exists) {
+            if (tp_load_baked_frames(baked_path, storage_kind, atlas)) return true;
+            RC2D_log(RC2D_LOG_WARN, "TexturePacker: baked atlas '%s' unusable, falling back to JSON", baked_path);
+            *atlas = (RC2D_TP_Atlas){0};
+        }
+    }
+
+    /* Fallback : parser le JSON directement depuis sa vue storage (mappée sur Title, sans copie) */
+    RC2D_StorageMapping file = {0};
+    const bool ok = storage_kind == RC2D_STORAGE_TITLE ? rc2d_storage_titleMapFile(json_path, &file)
+                  : storage_kind == RC2D_STORAGE_USER  ? rc2d_storage_userMapFile(json_path, &file)
+                  : false;
+    if (!ok || file.len == 0) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: failed to read '%s' from storage", json_path);
+        rc2d_storage_unmapFile(&file);
+        return false;
+    }
+
+    const bool parsed = tp_parse_json((const char*)file.data, file.len, atlas, json_path);
+    rc2d_storage_unmapFile(&file);
+    return parsed;
+}
+
+/* ========================================================================= */
+/*                               API PUBLIQUE                                 */
+/* ========================================================================= */
+
+bool rc2d_tp_loadAtlasFramesFromStorage(const char* path, RC2D_StorageKind storage_kind,
+                                        RC2D_TP_Atlas* atlas, char* image_path, size_t image_path_cap)
+{
+    if (!atlas || !image_path || image_path_cap == 0) return false;
+    *atlas = (RC2D_TP_Atlas){0};
+
+    if (!path || !*path)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: invalid atlas path");
+        return false;
+    }
+
+    /* Atlas binaire précalculé : chemin direct, ou voisin du JSON s'il a été généré */
+    const bool loaded = tp_is_baked_path(path) ? tp_load_baked_frames(path, storage_kind, atlas)
+                                               : tp_load_json_frames(path, storage_kind, atlas);
+    if (!loaded || !tp_image_path(atlas, path, image_path, image_path_cap)) {
+        rc2d_tp_freeAtlas(atlas);
+        return false;
+    }
+    return true;
+}
+
+RC2D_TP_Atlas rc2d_tp_loadAtlasFromStorage(const char* json_path, RC2D_StorageKind storage_kind)
+{
+    RC2D_TP_Atlas atlas = (RC2D_TP_Atlas){0};
+    char image_path[1024];
+
+    /* 1) Frames + méta (binaire précalculé si disponible, sinon JSON) */
+    if (!rc2d_tp_loadAtlasFramesFromStorage(json_path, storage_kind, &atlas, image_path, sizeof(image_path))) {
         return atlas;
     }
 
-    atlas.frames = (RC2D_TP_Frame*)RC2D_calloc((size_t)n, sizeof(RC2D_TP_Frame));
-    if (!atlas.frames) {
-        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: out of memory for frames");
-        cJSON_Delete(root);
+    /* 2) Charger l'image d'atlas (dans le même dossier que le JSON) */
+    return tp_load_image(atlas, image_path, storage_kind);
+}
+
+RC2D_TP_Atlas rc2d_tp_loadBakedAtlasFromStorage(const char* path, RC2D_StorageKind storage_kind)
+{
+    RC2D_TP_Atlas atlas = (RC2D_TP_Atlas){0};
+
+    if (!path || !*path)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: invalid baked atlas path");
+        return atlas;
+    }
+
+    /* Une seule lecture : le buffer devient la mémoire de l'atlas (index + noms) */
+    char image_path[1024];
+    if (!tp_load_baked_frames(path, storage_kind, &atlas) ||
+        !tp_image_path(&atlas, path, image_path, sizeof(image_path))) {
         rc2d_tp_freeAtlas(&atlas);
         return (RC2D_TP_Atlas){0};
     }
-    atlas.frame_count = n;
 
-    for (int i = 0; i < n; ++i) {
-        const cJSON* fobj = cJSON_GetArrayItem(jframes, i);
-        if (!cJSON_IsObject(fobj)) {
-            RC2D_log(RC2D_LOG_WARN, "TexturePacker: skipping non-object frame at index %d", i);
-            continue;
-        }
-        if (!tp_parse_frame(fobj, &atlas.frames[i])) {
-            RC2D_log(RC2D_LOG_WARN, "TexturePacker: failed parsing frame at index %d", i);
+    return tp_load_image(atlas, image_path, storage_kind);
+}
+
+bool rc2d_tp_bakeAtlas(const void* json_data, Uint64 json_len, void** out_data, Uint64* out_len)
+{
+    if (!json_data || json_len == 0 || !out_data || !out_len) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: invalid args in rc2d_tp_bakeAtlas");
+        return false;
+    }
+    *out_data = NULL;
+    *out_len = 0;
+
+    RC2D_TP_Atlas atlas = (RC2D_TP_Atlas){0};
+    if (!tp_parse_json((const char*)json_data, json_len, &atlas, "<bake>")) {
+        rc2d_tp_freeAtlas(&atlas);
+        return false;
+    }
+    if (atlas.frame_count > 0 && !atlas._name_index) {
+        rc2d_tp_freeAtlas(&atlas);
+        return false;
+    }
+
+    /* Table de chaînes : "" (offset 0, frames sans nom), meta.image, puis les noms */
+    const char* image_name = atlas.atlas_image_name ? atlas.atlas_image_name : "";
+    Uint64 strings_size = 1 + SDL_strlen(image_name) + 1;
+    for (int i = 0; i < atlas.frame_count; ++i) {
+        if (atlas.frames[i].filename) strings_size += SDL_strlen(atlas.frames[i].filename) + 1;
+    }
+
+    const Uint32 capacity = (Uint32)atlas._name_index_capacity;
+    const Uint64 index_off = TP_BAKED_HEADER_SIZE + (Uint64)atlas.frame_count * TP_BAKED_FRAME_SIZE;
+    const Uint64 strings_off = index_off + (Uint64)capacity * TP_BAKED_SLOT_SIZE;
+    const Uint64 total = strings_off + strings_size;
+    if (strings_size > SDL_MAX_UINT32) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: atlas too large to bake");
+        rc2d_tp_freeAtlas(&atlas);
+        return false;
+    }
+
+    Uint8* out = (Uint8*)RC2D_calloc(1, (size_t)total);
+    if (!out) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: out of memory for baked atlas");
+        rc2d_tp_freeAtlas(&atlas);
+        return false;
+    }
+
+    /* Chaînes */
+    char* strings = (char*)(out + strings_off);
+    Uint32 cursor = 1;
+    const Uint32 image_off = cursor;
+    {
+        const size_t n = SDL_strlen(image_name) + 1;
+        SDL_memcpy(strings + cursor, image_name, n);
+        cursor += (Uint32)n;
+    }
+
+    /* En-tête */
+    SDL_memcpy(out, TP_BAKED_MAGIC, 4);
+    tp_put_u32(out + 4, RC2D_TP_BAKED_VERSION);
+    tp_put_u32(out + 8, (Uint32)atlas.frame_count);
+    tp_put_u32(out + 12, capacity);
+    tp_put_u32(out + 16, (Uint32)strings_size);
+    tp_put_u32(out + 20, image_name[0] ? image_off : 0);
+    tp_put_f32(out + 24, atlas.atlas_size.x);
+    tp_put_f32(out + 28, atlas.atlas_size.y);
+
+    /* Frames */
+    Uint8* rec = out + TP_BAKED_HEADER_SIZE;
+    for (int i = 0; i < atlas.frame_count; ++i, rec += TP_BAKED_FRAME_SIZE) {
+        const RC2D_TP_Frame* f = &atlas.frames[i];
+        Uint32 name = 0;
+        if (f->filename) {
+            const size_t n = SDL_strlen(f->filename) + 1;
+            SDL_memcpy(strings + cursor, f->filename, n);
+            name = cursor;
+            cursor += (Uint32)n;
         }
+        tp_put_u32(rec, name);
+        tp_put_f32(rec + 4,  f->frame.x);
+        tp_put_f32(rec + 8,  f->frame.y);
+        tp_put_f32(rec + 12, f->frame.w);
+        tp_put_f32(rec + 16, f->frame.h);
+        tp_put_f32(rec + 20, f->spriteSourceSize.x);
+        tp_put_f32(rec + 24, f->spriteSourceSize.y);
+        tp_put_f32(rec + 28, f->spriteSourceSize.w);
+        tp_put_f32(rec + 32, f->spriteSourceSize.h);
+        tp_put_f32(rec + 36, f->sourceSize.x);
+        tp_put_f32(rec + 40, f->sourceSize.y);
     }
 
-    cJSON_Delete(root);
-    return atlas;
+    /* Index précalculé (mêmes hash / sondage qu'au runtime) */
+    Uint8* slot = out + index_off;
+    for (Uint32 i = 0; i < capacity; ++i, slot += TP_BAKED_SLOT_SIZE) {
+        tp_put_u32(slot, atlas._name_index[i].hash);
+        tp_put_u32(slot + 4, (Uint32)atlas._name_index[i].frame);
+    }
+
+    rc2d_tp_freeAtlas(&atlas);
+
+    *out_data = out;
+    *out_len = total;
+    return true;
 }
 
 void rc2d_tp_freeAtlas(RC2D_TP_Atlas* atlas)
 {
     if (!atlas) return;
 
-    /* Libérer frames */
-    for (int i = 0; i < atlas->frame_count; ++i) {
-        tp_free_frame(&atlas->frames[i]);
-    }
+    /* Libérer frames, noms internés et index (sauf s'ils vivent dans le buffer binaire) */
     if (atlas->frames) { RC2D_free(atlas->frames); atlas->frames = NULL; }
+    if (atlas->_name_index && atlas->_name_index != tp_baked_index(atlas)) RC2D_free(atlas->_name_index);
+    atlas->_name_index = NULL;
+    atlas->_name_index_capacity = 0;
+    if (atlas->_baked_data) {
+        RC2D_free(atlas->_baked_data);
+        atlas->_baked_data = NULL;
+    }
+    else {
+        if (atlas->_name_pool) RC2D_free(atlas->_name_pool);
+        if (atlas->atlas_image_name) RC2D_free(atlas->atlas_image_name);
+    }
     atlas->frame_count = 0;
-
-    /* Libérer nom d'image */
-    if (atlas->atlas_image_name) { RC2D_free(atlas->atlas_image_name); atlas->atlas_image_name = NULL; }
+    atlas->_name_pool = NULL;
+    atlas->atlas_image_name = NULL;
 
     /* Détruire texture d'atlas */
     if (atlas->atlas_image.sdl_texture) {
@@ -264,15 +677,95 @@ void rc2d_tp_freeAtlas(RC2D_TP_Atlas* atlas)
     atlas->atlas_size.x = atlas->atlas_size.y = 0.0f;
 }
 
-const RC2D_TP_Frame* rc2d_tp_getFrame(const RC2D_TP_Atlas* atlas, const char* filename)
+bool rc2d_tp_buildFrameIndex(RC2D_TP_Atlas* atlas)
 {
-    if (!atlas || !filename || !*filename) return NULL;
+    if (!atlas) return false;
+
+    /* L'index d'un atlas binaire vit dans son buffer : on le remplace sans le libérer */
+    if (atlas->_name_index && atlas->_name_index != tp_baked_index(atlas)) RC2D_free(atlas->_name_index);
+    atlas->_name_index = NULL;
+    atlas->_name_index_capacity = 0;
+    if (atlas->frame_count <= 0 || !atlas->frames) return false;
+
+    /* Capacité puissance de 2, facteur de charge <= 0.5 */
+    int capacity = 8;
+    while (capacity < atlas->frame_count * 2) capacity *= 2;
+
+    RC2D_TP_NameSlot* slots = (RC2D_TP_NameSlot*)RC2D_malloc((size_t)capacity * sizeof(RC2D_TP_NameSlot));
+    if (!slots) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: out of memory for frame index");
+        return false;
+    }
+    for (int i = 0; i < capacity; ++i) {
+        slots[i].hash = 0;
+        slots[i].frame = RC2D_TP_INVALID_FRAME;
+    }
+    atlas->_name_index = slots;
+    atlas->_name_index_capacity = capacity;
+
+    for (int f = 0; f < atlas->frame_count; ++f) {
+        const char* name = atlas->frames[f].filename;
+        if (!name) continue;
+
+        /* Doublon : on garde la première frame (comme l'ancienne recherche linéaire) */
+        const Uint32 hash = tp_hash_name(name);
+        if (tp_index_find(atlas, name, hash) != RC2D_TP_INVALID_FRAME) continue;
+
+        const Uint32 mask = (Uint32)capacity - 1;
+        Uint32 i = hash & mask;
+        while (slots[i].frame != RC2D_TP_INVALID_FRAME) i = (i + 1) & mask;
+        slots[i].hash = hash;
+        slots[i].frame = f;
+    }
+
+    return true;
+}
+
+RC2D_TP_FrameHandle rc2d_tp_getFrameHandle(const RC2D_TP_Atlas* atlas, const char* filename)
+{
+    if (!atlas || !filename || !*filename) return RC2D_TP_INVALID_FRAME;
+
+    if (atlas->_name_index) {
+        return tp_index_find(atlas, filename, tp_hash_name(filename));
+    }
+
+    /* Pas d'index (atlas construit à la main) : recherche linéaire */
     for (int i = 0; i < atlas->frame_count; ++i) {
-        RC2D_TP_Frame* f = &atlas->frames[i];
+        const RC2D_TP_Frame* f = &atlas->frames[i];
         if (f->filename && SDL_strcmp(f->filename, filename) == 0)
-            return f;
+            return i;
     }
-    return NULL;
+    return RC2D_TP_INVALID_FRAME;
+}
+
+const RC2D_TP_Frame* rc2d_tp_getFrameByHandle(const RC2D_TP_Atlas* atlas, RC2D_TP_FrameHandle handle)
+{
+    if (!atlas || handle < 0 || handle >= atlas->frame_count) return NULL;
+    return &atlas->frames[handle];
+}
+
+const RC2D_TP_Frame* rc2d_tp_getFrame(const RC2D_TP_Atlas* atlas, const char* filename)
+{
+    return rc2d_tp_getFrameByHandle(atlas, rc2d_tp_getFrameHandle(atlas, filename));
+}
+
+/* Dessin RAW : prend le sous-rect 'frame' tel quel dans l'atlas, à (x, y). */
+static void tp_draw_frame(const RC2D_TP_Atlas* atlas, const RC2D_TP_Frame* f,
+                          float x, float y,
+                          double angle,
+                          float scaleX, float scaleY,
+                          float offsetX, float offsetY,
+                          bool flipH, bool flipV)
+{
+    RC2D_Quad q;
+    q.src = f->frame;
+
+    rc2d_graphics_drawQuad((RC2D_Image*)&atlas->atlas_image, &q,
+                           x, y,
+                           angle,
+                           scaleX, scaleY,
+                           offsetX, offsetY,
+                           flipH, flipV);
 }
 
 void rc2d_tp_drawFrameByName(const RC2D_TP_Atlas* atlas, const char* filename,
@@ -293,14 +786,21 @@ void rc2d_tp_drawFrameByName(const RC2D_TP_Atlas* atlas, const char* filename,
         return;
     }
 
-    /* Dessin RAW: prend le sous-rect 'frame' tel quel dans l'atlas, à (x, y). */
-    RC2D_Quad q;
-    q.src = f->frame;
+    tp_draw_frame(atlas, f, x, y, angle, scaleX, scaleY, offsetX, offsetY, flipH, flipV);
+}
 
-    rc2d_graphics_drawQuad((RC2D_Image*)&atlas->atlas_image, &q,
-                           x, y,
-                           angle,
-                           scaleX, scaleY,
-                           offsetX, offsetY,
-                           flipH, flipV);
-}
\ No newline at end of file
+void rc2d_tp_drawFrame(const RC2D_TP_Atlas* atlas, RC2D_TP_FrameHandle handle,
+                       float x, float y,
+                       double angle,
+                       float scaleX, float scaleY,
+                       float offsetX, float offsetY,
+                       bool flipH, bool flipV)
+{
+    const RC2D_TP_Frame* f = rc2d_tp_getFrameByHandle(atlas, handle);
+    if (!f || !atlas->atlas_image.sdl_texture) {
+        RC2D_log(RC2D_LOG_ERROR, "TexturePacker: invalid atlas or frame handle %d in rc2d_tp_drawFrame", handle);
+        return;
+    }
+
+    tp_draw_frame(atlas, f, x, y, angle, scaleX, scaleY, offsetX, offsetY, flipH, flipV);
+}
@@ -91,6 +91,9 @@ static bool rc2d__draw_anchored(RC2D_Image image,
 
     if (out_drawn_rect) *out_drawn_rect = dst;
 
+    /* Les sprites batchés avant cet élément d'UI doivent être dessinés dessous */
+    rc2d_graphics_flushActiveSpriteBatch();
+
     if (!SDL_RenderTexture(rc2d_engine_state.renderer, image.sdl_texture, NULL, &dst)) {
         RC2D_log(RC2D_LOG_ERROR, "SDL_RenderTexture failed: %s", SDL_GetError());
         return false;
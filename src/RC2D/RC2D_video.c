@@ -151,18 +151,19 @@ int rc2d_video_openFromStorage(RC2D_Video *video,
     video->perf_freq            = SDL_GetPerformanceFrequency();
     video->perf_t0              = SDL_GetPerformanceCounter();
 
-    /* --- 1) Lire le fichier depuis le storage en mémoire --- */
-    void  *bytes = NULL;
-    Uint64 len   = 0;
+    /* --- 1) Ouvrir le fichier en streaming depuis le storage (lu au fil du décodage) --- */
+    RC2D_StorageStream *stream = NULL;
 
     if (storage_kind == RC2D_STORAGE_TITLE) {
-        if (!rc2d_storage_titleReadFile(storage_path, &bytes, &len)) {
-            RC2D_log(RC2D_LOG_ERROR, "TitleReadFile failed for '%s'", storage_path);
+        stream = rc2d_storage_titleOpenStream(storage_path);
+        if (!stream) {
+            RC2D_log(RC2D_LOG_ERROR, "TitleOpenStream failed for '%s'", storage_path);
             return -1;
         }
     } else if (storage_kind == RC2D_STORAGE_USER) {
-        if (!rc2d_storage_userReadFile(storage_path, &bytes, &len)) {
-            RC2D_log(RC2D_LOG_ERROR, "UserReadFile failed for '%s'", storage_path);
+        stream = rc2d_storage_userOpenStream(storage_path);
+        if (!stream) {
+            RC2D_log(RC2D_LOG_ERROR, "UserOpenStream failed for '%s'", storage_path);
             return -1;
         }
     } else {
@@ -170,28 +171,23 @@ int rc2d_video_openFromStorage(RC2D_Video *video,
         return -1;
     }
 
-    if (!bytes || len == 0) {
+    const Uint64 len = rc2d_storage_streamSize(stream);
+    if (len == 0) {
         RC2D_log(RC2D_LOG_ERROR, "Empty video '%s' in %s storage",
                  storage_path, (storage_kind==RC2D_STORAGE_TITLE)?"Title":"User");
-        RC2D_safe_free(bytes);
+        rc2d_storage_closeStream(stream);
         return -1;
     }
 
-    /* --- 2) IO SDL seekable sur le buffer (ne PAS libérer 'bytes' ici) --- */
-    SDL_IOStream *io = SDL_IOFromConstMem(bytes, (size_t)len);
-    if (!io) {
-        RC2D_log(RC2D_LOG_ERROR, "SDL_IOFromConstMem failed: %s", SDL_GetError());
-        RC2D_safe_free(bytes);
-        return -1;
-    }
+    /* --- 2) IO SDL seekable porté par le stream (fermé avec le stream) --- */
+    SDL_IOStream *io = rc2d_storage_streamGetIO(stream);
 
     /* --- 3) AVIOContext custom (utiliser av_malloc !) --- */
     const int avio_buf_size = 32 * 1024;
     uint8_t *avio_buf = (uint8_t *)av_malloc(avio_buf_size);
     if (!avio_buf) {
         RC2D_log(RC2D_LOG_ERROR, "av_malloc failed for AVIO buffer");
-        SDL_CloseIO(io);
-        RC2D_safe_free(bytes);
+        rc2d_storage_closeStream(stream);
         return -1;
     }
 
@@ -199,8 +195,7 @@ int rc2d_video_openFromStorage(RC2D_Video *video,
     if (!opaque) {
         RC2D_log(RC2D_LOG_ERROR, "RC2D_malloc failed for opaque");
         av_free(avio_buf);
-        SDL_CloseIO(io);
-        RC2D_safe_free(bytes);
+        rc2d_storage_closeStream(stream);
         return -1;
     }
     opaque->io   = io;
@@ -213,8 +208,7 @@ int rc2d_video_openFromStorage(RC2D_Video *video,
         RC2D_log(RC2D_LOG_ERROR, "avio_alloc_context failed");
         RC2D_free(opaque);
         av_free(avio_buf);
-        SDL_CloseIO(io);
-        RC2D_safe_free(bytes);
+        rc2d_storage_closeStream(stream);
         return -1;
     }
     avio->seekable = AVIO_SEEKABLE_NORMAL;
@@ -223,10 +217,10 @@ int rc2d_video_openFromStorage(RC2D_Video *video,
     AVFormatContext *fmt = avformat_alloc_context();
     if (!fmt) {
         RC2D_log(RC2D_LOG_ERROR, "avformat_alloc_context failed");
-        avio_context_free(&avio);           /* libère aussi avio_buf */
+        av_freep(&avio->buffer);            /* avio_context_free ne libère pas le buffer */
+        avio_context_free(&avio);
         RC2D_free(opaque);
-        SDL_CloseIO(io);
-        RC2D_safe_free(bytes);
+        rc2d_storage_closeStream(stream);
         return -1;
     }
     fmt->pb    = avio;
@@ -237,10 +231,10 @@ int rc2d_video_openFromStorage(RC2D_Video *video,
     if (pret < 0 || !fmt->iformat) {
         RC2D_log(RC2D_LOG_ERROR, "FFmpeg: probe failed for '%s' (%d)", storage_path, pret);
         avformat_close_input(&fmt);         /* ferme fmt si ouvert */
+        av_freep(&avio->buffer);
         avio_context_free(&avio);
         RC2D_free(opaque);
-        SDL_CloseIO(io);
-        RC2D_safe_free(bytes);
+        rc2d_storage_closeStream(stream);
         return -1;
     }
 
@@ -249,19 +243,18 @@ int rc2d_video_openFromStorage(RC2D_Video *video,
     if (oret < 0) {
         RC2D_log(RC2D_LOG_ERROR, "FFmpeg: avformat_open_input failed (%d) for '%s'", oret, storage_path);
         avformat_close_input(&fmt);
+        av_freep(&avio->buffer);
         avio_context_free(&avio);
         RC2D_free(opaque);
-        SDL_CloseIO(io);
-        RC2D_safe_free(bytes);
+        rc2d_storage_closeStream(stream);
         return -1;
     }
 
     /* Succès : rattacher au RC2D_Video pour cleanup ultérieur */
     video->format_ctx = fmt;
-    video->avio       = avio;         /* libéré avec avio_context_free */
-    video->sdl_io     = io;           /* libéré avec SDL_CloseIO */
-    video->owned_mem  = bytes;        /* libéré avec RC2D_safe_free */
-    video->owned_len  = (size_t)len;
+    video->avio       = avio;         /* buffer (av_freep) puis contexte (avio_context_free) libérés à la fermeture */
+    video->sdl_io     = io;           /* porté par 'stream' */
+    video->stream     = stream;       /* libéré avec rc2d_storage_closeStream */
     video->io_size    = (int64_t)len;
 
     /* Récupérer infos de flux */
@@ -811,6 +804,9 @@ int rc2d_video_draw(RC2D_Video* video)
         dst_rect.y = 0.0f;
     }
 
+    /* Les sprites batchés avant la vidéo doivent être dessinés dessous */
+    rc2d_graphics_flushActiveSpriteBatch();
+
     if (!SDL_RenderTexture(rc2d_engine_state.renderer, video->texture, NULL, &dst_rect)) {
         RC2D_log(RC2D_LOG_ERROR, "SDL: échec rendu texture vidéo: %s", SDL_GetError());
         return -1;
@@ -882,6 +878,18 @@ void rc2d_video_close(RC2D_Video* video)
         avformat_close_input(&video->format_ctx);
     }
 
+    /* IO custom : avformat_close_input ne libère pas un pb fourni par l'appelant */
+    if (video->avio) {
+        RC2D_free(video->avio->opaque);
+        av_freep(&video->avio->buffer);   /* avio_context_free ne libère pas le buffer (éventuellement réalloué par FFmpeg) */
+        avio_context_free(&video->avio);
+    }
+    if (video->stream) {
+        rc2d_storage_closeStream(video->stream);
+        video->stream = NULL;
+        video->sdl_io = NULL;
+    }
+
     video->is_finished = 1;
 }
 #endif // RC2D_VIDEO_MODULE_ENABLED
\ No newline at end of file
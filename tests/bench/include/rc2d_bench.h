@@ -0,0 +1,19 @@
+#ifndef RC2D_BENCH_H
+#define RC2D_BENCH_H
+
+#include <SDL3/SDL_stdinc.h> // Requis pour : Uint64
+#include <SDL3/SDL_timer.h>  // Requis pour : SDL_GetPerformanceCounter, SDL_GetPerformanceFrequency
+
+/*
+ * Benchmarks RC2D (cible rc2d_benchmarks, option CMake RC2D_BUILD_BENCHMARKS).
+ * Ils ne font que mesurer et journaliser (cr_log_info) : les vérifications de comportement
+ * restent dans tests/src, les durées ne sont jamais comparées dans une assertion.
+ */
+
+/* Millisecondes écoulées depuis `start` (valeur de SDL_GetPerformanceCounter) */
+static inline double rc2d_bench_elapsedMs(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+#endif // RC2D_BENCH_H
@@ -0,0 +1,257 @@
+#include <RC2D/RC2D_data.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <rc2d_bench.h>
+
+#if RC2D_DATA_MODULE_ENABLED
+
+#define DATA_BENCH_SIZE (8 * 1024 * 1024)
+#define DATA_SNAPSHOT_COUNT 2000
+
+/* Sauvegarde JSON typique : entités avec champs répétés et valeurs variées */
+static char* make_save_json(size_t size)
+{
+    char* json = (char*)RC2D_malloc(size + 1);
+    cr_assert_not_null(json);
+    size_t pos = 0;
+    Uint32 seed = 1;
+    while (pos < size)
+    {
+        char entity[160];
+        seed = seed * 1103515245u + 12345u;
+        const int len = SDL_snprintf(entity, sizeof(entity), "{\"id\":%u,\"type\":\"enemy_%u\",\"hp\":%u,\"x\":%u.%u,\"y\":%u.%u,\"alive\":%s},\n",
+                                     seed % 100000, (seed >> 8) % 12, (seed >> 4) % 100, (seed >> 12) % 4096, seed % 10,
+                                     (seed >> 16) % 4096, (seed >> 3) % 10, (seed & 1) ? "true" : "false");
+        const size_t copy = SDL_min((size_t)len, size - pos);
+        SDL_memcpy(json + pos, entity, copy);
+        pos += copy;
+    }
+    json[size] = '\0';
+    return json;
+}
+
+/* Tilemap : grandes zones du même tile avec quelques décors */
+static Uint8* make_tilemap(size_t size)
+{
+    Uint8* tiles = (Uint8*)RC2D_malloc(size);
+    cr_assert_not_null(tiles);
+    Uint32 seed = 7;
+    for (size_t i = 0; i < size; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        tiles[i] = ((seed >> 16) % 9 == 0) ? (Uint8)(seed >> 24) : (Uint8)((i / 64) % 6);
+    }
+    return tiles;
+}
+
+/* Snapshot réseau de ~200 octets : même structure, quelques champs qui changent */
+static int make_snapshot(char* out, size_t capacity, Uint32 tick)
+{
+    return SDL_snprintf(out, capacity, "{\"tick\":%u,\"players\":[{\"id\":1,\"x\":%u,\"y\":%u,\"state\":\"running\"},"
+                                       "{\"id\":2,\"x\":%u,\"y\":%u,\"state\":\"idle\"}],\"score\":%u}",
+                        tick, tick * 3 % 640, tick * 7 % 480, tick * 5 % 640, tick * 11 % 480, tick / 10);
+}
+
+static void bench_format(const char* label, const unsigned char* data, size_t size, RC2D_CompressFormat format, int level)
+{
+    RC2D_CompressOptions options = { level, NULL, 0, 0 };
+    Uint64 start = SDL_GetPerformanceCounter();
+    RC2D_CompressedData* compressed = rc2d_data_compressWithOptions(data, size, RC2D_DATA_TYPE_RAW_DATA, format, &options);
+    const double compressMs = rc2d_bench_elapsedMs(start);
+    cr_assert_not_null(compressed);
+
+    start = SDL_GetPerformanceCounter();
+    unsigned char* decompressed = rc2d_data_decompress(compressed);
+    const double decompressMs = rc2d_bench_elapsedMs(start);
+    cr_assert_not_null(decompressed);
+
+    const double mb = (double)size / (1024.0 * 1024.0);
+    cr_log_info("%s level=%d ratio=%.2f compress=%.1f MB/s decompress=%.1f MB/s",
+                label, level, (double)size / (double)compressed->compressedSize, mb * 1000.0 / compressMs, mb * 1000.0 / decompressMs);
+
+    RC2D_safe_free(decompressed);
+    RC2D_safe_free(compressed->data);
+    RC2D_safe_free(compressed);
+}
+
+Test(rc2d_data, bench_lz4_vs_lz4hc) {
+    char* json = make_save_json(DATA_BENCH_SIZE);
+    Uint8* tiles = make_tilemap(DATA_BENCH_SIZE);
+
+    bench_format("save.json LZ4   ", (const unsigned char*)json, DATA_BENCH_SIZE, RC2D_COMPRESS_FORMAT_LZ4, RC2D_COMPRESS_LEVEL_DEFAULT);
+    bench_format("tilemap   LZ4   ", tiles, DATA_BENCH_SIZE, RC2D_COMPRESS_FORMAT_LZ4, RC2D_COMPRESS_LEVEL_DEFAULT);
+    const int levels[] = { RC2D_COMPRESS_LEVEL_HC_MIN, 4, RC2D_COMPRESS_LEVEL_HC_DEFAULT, RC2D_COMPRESS_LEVEL_HC_MAX };
+    for (size_t i = 0; i < SDL_arraysize(levels); i++)
+    {
+        bench_format("save.json LZ4 HC", (const unsigned char*)json, DATA_BENCH_SIZE, RC2D_COMPRESS_FORMAT_LZ4_HC, levels[i]);
+        bench_format("tilemap   LZ4 HC", tiles, DATA_BENCH_SIZE, RC2D_COMPRESS_FORMAT_LZ4_HC, levels[i]);
+    }
+
+    RC2D_free(tiles);
+    RC2D_free(json);
+}
+
+Test(rc2d_data, bench_blocks_threadScaling) {
+    const size_t size = 8 * DATA_BENCH_SIZE;
+    Uint8* tiles = make_tilemap(size);
+
+    const int threadCounts[] = { 1, 2, 4, 0 };
+    for (size_t i = 0; i < SDL_arraysize(threadCounts); i++)
+    {
+        RC2D_CompressOptions options = { RC2D_COMPRESS_LEVEL_DEFAULT, NULL, 0, threadCounts[i] };
+        Uint64 start = SDL_GetPerformanceCounter();
+        RC2D_CompressedData* compressed = rc2d_data_compressWithOptions(tiles, size, RC2D_DATA_TYPE_RAW_DATA, RC2D_COMPRESS_FORMAT_LZ4_BLOCKS, &options);
+        const double compressMs = rc2d_bench_elapsedMs(start);
+        cr_assert_not_null(compressed);
+
+        start = SDL_GetPerformanceCounter();
+        unsigned char* decompressed = rc2d_data_decompressWithOptions(compressed, &options);
+        const double decompressMs = rc2d_bench_elapsedMs(start);
+        cr_assert_not_null(decompressed);
+
+        const double mb = (double)size / (1024.0 * 1024.0);
+        cr_log_info("LZ4 blocks %d MB threads=%d ratio=%.2f compress=%.1f MB/s decompress=%.1f MB/s",
+                    (int)mb, threadCounts[i], (double)size / (double)compressed->compressedSize, mb * 1000.0 / compressMs, mb * 1000.0 / decompressMs);
+
+        RC2D_safe_free(decompressed);
+        RC2D_safe_free(compressed->data);
+        RC2D_safe_free(compressed);
+    }
+
+    RC2D_free(tiles);
+}
+
+Test(rc2d_data, bench_snapshots_withDictionary) {
+    /* Dictionnaire entraîné sur quelques snapshots types */
+    char training[4096];
+    size_t trainingSize = 0;
+    for (Uint32 tick = 0; tick < 16; tick++)
+    {
+        trainingSize += (size_t)make_snapshot(training + trainingSize, sizeof(training) - trainingSize, tick * 37);
+    }
+    RC2D_CompressDictionary* dictionary = rc2d_data_createCompressDictionary(training, trainingSize);
+    cr_assert_not_null(dictionary);
+
+    size_t rawTotal = 0;
+    size_t plainTotal = 0;
+    size_t dictTotal = 0;
+    double plainMs = 0.0;
+    double dictMs = 0.0;
+    RC2D_CompressOptions options = { RC2D_COMPRESS_LEVEL_DEFAULT, dictionary, 0, 0 };
+    for (Uint32 tick = 1000; tick < 1000 + DATA_SNAPSHOT_COUNT; tick++)
+    {
+        char snapshot[256];
+        const size_t size = (size_t)make_snapshot(snapshot, sizeof(snapshot), tick);
+        rawTotal += size;
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        RC2D_CompressedData* plain = rc2d_data_compress((const unsigned char*)snapshot, size, RC2D_DATA_TYPE_RAW_DATA, RC2D_COMPRESS_FORMAT_LZ4);
+        plainMs += rc2d_bench_elapsedMs(start);
+
+        start = SDL_GetPerformanceCounter();
+        RC2D_CompressedData* withDict = rc2d_data_compressWithOptions((const unsigned char*)snapshot, size, RC2D_DATA_TYPE_RAW_DATA, RC2D_COMPRESS_FORMAT_LZ4_DICT, &options);
+        dictMs += rc2d_bench_elapsedMs(start);
+
+        cr_assert_not_null(plain);
+        cr_assert_not_null(withDict);
+        plainTotal += plain->compressedSize;
+        dictTotal += withDict->compressedSize;
+
+        RC2D_safe_free(plain->data);
+        RC2D_safe_free(plain);
+        RC2D_safe_free(withDict->data);
+        RC2D_safe_free(withDict);
+    }
+
+    cr_log_info("%d snapshots (%zu B avg): LZ4 ratio=%.2f (%.2f us/op) LZ4 dict ratio=%.2f (%.2f us/op)",
+                DATA_SNAPSHOT_COUNT, rawTotal / DATA_SNAPSHOT_COUNT,
+                (double)rawTotal / (double)plainTotal, plainMs * 1000.0 / DATA_SNAPSHOT_COUNT,
+                (double)rawTotal / (double)dictTotal, dictMs * 1000.0 / DATA_SNAPSHOT_COUNT);
+
+    rc2d_data_destroyCompressDictionary(dictionary);
+}
+
+Test(rc2d_data, bench_cryptoKey_vs_passphrase) {
+    const char* message = "{\"type\":\"move\",\"x\":12,\"y\":34}";
+    const size_t messageSize = SDL_strlen(message);
+    const int count = 20;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < count; i++)
+    {
+        RC2D_EncryptedData* encrypted = rc2d_data_encrypt((const unsigned char*)message, messageSize, "rc2dtests", RC2D_DATA_TYPE_TEXT, RC2D_CIPHER_FORMAT_AES);
+        cr_assert_not_null(encrypted);
+        rc2d_data_freeSecurity(encrypted);
+    }
+    const double passphraseMs = rc2d_bench_elapsedMs(start);
+
+    start = SDL_GetPerformanceCounter();
+    RC2D_CryptoKey* key = rc2d_data_createCryptoKey("rc2dtests", NULL, RC2D_CIPHER_FORMAT_AES);
+    cr_assert_not_null(key);
+    for (int i = 0; i < count; i++)
+    {
+        RC2D_EncryptedData* encrypted = rc2d_data_encryptWithKey(key, (const unsigned char*)message, messageSize, RC2D_DATA_TYPE_TEXT);
+        cr_assert_not_null(encrypted);
+        rc2d_data_freeSecurity(encrypted);
+    }
+    const double keyMs = rc2d_bench_elapsedMs(start);
+    rc2d_data_destroyCryptoKey(key);
+
+    cr_log_info("%d messages (%zu B): passphrase=%.2f ms/op, cryptoKey=%.2f ms/op (derivation incluse)",
+                count, messageSize, passphraseMs / count, keyMs / count);
+}
+
+Test(rc2d_data, bench_hash_xxh3_vs_openssl) {
+    Uint8* data = (Uint8*)RC2D_malloc(DATA_BENCH_SIZE);
+    cr_assert_not_null(data);
+    for (size_t i = 0; i < DATA_BENCH_SIZE; i++) data[i] = (Uint8)((i * 2654435761u) >> 13);
+
+    const RC2D_HashFormat formats[] = { RC2D_HASHING_FORMAT_MD5, RC2D_HASHING_FORMAT_SHA256, RC2D_HASHING_FORMAT_SHA3_256, RC2D_HASHING_FORMAT_XXH64, RC2D_HASHING_FORMAT_XXH3_64, RC2D_HASHING_FORMAT_XXH3_128 };
+    const char* names[] = { "MD5", "SHA256", "SHA3-256", "XXH64", "XXH3-64", "XXH3-128" };
+    for (size_t f = 0; f < SDL_arraysize(formats); f++)
+    {
+        unsigned char hash[RC2D_HASH_MAX_SIZE];
+        Uint64 start = SDL_GetPerformanceCounter();
+        cr_assert_gt(rc2d_data_hashBytes(data, DATA_BENCH_SIZE, formats[f], hash, sizeof(hash)), 0);
+        const double ms = rc2d_bench_elapsedMs(start);
+        cr_log_info("%-8s : %.1f MB/s", names[f], (DATA_BENCH_SIZE / (1024.0 * 1024.0)) / (ms / 1000.0));
+    }
+
+    RC2D_free(data);
+}
+
+Test(rc2d_data, bench_encode_base64_hex) {
+    Uint8* data = (Uint8*)RC2D_malloc(DATA_BENCH_SIZE);
+    char* encoded = (char*)RC2D_malloc(DATA_BENCH_SIZE * 2);
+    cr_assert_not_null(data);
+    cr_assert_not_null(encoded);
+    for (size_t i = 0; i < DATA_BENCH_SIZE; i++) data[i] = (Uint8)((i * 2654435761u) >> 13);
+
+    const RC2D_EncodeFormat formats[] = { RC2D_ENCODE_FORMAT_BASE64, RC2D_ENCODE_FORMAT_HEX };
+    const char* names[] = { "Base64", "Hex" };
+    for (size_t f = 0; f < SDL_arraysize(formats); f++)
+    {
+        size_t encodedSize = 0;
+        size_t decodedSize = 0;
+        Uint64 start = SDL_GetPerformanceCounter();
+        cr_assert(rc2d_data_encodeTo(data, DATA_BENCH_SIZE, formats[f], encoded, DATA_BENCH_SIZE * 2, &encodedSize));
+        const double encodeMs = rc2d_bench_elapsedMs(start);
+
+        start = SDL_GetPerformanceCounter();
+        cr_assert(rc2d_data_decodeTo(encoded, encodedSize, formats[f], data, DATA_BENCH_SIZE, &decodedSize));
+        const double decodeMs = rc2d_bench_elapsedMs(start);
+        cr_assert_eq(decodedSize, DATA_BENCH_SIZE);
+
+        const double megabytes = DATA_BENCH_SIZE / (1024.0 * 1024.0);
+        cr_log_info("%-6s : encode %.1f MB/s, decode %.1f MB/s", names[f], megabytes / (encodeMs / 1000.0), megabytes / (decodeMs / 1000.0));
+    }
+
+    RC2D_free(encoded);
+    RC2D_free(data);
+}
+
+#endif // RC2D_DATA_MODULE_ENABLED
@@ -0,0 +1,46 @@
+#include <RC2D/RC2D_frame.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <rc2d_bench.h>
+
+#define FRAME_BENCH_FRAMES 100
+#define FRAME_BENCH_ALLOCS 10000
+
+static void frame_teardown(void)
+{
+    rc2d_frame_quit();
+}
+
+Test(rc2d_frame, bench_frameAllocVsMalloc, .fini = frame_teardown) {
+    static void* blocks[FRAME_BENCH_ALLOCS];
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int frame = 0; frame < FRAME_BENCH_FRAMES; frame++)
+    {
+        for (int i = 0; i < FRAME_BENCH_ALLOCS; i++)
+        {
+            blocks[i] = RC2D_malloc(48);
+        }
+        for (int i = 0; i < FRAME_BENCH_ALLOCS; i++)
+        {
+            RC2D_free(blocks[i]);
+        }
+    }
+    const double mallocMs = rc2d_bench_elapsedMs(start);
+
+    start = SDL_GetPerformanceCounter();
+    for (int frame = 0; frame < FRAME_BENCH_FRAMES; frame++)
+    {
+        for (int i = 0; i < FRAME_BENCH_ALLOCS; i++)
+        {
+            blocks[i] = rc2d_frame_alloc(48, 0);
+        }
+        rc2d_frame_endFrame();
+    }
+    const double frameMs = rc2d_bench_elapsedMs(start);
+
+    cr_log_info("%d frames x %d allocations : RC2D_malloc/RC2D_free %.1f ms, rc2d_frame_alloc %.1f ms",
+                FRAME_BENCH_FRAMES, FRAME_BENCH_ALLOCS, mallocMs, frameMs);
+}
@@ -0,0 +1,79 @@
+#include <RC2D/RC2D_graphics.h>
+#include <RC2D/RC2D_internal.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_surface.h>
+
+#include <rc2d_bench.h>
+
+#define BENCH_TARGET_W 1024
+#define BENCH_TARGET_H 768
+#define BENCH_SPRITE_COUNT 10000
+
+static SDL_Surface* target = NULL;
+static RC2D_Image sprite = { NULL };
+
+/* Renderer logiciel sans fenêtre : suffisant pour mesurer le coût par appel. */
+static void setup_software_renderer(void)
+{
+    target = SDL_CreateSurface(BENCH_TARGET_W, BENCH_TARGET_H, SDL_PIXELFORMAT_RGBA8888);
+    cr_assert_not_null(target);
+
+    rc2d_engine_state.renderer = SDL_CreateSoftwareRenderer(target);
+    cr_assert_not_null(rc2d_engine_state.renderer);
+
+    SDL_Surface* pixels = SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_RGBA8888);
+    cr_assert_not_null(pixels);
+    SDL_FillSurfaceRect(pixels, NULL, SDL_MapSurfaceRGBA(pixels, 255, 0, 0, 255));
+    sprite.sdl_texture = SDL_CreateTextureFromSurface(rc2d_engine_state.renderer, pixels);
+    SDL_DestroySurface(pixels);
+    cr_assert_not_null(sprite.sdl_texture);
+}
+
+static void teardown_software_renderer(void)
+{
+    rc2d_graphics_setSpriteBatch(NULL);
+    rc2d_graphics_freeImage(&sprite);
+    SDL_DestroyRenderer(rc2d_engine_state.renderer);
+    rc2d_engine_state.renderer = NULL;
+    SDL_DestroySurface(target);
+    target = NULL;
+}
+
+static void draw_sprites(void)
+{
+    for (int i = 0; i < BENCH_SPRITE_COUNT; ++i)
+    {
+        const float x = (float)((i * 37) % (BENCH_TARGET_W - 32));
+        const float y = (float)((i * 53) % (BENCH_TARGET_H - 32));
+        rc2d_graphics_drawImage(&sprite, x, y, (double)(i % 360), 1.0f, 1.0f, -1.0f, -1.0f, false, false);
+    }
+}
+
+TestSuite(rc2d_graphics, .init = setup_software_renderer, .fini = teardown_software_renderer);
+
+Test(rc2d_graphics, bench_spriteBatch_10k) {
+    /* Immédiat : un SDL_RenderTextureRotated par sprite */
+    Uint64 start = SDL_GetPerformanceCounter();
+    draw_sprites();
+    SDL_RenderPresent(rc2d_engine_state.renderer);
+    const double immediateMs = rc2d_bench_elapsedMs(start);
+
+    /* Batché : un seul SDL_RenderGeometry pour les 10k sprites */
+    RC2D_SpriteBatch* batch = rc2d_graphics_newSpriteBatch(BENCH_SPRITE_COUNT);
+    cr_assert_not_null(batch);
+
+    start = SDL_GetPerformanceCounter();
+    rc2d_graphics_setSpriteBatch(batch);
+    draw_sprites();
+    cr_assert_eq(rc2d_graphics_getSpriteBatchCount(batch), BENCH_SPRITE_COUNT);
+    rc2d_graphics_setSpriteBatch(NULL);
+    SDL_RenderPresent(rc2d_engine_state.renderer);
+    const double batchedMs = rc2d_bench_elapsedMs(start);
+
+    cr_log_info("sprites=%d immediate=%.2f ms batched=%.2f ms (x%.2f)",
+                BENCH_SPRITE_COUNT, immediateMs, batchedMs, batchedMs > 0.0 ? immediateMs / batchedMs : 0.0);
+
+    rc2d_graphics_freeSpriteBatch(batch);
+}
@@ -0,0 +1,51 @@
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_storage.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <rc2d_bench.h>
+
+#define LOGGER_BENCH_FILE "rc2d_logger_bench.log"
+#define LOGGER_BENCH_RECORDS 20000
+
+static void setup_logger(void)
+{
+    cr_assert(rc2d_storage_openUser("RC2DTests", "rc2d_logger"));
+    rc2d_storage_userRemovePath(LOGGER_BENCH_FILE);
+    rc2d_logger_set_console_enabled(false);
+}
+
+static void teardown_logger(void)
+{
+    rc2d_logger_quit();
+    rc2d_logger_set_console_enabled(true);
+    rc2d_storage_userRemovePath(LOGGER_BENCH_FILE);
+    rc2d_storage_closeUser();
+}
+
+TestSuite(rc2d_logger, .init = setup_logger, .fini = teardown_logger);
+
+Test(rc2d_logger, bench_asyncVsSync) {
+    cr_assert(rc2d_logger_set_file_sink(LOGGER_BENCH_FILE, 0, 0));
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < LOGGER_BENCH_RECORDS; i++)
+    {
+        RC2D_log(RC2D_LOG_INFO, "camera x=%f y=%f", i * 0.5, i * 0.25);
+    }
+    const double syncMs = rc2d_bench_elapsedMs(start);
+
+    cr_assert(rc2d_logger_set_async(true));
+    const int dropped = rc2d_logger_get_dropped_count();
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < LOGGER_BENCH_RECORDS; i++)
+    {
+        RC2D_log(RC2D_LOG_INFO, "camera x=%f y=%f", i * 0.5, i * 0.25);
+    }
+    const double asyncMs = rc2d_bench_elapsedMs(start);
+    rc2d_logger_flush();
+
+    cr_log_info("%d messages : synchrone %.1f ms, asynchrone %.1f ms côté appelant (%d perdus, file de %d)",
+                LOGGER_BENCH_RECORDS, syncMs, asyncMs, rc2d_logger_get_dropped_count() - dropped,
+                RC2D_LOGGER_RING_CAPACITY);
+}
@@ -0,0 +1,108 @@
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_thread.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <rc2d_bench.h>
+
+#define MEMORY_THREAD_COUNT 8
+#define MEMORY_THREAD_OPS 200000
+#define MEMORY_LIVE_COUNT 100000
+#define POOL_OBJECT_SIZE 48
+#define POOL_SLOTS 1024
+
+/* Pool partagé par les workers de churn (NULL : SDL_malloc / SDL_free) */
+static RC2D_Pool* churn_pool = NULL;
+
+static int pool_churn_worker(void* data)
+{
+    void* slots[POOL_SLOTS] = { 0 };
+    Uint32 seed = (Uint32)(uintptr_t)data;
+    for (int op = 0; op < MEMORY_THREAD_OPS; op++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const int k = (int)((seed >> 8) & (POOL_SLOTS - 1));
+        if (slots[k] == NULL)
+        {
+            slots[k] = churn_pool ? RC2D_pool_alloc(churn_pool) : SDL_malloc(POOL_OBJECT_SIZE);
+            SDL_memset(slots[k], 0xAB, POOL_OBJECT_SIZE);
+        }
+        else
+        {
+            if (churn_pool) RC2D_pool_free(churn_pool, slots[k]);
+            else SDL_free(slots[k]);
+            slots[k] = NULL;
+        }
+    }
+
+    for (int k = 0; k < POOL_SLOTS; k++)
+    {
+        if (churn_pool) RC2D_pool_free(churn_pool, slots[k]);
+        else SDL_free(slots[k]);
+    }
+    return 0;
+}
+
+/* Lance 'threads' workers de churn et retourne la durée en millisecondes */
+static double run_pool_churn(RC2D_Pool* pool, int threads)
+{
+    RC2D_Thread* workers[MEMORY_THREAD_COUNT];
+    churn_pool = pool;
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < threads; i++)
+    {
+        workers[i] = rc2d_thread_new(pool_churn_worker, "rc2d_pool_churn", (void*)(uintptr_t)(i + 1));
+        cr_assert_not_null(workers[i]);
+    }
+    for (int i = 0; i < threads; i++)
+    {
+        rc2d_thread_wait(workers[i], NULL);
+    }
+    return rc2d_bench_elapsedMs(start);
+}
+
+Test(rc2d_memory, bench_poolVsSDLMalloc) {
+    RC2D_Pool* pool = rc2d_memory_createPool("bench", POOL_OBJECT_SIZE, 0, false);
+    RC2D_Pool* cachedPool = rc2d_memory_createPool("bench_cached", POOL_OBJECT_SIZE, 0, true);
+    cr_assert_not_null(pool);
+    cr_assert_not_null(cachedPool);
+
+    const double mallocSingle = run_pool_churn(NULL, 1);
+    const double poolSingle = run_pool_churn(pool, 1);
+    const double mallocMulti = run_pool_churn(NULL, MEMORY_THREAD_COUNT);
+    const double poolMulti = run_pool_churn(pool, MEMORY_THREAD_COUNT);
+    const double cachedMulti = run_pool_churn(cachedPool, MEMORY_THREAD_COUNT);
+
+    cr_log_info("Churn %d octets, 1 thread x %d ops : SDL_malloc %.1f ms, RC2D_Pool %.1f ms",
+                POOL_OBJECT_SIZE, MEMORY_THREAD_OPS, mallocSingle, poolSingle);
+    cr_log_info("Churn %d octets, %d threads x %d ops : SDL_malloc %.1f ms, RC2D_Pool %.1f ms, RC2D_Pool + cache de thread %.1f ms",
+                POOL_OBJECT_SIZE, MEMORY_THREAD_COUNT, MEMORY_THREAD_OPS, mallocMulti, poolMulti, cachedMulti);
+
+    rc2d_memory_destroyPool(pool);
+    rc2d_memory_destroyPool(cachedPool);
+}
+
+#if RC2D_MEMORY_DEBUG_ENABLED
+
+Test(rc2d_memory, bench_manyLiveAllocations) {
+    void** live = (void**)SDL_malloc(MEMORY_LIVE_COUNT * sizeof(void*));
+    cr_assert_not_null(live);
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < MEMORY_LIVE_COUNT; i++)
+    {
+        live[i] = RC2D_malloc(32);
+    }
+    for (int i = 0; i < MEMORY_LIVE_COUNT; i++)
+    {
+        RC2D_free(live[i]);
+    }
+    const double ms = rc2d_bench_elapsedMs(start);
+
+    cr_log_info("%d allocations vivantes puis libérées (suivi actif) : %.1f ms", MEMORY_LIVE_COUNT, ms);
+    SDL_free(live);
+}
+
+#endif // RC2D_MEMORY_DEBUG_ENABLED
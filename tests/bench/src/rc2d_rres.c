@@ -0,0 +1,195 @@
+#include <RC2D/RC2D_rres.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <monocypher/monocypher.h>
+
+#include <rc2d_bench.h>
+
+#define RRES_TEST_PASSWORD "rc2dtests"
+#define RRES_BENCH_CHUNK_COUNT 500
+
+/* Sans cache, chaque chunk coûte une dérivation Argon2 complète : mesuré sur un sous-ensemble */
+#define RRES_BENCH_UNCACHED_COUNT 20
+
+/* Propriétés en tête des données : propCount + 4 props (layout attendu par l'unpack) */
+#define RRES_PROPS_SIZE 20
+
+#define RRES_IMAGE_BENCH_SIZE 512
+#define RRES_IMAGE_BENCH_ITERATIONS 20
+
+static const uint8_t pack_salt[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+static uint8_t pack_key[32];
+
+/* Même dérivation que rrespacker : Argon2i 16 MB, 3 passes, mot de passe sur 16 octets */
+static void derive_pack_key(void)
+{
+    uint8_t pass[16] = { 0 };
+    SDL_memcpy(pass, RRES_TEST_PASSWORD, SDL_strlen(RRES_TEST_PASSWORD));
+
+    void* workArea = RC2D_malloc(16384 * 1024);
+    cr_assert_not_null(workArea);
+
+    crypto_argon2_config config = { CRYPTO_ARGON2_I, 16384, 3, 1 };
+    crypto_argon2_inputs inputs = { pass, pack_salt, 16, 16 };
+    crypto_argon2_extras extras = { 0 };
+    crypto_argon2(pack_key, 32, workArea, config, inputs, extras);
+    RC2D_free(workArea);
+}
+
+/* Chunk RAWD chiffré XChaCha20 comme le produit rrespacker : données + salt[16] + nonce[24] + MAC[16] */
+static rresResourceChunk make_encrypted_chunk(int index)
+{
+    Uint8 plain[RRES_PROPS_SIZE + 64];
+    const unsigned int payloadSize = sizeof(plain) - RRES_PROPS_SIZE;
+    const int props[5] = { 4, (int)payloadSize, 0, 0, 0 };
+    SDL_memcpy(plain, props, sizeof(props));
+    for (unsigned int i = 0; i < payloadSize; ++i) plain[RRES_PROPS_SIZE + i] = (Uint8)(index + i);
+
+    uint8_t nonce[24] = { 0 };
+    SDL_memcpy(nonce, &index, sizeof(index));
+
+    rresResourceChunk chunk = { 0 };
+    SDL_memcpy(chunk.info.type, "RAWD", 4);
+    chunk.info.id = index;
+    chunk.info.cipherType = RRES_CIPHER_XCHACHA20_POLY1305;
+    chunk.info.compType = RRES_COMP_NONE;
+    chunk.info.baseSize = sizeof(plain);
+    chunk.info.packedSize = sizeof(plain) + 16 + 24 + 16;
+
+    Uint8* packed = (Uint8*)RC2D_malloc(chunk.info.packedSize);
+    cr_assert_not_null(packed);
+    crypto_aead_lock(packed, packed + sizeof(plain) + 16 + 24, pack_key, nonce, NULL, 0, plain, sizeof(plain));
+    SDL_memcpy(packed + sizeof(plain), pack_salt, 16);
+    SDL_memcpy(packed + sizeof(plain) + 16, nonce, 24);
+    chunk.data.raw = packed;
+    return chunk;
+}
+
+/* Déchiffre 'count' chunks et vérifie leur contenu, renvoie le temps écoulé en ms */
+static double unpack_chunks(int count)
+{
+    const Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < count; ++i)
+    {
+        rresResourceChunk chunk = make_encrypted_chunk(i);
+        cr_assert_eq(rc2d_rres_unpackResourceChunk(&chunk), 0);
+        cr_assert_eq(chunk.data.props[0], 64);
+        cr_assert_eq(((Uint8*)chunk.data.raw)[1], (Uint8)(i + 1));
+        rresUnloadResourceChunk(chunk);
+    }
+    return rc2d_bench_elapsedMs(start);
+}
+
+static void setup_rres(void)
+{
+    derive_pack_key();
+    rc2d_rres_setCipherPassword(RRES_TEST_PASSWORD);
+}
+
+static void teardown_rres(void)
+{
+    rc2d_rres_setKeyCacheEnabled(true);
+    rc2d_rres_cleanCipherPassword();
+}
+
+TestSuite(rc2d_rres, .init = setup_rres, .fini = teardown_rres);
+
+Test(rc2d_rres, bench_unpackEncryptedChunks_keyCache) {
+    /* Avant : une dérivation Argon2 par chunk */
+    rc2d_rres_setKeyCacheEnabled(false);
+    const double uncachedMs = unpack_chunks(RRES_BENCH_UNCACHED_COUNT);
+
+    /* Après : salt partagé par le pack, une seule dérivation */
+    rc2d_rres_setKeyCacheEnabled(true);
+    const double cachedMs = unpack_chunks(RRES_BENCH_CHUNK_COUNT);
+
+    const double uncachedPackMs = uncachedMs * RRES_BENCH_CHUNK_COUNT / RRES_BENCH_UNCACHED_COUNT;
+    cr_log_info("%d encrypted chunks: without key cache ~%.0f ms (%.2f ms/chunk, measured on %d), with key cache %.2f ms (x%.0f)",
+                RRES_BENCH_CHUNK_COUNT, uncachedPackMs, uncachedMs / RRES_BENCH_UNCACHED_COUNT, RRES_BENCH_UNCACHED_COUNT,
+                cachedMs, uncachedPackMs / cachedMs);
+}
+
+static SDL_Surface* image_target = NULL;
+
+/* Chunk IMGE non compressé : props { largeur, hauteur, format, mipmaps } + pixels copiés */
+static rresResourceChunk make_image_chunk(Uint32 width, Uint32 height, int format, const void* pixels, unsigned int size)
+{
+    rresResourceChunk chunk = { 0 };
+    SDL_memcpy(chunk.info.type, "IMGE", 4);
+    chunk.info.baseSize = chunk.info.packedSize = 4 + 4 * 4 + size;
+    chunk.data.propCount = 4;
+    chunk.data.props = (unsigned int*)RC2D_malloc(4 * sizeof(unsigned int));
+    cr_assert_not_null(chunk.data.props);
+    chunk.data.props[0] = width;
+    chunk.data.props[1] = height;
+    chunk.data.props[2] = (unsigned int)format;
+    chunk.data.props[3] = 1;
+    chunk.data.raw = RC2D_malloc(size);
+    cr_assert_not_null(chunk.data.raw);
+    SDL_memcpy(chunk.data.raw, pixels, size);
+    return chunk;
+}
+
+static void setup_rres_image(void)
+{
+    image_target = SDL_CreateSurface(RRES_IMAGE_BENCH_SIZE, RRES_IMAGE_BENCH_SIZE, SDL_PIXELFORMAT_RGBA32);
+    cr_assert_not_null(image_target);
+    rc2d_engine_state.renderer = SDL_CreateSoftwareRenderer(image_target);
+    cr_assert_not_null(rc2d_engine_state.renderer);
+}
+
+static void teardown_rres_image(void)
+{
+    SDL_DestroyRenderer(rc2d_engine_state.renderer);
+    rc2d_engine_state.renderer = NULL;
+    SDL_DestroySurface(image_target);
+    image_target = NULL;
+}
+
+TestSuite(rc2d_rres_image, .init = setup_rres_image, .fini = teardown_rres_image);
+
+Test(rc2d_rres_image, bench_loadImageFromChunk_vs_png) {
+    const unsigned int size = RRES_IMAGE_BENCH_SIZE * RRES_IMAGE_BENCH_SIZE * 4;
+    SDL_Surface* source = SDL_CreateSurface(RRES_IMAGE_BENCH_SIZE, RRES_IMAGE_BENCH_SIZE, SDL_PIXELFORMAT_RGBA32);
+    cr_assert_not_null(source);
+    Uint8* pixels = (Uint8*)source->pixels;
+    for (unsigned int i = 0; i < size; ++i) pixels[i] = (Uint8)((i * 7) ^ (i >> 9));
+
+    /* Même image encodée en PNG, en mémoire */
+    SDL_IOStream* png = SDL_IOFromDynamicMem();
+    cr_assert_not_null(png);
+    cr_assert(IMG_SavePNG_IO(source, png, false));
+    const Sint64 pngSize = SDL_TellIO(png);
+    void* pngData = SDL_GetPointerProperty(SDL_GetIOProperties(png), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+    cr_assert_not_null(pngData);
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < RRES_IMAGE_BENCH_ITERATIONS; ++i)
+    {
+        SDL_Texture* texture = IMG_LoadTexture_IO(rc2d_engine_state.renderer, SDL_IOFromConstMem(pngData, (size_t)pngSize), true);
+        cr_assert_not_null(texture);
+        SDL_DestroyTexture(texture);
+    }
+    const double pngMs = rc2d_bench_elapsedMs(start);
+
+    rresResourceChunk chunk = make_image_chunk(RRES_IMAGE_BENCH_SIZE, RRES_IMAGE_BENCH_SIZE, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, pixels, size);
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < RRES_IMAGE_BENCH_ITERATIONS; ++i)
+    {
+        RC2D_Image image = rc2d_rres_loadImageFromChunk(chunk);
+        cr_assert_not_null(image.sdl_texture);
+        rc2d_graphics_freeImage(&image);
+    }
+    const double rresMs = rc2d_bench_elapsedMs(start);
+
+    cr_log_info("%dx%d RGBA, %d loads: PNG decode %.2f ms/image (%lld bytes), rres chunk %.2f ms/image (x%.1f)",
+                RRES_IMAGE_BENCH_SIZE, RRES_IMAGE_BENCH_SIZE, RRES_IMAGE_BENCH_ITERATIONS,
+                pngMs / RRES_IMAGE_BENCH_ITERATIONS, (long long)pngSize, rresMs / RRES_IMAGE_BENCH_ITERATIONS, pngMs / rresMs);
+
+    rresUnloadResourceChunk(chunk);
+    SDL_CloseIO(png);
+    SDL_DestroySurface(source);
+}
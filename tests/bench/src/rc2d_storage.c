@@ -0,0 +1,85 @@
+#include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
+
+#include <rc2d_bench.h>
+
+#define STORAGE_BENCH_DIR "rc2d_storage_bench/"
+#define BENCH_FILE_SIZE (32 * 1024 * 1024)
+
+/* RSS anonyme courant (heap, hors pages de fichiers mappés) en Ko ; 0 hors Linux. */
+static long rss_anon_kb(void)
+{
+    long kb = 0;
+#ifdef __linux__
+    size_t len = 0;
+    char* status = (char*)SDL_LoadFile("/proc/self/status", &len);
+    const char* line = status ? SDL_strstr(status, "RssAnon:") : NULL;
+    if (line) kb = SDL_strtol(line + 8, NULL, 10);
+    SDL_free(status);
+#endif
+    return kb;
+}
+
+/* Somme des octets : force le chargement de toutes les pages, comme un décodeur */
+static Uint64 touch_all(const void* data, Uint64 len)
+{
+    const Uint8* p = (const Uint8*)data;
+    Uint64 sum = 0;
+    for (Uint64 i = 0; i < len; i += 64) sum += p[i];
+    return sum;
+}
+
+static void setup_storage(void)
+{
+    cr_assert(SDL_CreateDirectory(STORAGE_BENCH_DIR));
+
+    Uint8* content = (Uint8*)RC2D_malloc(BENCH_FILE_SIZE);
+    cr_assert_not_null(content);
+    for (int i = 0; i < BENCH_FILE_SIZE; ++i) content[i] = (Uint8)(i * 31);
+    cr_assert(SDL_SaveFile(STORAGE_BENCH_DIR "big.bin", content, BENCH_FILE_SIZE));
+    RC2D_free(content);
+
+    cr_assert(rc2d_storage_openTitle(STORAGE_BENCH_DIR));
+}
+
+static void teardown_storage(void)
+{
+    rc2d_storage_closeTitle();
+    SDL_RemovePath(STORAGE_BENCH_DIR "big.bin");
+    SDL_RemovePath(STORAGE_BENCH_DIR);
+}
+
+TestSuite(rc2d_storage, .init = setup_storage, .fini = teardown_storage);
+
+Test(rc2d_storage, bench_mapFile_vs_readFile) {
+    /* Lecture complète : buffer heap de la taille du fichier + copie */
+    const long anonBefore = rss_anon_kb();
+    Uint64 start = SDL_GetPerformanceCounter();
+    void* bytes = NULL;
+    Uint64 len = 0;
+    cr_assert(rc2d_storage_titleReadFile("big.bin", &bytes, &len));
+    const Uint64 sumRead = touch_all(bytes, len);
+    const double readMs = rc2d_bench_elapsedMs(start);
+    const long readAnonKb = rss_anon_kb() - anonBefore;
+    RC2D_free(bytes);
+
+    /* Mapping : pages du page cache, aucune allocation */
+    const long anonBeforeMap = rss_anon_kb();
+    start = SDL_GetPerformanceCounter();
+    RC2D_StorageMapping file;
+    cr_assert(rc2d_storage_titleMapFile("big.bin", &file));
+    const Uint64 sumMap = touch_all(file.data, file.len);
+    const double mapMs = rc2d_bench_elapsedMs(start);
+    const long mapAnonKb = rss_anon_kb() - anonBeforeMap;
+    const bool mapped = file._map_addr != NULL;
+    rc2d_storage_unmapFile(&file);
+
+    cr_assert_eq(sumRead, sumMap);
+    cr_log_info("file=%d MB readFile=%.2f ms (+%ld KB heap) mapFile=%.2f ms (+%ld KB heap, mmap=%s)",
+                BENCH_FILE_SIZE / (1024 * 1024), readMs, readAnonKb, mapMs, mapAnonKb, mapped ? "yes" : "no");
+}
@@ -0,0 +1,86 @@
+#include <RC2D/RC2D_texturepacker.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <rc2d_bench.h>
+
+#define BENCH_LOOKUPS 100000
+
+/* Construit un atlas en mémoire de `n` frames nommées "frame_<i>.png" (sans texture). */
+static RC2D_TP_Atlas make_atlas(int n)
+{
+    RC2D_TP_Atlas atlas = {0};
+    atlas.frames = (RC2D_TP_Frame*)RC2D_calloc((size_t)n, sizeof(RC2D_TP_Frame));
+    atlas._name_pool = (char*)RC2D_malloc((size_t)n * 24);
+    cr_assert_not_null(atlas.frames);
+    cr_assert_not_null(atlas._name_pool);
+
+    char* pool = atlas._name_pool;
+    for (int i = 0; i < n; ++i)
+    {
+        const int len = SDL_snprintf(pool, 24, "frame_%d.png", i);
+        atlas.frames[i].filename = pool;
+        atlas.frames[i].frame = (SDL_FRect){ (float)i, 0.0f, 16.0f, 16.0f };
+        pool += len + 1;
+    }
+    atlas.frame_count = n;
+    return atlas;
+}
+
+/* Référence : l'ancienne recherche linéaire par SDL_strcmp. */
+static const RC2D_TP_Frame* linear_find(const RC2D_TP_Atlas* atlas, const char* name)
+{
+    for (int i = 0; i < atlas->frame_count; ++i)
+    {
+        if (SDL_strcmp(atlas->frames[i].filename, name) == 0) return &atlas->frames[i];
+    }
+    return NULL;
+}
+
+static void bench_atlas(int n)
+{
+    RC2D_TP_Atlas atlas = make_atlas(n);
+    cr_assert(rc2d_tp_buildFrameIndex(&atlas));
+
+    /* Noms recherchés (pré-formatés pour ne mesurer que la recherche) */
+    char (*names)[24] = RC2D_malloc(sizeof(*names) * 64);
+    cr_assert_not_null(names);
+    for (int i = 0; i < 64; ++i) SDL_snprintf(names[i], 24, "frame_%d.png", (i * 7919) % n);
+
+    const int linearLookups = n >= 10000 ? BENCH_LOOKUPS / 100 : BENCH_LOOKUPS;
+    const RC2D_TP_Frame* volatile sink = NULL;
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < linearLookups; ++i) sink = linear_find(&atlas, names[i & 63]);
+    const double linearNs = rc2d_bench_elapsedMs(start) * 1e6 / linearLookups;
+
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < BENCH_LOOKUPS; ++i) sink = rc2d_tp_getFrame(&atlas, names[i & 63]);
+    const double hashedNs = rc2d_bench_elapsedMs(start) * 1e6 / BENCH_LOOKUPS;
+
+    const RC2D_TP_FrameHandle handle = rc2d_tp_getFrameHandle(&atlas, names[0]);
+    start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < BENCH_LOOKUPS; ++i) sink = rc2d_tp_getFrameByHandle(&atlas, handle);
+    const double handleNs = rc2d_bench_elapsedMs(start) * 1e6 / BENCH_LOOKUPS;
+    (void)sink;
+
+    cr_log_info("frames=%d linear=%.1f ns hashed=%.1f ns handle=%.1f ns", n, linearNs, hashedNs, handleNs);
+
+    RC2D_free(names);
+    rc2d_tp_freeAtlas(&atlas);
+}
+
+Test(rc2d_texturepacker, bench_getFrame_10) {
+    bench_atlas(10);
+}
+
+Test(rc2d_texturepacker, bench_getFrame_1k) {
+    bench_atlas(1000);
+}
+
+Test(rc2d_texturepacker, bench_getFrame_10k) {
+    bench_atlas(10000);
+}
@@ -0,0 +1,201 @@
+#include <RC2D/RC2D_assetcache.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_storage.h>
+#include <criterion/criterion.h>
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_surface.h>
+
+#define ASSETCACHE_TEST_DIR "rc2d_assetcache_test/"
+#define ASSETCACHE_IMAGE_COUNT 4
+
+/* Taille d'une texture de test en RGBA8888 (16x16) */
+#define ASSETCACHE_IMAGE_BYTES (16 * 16 * 4)
+
+static SDL_Surface* target = NULL;
+
+static void image_path(int i, char* out, size_t cap)
+{
+    SDL_snprintf(out, cap, "img_%d.bmp", i);
+}
+
+static void setup_assetcache(void)
+{
+    target = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA8888);
+    cr_assert_not_null(target);
+    rc2d_engine_state.renderer = SDL_CreateSoftwareRenderer(target);
+    cr_assert_not_null(rc2d_engine_state.renderer);
+
+    cr_assert(SDL_CreateDirectory(ASSETCACHE_TEST_DIR));
+    for (int i = 0; i < ASSETCACHE_IMAGE_COUNT; ++i)
+    {
+        SDL_Surface* pixels = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_RGBA8888);
+        cr_assert_not_null(pixels);
+        char name[64], path[128];
+        image_path(i, name, sizeof(name));
+        SDL_snprintf(path, sizeof(path), ASSETCACHE_TEST_DIR "%s", name);
+        cr_assert(SDL_SaveBMP(pixels, path));
+        SDL_DestroySurface(pixels);
+    }
+    cr_assert(rc2d_storage_openTitle(ASSETCACHE_TEST_DIR));
+    rc2d_assetcache_setBudget(RC2D_ASSETCACHE_DEFAULT_BUDGET_BYTES);
+}
+
+static void teardown_assetcache(void)
+{
+    rc2d_assetcache_destroyAll();
+    rc2d_storage_closeTitle();
+    for (int i = 0; i < ASSETCACHE_IMAGE_COUNT; ++i)
+    {
+        char name[64], path[128];
+        image_path(i, name, sizeof(name));
+        SDL_snprintf(path, sizeof(path), ASSETCACHE_TEST_DIR "%s", name);
+        SDL_RemovePath(path);
+    }
+    SDL_RemovePath(ASSETCACHE_TEST_DIR);
+    SDL_DestroyRenderer(rc2d_engine_state.renderer);
+    rc2d_engine_state.renderer = NULL;
+    SDL_DestroySurface(target);
+    target = NULL;
+}
+
+TestSuite(rc2d_assetcache, .init = setup_assetcache, .fini = teardown_assetcache);
+
+Test(rc2d_assetcache, acquire_sharesSameEntry) {
+    RC2D_CachedAsset* a = rc2d_assetcache_acquireImage("img_0.bmp", RC2D_STORAGE_TITLE);
+    RC2D_CachedAsset* b = rc2d_assetcache_acquireImage("img_0.bmp", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(a);
+    cr_assert_eq(a, b);
+    cr_assert_eq(rc2d_assetcache_getImage(a).sdl_texture, rc2d_assetcache_getImage(b).sdl_texture);
+
+    /* Même fichier, autre type : autre entrée */
+    RC2D_CachedAsset* data = rc2d_assetcache_acquireImageData("img_0.bmp", RC2D_STORAGE_TITLE);
+    cr_assert_neq(data, a);
+    cr_assert_null(rc2d_assetcache_getImage(data).sdl_texture);
+    cr_assert_not_null(rc2d_assetcache_getImageData(data).sdl_surface);
+
+    RC2D_AssetCacheStats stats;
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.hits, 1);
+    cr_assert_eq(stats.misses, 2);
+    cr_assert_eq(stats.entry_count, 2);
+    cr_assert_eq(stats.referenced_count, 2);
+    cr_assert_gt(stats.bytes_resident, 0);
+
+    rc2d_assetcache_release(a);
+    rc2d_assetcache_release(b);
+    rc2d_assetcache_release(data);
+
+    /* Non référencées mais toujours en mémoire (sous le budget) */
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.entry_count, 2);
+    cr_assert_eq(stats.referenced_count, 0);
+}
+
+Test(rc2d_assetcache, acquireImage_reusesCachedImageData) {
+    RC2D_CachedAsset* data = rc2d_assetcache_acquireImageData("img_1.bmp", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(data);
+
+    /* Le fichier disparaît du storage : seule la surface en cache permet de créer la texture */
+    rc2d_storage_closeTitle();
+    RC2D_CachedAsset* image = rc2d_assetcache_acquireImage("img_1.bmp", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(image);
+    cr_assert_eq(rc2d_assetcache_getImage(image).sdl_texture->w, 16);
+    cr_assert(rc2d_storage_openTitle(ASSETCACHE_TEST_DIR));
+
+    rc2d_assetcache_release(image);
+    rc2d_assetcache_release(data);
+}
+
+Test(rc2d_assetcache, acquireImageWithHitMask_sharesTexture) {
+    RC2D_CachedAsset* image = rc2d_assetcache_acquireImage("img_2.bmp", RC2D_STORAGE_TITLE);
+    RC2D_CachedAsset* masked = rc2d_assetcache_acquireImageWithHitMask("img_2.bmp", RC2D_STORAGE_TITLE, 0x80);
+    RC2D_CachedAsset* other = rc2d_assetcache_acquireImageWithHitMask("img_2.bmp", RC2D_STORAGE_TITLE, 0x10);
+    cr_assert_not_null(image);
+    cr_assert_eq(masked, image);
+    cr_assert_eq(other, image);
+
+    /* Un masque par seuil, sur la même texture */
+    const RC2D_HitMask* mask = rc2d_assetcache_getHitMask(image, 0x80);
+    cr_assert_not_null(mask);
+    cr_assert_eq(mask->w, 16);
+    cr_assert_not_null(rc2d_assetcache_getHitMask(image, 0x10));
+    cr_assert_neq(rc2d_assetcache_getHitMask(image, 0x10), mask);
+    cr_assert_null(rc2d_assetcache_getHitMask(image, 0x20));
+
+    RC2D_AssetCacheStats stats;
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.misses, 1);
+    cr_assert_eq(stats.entry_count, 1);
+    cr_assert_eq(stats.bytes_resident, ASSETCACHE_IMAGE_BYTES + 2 * 2 * 16);
+
+    rc2d_assetcache_release(image);
+    rc2d_assetcache_release(masked);
+    rc2d_assetcache_release(other);
+}
+
+Test(rc2d_assetcache, budget_evictsLeastRecentlyReleased) {
+    rc2d_assetcache_setBudget(2 * ASSETCACHE_IMAGE_BYTES);
+
+    RC2D_CachedAsset* assets[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        char name[64];
+        image_path(i, name, sizeof(name));
+        assets[i] = rc2d_assetcache_acquireImage(name, RC2D_STORAGE_TITLE);
+        cr_assert_not_null(assets[i]);
+    }
+
+    /* Toutes référencées : le budget est dépassé mais rien n'est évincé */
+    RC2D_AssetCacheStats stats;
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.entry_count, 3);
+    cr_assert_eq(stats.bytes_resident, 3 * ASSETCACHE_IMAGE_BYTES);
+
+    /* img_1 rendue en premier : c'est elle qui part */
+    rc2d_assetcache_release(assets[1]);
+    rc2d_assetcache_release(assets[0]);
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.evictions, 1);
+    cr_assert_eq(stats.entry_count, 2);
+    cr_assert_eq(stats.bytes_resident, 2 * ASSETCACHE_IMAGE_BYTES);
+
+    /* img_0 est toujours là (hit), img_1 doit être rechargée (miss) */
+    rc2d_assetcache_resetStats();
+    RC2D_CachedAsset* again0 = rc2d_assetcache_acquireImage("img_0.bmp", RC2D_STORAGE_TITLE);
+    RC2D_CachedAsset* again1 = rc2d_assetcache_acquireImage("img_1.bmp", RC2D_STORAGE_TITLE);
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.hits, 1);
+    cr_assert_eq(stats.misses, 1);
+
+    rc2d_assetcache_release(again0);
+    rc2d_assetcache_release(again1);
+    rc2d_assetcache_release(assets[2]);
+}
+
+Test(rc2d_assetcache, zeroBudget_freesOnLastRelease) {
+    rc2d_assetcache_setBudget(0);
+
+    RC2D_CachedAsset* asset = rc2d_assetcache_acquireImage("img_2.bmp", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(asset);
+    cr_assert_eq(rc2d_assetcache_retain(asset), asset);
+
+    rc2d_assetcache_release(asset);
+    RC2D_AssetCacheStats stats;
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.entry_count, 1);
+
+    rc2d_assetcache_release(asset);
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.entry_count, 0);
+    cr_assert_eq(stats.bytes_resident, 0);
+}
+
+Test(rc2d_assetcache, missingFile_returnsNull) {
+    cr_assert_null(rc2d_assetcache_acquireImage("missing.bmp", RC2D_STORAGE_TITLE));
+
+    RC2D_AssetCacheStats stats;
+    rc2d_assetcache_getStats(&stats);
+    cr_assert_eq(stats.misses, 1);
+    cr_assert_eq(stats.entry_count, 0);
+}
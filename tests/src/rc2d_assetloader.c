@@ -0,0 +1,192 @@
+#include <RC2D/RC2D_assetloader.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_storage.h>
+#include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_surface.h>
+#include <SDL3/SDL_timer.h>
+
+#define ASSETLOADER_TEST_DIR "rc2d_assetloader_test/"
+#define ASSETLOADER_IMAGE_COUNT 8
+
+static SDL_Surface* target = NULL;
+
+static void image_path(int i, char* out, size_t cap)
+{
+    SDL_snprintf(out, cap, "img_%d.bmp", i);
+}
+
+/* Renderer logiciel + storage Title ouvert sur un dossier d'images BMP générées. */
+static void setup_assetloader(void)
+{
+    target = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA8888);
+    cr_assert_not_null(target);
+    rc2d_engine_state.renderer = SDL_CreateSoftwareRenderer(target);
+    cr_assert_not_null(rc2d_engine_state.renderer);
+
+    cr_assert(SDL_CreateDirectory(ASSETLOADER_TEST_DIR));
+    for (int i = 0; i < ASSETLOADER_IMAGE_COUNT; ++i)
+    {
+        SDL_Surface* pixels = SDL_CreateSurface(16 + i, 8 + i, SDL_PIXELFORMAT_RGBA8888);
+        cr_assert_not_null(pixels);
+        char name[64], path[128];
+        image_path(i, name, sizeof(name));
+        SDL_snprintf(path, sizeof(path), ASSETLOADER_TEST_DIR "%s", name);
+        cr_assert(SDL_SaveBMP(pixels, path));
+        SDL_DestroySurface(pixels);
+    }
+    cr_assert(rc2d_storage_openTitle(ASSETLOADER_TEST_DIR));
+}
+
+static void teardown_assetloader(void)
+{
+    rc2d_storage_closeTitle();
+    for (int i = 0; i < ASSETLOADER_IMAGE_COUNT; ++i)
+    {
+        char name[64], path[128];
+        image_path(i, name, sizeof(name));
+        SDL_snprintf(path, sizeof(path), ASSETLOADER_TEST_DIR "%s", name);
+        SDL_RemovePath(path);
+    }
+    SDL_RemovePath(ASSETLOADER_TEST_DIR);
+    SDL_DestroyRenderer(rc2d_engine_state.renderer);
+    rc2d_engine_state.renderer = NULL;
+    SDL_DestroySurface(target);
+    target = NULL;
+}
+
+static void count_completion(RC2D_AssetHandle* handle, void* userdata)
+{
+    (void)handle;
+    (*(int*)userdata)++;
+}
+
+/* Attend que les workers aient tout décodé, sans rien finaliser. */
+static void wait_decoded(RC2D_AssetHandle** handles, int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        while (rc2d_assetloader_getState(handles[i]) != RC2D_ASSET_STATE_DECODED) SDL_Delay(1);
+    }
+}
+
+TestSuite(rc2d_assetloader, .init = setup_assetloader, .fini = teardown_assetloader);
+
+Test(rc2d_assetloader, loadImages_completesWithCallbacks) {
+    RC2D_AssetLoader* loader = rc2d_assetloader_create(2, RC2D_ASSETLOADER_DEFAULT_UPLOAD_BUDGET_MS);
+    cr_assert_not_null(loader);
+
+    int completed = 0;
+    RC2D_AssetHandle* handles[ASSETLOADER_IMAGE_COUNT];
+    for (int i = 0; i < ASSETLOADER_IMAGE_COUNT; ++i)
+    {
+        char name[64];
+        image_path(i, name, sizeof(name));
+        handles[i] = rc2d_assetloader_loadImage(loader, name, RC2D_STORAGE_TITLE, count_completion, &completed);
+        cr_assert_not_null(handles[i]);
+    }
+    cr_assert_eq(rc2d_assetloader_getPendingCount(loader), ASSETLOADER_IMAGE_COUNT);
+
+    rc2d_assetloader_waitAll(loader);
+    cr_assert_eq(completed, ASSETLOADER_IMAGE_COUNT);
+    cr_assert_float_eq(rc2d_assetloader_getProgress(loader), 1.0f, 1e-6);
+
+    for (int i = 0; i < ASSETLOADER_IMAGE_COUNT; ++i)
+    {
+        cr_assert_eq(rc2d_assetloader_getState(handles[i]), RC2D_ASSET_STATE_READY);
+        cr_assert_float_eq(rc2d_assetloader_getHandleProgress(handles[i]), 1.0f, 1e-6);
+
+        RC2D_Image image = rc2d_assetloader_getImage(handles[i]);
+        cr_assert_not_null(image.sdl_texture);
+        cr_assert_eq(image.sdl_texture->w, 16 + i);
+        cr_assert_eq(image.sdl_texture->h, 8 + i);
+
+        rc2d_graphics_freeImage(&image);
+        rc2d_assetloader_releaseHandle(handles[i]);
+    }
+
+    rc2d_assetloader_destroy(loader);
+}
+
+Test(rc2d_assetloader, update_respectsUploadBudget) {
+    /* Budget quasi nul : une seule texture créée par frame */
+    RC2D_AssetLoader* loader = rc2d_assetloader_create(2, 1e-9);
+    cr_assert_not_null(loader);
+
+    RC2D_AssetHandle* handles[4];
+    for (int i = 0; i < 4; ++i)
+    {
+        char name[64];
+        image_path(i, name, sizeof(name));
+        handles[i] = rc2d_assetloader_loadImage(loader, name, RC2D_STORAGE_TITLE, NULL, NULL);
+    }
+    wait_decoded(handles, 4);
+
+    cr_assert_eq(rc2d_assetloader_update(loader), 1);
+    cr_assert_eq(rc2d_assetloader_getPendingCount(loader), 3);
+    cr_assert_float_eq(rc2d_assetloader_getProgress(loader), 0.25f, 1e-6);
+
+    /* Sans budget : tout le reste est finalisé en un appel */
+    rc2d_assetloader_setUploadBudget(loader, 0.0);
+    cr_assert_eq(rc2d_assetloader_update(loader), 3);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        RC2D_Image image = rc2d_assetloader_getImage(handles[i]);
+        rc2d_graphics_freeImage(&image);
+    }
+    rc2d_assetloader_destroy(loader);
+}
+
+Test(rc2d_assetloader, loadImageData_keepsSurfaceOnCpu) {
+    RC2D_AssetLoader* loader = rc2d_assetloader_create(1, 0.0);
+    cr_assert_not_null(loader);
+
+    RC2D_AssetHandle* handle = rc2d_assetloader_loadImageData(loader, "img_3.bmp", RC2D_STORAGE_TITLE, NULL, NULL);
+    rc2d_assetloader_waitAll(loader);
+
+    RC2D_ImageData data = rc2d_assetloader_getImageData(handle);
+    cr_assert_not_null(data.sdl_surface);
+    cr_assert_eq(data.sdl_surface->w, 19);
+    cr_assert_null(rc2d_assetloader_getImage(handle).sdl_texture);
+
+    rc2d_graphics_freeImageData(&data);
+    rc2d_assetloader_destroy(loader);
+}
+
+Test(rc2d_assetloader, missingFile_fails) {
+    RC2D_AssetLoader* loader = rc2d_assetloader_create(1, 0.0);
+    cr_assert_not_null(loader);
+
+    int completed = 0;
+    RC2D_AssetHandle* handle = rc2d_assetloader_loadImage(loader, "missing.bmp", RC2D_STORAGE_TITLE, count_completion, &completed);
+    rc2d_assetloader_waitAll(loader);
+
+    cr_assert_eq(completed, 1);
+    cr_assert_eq(rc2d_assetloader_getState(handle), RC2D_ASSET_STATE_FAILED);
+    cr_assert_null(rc2d_assetloader_getImage(handle).sdl_texture);
+
+    rc2d_assetloader_destroy(loader);
+}
+
+Test(rc2d_assetloader, releaseBeforeDone_discardsResult) {
+    RC2D_AssetLoader* loader = rc2d_assetloader_create(1, 0.0);
+    cr_assert_not_null(loader);
+
+    int completed = 0;
+    for (int i = 0; i < ASSETLOADER_IMAGE_COUNT; ++i)
+    {
+        char name[64];
+        image_path(i, name, sizeof(name));
+        rc2d_assetloader_releaseHandle(rc2d_assetloader_loadImage(loader, name, RC2D_STORAGE_TITLE, count_completion, &completed));
+    }
+    rc2d_assetloader_waitAll(loader);
+
+    /* Les textures ont été détruites et aucune callback n'a été appelée */
+    cr_assert_eq(completed, 0);
+    cr_assert_eq(rc2d_assetloader_getPendingCount(loader), 0);
+
+    rc2d_assetloader_destroy(loader);
+}
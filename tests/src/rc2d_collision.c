@@ -1,5 +1,8 @@
 #include <RC2D/RC2D_collision.h>
 #include <criterion/criterion.h>
+#include <criterion/logging.h>
+
+#include <SDL3/SDL_surface.h>
 
 Test(rc2d_collision, pointInAABB_inside) {
     RC2D_Point point = {5, 5};
@@ -59,4 +62,60 @@ Test(rc2d_collision, betweenAABBCircle_no_overlap) {
     RC2D_AABB box = {0, 0, 10, 10};
     RC2D_Circle circle = {20, 20, 3};
     cr_assert_not(rc2d_collision_betweenAABBCircle(box, circle));
-}
\ No newline at end of file
+}
+
+/* Surface 20x10 : moitié gauche opaque, moitié droite transparente */
+static RC2D_ImageData make_half_opaque(SDL_PixelFormat format)
+{
+    RC2D_ImageData data = { SDL_CreateSurface(20, 10, format) };
+    cr_assert_not_null(data.sdl_surface);
+    SDL_FillSurfaceRect(data.sdl_surface, NULL, SDL_MapSurfaceRGBA(data.sdl_surface, 0, 0, 0, 0));
+    SDL_Rect left = { 0, 0, 10, 10 };
+    SDL_FillSurfaceRect(data.sdl_surface, &left, SDL_MapSurfaceRGBA(data.sdl_surface, 255, 255, 255, 255));
+    return data;
+}
+
+Test(rc2d_collision, hitMask_matchesAlpha) {
+    const SDL_PixelFormat formats[] = { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB4444 };
+    for (size_t f = 0; f < SDL_arraysize(formats); ++f)
+    {
+        RC2D_ImageData data = make_half_opaque(formats[f]);
+        RC2D_HitMask mask;
+        cr_assert(rc2d_graphics_newHitMaskFromImageData(&data, RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD, &mask));
+        cr_assert_eq(mask.w, 20);
+        cr_assert_eq(mask.h, 10);
+        cr_assert_eq(mask.stride, 3);
+
+        cr_assert(rc2d_graphics_hitMaskTest(&mask, 0, 0));
+        cr_assert(rc2d_graphics_hitMaskTest(&mask, 9, 9));
+        cr_assert_not(rc2d_graphics_hitMaskTest(&mask, 10, 0));
+        cr_assert_not(rc2d_graphics_hitMaskTest(&mask, 19, 9));
+        cr_assert_not(rc2d_graphics_hitMaskTest(&mask, 20, 0));
+        cr_assert_not(rc2d_graphics_hitMaskTest(&mask, -1, 0));
+
+        rc2d_graphics_freeHitMask(&mask);
+        cr_assert_null(mask.bits);
+        rc2d_graphics_freeImageData(&data);
+    }
+}
+
+Test(rc2d_collision, pointInUIImagePixelPerfect_usesHitMask) {
+    RC2D_ImageData data = make_half_opaque(SDL_PIXELFORMAT_RGBA8888);
+    RC2D_UIImage ui = { 0 };
+    cr_assert(rc2d_graphics_newHitMaskFromImageData(&data, RC2D_HITMASK_DEFAULT_ALPHA_THRESHOLD, &ui.hitMask));
+
+    cr_log_info("hit-test memory: surface=%d bytes mask=%d bytes",
+                data.sdl_surface->pitch * data.sdl_surface->h, ui.hitMask.stride * ui.hitMask.h);
+    rc2d_graphics_freeImageData(&data);
+
+    /* Dessinée à l'échelle x2 en (100, 100) */
+    ui.visible = true;
+    ui.hittable = true;
+    ui.last_drawn_rect = (SDL_FRect){ 100.0f, 100.0f, 40.0f, 20.0f };
+
+    cr_assert(rc2d_collision_pointInUIImagePixelPerfect(&ui, 105.0f, 110.0f));
+    cr_assert_not(rc2d_collision_pointInUIImagePixelPerfect(&ui, 125.0f, 110.0f));
+    cr_assert_not(rc2d_collision_pointInUIImagePixelPerfect(&ui, 90.0f, 110.0f));
+
+    rc2d_graphics_freeHitMask(&ui.hitMask);
+}
@@ -0,0 +1,338 @@
+#include <RC2D/RC2D_data.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+
+#include <SDL3/SDL_stdinc.h>
+
+#if RC2D_DATA_MODULE_ENABLED
+
+#define DATA_SNAPSHOT_COUNT 200
+
+/* Sauvegarde JSON typique : entités avec champs répétés et valeurs variées */
+static char* make_save_json(size_t size)
+{
+    char* json = (char*)RC2D_malloc(size + 1);
+    cr_assert_not_null(json);
+    size_t pos = 0;
+    Uint32 seed = 1;
+    while (pos < size)
+    {
+        char entity[160];
+        seed = seed * 1103515245u + 12345u;
+        const int len = SDL_snprintf(entity, sizeof(entity), "{\"id\":%u,\"type\":\"enemy_%u\",\"hp\":%u,\"x\":%u.%u,\"y\":%u.%u,\"alive\":%s},\n",
+                                     seed % 100000, (seed >> 8) % 12, (seed >> 4) % 100, (seed >> 12) % 4096, seed % 10,
+                                     (seed >> 16) % 4096, (seed >> 3) % 10, (seed & 1) ? "true" : "false");
+        const size_t copy = SDL_min((size_t)len, size - pos);
+        SDL_memcpy(json + pos, entity, copy);
+        pos += copy;
+    }
+    json[size] = '\0';
+    return json;
+}
+
+/* Tilemap : grandes zones du même tile avec quelques décors */
+static Uint8* make_tilemap(size_t size)
+{
+    Uint8* tiles = (Uint8*)RC2D_malloc(size);
+    cr_assert_not_null(tiles);
+    Uint32 seed = 7;
+    for (size_t i = 0; i < size; i++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        tiles[i] = ((seed >> 16) % 9 == 0) ? (Uint8)(seed >> 24) : (Uint8)((i / 64) % 6);
+    }
+    return tiles;
+}
+
+/* Snapshot réseau de ~200 octets : même structure, quelques champs qui changent */
+static int make_snapshot(char* out, size_t capacity, Uint32 tick)
+{
+    return SDL_snprintf(out, capacity, "{\"tick\":%u,\"players\":[{\"id\":1,\"x\":%u,\"y\":%u,\"state\":\"running\"},"
+                                       "{\"id\":2,\"x\":%u,\"y\":%u,\"state\":\"idle\"}],\"score\":%u}",
+                        tick, tick * 3 % 640, tick * 7 % 480, tick * 5 % 640, tick * 11 % 480, tick / 10);
+}
+
+static void check_roundtrip(const unsigned char* data, size_t size, RC2D_CompressFormat format, const RC2D_CompressOptions* options)
+{
+    RC2D_CompressedData* compressed = rc2d_data_compressWithOptions(data, size, RC2D_DATA_TYPE_RAW_DATA, format, options);
+    cr_assert_not_null(compressed);
+    cr_assert_eq(compressed->compressFormat, format);
+    cr_assert_eq(compressed->originalSize, size);
+
+    unsigned char* decompressed = rc2d_data_decompressWithOptions(compressed, options);
+    cr_assert_not_null(decompressed);
+    cr_assert_eq(SDL_memcmp(decompressed, data, size), 0);
+
+    RC2D_safe_free(decompressed);
+    RC2D_safe_free(compressed->data);
+    RC2D_safe_free(compressed);
+}
+
+Test(rc2d_data, compress_roundtripAllFormats) {
+    char* json = make_save_json(300000);
+    RC2D_CompressDictionary* dictionary = rc2d_data_createCompressDictionary(json, 4096);
+    cr_assert_not_null(dictionary);
+
+    const size_t sizes[] = { 1, 13, 4096, 300000 };
+    for (size_t i = 0; i < SDL_arraysize(sizes); i++)
+    {
+        check_roundtrip((const unsigned char*)json, sizes[i], RC2D_COMPRESS_FORMAT_LZ4, NULL);
+        check_roundtrip((const unsigned char*)json, sizes[i], RC2D_COMPRESS_FORMAT_LZ4_STREAM, NULL);
+        for (int level = RC2D_COMPRESS_LEVEL_HC_MIN; level <= RC2D_COMPRESS_LEVEL_HC_MAX; level += 3)
+        {
+            RC2D_CompressOptions options = { level, NULL, 0, 0 };
+            check_roundtrip((const unsigned char*)json, sizes[i], RC2D_COMPRESS_FORMAT_LZ4_HC, &options);
+        }
+
+        RC2D_CompressOptions options = { RC2D_COMPRESS_LEVEL_DEFAULT, dictionary, 0, 0 };
+        check_roundtrip((const unsigned char*)json, sizes[i], RC2D_COMPRESS_FORMAT_LZ4_DICT, &options);
+    }
+
+    /* Le format dictionnaire exige un dictionnaire */
+    cr_assert_null(rc2d_data_compress((const unsigned char*)json, 100, RC2D_DATA_TYPE_TEXT, RC2D_COMPRESS_FORMAT_LZ4_DICT));
+
+    rc2d_data_destroyCompressDictionary(dictionary);
+    RC2D_free(json);
+}
+
+Test(rc2d_data, compress_streamSpansSeveralBlocks) {
+    /* Plus grand qu'un bloc de 4 Mo : les blocs suivants référencent les précédents */
+    const size_t size = 10 * 1024 * 1024 + 123;
+    Uint8* tiles = make_tilemap(size);
+    check_roundtrip(tiles, size, RC2D_COMPRESS_FORMAT_LZ4_STREAM, NULL);
+
+    /* Flux tronqué : la décompression échoue proprement */
+    RC2D_CompressedData* compressed = rc2d_data_compress(tiles, size, RC2D_DATA_TYPE_RAW_DATA, RC2D_COMPRESS_FORMAT_LZ4_STREAM);
+    cr_assert_not_null(compressed);
+    compressed->compressedSize -= 16;
+    cr_assert_null(rc2d_data_decompress(compressed));
+
+    RC2D_safe_free(compressed->data);
+    RC2D_safe_free(compressed);
+    RC2D_free(tiles);
+}
+
+Test(rc2d_data, compress_blocksDeterministicAcrossThreadCounts) {
+    const size_t size = 6 * 1024 * 1024 + 77;
+    Uint8* tiles = make_tilemap(size);
+
+    for (int level = RC2D_COMPRESS_LEVEL_DEFAULT; level <= RC2D_COMPRESS_LEVEL_HC_MIN; level++)
+    {
+        RC2D_CompressedData* reference = NULL;
+        const int threadCounts[] = { 1, 2, 3, 8, 0 };
+        for (size_t i = 0; i < SDL_arraysize(threadCounts); i++)
+        {
+            RC2D_CompressOptions options = { level, NULL, 256 * 1024, threadCounts[i] };
+            check_roundtrip(tiles, size, RC2D_COMPRESS_FORMAT_LZ4_BLOCKS, &options);
+
+            RC2D_CompressedData* compressed = rc2d_data_compressWithOptions(tiles, size, RC2D_DATA_TYPE_RAW_DATA, RC2D_COMPRESS_FORMAT_LZ4_BLOCKS, &options);
+            cr_assert_not_null(compressed);
+            if (reference == NULL)
+            {
+                reference = compressed;
+                continue;
+            }
+
+            /* Même sortie, octet pour octet, quel que soit le nombre de threads */
+            cr_assert_eq(compressed->compressedSize, reference->compressedSize);
+            cr_assert_eq(SDL_memcmp(compressed->data, reference->data, reference->compressedSize), 0);
+            RC2D_safe_free(compressed->data);
+            RC2D_safe_free(compressed);
+        }
+
+        /* Table de blocs incohérente avec les données : échec propre */
+        reference->compressedSize -= 1;
+        cr_assert_null(rc2d_data_decompress(reference));
+
+        RC2D_safe_free(reference->data);
+        RC2D_safe_free(reference);
+    }
+
+    RC2D_free(tiles);
+}
+
+Test(rc2d_data, compress_dictionaryShrinksSnapshots) {
+    /* Dictionnaire entraîné sur quelques snapshots types */
+    char training[4096];
+    size_t trainingSize = 0;
+    for (Uint32 tick = 0; tick < 16; tick++)
+    {
+        trainingSize += (size_t)make_snapshot(training + trainingSize, sizeof(training) - trainingSize, tick * 37);
+    }
+    RC2D_CompressDictionary* dictionary = rc2d_data_createCompressDictionary(training, trainingSize);
+    cr_assert_not_null(dictionary);
+
+    size_t plainTotal = 0;
+    size_t dictTotal = 0;
+    RC2D_CompressOptions options = { RC2D_COMPRESS_LEVEL_DEFAULT, dictionary, 0, 0 };
+    for (Uint32 tick = 1000; tick < 1000 + DATA_SNAPSHOT_COUNT; tick++)
+    {
+        char snapshot[256];
+        const size_t size = (size_t)make_snapshot(snapshot, sizeof(snapshot), tick);
+
+        RC2D_CompressedData* plain = rc2d_data_compress((const unsigned char*)snapshot, size, RC2D_DATA_TYPE_RAW_DATA, RC2D_COMPRESS_FORMAT_LZ4);
+        RC2D_CompressedData* withDict = rc2d_data_compressWithOptions((const unsigned char*)snapshot, size, RC2D_DATA_TYPE_RAW_DATA, RC2D_COMPRESS_FORMAT_LZ4_DICT, &options);
+        cr_assert_not_null(plain);
+        cr_assert_not_null(withDict);
+        plainTotal += plain->compressedSize;
+        dictTotal += withDict->compressedSize;
+
+        RC2D_safe_free(plain->data);
+        RC2D_safe_free(plain);
+        RC2D_safe_free(withDict->data);
+        RC2D_safe_free(withDict);
+    }
+
+    /* Petits messages de même structure : le dictionnaire doit réduire la taille totale */
+    cr_assert_lt(dictTotal, plainTotal);
+
+    rc2d_data_destroyCompressDictionary(dictionary);
+}
+
+Test(rc2d_data, cryptoKey_roundtripAndCompatibility) {
+    const char* message = "{\"type\":\"move\",\"x\":12,\"y\":34}";
+    const size_t messageSize = SDL_strlen(message);
+
+    RC2D_CryptoKey* key = rc2d_data_createCryptoKey("rc2dtests", NULL, RC2D_CIPHER_FORMAT_AES);
+    cr_assert_not_null(key);
+
+    RC2D_EncryptedData* encrypted = rc2d_data_encryptWithKey(key, (const unsigned char*)message, messageSize, RC2D_DATA_TYPE_TEXT);
+    cr_assert_not_null(encrypted);
+    unsigned char* decrypted = rc2d_data_decryptWithKey(key, encrypted);
+    cr_assert_not_null(decrypted);
+    cr_assert_str_eq((const char*)decrypted, message);
+    RC2D_safe_free(decrypted);
+
+    /* Données altérées : le HMAC doit échouer */
+    encrypted->data[encrypted->encryptedSize - 1] ^= 0x01;
+    cr_assert_null(rc2d_data_decryptWithKey(key, encrypted));
+    rc2d_data_freeSecurity(encrypted);
+
+    /* Un message de rc2d_data_encrypt se déchiffre avec une clé dérivée de son propre sel */
+    encrypted = rc2d_data_encrypt((const unsigned char*)message, messageSize, "rc2dtests", RC2D_DATA_TYPE_TEXT, RC2D_CIPHER_FORMAT_AES);
+    cr_assert_not_null(encrypted);
+    cr_assert_null(rc2d_data_decryptWithKey(key, encrypted));
+    RC2D_CryptoKey* sameSalt = rc2d_data_createCryptoKey("rc2dtests", encrypted->data, RC2D_CIPHER_FORMAT_AES);
+    cr_assert_not_null(sameSalt);
+    decrypted = rc2d_data_decryptWithKey(sameSalt, encrypted);
+    cr_assert_not_null(decrypted);
+    cr_assert_str_eq((const char*)decrypted, message);
+    RC2D_safe_free(decrypted);
+
+    rc2d_data_freeSecurity(encrypted);
+    rc2d_data_destroyCryptoKey(sameSalt);
+    rc2d_data_destroyCryptoKey(key);
+}
+
+Test(rc2d_data, hash_knownVectorsAndIncremental) {
+    unsigned char hash[RC2D_HASH_MAX_SIZE];
+
+    /* Vecteurs de référence (entrée vide) */
+    cr_assert_eq(rc2d_data_hashBytes(NULL, 0, RC2D_HASHING_FORMAT_XXH64, hash, sizeof(hash)), 8);
+    cr_assert_eq(SDL_memcmp(hash, "\xef\x46\xdb\x37\x51\xd8\xe9\x99", 8), 0);
+    cr_assert_eq(rc2d_data_hashBytes(NULL, 0, RC2D_HASHING_FORMAT_XXH3_64, hash, sizeof(hash)), 8);
+    cr_assert_eq(SDL_memcmp(hash, "\x2d\x06\x80\x05\x38\xd3\x94\xc2", 8), 0);
+    char* hex = rc2d_data_hash("abc", RC2D_HASHING_FORMAT_SHA256);
+    cr_assert_str_eq(hex, "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    RC2D_safe_free(hex);
+
+    /* Le hash incrémental (morceaux de tailles variables) est identique au hash en une fois */
+    const size_t size = 100003;
+    Uint8* data = (Uint8*)RC2D_malloc(size);
+    cr_assert_not_null(data);
+    for (size_t i = 0; i < size; i++) data[i] = (Uint8)((i * 2654435761u) >> 13);
+
+    const RC2D_HashFormat formats[] = { RC2D_HASHING_FORMAT_SHA256, RC2D_HASHING_FORMAT_SHA3_512, RC2D_HASHING_FORMAT_XXH64, RC2D_HASHING_FORMAT_XXH3_64, RC2D_HASHING_FORMAT_XXH3_128 };
+    for (size_t f = 0; f < SDL_arraysize(formats); f++)
+    {
+        unsigned char expected[RC2D_HASH_MAX_SIZE];
+        const size_t expectedSize = rc2d_data_hashBytes(data, size, formats[f], expected, sizeof(expected));
+        cr_assert_eq(expectedSize, rc2d_data_getHashSize(formats[f]));
+
+        RC2D_HashContext* context = rc2d_data_createHashContext(formats[f]);
+        cr_assert_not_null(context);
+
+        /* Deux passes : le contexte est réutilisable après rc2d_data_hashFinal() */
+        for (int pass = 0; pass < 2; pass++)
+        {
+            size_t offset = 0;
+            size_t step = 1;
+            while (offset < size)
+            {
+                const size_t chunk = SDL_min(step, size - offset);
+                cr_assert(rc2d_data_hashUpdate(context, data + offset, chunk));
+                offset += chunk;
+                step = step * 3 + 1;
+            }
+            cr_assert_eq(rc2d_data_hashFinal(context, hash, sizeof(hash)), expectedSize);
+            cr_assert_eq(SDL_memcmp(hash, expected, expectedSize), 0);
+        }
+
+        rc2d_data_destroyHashContext(context);
+    }
+
+    /* Buffer de sortie trop petit */
+    cr_assert_eq(rc2d_data_hashBytes(data, size, RC2D_HASHING_FORMAT_SHA512, hash, 32), 0);
+
+    RC2D_free(data);
+}
+
+Test(rc2d_data, encode_roundtripAllSizesAndValidation) {
+    unsigned char data[300];
+    unsigned char decoded[300];
+    char encoded[700];
+    for (size_t i = 0; i < sizeof(data); i++) data[i] = (unsigned char)((i * 2654435761u) >> 13);
+
+    /* Toutes les tailles : couvre les blocs vectorisés, les fins scalaires et le padding */
+    const RC2D_EncodeFormat formats[] = { RC2D_ENCODE_FORMAT_BASE64, RC2D_ENCODE_FORMAT_HEX };
+    for (size_t f = 0; f < SDL_arraysize(formats); f++)
+    {
+        for (size_t size = 0; size <= sizeof(data); size++)
+        {
+            size_t encodedSize = 0;
+            size_t decodedSize = 0;
+            cr_assert(rc2d_data_encodeTo(data, size, formats[f], encoded, sizeof(encoded), &encodedSize));
+            cr_assert_eq(encodedSize, rc2d_data_getEncodedSize(size, formats[f]));
+            cr_assert(rc2d_data_decodeTo(encoded, encodedSize, formats[f], decoded, sizeof(decoded), &decodedSize));
+            cr_assert_eq(decodedSize, size);
+            cr_assert_eq(SDL_memcmp(decoded, data, size), 0);
+        }
+    }
+
+    /* Vecteurs connus */
+    size_t written = 0;
+    cr_assert(rc2d_data_encodeTo((const unsigned char*)"RC2D!", 5, RC2D_ENCODE_FORMAT_BASE64, encoded, sizeof(encoded), &written));
+    cr_assert_eq(SDL_strncmp(encoded, "UkMyRCE=", written), 0);
+    cr_assert(rc2d_data_encodeTo((const unsigned char*)"\x01\xAB", 2, RC2D_ENCODE_FORMAT_HEX, encoded, sizeof(encoded), &written));
+    cr_assert_eq(SDL_strncmp(encoded, "01AB", written), 0);
+    cr_assert(rc2d_data_decodeTo("01ab", 4, RC2D_ENCODE_FORMAT_HEX, decoded, sizeof(decoded), &written));
+    cr_assert_eq(decoded[1], 0xAB);
+
+    /* Entrées invalides, y compris au milieu d'un bloc vectorisé */
+    cr_assert(rc2d_data_encodeTo(data, 120, RC2D_ENCODE_FORMAT_BASE64, encoded, sizeof(encoded), &written));
+    encoded[70] = '-';
+    cr_assert_not(rc2d_data_decodeTo(encoded, written, RC2D_ENCODE_FORMAT_BASE64, decoded, sizeof(decoded), NULL));
+    encoded[70] = '=';
+    cr_assert_not(rc2d_data_decodeTo(encoded, written, RC2D_ENCODE_FORMAT_BASE64, decoded, sizeof(decoded), NULL));
+    cr_assert_not(rc2d_data_decodeTo("UkMyRCE", 7, RC2D_ENCODE_FORMAT_BASE64, decoded, sizeof(decoded), NULL));
+    cr_assert_not(rc2d_data_decodeTo("UkMyRC=E", 8, RC2D_ENCODE_FORMAT_BASE64, decoded, sizeof(decoded), NULL));
+    cr_assert(rc2d_data_encodeTo(data, 120, RC2D_ENCODE_FORMAT_HEX, encoded, sizeof(encoded), &written));
+    encoded[100] = 'g';
+    cr_assert_not(rc2d_data_decodeTo(encoded, written, RC2D_ENCODE_FORMAT_HEX, decoded, sizeof(decoded), NULL));
+    cr_assert_not(rc2d_data_decodeTo("ABC", 3, RC2D_ENCODE_FORMAT_HEX, decoded, sizeof(decoded), NULL));
+
+    /* Buffer de sortie trop petit */
+    cr_assert_not(rc2d_data_encodeTo(data, 10, RC2D_ENCODE_FORMAT_BASE64, encoded, 15, NULL));
+
+    /* rc2d_data_decode sur des données brutes (sans caractère nul) utilise encodedSize */
+    RC2D_EncodedData* legacy = rc2d_data_encode(data, 100, RC2D_DATA_TYPE_RAW_DATA, RC2D_ENCODE_FORMAT_BASE64);
+    cr_assert_not_null(legacy);
+    unsigned char* legacyDecoded = rc2d_data_decode(legacy);
+    cr_assert_not_null(legacyDecoded);
+    cr_assert_eq(SDL_memcmp(legacyDecoded, data, 100), 0);
+    RC2D_safe_free(legacyDecoded);
+    RC2D_safe_free(legacy->data);
+    RC2D_safe_free(legacy);
+}
+
+#endif // RC2D_DATA_MODULE_ENABLED
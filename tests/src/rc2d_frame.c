@@ -0,0 +1,91 @@
+#include <RC2D/RC2D_frame.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_math.h>
+#include <RC2D/RC2D_data.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+
+static void frame_teardown(void)
+{
+    rc2d_frame_quit();
+}
+
+Test(rc2d_frame, alloc_alignedAndReusedAfterEndFrame, .fini = frame_teardown) {
+    for (size_t align = 1; align <= 256; align <<= 1)
+    {
+        void* ptr = rc2d_frame_alloc(3, align);
+        cr_assert_not_null(ptr);
+        cr_assert_eq((uintptr_t)ptr & (align - 1), 0, "alignement %zu", align);
+        cr_assert(rc2d_frame_owns(ptr));
+    }
+    cr_assert_null(rc2d_frame_alloc(8, 3));
+
+    // Une frame qui déborde sur plusieurs blocs : ils sont fusionnés à la fin de la frame
+    for (int i = 0; i < 64; i++)
+    {
+        cr_assert_not_null(rc2d_frame_alloc(RC2D_FRAME_ARENA_BLOCK_SIZE / 8, 0));
+    }
+    rc2d_frame_endFrame();
+
+    RC2D_FrameArenaStats before;
+    rc2d_frame_getStats(&before);
+    cr_assert_eq(before.usedBytes, 0);
+    cr_assert_geq(before.peakBytes, 8 * RC2D_FRAME_ARENA_BLOCK_SIZE);
+
+    // La même charge ne doit plus faire grandir l'arène
+    for (int i = 0; i < 64; i++)
+    {
+        cr_assert_not_null(rc2d_frame_alloc(RC2D_FRAME_ARENA_BLOCK_SIZE / 8, 0));
+    }
+    RC2D_FrameArenaStats after;
+    rc2d_frame_getStats(&after);
+    cr_assert_eq(after.capacityBytes, before.capacityBytes);
+    cr_assert_eq(after.frameIndex, before.frameIndex);
+}
+
+Test(rc2d_frame, allocDoubleBuffered_survivesOneExtraFrame, .fini = frame_teardown) {
+    char* text = rc2d_frame_allocDoubleBuffered(16, 0);
+    cr_assert_not_null(text);
+    SDL_strlcpy(text, "frame N", 16);
+
+    rc2d_frame_endFrame();
+    cr_assert(rc2d_frame_owns(text));
+    cr_assert_str_eq(text, "frame N");
+
+    // Fin de la frame N+1 : l'arène de la frame N redevient courante et repart de zéro
+    rc2d_frame_endFrame();
+    char* reused = rc2d_frame_allocDoubleBuffered(16, 0);
+    cr_assert_eq(reused, text);
+}
+
+Test(rc2d_frame, frameVariants_matchHeapVariants, .fini = frame_teardown) {
+    RC2D_Point controls[4] = { {0, 0}, {10, 40}, {60, 40}, {100, 0} };
+    RC2D_BezierCurve* curve = rc2d_math_newBezierCurve(4, controls);
+    cr_assert_not_null(curve);
+
+    int heapCount = 0;
+    int frameCount = 0;
+    RC2D_Point* heapPoints = rc2d_math_renderBezierCurve(curve, 5, &heapCount);
+    RC2D_Point* framePoints = rc2d_math_renderBezierCurveFrame(curve, 5, &frameCount);
+    cr_assert_not_null(heapPoints);
+    cr_assert_not_null(framePoints);
+    cr_assert_eq(heapCount, 33);
+    cr_assert_eq(frameCount, heapCount);
+    cr_assert(rc2d_frame_owns(framePoints));
+    cr_assert_not(rc2d_frame_owns(heapPoints));
+    cr_assert_arr_eq(framePoints, heapPoints, sizeof(RC2D_Point) * heapCount);
+    cr_assert_float_eq(framePoints[frameCount - 1].x, 100.0, 1e-9);
+
+    RC2D_free(heapPoints);
+    rc2d_math_freeBezierCurve(curve);
+
+#if RC2D_DATA_MODULE_ENABLED
+    const unsigned char bytes[] = "RC2D frame arena";
+    size_t length = 0;
+    char* encoded = rc2d_data_encodeFrame(bytes, sizeof(bytes) - 1, RC2D_ENCODE_FORMAT_BASE64, &length);
+    cr_assert_not_null(encoded);
+    cr_assert(rc2d_frame_owns(encoded));
+    cr_assert_eq(length, SDL_strlen(encoded));
+    cr_assert_str_eq(encoded, "UkMyRCBmcmFtZSBhcmVuYQ==");
+#endif
+}
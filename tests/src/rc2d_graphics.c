@@ -0,0 +1,103 @@
+#include <RC2D/RC2D_graphics.h>
+#include <RC2D/RC2D_internal.h>
+#include <criterion/criterion.h>
+
+#include <SDL3/SDL_surface.h>
+
+#define TARGET_W 1024
+#define TARGET_H 768
+
+static SDL_Surface* target = NULL;
+static RC2D_Image sprite = { NULL };
+
+/* Renderer logiciel sans fenêtre : les pixels rendus sont relus sur la surface cible. */
+static void setup_software_renderer(void)
+{
+    target = SDL_CreateSurface(TARGET_W, TARGET_H, SDL_PIXELFORMAT_RGBA8888);
+    cr_assert_not_null(target);
+
+    rc2d_engine_state.renderer = SDL_CreateSoftwareRenderer(target);
+    cr_assert_not_null(rc2d_engine_state.renderer);
+
+    SDL_Surface* pixels = SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_RGBA8888);
+    cr_assert_not_null(pixels);
+    SDL_FillSurfaceRect(pixels, NULL, SDL_MapSurfaceRGBA(pixels, 255, 0, 0, 255));
+    sprite.sdl_texture = SDL_CreateTextureFromSurface(rc2d_engine_state.renderer, pixels);
+    SDL_DestroySurface(pixels);
+    cr_assert_not_null(sprite.sdl_texture);
+}
+
+static void teardown_software_renderer(void)
+{
+    rc2d_graphics_setSpriteBatch(NULL);
+    rc2d_graphics_freeImage(&sprite);
+    SDL_DestroyRenderer(rc2d_engine_state.renderer);
+    rc2d_engine_state.renderer = NULL;
+    SDL_DestroySurface(target);
+    target = NULL;
+}
+
+TestSuite(rc2d_graphics, .init = setup_software_renderer, .fini = teardown_software_renderer);
+
+Test(rc2d_graphics, spriteBatch_routesDrawImage) {
+    RC2D_SpriteBatch* batch = rc2d_graphics_newSpriteBatch(4);
+    cr_assert_not_null(batch);
+
+    rc2d_graphics_setSpriteBatch(batch);
+    for (int i = 0; i < 10; ++i)
+    {
+        rc2d_graphics_drawImage(&sprite, 0.0f, 0.0f, 0.0, 1.0f, 1.0f, -1.0f, -1.0f, false, false);
+    }
+    cr_assert_eq(rc2d_graphics_getSpriteBatchCount(batch), 10);
+
+    /* Un dessin immédiat flushe le lot actif pour conserver l'ordre */
+    SDL_FRect r = { 0, 0, 1, 1 };
+    rc2d_graphics_rectangle("fill", &r);
+    cr_assert_eq(rc2d_graphics_getSpriteBatchCount(batch), 0);
+
+    rc2d_graphics_setSpriteBatch(NULL);
+    rc2d_graphics_freeSpriteBatch(batch);
+}
+
+Test(rc2d_graphics, spriteBatch_flushedOnRenderStateChange) {
+    RC2D_SpriteBatch* batch = rc2d_graphics_newSpriteBatch(4);
+    cr_assert_not_null(batch);
+    rc2d_graphics_setSpriteBatch(batch);
+
+    /* Les sprites en attente partent avec l'état courant avant tout changement */
+    rc2d_graphics_drawImage(&sprite, 0.0f, 0.0f, 0.0, 1.0f, 1.0f, -1.0f, -1.0f, false, false);
+    cr_assert(rc2d_graphics_setColor((RC2D_Color){0, 255, 0, 255}));
+    cr_assert_eq(rc2d_graphics_getSpriteBatchCount(batch), 0);
+
+    rc2d_graphics_drawImage(&sprite, 0.0f, 0.0f, 0.0, 1.0f, 1.0f, -1.0f, -1.0f, false, false);
+    cr_assert(rc2d_graphics_setBlendMode(RC2D_BLENDMODE_MOD));
+    cr_assert_eq(rc2d_graphics_getSpriteBatchCount(batch), 0);
+
+    rc2d_graphics_drawImage(&sprite, 0.0f, 0.0f, 0.0, 1.0f, 1.0f, -1.0f, -1.0f, false, false);
+    cr_assert(rc2d_graphics_scale(2.0f, 2.0f));
+    cr_assert_eq(rc2d_graphics_getSpriteBatchCount(batch), 0);
+
+    rc2d_graphics_setSpriteBatch(NULL);
+    rc2d_graphics_freeSpriteBatch(batch);
+}
+
+Test(rc2d_graphics, spriteBatch_rendersQuad) {
+    RC2D_SpriteBatch* batch = rc2d_graphics_newSpriteBatch(0);
+    cr_assert_not_null(batch);
+
+    SDL_SetRenderDrawColor(rc2d_engine_state.renderer, 0, 0, 0, 255);
+    SDL_RenderClear(rc2d_engine_state.renderer);
+
+    cr_assert(rc2d_graphics_addToSpriteBatch(batch, &sprite, NULL, 100.0f, 100.0f, 45.0, 2.0f, 2.0f, -1.0f, -1.0f,
+                                             false, false, (RC2D_Color){255, 255, 255, 255}));
+    cr_assert(rc2d_graphics_flushSpriteBatch(batch));
+    SDL_RenderPresent(rc2d_engine_state.renderer);
+
+    /* Le centre du sprite (100 + 32, 100 + 32) doit être rouge */
+    Uint8 r = 0, g = 0, b = 0, a = 0;
+    cr_assert(SDL_ReadSurfacePixel(target, 132, 132, &r, &g, &b, &a));
+    cr_assert_eq(r, 255);
+    cr_assert_eq(g, 0);
+
+    rc2d_graphics_freeSpriteBatch(batch);
+}
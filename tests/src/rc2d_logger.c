@@ -0,0 +1,140 @@
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+
+#include <SDL3/SDL_timer.h>
+
+#define LOGGER_TEST_FILE "rc2d_logger.log"
+
+/* Nombre de lignes du fichier de log, ou -1 s'il n'existe pas */
+static int count_lines(const char* path, const char* needle)
+{
+    void* data = NULL;
+    Uint64 len = 0;
+    if (!rc2d_storage_userReadFile(path, &data, &len)) return -1;
+
+    int lines = 0;
+    const char* text = (const char*)data;
+    for (Uint64 i = 0; i < len; i++)
+    {
+        if (text[i] == '\n') lines++;
+    }
+    if (needle && len > 0)
+    {
+        char* copy = (char*)RC2D_malloc((size_t)len + 1);
+        cr_assert_not_null(copy);
+        SDL_memcpy(copy, text, (size_t)len);
+        copy[len] = '\0';
+        if (!SDL_strstr(copy, needle)) lines = 0;
+        RC2D_free(copy);
+    }
+    RC2D_free(data);
+    return lines;
+}
+
+static void setup_logger(void)
+{
+    cr_assert(rc2d_storage_openUser("RC2DTests", "rc2d_logger"));
+    rc2d_storage_userRemovePath(LOGGER_TEST_FILE);
+    rc2d_storage_userRemovePath(LOGGER_TEST_FILE ".1");
+    rc2d_storage_userRemovePath(LOGGER_TEST_FILE ".2");
+    rc2d_storage_userRemovePath(LOGGER_TEST_FILE ".3");
+    rc2d_logger_set_console_enabled(false);
+}
+
+static void teardown_logger(void)
+{
+    rc2d_logger_quit();
+    rc2d_logger_set_console_enabled(true);
+    rc2d_storage_userRemovePath(LOGGER_TEST_FILE);
+    rc2d_storage_userRemovePath(LOGGER_TEST_FILE ".1");
+    rc2d_storage_userRemovePath(LOGGER_TEST_FILE ".2");
+    rc2d_storage_closeUser();
+}
+
+TestSuite(rc2d_logger, .init = setup_logger, .fini = teardown_logger);
+
+Test(rc2d_logger, async_flushWritesEveryQueuedRecord) {
+    cr_assert(rc2d_logger_set_file_sink(LOGGER_TEST_FILE, 0, 0));
+    cr_assert(rc2d_logger_set_async(true));
+
+    // Moins de messages que de cases dans la file : aucun ne doit être perdu
+    const int dropped = rc2d_logger_get_dropped_count();
+    for (int i = 0; i < RC2D_LOGGER_RING_CAPACITY / 2; i++)
+    {
+        RC2D_log(RC2D_LOG_INFO, "record %d", i);
+    }
+    rc2d_logger_flush();
+
+    cr_assert_eq(rc2d_logger_get_dropped_count(), dropped);
+    cr_assert_eq(count_lines(LOGGER_TEST_FILE, "record 255"), RC2D_LOGGER_RING_CAPACITY / 2);
+}
+
+Test(rc2d_logger, async_criticalIsWrittenBeforeReturning) {
+    cr_assert(rc2d_logger_set_file_sink(LOGGER_TEST_FILE, 0, 0));
+    cr_assert(rc2d_logger_set_async(true));
+
+    RC2D_log(RC2D_LOG_CRITICAL, "fatal state");
+    cr_assert_eq(count_lines(LOGGER_TEST_FILE, "[critical:rc2d_logger.c:"), 1);
+}
+
+Test(rc2d_logger, fileSink_rotatesAndKeepsMaxFiles) {
+    cr_assert_not(rc2d_logger_set_file_sink("../outside.log", 0, 0));
+    cr_assert(rc2d_logger_set_file_sink(LOGGER_TEST_FILE, 4096, 2));
+
+    for (int i = 0; i < 1000; i++)
+    {
+        RC2D_log(RC2D_LOG_INFO, "rotation %d", i);
+    }
+    rc2d_logger_flush();
+
+    cr_assert(rc2d_storage_userFileExists(LOGGER_TEST_FILE));
+    cr_assert(rc2d_storage_userFileExists(LOGGER_TEST_FILE ".1"));
+    cr_assert(rc2d_storage_userFileExists(LOGGER_TEST_FILE ".2"));
+    cr_assert_not(rc2d_storage_userFileExists(LOGGER_TEST_FILE ".3"));
+    cr_assert_geq(rc2d_storage_userFileSize(LOGGER_TEST_FILE ".1"), 4096);
+    cr_assert_lt(rc2d_storage_userFileSize(LOGGER_TEST_FILE ".1"), 4096 + RC2D_LOGGER_RECORD_SIZE);
+}
+
+static int count_calls(int* calls)
+{
+    return ++*calls;
+}
+
+Test(rc2d_logger, log_filteredLevelDoesNotEvaluateArguments) {
+    const RC2D_LogLevel previous = rc2d_logger_get_priority();
+    int calls = 0;
+
+    rc2d_logger_set_priority(RC2D_LOG_WARN);
+    RC2D_log(RC2D_LOG_INFO, "calls %d", count_calls(&calls));
+    cr_assert_eq(calls, 0);
+
+    RC2D_log(RC2D_LOG_WARN, "calls %d", count_calls(&calls));
+    cr_assert_eq(calls, RC2D_LOG_MIN_LEVEL <= RC2D_LOG_WARN ? 1 : 0);
+
+    rc2d_logger_set_priority(previous);
+}
+
+Test(rc2d_logger, everyN_andThrottled_limitPerCallsite) {
+    cr_assert(rc2d_logger_set_file_sink(LOGGER_TEST_FILE, 0, 0));
+
+    for (int i = 0; i < 10; i++)
+    {
+        RC2D_log_every_n(RC2D_LOG_WARN, 4, "every %d", i);
+    }
+    rc2d_logger_flush();
+    cr_assert_eq(count_lines(LOGGER_TEST_FILE, "every 8"), 3);
+
+    // 30 passages en ~150 ms (plus selon l'ordonnancement) avec un intervalle de 50 ms : environ 3 messages
+    for (int i = 0; i < 30; i++)
+    {
+        RC2D_log_throttled(RC2D_LOG_WARN, 50, "throttled %d", i);
+        SDL_Delay(5);
+    }
+    rc2d_logger_flush();
+    const int lines = count_lines(LOGGER_TEST_FILE, "throttled 0") - 3;
+    cr_assert_geq(lines, 2);
+    cr_assert_leq(lines, 5);
+}
@@ -0,0 +1,268 @@
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_thread.h>
+#include <criterion/criterion.h>
+
+#define MEMORY_THREAD_COUNT 8
+#define MEMORY_THREAD_OPS 200000
+#define POOL_OBJECT_SIZE 48
+#define POOL_SLOTS 1024
+
+/* Pool partagé par les workers de churn (NULL : SDL_malloc / SDL_free) */
+static RC2D_Pool* churn_pool = NULL;
+
+static int pool_churn_worker(void* data)
+{
+    void* slots[POOL_SLOTS] = { 0 };
+    Uint32 seed = (Uint32)(uintptr_t)data;
+    for (int op = 0; op < MEMORY_THREAD_OPS; op++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const int k = (int)((seed >> 8) & (POOL_SLOTS - 1));
+        if (slots[k] == NULL)
+        {
+            slots[k] = churn_pool ? RC2D_pool_alloc(churn_pool) : SDL_malloc(POOL_OBJECT_SIZE);
+            SDL_memset(slots[k], 0xAB, POOL_OBJECT_SIZE);
+        }
+        else
+        {
+            if (churn_pool) RC2D_pool_free(churn_pool, slots[k]);
+            else SDL_free(slots[k]);
+            slots[k] = NULL;
+        }
+    }
+
+    for (int k = 0; k < POOL_SLOTS; k++)
+    {
+        if (churn_pool) RC2D_pool_free(churn_pool, slots[k]);
+        else SDL_free(slots[k]);
+    }
+    return 0;
+}
+
+/* Lance 'threads' workers de churn et attend leur fin */
+static void run_pool_churn(RC2D_Pool* pool, int threads)
+{
+    RC2D_Thread* workers[MEMORY_THREAD_COUNT];
+    churn_pool = pool;
+
+    for (int i = 0; i < threads; i++)
+    {
+        workers[i] = rc2d_thread_new(pool_churn_worker, "rc2d_pool_churn", (void*)(uintptr_t)(i + 1));
+        cr_assert_not_null(workers[i]);
+    }
+    for (int i = 0; i < threads; i++)
+    {
+        rc2d_thread_wait(workers[i], NULL);
+    }
+}
+
+Test(rc2d_memory, pool_reusesAlignedObjects) {
+    RC2D_Pool* pool = rc2d_memory_createPool("test", 20, 8, false);
+    cr_assert_not_null(pool);
+
+    void* objects[20];
+    for (int i = 0; i < 20; i++)
+    {
+        objects[i] = RC2D_pool_alloc(pool);
+        cr_assert_not_null(objects[i]);
+        cr_assert_eq((uintptr_t)objects[i] & 15, 0);
+    }
+
+    RC2D_PoolStats stats;
+    rc2d_memory_getPoolStats(pool, &stats);
+    cr_assert_eq(stats.objectSize, 20);
+    cr_assert_eq(stats.slabCount, 3);
+    cr_assert_eq(stats.capacity, 24);
+    cr_assert_eq(stats.liveCount, 20);
+
+    // Un objet rendu est le prochain servi (LIFO)
+    void* recycled = objects[7];
+    RC2D_pool_free(pool, recycled);
+    objects[7] = RC2D_pool_alloc(pool);
+    cr_assert_eq(objects[7], recycled);
+
+    for (int i = 0; i < 20; i++)
+    {
+        RC2D_pool_free(pool, objects[i]);
+    }
+    rc2d_memory_getPoolStats(pool, &stats);
+    cr_assert_eq(stats.liveCount, 0);
+    cr_assert_eq(stats.peakCount, 20);
+    rc2d_memory_destroyPool(pool);
+}
+
+Test(rc2d_memory, pool_threadCacheUnderChurn) {
+    RC2D_Pool* pool = rc2d_memory_createPool("churn", POOL_OBJECT_SIZE, 0, true);
+    cr_assert_not_null(pool);
+    run_pool_churn(pool, MEMORY_THREAD_COUNT);
+
+    // Les caches des workers terminés sont rendus au pool
+    RC2D_PoolStats stats;
+    rc2d_memory_getPoolStats(pool, &stats);
+    cr_assert_eq(stats.liveCount, 0);
+    cr_assert_leq(stats.peakCount, stats.capacity);
+    rc2d_memory_destroyPool(pool);
+}
+
+#if RC2D_MEMORY_TELEMETRY_ENABLED
+
+Test(rc2d_memory, telemetry_countsTagsAndFrames) {
+    RC2D_MemoryCounters before;
+    rc2d_memory_getCounters(&before);
+
+    void* general = RC2D_malloc(64);
+    void* ui = RC2D_malloc_tagged(128, RC2D_MEMORY_TAG_UI);
+    RC2D_MEMORY_TAG_SCOPE(RC2D_MEMORY_TAG_NET)
+    {
+        cr_assert_eq(rc2d_memory_getCurrentTag(), RC2D_MEMORY_TAG_NET);
+        RC2D_free(RC2D_calloc(4, 16));
+    }
+    cr_assert_eq(rc2d_memory_getCurrentTag(), RC2D_MEMORY_TAG_GENERAL);
+
+    RC2D_MemoryCounters after;
+    rc2d_memory_getCounters(&after);
+    cr_assert_eq(after.allocCount - before.allocCount, 3);
+    cr_assert_eq(after.freeCount - before.freeCount, 1);
+    cr_assert_eq(after.tagAllocCount[RC2D_MEMORY_TAG_UI] - before.tagAllocCount[RC2D_MEMORY_TAG_UI], 1);
+    cr_assert_eq(after.tagAllocCount[RC2D_MEMORY_TAG_NET] - before.tagAllocCount[RC2D_MEMORY_TAG_NET], 1);
+    cr_assert_str_eq(rc2d_memory_getTagName(RC2D_MEMORY_TAG_UI), "ui");
+
+    // Une frame : les deux blocs restants sont encore vivants à l'échantillonnage
+    rc2d_memory_sampleFrame();
+    RC2D_free(general);
+    RC2D_free(ui);
+    rc2d_memory_sampleFrame();
+
+    RC2D_MemoryFrameStats frames[2];
+    cr_assert_eq(rc2d_memory_getFrameHistory(frames, 2), 2);
+    cr_assert_eq(frames[0].frameIndex, frames[1].frameIndex + 1);
+    cr_assert_eq(frames[0].allocCount, 0);
+    cr_assert_eq(frames[0].freeCount, 2);
+    cr_assert_geq(frames[1].allocCount, 3);
+    cr_assert_eq(frames[0].bytesFreed, frames[1].bytesInFlight - frames[0].bytesInFlight);
+    cr_assert_geq(frames[0].peakBytesInFlight, frames[1].bytesInFlight);
+}
+
+#endif // RC2D_MEMORY_TELEMETRY_ENABLED
+
+#if RC2D_MEMORY_DEBUG_ENABLED
+
+/* Retrouve les statistiques d'un site d'appel de ce fichier */
+static bool find_callsite(int line, RC2D_MemoryCallsiteStats* out_stats)
+{
+    static RC2D_MemoryCallsiteStats stats[512];
+    const int count = rc2d_memory_getTopCallsites(stats, 512);
+    for (int i = 0; i < count; i++)
+    {
+        if (stats[i].line == line && SDL_strcmp(stats[i].file, __FILE__) == 0)
+        {
+            *out_stats = stats[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+static int churn_worker(void* data)
+{
+    void* slots[256] = { 0 };
+    Uint32 seed = (Uint32)(uintptr_t)data;
+    for (int op = 0; op < MEMORY_THREAD_OPS; op++)
+    {
+        seed = seed * 1103515245u + 12345u;
+        const int k = (int)((seed >> 8) & 255);
+        if (slots[k] == NULL)
+        {
+            slots[k] = RC2D_malloc(16 + (seed >> 24));
+        }
+        else if (seed & 0x10000)
+        {
+            slots[k] = RC2D_realloc(slots[k], 16 + ((seed >> 20) & 255));
+        }
+        else
+        {
+            RC2D_free(slots[k]);
+            slots[k] = NULL;
+        }
+    }
+
+    for (int k = 0; k < 256; k++)
+    {
+        RC2D_free(slots[k]);
+    }
+    return 0;
+}
+
+Test(rc2d_memory, callsiteStats_aggregateAndPeak) {
+    void* blocks[10];
+    const int line = __LINE__ + 3;
+    for (int i = 0; i < 10; i++)
+    {
+        blocks[i] = RC2D_malloc(100);
+    }
+
+    RC2D_MemoryCallsiteStats stats;
+    cr_assert(find_callsite(line, &stats));
+    cr_assert_eq(stats.liveCount, 10);
+    cr_assert_eq(stats.liveBytes, 1000);
+    cr_assert_eq(stats.peakBytes, 1000);
+
+    for (int i = 0; i < 10; i++)
+    {
+        RC2D_free(blocks[i]);
+    }
+
+    cr_assert(find_callsite(line, &stats));
+    cr_assert_eq(stats.liveCount, 0);
+    cr_assert_eq(stats.liveBytes, 0);
+    cr_assert_eq(stats.peakBytes, 1000);
+    cr_assert_eq(stats.totalCount, 10);
+}
+
+Test(rc2d_memory, tracker_threadSafeUnderChurn) {
+    RC2D_Thread* threads[MEMORY_THREAD_COUNT];
+    for (int i = 0; i < MEMORY_THREAD_COUNT; i++)
+    {
+        threads[i] = rc2d_thread_new(churn_worker, "rc2d_memory_churn", (void*)(uintptr_t)(i + 1));
+        cr_assert_not_null(threads[i]);
+    }
+    for (int i = 0; i < MEMORY_THREAD_COUNT; i++)
+    {
+        rc2d_thread_wait(threads[i], NULL);
+    }
+
+    /* Tout a été libéré : aucun site d'appel de ce fichier ne doit garder d'allocation vivante */
+    RC2D_MemoryCallsiteStats stats[512];
+    const int count = rc2d_memory_getTopCallsites(stats, 512);
+    for (int i = 0; i < count; i++)
+    {
+        if (SDL_strcmp(stats[i].file, __FILE__) == 0)
+        {
+            cr_assert_eq(stats[i].liveCount, 0, "%s:%d", stats[i].file, stats[i].line);
+            cr_assert_eq(stats[i].liveBytes, 0, "%s:%d", stats[i].file, stats[i].line);
+        }
+    }
+}
+
+Test(rc2d_memory, pool_leaksTrackedPerPool) {
+    RC2D_Pool* pool = rc2d_memory_createPool("leaky", 32, 0, true);
+    cr_assert_not_null(pool);
+
+    const int line = __LINE__ + 1;
+    void* leaked = RC2D_pool_alloc(pool);
+    cr_assert_not_null(leaked);
+
+    RC2D_MemoryCallsiteStats stats;
+    cr_assert(find_callsite(line, &stats));
+    cr_assert_eq(stats.liveCount, 1);
+    cr_assert_eq(stats.liveBytes, 32);
+
+    // La destruction signale l'objet non rendu et le retire du suivi
+    rc2d_memory_destroyPool(pool);
+    cr_assert(find_callsite(line, &stats));
+    cr_assert_eq(stats.liveCount, 0);
+    cr_assert_eq(stats.liveBytes, 0);
+}
+
+#endif // RC2D_MEMORY_DEBUG_ENABLED
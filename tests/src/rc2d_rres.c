@@ -0,0 +1,403 @@
+#include <RC2D/RC2D_rres.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+
+#include <monocypher/monocypher.h>
+#include <SDL3/SDL_filesystem.h>
+
+#define RRES_TEST_PASSWORD "rc2dtests"
+
+/* Propriétés en tête des données : propCount + 4 props (layout attendu par l'unpack) */
+#define RRES_PROPS_SIZE 20
+
+#define RRES_PACK_TEST_DIR "rc2d_rres_pack_test/"
+#define RRES_PACK_CHUNK_COUNT 3
+#define RRES_PACK_PAYLOAD_SIZE 256
+
+#define RRES_IMAGE_TARGET_SIZE 512
+
+static const uint8_t pack_salt[16] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+static uint8_t pack_key[32];
+
+/* Même dérivation que rrespacker : Argon2i 16 MB, 3 passes, mot de passe sur 16 octets */
+static void derive_pack_key(void)
+{
+    uint8_t pass[16] = { 0 };
+    SDL_memcpy(pass, RRES_TEST_PASSWORD, SDL_strlen(RRES_TEST_PASSWORD));
+
+    void* workArea = RC2D_malloc(16384 * 1024);
+    cr_assert_not_null(workArea);
+
+    crypto_argon2_config config = { CRYPTO_ARGON2_I, 16384, 3, 1 };
+    crypto_argon2_inputs inputs = { pass, pack_salt, 16, 16 };
+    crypto_argon2_extras extras = { 0 };
+    crypto_argon2(pack_key, 32, workArea, config, inputs, extras);
+    RC2D_free(workArea);
+}
+
+/* Chunk RAWD chiffré XChaCha20 comme le produit rrespacker : données + salt[16] + nonce[24] + MAC[16] */
+static rresResourceChunk make_encrypted_chunk(int index)
+{
+    Uint8 plain[RRES_PROPS_SIZE + 64];
+    const unsigned int payloadSize = sizeof(plain) - RRES_PROPS_SIZE;
+    const int props[5] = { 4, (int)payloadSize, 0, 0, 0 };
+    SDL_memcpy(plain, props, sizeof(props));
+    for (unsigned int i = 0; i < payloadSize; ++i) plain[RRES_PROPS_SIZE + i] = (Uint8)(index + i);
+
+    uint8_t nonce[24] = { 0 };
+    SDL_memcpy(nonce, &index, sizeof(index));
+
+    rresResourceChunk chunk = { 0 };
+    SDL_memcpy(chunk.info.type, "RAWD", 4);
+    chunk.info.id = index;
+    chunk.info.cipherType = RRES_CIPHER_XCHACHA20_POLY1305;
+    chunk.info.compType = RRES_COMP_NONE;
+    chunk.info.baseSize = sizeof(plain);
+    chunk.info.packedSize = sizeof(plain) + 16 + 24 + 16;
+
+    Uint8* packed = (Uint8*)RC2D_malloc(chunk.info.packedSize);
+    cr_assert_not_null(packed);
+    crypto_aead_lock(packed, packed + sizeof(plain) + 16 + 24, pack_key, nonce, NULL, 0, plain, sizeof(plain));
+    SDL_memcpy(packed + sizeof(plain), pack_salt, 16);
+    SDL_memcpy(packed + sizeof(plain) + 16, nonce, 24);
+    chunk.data.raw = packed;
+    return chunk;
+}
+
+/* Déchiffre 'count' chunks et vérifie leur contenu */
+static void unpack_chunks(int count)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        rresResourceChunk chunk = make_encrypted_chunk(i);
+        cr_assert_eq(rc2d_rres_unpackResourceChunk(&chunk), 0);
+        cr_assert_eq(chunk.data.props[0], 64);
+        cr_assert_eq(((Uint8*)chunk.data.raw)[1], (Uint8)(i + 1));
+        rresUnloadResourceChunk(chunk);
+    }
+}
+
+static void setup_rres(void)
+{
+    derive_pack_key();
+    rc2d_rres_setCipherPassword(RRES_TEST_PASSWORD);
+}
+
+static void teardown_rres(void)
+{
+    rc2d_rres_setKeyCacheEnabled(true);
+    rc2d_rres_cleanCipherPassword();
+}
+
+TestSuite(rc2d_rres, .init = setup_rres, .fini = teardown_rres);
+
+Test(rc2d_rres, keyCache_wrongPasswordStillFails) {
+    /* Clé du bon mot de passe en cache */
+    unpack_chunks(1);
+
+    /* Le cache est indexé par mot de passe : un autre mot de passe ne réutilise pas la clé */
+    rc2d_rres_setCipherPassword("wrongpassword");
+    rresResourceChunk chunk = make_encrypted_chunk(0);
+    cr_assert_eq(rc2d_rres_unpackResourceChunk(&chunk), 2);
+    rresUnloadResourceChunk(chunk);
+
+    rc2d_rres_setCipherPassword(RRES_TEST_PASSWORD);
+    unpack_chunks(1);
+}
+
+Test(rc2d_rres, unpackChunksParallel_reportsPerChunkErrors) {
+    rresResourceChunk chunks[64];
+    int results[64];
+    for (int i = 0; i < 64; ++i) chunks[i] = make_encrypted_chunk(i);
+
+    /* Chunk 17 corrompu : le MAC ne correspond plus */
+    ((Uint8*)chunks[17].data.raw)[0] ^= 0xFF;
+
+    cr_assert_eq(rc2d_rres_unpackChunksParallel(chunks, 64, 4, results), 1);
+    for (int i = 0; i < 64; ++i)
+    {
+        if (i == 17)
+        {
+            cr_assert_eq(results[i], 2);
+            continue;
+        }
+        cr_assert_eq(results[i], 0);
+        cr_assert_eq(chunks[i].info.cipherType, RRES_CIPHER_NONE);
+        cr_assert_eq(((Uint8*)chunks[i].data.raw)[1], (Uint8)(i + 1));
+    }
+
+    for (int i = 0; i < 64; ++i) rresUnloadResourceChunk(chunks[i]);
+}
+
+/* Ajoute à 'file' un chunk non compressé/non chiffré : info + propCount + props + payload */
+static Uint64 append_chunk(Uint8* file, Uint64 offset, const char type[4], int id, const void* props, unsigned int propsSize, const void* raw, unsigned int rawSize)
+{
+    rresResourceChunkInfo info = { 0 };
+    SDL_memcpy(info.type, type, 4);
+    info.id = id;
+    info.packedSize = info.baseSize = propsSize + rawSize;
+
+    Uint8* data = file + offset + sizeof(info);
+    SDL_memcpy(data, props, propsSize);
+    SDL_memcpy(data + propsSize, raw, rawSize);
+    info.crc32 = rresComputeCRC32(data, info.packedSize);
+    SDL_memcpy(file + offset, &info, sizeof(info));
+    return offset + sizeof(info) + info.packedSize;
+}
+
+/* Pack de RRES_PACK_CHUNK_COUNT chunks RAWD ("chunk_<i>.bin") suivis d'un CDIR */
+static void write_test_pack(void)
+{
+    Uint8* file = (Uint8*)RC2D_calloc(64 * 1024, 1);
+    cr_assert_not_null(file);
+
+    rresFileHeader header = { { 'r', 'r', 'e', 's' }, 100, RRES_PACK_CHUNK_COUNT + 1, 0, 0 };
+    Uint64 offset = sizeof(header);
+
+    Uint8 cdir[RRES_PACK_CHUNK_COUNT * (16 + 16)];
+    unsigned int cdirSize = 0;
+    for (int i = 0; i < RRES_PACK_CHUNK_COUNT; ++i)
+    {
+        char name[16] = { 0 };
+        SDL_snprintf(name, sizeof(name), "chunk_%d.bin", i);
+        const int id = (int)rresComputeCRC32((unsigned char*)name, (int)SDL_strlen(name));
+
+        Uint8 payload[RRES_PACK_PAYLOAD_SIZE];
+        for (int b = 0; b < RRES_PACK_PAYLOAD_SIZE; ++b) payload[b] = (Uint8)(i * 7 + b);
+        const unsigned int props[2] = { 1, RRES_PACK_PAYLOAD_SIZE };
+
+        const unsigned int entry[4] = { (unsigned int)id, (unsigned int)offset, 0, 16 };
+        SDL_memcpy(cdir + cdirSize, entry, sizeof(entry));
+        SDL_memcpy(cdir + cdirSize + sizeof(entry), name, 16);
+        cdirSize += sizeof(entry) + 16;
+
+        offset = append_chunk(file, offset, "RAWD", id, props, sizeof(props), payload, sizeof(payload));
+    }
+
+    header.cdOffset = (unsigned int)offset;
+    const unsigned int cdirProps[2] = { 1, RRES_PACK_CHUNK_COUNT };
+    offset = append_chunk(file, offset, "CDIR", 0, cdirProps, sizeof(cdirProps), cdir, cdirSize);
+    SDL_memcpy(file, &header, sizeof(header));
+
+    cr_assert(SDL_SaveFile(RRES_PACK_TEST_DIR "test.rres", file, (size_t)offset));
+    RC2D_free(file);
+}
+
+static void setup_rres_pack(void)
+{
+    cr_assert(SDL_CreateDirectory(RRES_PACK_TEST_DIR));
+    write_test_pack();
+    cr_assert(rc2d_storage_openTitle(RRES_PACK_TEST_DIR));
+}
+
+static void teardown_rres_pack(void)
+{
+    rc2d_storage_closeTitle();
+    SDL_RemovePath(RRES_PACK_TEST_DIR "test.rres");
+    SDL_RemovePath(RRES_PACK_TEST_DIR);
+}
+
+TestSuite(rc2d_rres_pack, .init = setup_rres_pack, .fini = teardown_rres_pack);
+
+Test(rc2d_rres_pack, loadPackChunk_byIdAndName) {
+    RC2D_RresPack* pack = rc2d_rres_openPack("test.rres", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(pack);
+    cr_assert_eq(rc2d_rres_getPackChunkCount(pack), RRES_PACK_CHUNK_COUNT + 1);
+
+    for (int i = RRES_PACK_CHUNK_COUNT - 1; i >= 0; --i)
+    {
+        char name[16];
+        SDL_snprintf(name, sizeof(name), "chunk_%d.bin", i);
+        const int id = rc2d_rres_getPackResourceId(pack, name);
+        cr_assert_eq(id, (int)rresComputeCRC32((unsigned char*)name, (int)SDL_strlen(name)));
+
+        rresResourceChunkInfo info;
+        cr_assert(rc2d_rres_getPackChunkInfo(pack, id, &info));
+        cr_assert_eq(info.baseSize, 8 + RRES_PACK_PAYLOAD_SIZE);
+
+        rresResourceChunk chunk = rc2d_rres_loadPackChunkByName(pack, name);
+        cr_assert_not_null(chunk.data.raw);
+        cr_assert_eq(chunk.data.propCount, 1);
+        cr_assert_eq(chunk.data.props[0], RRES_PACK_PAYLOAD_SIZE);
+        cr_assert_eq(((Uint8*)chunk.data.raw)[RRES_PACK_PAYLOAD_SIZE - 1], (Uint8)(i * 7 + RRES_PACK_PAYLOAD_SIZE - 1));
+        rresUnloadResourceChunk(chunk);
+    }
+
+    cr_assert_eq(rc2d_rres_getPackResourceId(pack, "missing.bin"), 0);
+    cr_assert_null(rc2d_rres_loadPackChunk(pack, 0x12345678).data.raw);
+
+    rc2d_rres_closePack(pack);
+    cr_assert_null(rc2d_rres_openPack("missing.rres", RC2D_STORAGE_TITLE));
+}
+
+Test(rc2d_rres_pack, loadPackChunk_cacheReturnsCopies) {
+    RC2D_RresPack* pack = rc2d_rres_openPack("test.rres", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(pack);
+    rc2d_rres_setPackCacheBudget(pack, 2 * (RRES_PACK_PAYLOAD_SIZE + 4));
+
+    rresResourceChunk first = rc2d_rres_loadPackChunkByName(pack, "chunk_1.bin");
+    rresResourceChunk second = rc2d_rres_loadPackChunkByName(pack, "chunk_1.bin");
+    cr_assert_not_null(second.data.raw);
+    cr_assert_neq(first.data.raw, second.data.raw);
+    cr_assert_eq(SDL_memcmp(first.data.raw, second.data.raw, RRES_PACK_PAYLOAD_SIZE), 0);
+
+    /* Le chunk rendu appartient à l'appelant : le modifier n'altère pas le cache */
+    ((Uint8*)first.data.raw)[0] ^= 0xFF;
+    rresUnloadResourceChunk(first);
+    rresUnloadResourceChunk(second);
+    rresResourceChunk third = rc2d_rres_loadPackChunkByName(pack, "chunk_1.bin");
+    cr_assert_eq(((Uint8*)third.data.raw)[0], (Uint8)7);
+    rresUnloadResourceChunk(third);
+
+    rc2d_rres_setPackCacheBudget(pack, 0);
+    rc2d_rres_closePack(pack);
+}
+
+Test(rc2d_rres_pack, openPack_rejectsOversizedCentralDirectoryCount) {
+    Uint8 file[1024] = { 0 };
+    rresFileHeader header = { { 'r', 'r', 'e', 's' }, 100, 2, 0, 0 };
+    Uint64 offset = sizeof(header);
+
+    const unsigned int props[2] = { 1, 4 };
+    const Uint8 payload[4] = { 1, 2, 3, 4 };
+    offset = append_chunk(file, offset, "RAWD", 42, props, sizeof(props), payload, sizeof(payload));
+
+    /* CDIR annonçant bien plus d'entrées que ses 16 octets de données ne peuvent en contenir */
+    header.cdOffset = (unsigned int)offset;
+    const unsigned int cdirProps[2] = { 1, 0x80000000u };
+    const unsigned int entry[4] = { 42, (unsigned int)sizeof(header), 0, 0 };
+    offset = append_chunk(file, offset, "CDIR", 0, cdirProps, sizeof(cdirProps), entry, sizeof(entry));
+    SDL_memcpy(file, &header, sizeof(header));
+    cr_assert(SDL_SaveFile(RRES_PACK_TEST_DIR "corrupt.rres", file, (size_t)offset));
+
+    RC2D_RresPack* pack = rc2d_rres_openPack("corrupt.rres", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(pack);
+    cr_assert_eq(rc2d_rres_getPackResourceId(pack, "chunk_0.bin"), 0);
+
+    rresResourceChunk chunk = rc2d_rres_loadPackChunk(pack, 42);
+    cr_assert_not_null(chunk.data.raw);
+    rresUnloadResourceChunk(chunk);
+
+    rc2d_rres_closePack(pack);
+    SDL_RemovePath(RRES_PACK_TEST_DIR "corrupt.rres");
+}
+
+static SDL_Surface* image_target = NULL;
+
+/* Chunk IMGE non compressé : props { largeur, hauteur, format, mipmaps } + pixels copiés */
+static rresResourceChunk make_image_chunk(Uint32 width, Uint32 height, int format, const void* pixels, unsigned int size)
+{
+    rresResourceChunk chunk = { 0 };
+    SDL_memcpy(chunk.info.type, "IMGE", 4);
+    chunk.info.baseSize = chunk.info.packedSize = 4 + 4 * 4 + size;
+    chunk.data.propCount = 4;
+    chunk.data.props = (unsigned int*)RC2D_malloc(4 * sizeof(unsigned int));
+    cr_assert_not_null(chunk.data.props);
+    chunk.data.props[0] = width;
+    chunk.data.props[1] = height;
+    chunk.data.props[2] = (unsigned int)format;
+    chunk.data.props[3] = 1;
+    chunk.data.raw = RC2D_malloc(size);
+    cr_assert_not_null(chunk.data.raw);
+    SDL_memcpy(chunk.data.raw, pixels, size);
+    return chunk;
+}
+
+/* Dessine la texture sur la cible logicielle et lit le pixel (x, y) */
+static void read_rendered_pixel(SDL_Texture* texture, int x, int y, Uint8* r, Uint8* g, Uint8* b, Uint8* a)
+{
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_NONE);
+    cr_assert(SDL_RenderTexture(rc2d_engine_state.renderer, texture, NULL, NULL));
+    cr_assert(SDL_FlushRenderer(rc2d_engine_state.renderer));
+    const float scale = (float)image_target->w / (float)texture->w;
+    cr_assert(SDL_ReadSurfacePixel(image_target, (int)(x * scale), (int)(y * scale), r, g, b, a));
+}
+
+static void setup_rres_image(void)
+{
+    image_target = SDL_CreateSurface(RRES_IMAGE_TARGET_SIZE, RRES_IMAGE_TARGET_SIZE, SDL_PIXELFORMAT_RGBA32);
+    cr_assert_not_null(image_target);
+    rc2d_engine_state.renderer = SDL_CreateSoftwareRenderer(image_target);
+    cr_assert_not_null(rc2d_engine_state.renderer);
+}
+
+static void teardown_rres_image(void)
+{
+    SDL_DestroyRenderer(rc2d_engine_state.renderer);
+    rc2d_engine_state.renderer = NULL;
+    SDL_DestroySurface(image_target);
+    image_target = NULL;
+}
+
+TestSuite(rc2d_rres_image, .init = setup_rres_image, .fini = teardown_rres_image);
+
+Test(rc2d_rres_image, loadImageFromChunk_uploadsRGBA) {
+    const Uint8 pixels[2 * 2 * 4] = { 255, 0, 0, 255,   0, 255, 0, 255,
+                                      0, 0, 255, 255,   255, 255, 255, 255 };
+    rresResourceChunk chunk = make_image_chunk(2, 2, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, pixels, sizeof(pixels));
+
+    RC2D_Image image = rc2d_rres_loadImageFromChunk(chunk);
+    cr_assert_not_null(image.sdl_texture);
+    cr_assert_eq(image.sdl_texture->w, 2);
+
+    Uint8 r, g, b, a;
+    read_rendered_pixel(image.sdl_texture, 1, 0, &r, &g, &b, &a);
+    cr_assert(r == 0 && g == 255 && b == 0);
+    read_rendered_pixel(image.sdl_texture, 0, 1, &r, &g, &b, &a);
+    cr_assert(r == 0 && g == 0 && b == 255);
+
+    rc2d_graphics_freeImage(&image);
+    rresUnloadResourceChunk(chunk);
+
+    /* Données tronquées : refusées */
+    chunk = make_image_chunk(4, 4, RRES_PIXELFORMAT_UNCOMP_R8G8B8A8, pixels, sizeof(pixels));
+    cr_assert_null(rc2d_rres_loadImageFromChunk(chunk).sdl_texture);
+    rresUnloadResourceChunk(chunk);
+}
+
+Test(rc2d_rres_image, loadImageFromChunk_decodesBC1OnCPU) {
+    /* Pas de SDL_GPUDevice derrière le renderer logiciel : décompression CPU */
+    cr_assert_null(rc2d_engine_state.gpu_device);
+
+    /* Bloc 4x4 : c0 = rouge pur, c1 = bleu pur, ligne 0 -> index 0, ligne 3 -> index 1 */
+    const Uint8 block[8] = { 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x55 };
+    rresResourceChunk chunk = make_image_chunk(4, 4, RRES_PIXELFORMAT_COMP_DXT1_RGB, block, sizeof(block));
+
+    RC2D_Image image = rc2d_rres_loadImageFromChunk(chunk);
+    cr_assert_not_null(image.sdl_texture);
+
+    Uint8 r, g, b, a;
+    read_rendered_pixel(image.sdl_texture, 2, 0, &r, &g, &b, &a);
+    cr_assert(r == 255 && g == 0 && b == 0);
+    read_rendered_pixel(image.sdl_texture, 2, 3, &r, &g, &b, &a);
+    cr_assert(r == 0 && g == 0 && b == 255);
+
+    rc2d_graphics_freeImage(&image);
+    rresUnloadResourceChunk(chunk);
+}
+
+Test(rc2d_rres_image, loadImageFromChunk_decodesBC1ThreeColorMode) {
+    /* c0 = bleu <= c1 = rouge : mode 3 couleurs, ligne 0 -> index 2 (moyenne), ligne 1 -> index 3 (noir) */
+    const Uint8 block[8] = { 0x1F, 0x00, 0x00, 0xF8, 0xAA, 0xFF, 0x00, 0x00 };
+    const int formats[2] = { RRES_PIXELFORMAT_COMP_DXT1_RGB, RRES_PIXELFORMAT_COMP_DXT1_RGBA };
+
+    for (int i = 0; i < 2; ++i)
+    {
+        rresResourceChunk chunk = make_image_chunk(4, 4, formats[i], block, sizeof(block));
+        RC2D_Image image = rc2d_rres_loadImageFromChunk(chunk);
+        cr_assert_not_null(image.sdl_texture);
+
+        Uint8 r, g, b, a;
+        read_rendered_pixel(image.sdl_texture, 1, 0, &r, &g, &b, &a);
+        cr_assert(r == 127 && g == 0 && b == 127 && a == 255);
+
+        /* Noir opaque en DXT1 RGB, transparent en DXT1 RGBA */
+        read_rendered_pixel(image.sdl_texture, 1, 1, &r, &g, &b, &a);
+        cr_assert(r == 0 && g == 0 && b == 0);
+        cr_assert_eq(a, formats[i] == RRES_PIXELFORMAT_COMP_DXT1_RGBA ? 0 : 255);
+
+        rc2d_graphics_freeImage(&image);
+        rresUnloadResourceChunk(chunk);
+    }
+}
@@ -0,0 +1,184 @@
+#include <RC2D/RC2D_save.h>
+#include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_internal.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+
+#include <SDL3/SDL_endian.h>
+
+#if RC2D_DATA_MODULE_ENABLED
+
+#define SAVE_TEST_SIZE (256 * 1024)
+
+static Uint8* make_payload(Uint8 seed)
+{
+    Uint8* payload = (Uint8*)RC2D_malloc(SAVE_TEST_SIZE);
+    cr_assert_not_null(payload);
+    for (int i = 0; i < SAVE_TEST_SIZE; ++i) payload[i] = (Uint8)((i / 32) * seed);
+    return payload;
+}
+
+static void check_saved(const char* path, const char* passphrase, const Uint8* expected)
+{
+    void* data = NULL;
+    size_t size = 0;
+    cr_assert(rc2d_save_read(path, passphrase, &data, &size));
+    cr_assert_eq(size, SAVE_TEST_SIZE);
+    cr_assert_eq(SDL_memcmp(data, expected, SAVE_TEST_SIZE), 0);
+    RC2D_free(data);
+}
+
+static void setup_save(void)
+{
+    cr_assert(rc2d_storage_openUser("RC2DTests", "rc2d_save"));
+}
+
+static void teardown_save(void)
+{
+    rc2d_save_shutdown();
+    rc2d_storage_userRemovePath("slot.sav");
+    rc2d_storage_closeUser();
+}
+
+TestSuite(rc2d_save, .init = setup_save, .fini = teardown_save);
+
+Test(rc2d_save, write_roundtripCompressedAndEncrypted) {
+    Uint8* payload = make_payload(3);
+
+    RC2D_SaveOptions options;
+    SDL_zero(options);
+    cr_assert(rc2d_save_write("slot.sav", payload, SAVE_TEST_SIZE, &options));
+    check_saved("slot.sav", NULL, payload);
+
+    options.compress = true;
+    options.compressFormat = RC2D_COMPRESS_FORMAT_LZ4;
+    options.passphrase = "rc2dtests";
+    options.cipherFormat = RC2D_CIPHER_FORMAT_AES;
+    cr_assert(rc2d_save_write("slot.sav", payload, SAVE_TEST_SIZE, &options));
+    check_saved("slot.sav", "rc2dtests", payload);
+
+    /* Aucun fichier temporaire ne reste après le renommage */
+    cr_assert_not(rc2d_storage_userFileExists("slot.sav.tmp"));
+
+    /* Mauvaise passphrase / passphrase manquante : échec */
+    void* data = NULL;
+    size_t size = 0;
+    cr_assert_not(rc2d_save_read("slot.sav", "wrong", &data, &size));
+    cr_assert_not(rc2d_save_read("slot.sav", NULL, &data, &size));
+    cr_assert_null(data);
+
+    RC2D_free(payload);
+}
+
+/* Réécrit un champ 64 bits de l'en-tête d'une sauvegarde (little-endian) */
+static void tamper_header64(const char* path, size_t offset, Uint64 value)
+{
+    void* bytes = NULL;
+    Uint64 len = 0;
+    cr_assert(rc2d_storage_userReadFile(path, &bytes, &len));
+    cr_assert_gt(len, offset + sizeof(value));
+    value = SDL_Swap64LE(value);
+    SDL_memcpy((Uint8*)bytes + offset, &value, sizeof(value));
+    cr_assert(rc2d_storage_userWriteFile(path, bytes, len));
+    RC2D_free(bytes);
+}
+
+Test(rc2d_save, read_rejectsTamperedHeaderSizes) {
+    /* [magic 8][version, flags, compressFormat, cipherFormat : 4 x 4][originalSize 8][compressedSize 8] */
+    const size_t originalSizeOffset = 8 + 4 * sizeof(Uint32);
+    const size_t compressedSizeOffset = originalSizeOffset + sizeof(Uint64);
+    Uint8* payload = make_payload(3);
+
+    RC2D_SaveOptions options;
+    SDL_zero(options);
+    options.compress = true;
+    options.compressFormat = RC2D_COMPRESS_FORMAT_LZ4;
+    options.passphrase = "rc2dtests";
+    options.cipherFormat = RC2D_CIPHER_FORMAT_AES;
+
+    void* data = NULL;
+    size_t size = 0;
+
+    /* compressedSize plus grand que le texte chiffré : lu au-delà du buffer déchiffré sans le contrôle */
+    cr_assert(rc2d_save_write("slot.sav", payload, SAVE_TEST_SIZE, &options));
+    tamper_header64("slot.sav", compressedSizeOffset, (Uint64)64 * 1024 * 1024);
+    cr_assert_not(rc2d_save_read("slot.sav", "rc2dtests", &data, &size));
+    cr_assert_null(data);
+
+    /* originalSize démesuré : refusé avant l'allocation du buffer décompressé */
+    cr_assert(rc2d_save_write("slot.sav", payload, SAVE_TEST_SIZE, &options));
+    tamper_header64("slot.sav", originalSizeOffset, (Uint64)1 << 40);
+    cr_assert_not(rc2d_save_read("slot.sav", "rc2dtests", &data, &size));
+    cr_assert_null(data);
+
+    /* Sans compression, originalSize doit correspondre exactement au payload */
+    options.compress = false;
+    options.passphrase = NULL;
+    cr_assert(rc2d_save_write("slot.sav", payload, SAVE_TEST_SIZE, &options));
+    tamper_header64("slot.sav", originalSizeOffset, SAVE_TEST_SIZE + 1);
+    cr_assert_not(rc2d_save_read("slot.sav", NULL, &data, &size));
+    cr_assert_null(data);
+
+    RC2D_free(payload);
+}
+
+typedef struct SaveCallbackLog {
+    char paths[4][32];
+    int count;
+} SaveCallbackLog;
+
+static void on_saved(const char* path, bool success, void* userdata)
+{
+    SaveCallbackLog* log = (SaveCallbackLog*)userdata;
+    cr_assert(success);
+    cr_assert_lt(log->count, 4);
+    SDL_strlcpy(log->paths[log->count++], path, sizeof(log->paths[0]));
+}
+
+static void teardown_saveOrder(void)
+{
+    rc2d_storage_userRemovePath("slot_a.sav");
+    rc2d_storage_userRemovePath("slot_b.sav");
+    rc2d_storage_userRemovePath("slot_c.sav");
+    teardown_save();
+}
+
+Test(rc2d_save, writeAsync_callbacksInSubmissionOrder, .fini = teardown_saveOrder) {
+    Uint8* first = make_payload(5);
+    Uint8* second = make_payload(7);
+
+    SaveCallbackLog log;
+    SDL_zero(log);
+    RC2D_SaveOptions options;
+    SDL_zero(options);
+    options.compress = true;
+    options.compressFormat = RC2D_COMPRESS_FORMAT_LZ4_HC;
+    options.callback = on_saved;
+    options.userdata = &log;
+
+    /* Chemins distincts : l'ordre des callbacks est vérifié, pas seulement leur nombre */
+    cr_assert(rc2d_save_writeAsync("slot_a.sav", first, SAVE_TEST_SIZE, &options));
+    cr_assert(rc2d_save_writeAsync("slot_b.sav", second, SAVE_TEST_SIZE, &options));
+    cr_assert(rc2d_save_writeAsync("slot_c.sav", first, SAVE_TEST_SIZE, &options));
+
+    /* Les données sont copiées : l'appelant peut réutiliser ses buffers immédiatement */
+    Uint8* expectedFirst = make_payload(5);
+    SDL_memset(first, 0, SAVE_TEST_SIZE);
+
+    rc2d_save_waitAll();
+    cr_assert_eq(log.count, 3);
+    cr_assert_str_eq(log.paths[0], "slot_a.sav");
+    cr_assert_str_eq(log.paths[1], "slot_b.sav");
+    cr_assert_str_eq(log.paths[2], "slot_c.sav");
+    cr_assert_eq(rc2d_save_getPendingCount(), 0);
+
+    check_saved("slot_a.sav", NULL, expectedFirst);
+    check_saved("slot_b.sav", NULL, second);
+    check_saved("slot_c.sav", NULL, expectedFirst);
+
+    RC2D_free(expectedFirst);
+    RC2D_free(first);
+    RC2D_free(second);
+}
+
+#endif // RC2D_DATA_MODULE_ENABLED
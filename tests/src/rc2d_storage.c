@@ -0,0 +1,96 @@
+#include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_memory.h>
+#include <criterion/criterion.h>
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
+
+#define STORAGE_TEST_DIR "rc2d_storage_test/"
+#define STORAGE_TEST_FILE_SIZE (32 * 1024 * 1024)
+
+static void setup_storage(void)
+{
+    cr_assert(SDL_CreateDirectory(STORAGE_TEST_DIR));
+
+    Uint8* content = (Uint8*)RC2D_malloc(STORAGE_TEST_FILE_SIZE);
+    cr_assert_not_null(content);
+    for (int i = 0; i < STORAGE_TEST_FILE_SIZE; ++i) content[i] = (Uint8)(i * 31);
+    cr_assert(SDL_SaveFile(STORAGE_TEST_DIR "big.bin", content, STORAGE_TEST_FILE_SIZE));
+    RC2D_free(content);
+
+    cr_assert(rc2d_storage_openTitle(STORAGE_TEST_DIR));
+}
+
+static void teardown_storage(void)
+{
+    rc2d_storage_closeTitle();
+    SDL_RemovePath(STORAGE_TEST_DIR "big.bin");
+    SDL_RemovePath(STORAGE_TEST_DIR);
+}
+
+TestSuite(rc2d_storage, .init = setup_storage, .fini = teardown_storage);
+
+Test(rc2d_storage, titleMapFile_matchesReadFile) {
+    void* bytes = NULL;
+    Uint64 len = 0;
+    cr_assert(rc2d_storage_titleReadFile("big.bin", &bytes, &len));
+
+    RC2D_StorageMapping file;
+    cr_assert(rc2d_storage_titleMapFile("big.bin", &file));
+    cr_assert_eq(file.len, len);
+    cr_assert_eq(SDL_memcmp(file.data, bytes, (size_t)len), 0);
+
+    rc2d_storage_unmapFile(&file);
+    cr_assert_null(file.data);
+    RC2D_free(bytes);
+
+    cr_assert_not(rc2d_storage_titleMapFile("missing.bin", &file));
+    cr_assert_null(file.data);
+}
+
+Test(rc2d_storage, titleOpenStream_readsInChunks) {
+    RC2D_StorageStream* stream = rc2d_storage_titleOpenStream("big.bin");
+    cr_assert_not_null(stream);
+    cr_assert_eq(rc2d_storage_streamSize(stream), STORAGE_TEST_FILE_SIZE);
+    cr_assert_eq(SDL_GetIOSize(rc2d_storage_streamGetIO(stream)), STORAGE_TEST_FILE_SIZE);
+
+    /* Lecture complète par blocs de 64 Ko : même contenu que celui écrit par le setup */
+    Uint8 chunk[64 * 1024];
+    Uint64 total = 0;
+    bool same = true;
+    size_t n;
+    while ((n = rc2d_storage_streamRead(stream, chunk, sizeof(chunk))) > 0)
+    {
+        for (size_t i = 0; i < n; ++i) same &= (chunk[i] == (Uint8)((total + i) * 31));
+        total += n;
+    }
+    cr_assert(same);
+    cr_assert_eq(total, STORAGE_TEST_FILE_SIZE);
+
+    /* Accès aléatoire */
+    cr_assert_eq(rc2d_storage_streamSeek(stream, 1000, SDL_IO_SEEK_SET), 1000);
+    cr_assert_eq(rc2d_storage_streamRead(stream, chunk, 1), 1);
+    cr_assert_eq(chunk[0], (Uint8)(1000 * 31));
+    cr_assert_eq(rc2d_storage_streamSeek(stream, -1, SDL_IO_SEEK_END), STORAGE_TEST_FILE_SIZE - 1);
+    cr_assert_eq(rc2d_storage_streamTell(stream), STORAGE_TEST_FILE_SIZE - 1);
+
+    rc2d_storage_closeStream(stream);
+
+    cr_assert_null(rc2d_storage_titleOpenStream("missing.bin"));
+}
+
+Test(rc2d_storage, openTitle_overrideWithoutTrailingSeparator) {
+    /* Même racine sans '/' final : les chemins directs doivent rester valides */
+    rc2d_storage_closeTitle();
+    cr_assert(rc2d_storage_openTitle("rc2d_storage_test"));
+
+    RC2D_StorageMapping file;
+    cr_assert(rc2d_storage_titleMapFile("big.bin", &file));
+    cr_assert_eq(file.len, STORAGE_TEST_FILE_SIZE);
+    rc2d_storage_unmapFile(&file);
+
+    RC2D_StorageStream* stream = rc2d_storage_titleOpenStream("big.bin");
+    cr_assert_not_null(stream);
+    cr_assert_eq(SDL_GetIOSize(rc2d_storage_streamGetIO(stream)), STORAGE_TEST_FILE_SIZE);
+    rc2d_storage_closeStream(stream);
+}
@@ -0,0 +1,167 @@
+#include <RC2D/RC2D_texturepacker.h>
+#include <RC2D/RC2D_memory.h>
+#include <RC2D/RC2D_storage.h>
+#include <RC2D/RC2D_internal.h>
+#include <criterion/criterion.h>
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_endian.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_surface.h>
+
+/* Construit un atlas en mémoire de `n` frames nommées "frame_<i>.png" (sans texture). */
+static RC2D_TP_Atlas make_atlas(int n)
+{
+    RC2D_TP_Atlas atlas = {0};
+    atlas.frames = (RC2D_TP_Frame*)RC2D_calloc((size_t)n, sizeof(RC2D_TP_Frame));
+    atlas._name_pool = (char*)RC2D_malloc((size_t)n * 24);
+    cr_assert_not_null(atlas.frames);
+    cr_assert_not_null(atlas._name_pool);
+
+    char* pool = atlas._name_pool;
+    for (int i = 0; i < n; ++i)
+    {
+        const int len = SDL_snprintf(pool, 24, "frame_%d.png", i);
+        atlas.frames[i].filename = pool;
+        atlas.frames[i].frame = (SDL_FRect){ (float)i, 0.0f, 16.0f, 16.0f };
+        pool += len + 1;
+    }
+    atlas.frame_count = n;
+    return atlas;
+}
+
+Test(rc2d_texturepacker, getFrame_hashed_matchesNames) {
+    RC2D_TP_Atlas atlas = make_atlas(1000);
+    cr_assert(rc2d_tp_buildFrameIndex(&atlas));
+
+    for (int i = 0; i < atlas.frame_count; ++i)
+    {
+        const RC2D_TP_Frame* f = rc2d_tp_getFrame(&atlas, atlas.frames[i].filename);
+        cr_assert_eq(f, &atlas.frames[i]);
+        cr_assert_eq(rc2d_tp_getFrameHandle(&atlas, atlas.frames[i].filename), i);
+    }
+    cr_assert_null(rc2d_tp_getFrame(&atlas, "missing.png"));
+    cr_assert_eq(rc2d_tp_getFrameHandle(&atlas, "missing.png"), RC2D_TP_INVALID_FRAME);
+    cr_assert_null(rc2d_tp_getFrameByHandle(&atlas, atlas.frame_count));
+
+    rc2d_tp_freeAtlas(&atlas);
+}
+
+Test(rc2d_texturepacker, getFrame_duplicateKeepsFirst) {
+    RC2D_TP_Atlas atlas = make_atlas(4);
+    atlas.frames[3].filename = atlas.frames[1].filename;
+    cr_assert(rc2d_tp_buildFrameIndex(&atlas));
+
+    cr_assert_eq(rc2d_tp_getFrameHandle(&atlas, "frame_1.png"), 1);
+
+    rc2d_tp_freeAtlas(&atlas);
+}
+
+/* Atlas TexturePacker minimal : deux frames côte à côte dans une image 16x8 */
+static const char TP_TEST_JSON[] =
+    "{\"frames\":["
+    "{\"filename\":\"a.png\",\"frame\":{\"x\":0,\"y\":0,\"w\":8,\"h\":8},"
+    "\"spriteSourceSize\":{\"x\":1,\"y\":2,\"w\":8,\"h\":8},\"sourceSize\":{\"w\":10,\"h\":12}},"
+    "{\"filename\":\"b.png\",\"frame\":{\"x\":8,\"y\":0,\"w\":8,\"h\":8},"
+    "\"spriteSourceSize\":{\"x\":0,\"y\":0,\"w\":8,\"h\":8},\"sourceSize\":{\"w\":8,\"h\":8}}"
+    "],\"meta\":{\"image\":\"atlas.bmp\",\"size\":{\"w\":16,\"h\":8}}}";
+
+#define TP_TEST_DIR "rc2d_tp_bake_test/"
+
+/* Écrit l'image d'atlas + le .rc2datlas dans TP_TEST_DIR et y ouvre le storage Title. */
+static SDL_Surface* setup_baked_atlas_storage(const void* baked, Uint64 baked_len)
+{
+    SDL_Surface* target = SDL_CreateSurface(16, 8, SDL_PIXELFORMAT_RGBA8888);
+    cr_assert_not_null(target);
+    rc2d_engine_state.renderer = SDL_CreateSoftwareRenderer(target);
+    cr_assert_not_null(rc2d_engine_state.renderer);
+
+    cr_assert(SDL_CreateDirectory(TP_TEST_DIR));
+    cr_assert(SDL_SaveBMP(target, TP_TEST_DIR "atlas.bmp"));
+    cr_assert(SDL_SaveFile(TP_TEST_DIR "atlas" RC2D_TP_BAKED_EXTENSION, baked, (size_t)baked_len));
+    cr_assert(rc2d_storage_openTitle(TP_TEST_DIR));
+    cr_assert(rc2d_storage_titleReady());
+    return target;
+}
+
+static void teardown_baked_atlas_storage(SDL_Surface* target)
+{
+    rc2d_storage_closeTitle();
+    SDL_RemovePath(TP_TEST_DIR "atlas" RC2D_TP_BAKED_EXTENSION);
+    SDL_RemovePath(TP_TEST_DIR "atlas.bmp");
+    SDL_RemovePath(TP_TEST_DIR);
+    SDL_DestroyRenderer(rc2d_engine_state.renderer);
+    rc2d_engine_state.renderer = NULL;
+    SDL_DestroySurface(target);
+}
+
+Test(rc2d_texturepacker, bakeAtlas_roundtrip) {
+    void* baked = NULL;
+    Uint64 baked_len = 0;
+    cr_assert(rc2d_tp_bakeAtlas(TP_TEST_JSON, sizeof(TP_TEST_JSON) - 1, &baked, &baked_len));
+    SDL_Surface* target = setup_baked_atlas_storage(baked, baked_len);
+    RC2D_safe_free(baked);
+
+    /* Le JSON n'existe pas : le loader doit prendre le .rc2datlas voisin */
+    RC2D_TP_Atlas atlas = rc2d_tp_loadAtlasFromStorage("atlas.json", RC2D_STORAGE_TITLE);
+    cr_assert_not_null(atlas.atlas_image.sdl_texture);
+    cr_assert_not_null(atlas._baked_data);
+    cr_assert_eq(atlas.frame_count, 2);
+    cr_assert_str_eq(atlas.atlas_image_name, "atlas.bmp");
+    cr_assert_float_eq(atlas.atlas_size.x, 16.0f, 1e-6);
+
+    const RC2D_TP_Frame* a = rc2d_tp_getFrame(&atlas, "a.png");
+    const RC2D_TP_Frame* b = rc2d_tp_getFrame(&atlas, "b.png");
+    cr_assert_eq(a, &atlas.frames[0]);
+    cr_assert_eq(b, &atlas.frames[1]);
+    cr_assert_float_eq(a->spriteSourceSize.y, 2.0f, 1e-6);
+    cr_assert_float_eq(a->sourceSize.y, 12.0f, 1e-6);
+    cr_assert_float_eq(b->frame.x, 8.0f, 1e-6);
+    cr_assert_null(rc2d_tp_getFrame(&atlas, "c.png"));
+
+    /* Reconstruire l'index ne doit pas libérer celui du buffer binaire */
+    cr_assert(rc2d_tp_buildFrameIndex(&atlas));
+    cr_assert_eq(rc2d_tp_getFrameHandle(&atlas, "b.png"), 1);
+
+    rc2d_tp_freeAtlas(&atlas);
+    teardown_baked_atlas_storage(target);
+}
+
+Test(rc2d_texturepacker, bakeAtlas_rejectsOtherVersion) {
+    void* baked = NULL;
+    Uint64 baked_len = 0;
+    cr_assert(rc2d_tp_bakeAtlas(TP_TEST_JSON, sizeof(TP_TEST_JSON) - 1, &baked, &baked_len));
+    ((Uint8*)baked)[4] = (Uint8)(RC2D_TP_BAKED_VERSION + 1);
+    SDL_Surface* target = setup_baked_atlas_storage(baked, baked_len);
+    RC2D_safe_free(baked);
+
+    RC2D_TP_Atlas atlas = rc2d_tp_loadBakedAtlasFromStorage("atlas" RC2D_TP_BAKED_EXTENSION, RC2D_STORAGE_TITLE);
+    cr_assert_null(atlas.frames);
+    cr_assert_null(atlas._baked_data);
+
+    teardown_baked_atlas_storage(target);
+}
+
+Test(rc2d_texturepacker, bakeAtlas_rejectsFullNameIndex) {
+    void* baked = NULL;
+    Uint64 baked_len = 0;
+    cr_assert(rc2d_tp_bakeAtlas(TP_TEST_JSON, sizeof(TP_TEST_JSON) - 1, &baked, &baked_len));
+
+    /* Remplit toutes les entrées de l'index (hash, frame 0) : plus aucune fin de sondage */
+    Uint8* bytes = (Uint8*)baked;
+    const Uint32 capacity = SDL_Swap32LE(*(const Uint32*)(bytes + 12));
+    const Uint32 strings_size = SDL_Swap32LE(*(const Uint32*)(bytes + 16));
+    Uint8* slot = bytes + baked_len - strings_size - (Uint64)capacity * 8;
+    for (Uint32 i = 0; i < capacity; ++i, slot += 8) {
+        SDL_memset(slot + 4, 0, 4);
+    }
+    SDL_Surface* target = setup_baked_atlas_storage(baked, baked_len);
+    RC2D_safe_free(baked);
+
+    RC2D_TP_Atlas atlas = rc2d_tp_loadBakedAtlasFromStorage("atlas" RC2D_TP_BAKED_EXTENSION, RC2D_STORAGE_TITLE);
+    cr_assert_null(atlas.frames);
+    cr_assert_null(atlas._baked_data);
+
+    teardown_baked_atlas_storage(target);
+}
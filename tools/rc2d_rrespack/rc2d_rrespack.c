@@ -0,0 +1,636 @@
+/**
+ * rc2d_rrespack : construit un pack .rres à partir d'un dossier d'assets.
+ *
+ * Usage : rc2d_rrespack <assets_dir> <output.rres> [--manifest <manifest.tsv>] [--no-compression] [--force]
+ *
+ * - Un chunk RAWD par fichier, nommé par son chemin relatif (style Unix) dans le répertoire central (CDIR).
+ * - LZ4 n'est gardé que si le gain mesuré dépasse RC2D_RRESPACK_MIN_GAIN_PERCENT, sinon le fichier est stocké tel quel.
+ * - Les fichiers au contenu identique partagent un seul chunk : leurs entrées CDIR pointent sur le même offset
+ *   (résolu par rc2d_rres_openPack / rc2d_rres_getPackResourceId).
+ * - Les atlas TexturePacker (JSON) sont aussi précalculés en "<nom>.rc2datlas" (cf. rc2d_tp_bakeAtlas).
+ * - Incrémental : "<output>.state" mémorise taille/date/hash/offset/compression de chaque entrée ; les entrées
+ *   inchangées sont recopiées telles quelles depuis l'ancien pack (ni relues ni recompressées), sauf si
+ *   --no-compression a changé depuis, et le pack n'est pas réécrit si rien n'a changé.
+ */
+#include <RC2D/RC2D_rres.h>
+#include <RC2D/RC2D_texturepacker.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_stdinc.h>
+
+#include <lz4/lz4.h>
+
+/* LZ4 n'est retenu que s'il réduit la taille d'au moins 10 % */
+#define RC2D_RRESPACK_MIN_GAIN_PERCENT 10
+
+/* Props d'un chunk RAWD : taille + extension sur 8 caractères (2 props) */
+#define RC2D_RRESPACK_RAWD_PROP_COUNT 3
+
+#define RC2D_RRESPACK_STATE_EXTENSION ".state"
+#define RC2D_RRESPACK_NO_CHUNK 0xFFFFFFFFu
+
+typedef struct RC2D_RrespackEntry {
+    char *name;            // Chemin relatif, nom dans le CDIR
+    char *sourcePath;      // Fichier lu sur disque (le JSON pour un atlas précalculé)
+    bool bakedAtlas;       // Entrée virtuelle : atlas précalculé depuis sourcePath
+    Uint64 sourceSize;
+    Sint64 sourceTime;
+    Uint64 hash;           // Hash du contenu empaqueté
+    Uint64 contentSize;
+    Uint32 offset;         // Offset du chunk (infos) dans le nouveau pack
+    int canonical;         // Entrée dont le chunk est partagé, -1 si chunk propre
+    unsigned int compType;
+    unsigned int packedSize;
+    unsigned int baseSize;
+} RC2D_RrespackEntry;
+
+typedef struct RC2D_RrespackState {
+    char *name;
+    Uint64 sourceSize;
+    Sint64 sourceTime;
+    Uint64 hash;
+    Uint64 contentSize;
+    Uint32 offset;
+    bool allowCompression; // --no-compression absent lors de l'écriture du chunk
+} RC2D_RrespackState;
+
+typedef struct RC2D_RrespackEntryList {
+    RC2D_RrespackEntry *items;
+    int count;
+    int capacity;
+} RC2D_RrespackEntryList;
+
+static Uint64 rrespack_hash(const void *data, size_t len)
+{
+    const Uint8 *p = (const Uint8 *)data;
+    Uint64 h = 14695981039346656037ull;
+    for (size_t i = 0; i < len; ++i)
+    {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+static int rrespack_compareEntries(const void *a, const void *b)
+{
+    return SDL_strcmp(((const RC2D_RrespackEntry *)a)->name, ((const RC2D_RrespackEntry *)b)->name);
+}
+
+static bool rrespack_isTexturePackerJson(const char *path)
+{
+    const size_t len = SDL_strlen(path);
+    if (len < 5 || SDL_strcasecmp(path + len - 5, ".json") != 0) return false;
+
+    size_t json_len = 0;
+    char *json = (char *)SDL_LoadFile(path, &json_len);
+    const bool isAtlas = json && SDL_strstr(json, "\"frames\"") && SDL_strstr(json, "\"meta\"");
+    SDL_free(json);
+    return isAtlas;
+}
+
+static bool rrespack_addEntry(RC2D_RrespackEntryList *list, const char *name, const char *sourcePath, bool bakedAtlas, const SDL_PathInfo *info)
+{
+    if (list->count == list->capacity)
+    {
+        const int capacity = list->capacity ? list->capacity * 2 : 64;
+        RC2D_RrespackEntry *items = (RC2D_RrespackEntry *)RC2D_realloc(list->items, capacity * sizeof(RC2D_RrespackEntry));
+        if (!items) return false;
+        list->items = items;
+        list->capacity = capacity;
+    }
+
+    RC2D_RrespackEntry *entry = &list->items[list->count];
+    SDL_zerop(entry);
+    entry->name = RC2D_strdup(name);
+    entry->sourcePath = RC2D_strdup(sourcePath);
+    entry->bakedAtlas = bakedAtlas;
+    entry->sourceSize = info->size;
+    entry->sourceTime = info->modify_time;
+    entry->canonical = -1;
+    if (!entry->name || !entry->sourcePath) return false;
+
+    list->count++;
+    return true;
+}
+
+/* Liste récursive des fichiers de assetsDir, triée par nom (pack reproductible) */
+static bool rrespack_listEntries(const char *assetsDir, const char *outputPath, RC2D_RrespackEntryList *list)
+{
+    int count = 0;
+    char **paths = SDL_GlobDirectory(assetsDir, NULL, 0, &count);
+    if (!paths)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: cannot list '%s': %s", assetsDir, SDL_GetError());
+        return false;
+    }
+
+    const char *outputName = SDL_strrchr(outputPath, '/') ? SDL_strrchr(outputPath, '/') + 1 : outputPath;
+    bool ok = true;
+    for (int i = 0; ok && i < count; ++i)
+    {
+        char *fullPath = NULL;
+        SDL_asprintf(&fullPath, "%s/%s", assetsDir, paths[i]);
+        SDL_PathInfo info;
+        if (!fullPath || !SDL_GetPathInfo(fullPath, &info) || info.type != SDL_PATHTYPE_FILE)
+        {
+            SDL_free(fullPath);
+            continue;
+        }
+
+        // Noms du CDIR en style Unix, quelle que soit la plateforme
+        char *name = RC2D_strdup(paths[i]);
+        if (!name)
+        {
+            SDL_free(fullPath);
+            ok = false;
+            break;
+        }
+        for (char *c = name; *c; ++c) if (*c == '\\') *c = '/';
+
+        // Le pack et son état peuvent être générés dans le dossier d'assets : on les ignore
+        const char *base = SDL_strrchr(name, '/') ? SDL_strrchr(name, '/') + 1 : name;
+        if (SDL_strncmp(base, outputName, SDL_strlen(outputName)) != 0)
+        {
+            ok = rrespack_addEntry(list, name, fullPath, false, &info);
+            if (ok && rrespack_isTexturePackerJson(fullPath))
+            {
+                char *bakedName = NULL;
+                SDL_asprintf(&bakedName, "%.*s%s", (int)(SDL_strlen(name) - 5), name, RC2D_TP_BAKED_EXTENSION);
+                ok = bakedName && rrespack_addEntry(list, bakedName, fullPath, true, &info);
+                SDL_free(bakedName);
+            }
+        }
+
+        RC2D_safe_free(name);
+        SDL_free(fullPath);
+    }
+    SDL_free(paths);
+
+    if (ok && list->count > 0) SDL_qsort(list->items, list->count, sizeof(RC2D_RrespackEntry), rrespack_compareEntries);
+    return ok;
+}
+
+/* Contenu à empaqueter : le fichier, ou l'atlas précalculé depuis le JSON */
+static void *rrespack_loadContent(const RC2D_RrespackEntry *entry, Uint64 *len)
+{
+    size_t fileLen = 0;
+    void *file = SDL_LoadFile(entry->sourcePath, &fileLen);
+    if (!file)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: cannot read '%s': %s", entry->sourcePath, SDL_GetError());
+        return NULL;
+    }
+
+    if (!entry->bakedAtlas)
+    {
+        *len = fileLen;
+        return file;
+    }
+
+    void *baked = NULL;
+    Uint64 bakedLen = 0;
+    const bool ok = rc2d_tp_bakeAtlas(file, fileLen, &baked, &bakedLen);
+    SDL_free(file);
+    if (!ok)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: failed to bake atlas '%s'", entry->sourcePath);
+        return NULL;
+    }
+
+    // Même allocateur que SDL_LoadFile pour que l'appelant libère avec SDL_free
+    void *copy = SDL_malloc(bakedLen > 0 ? (size_t)bakedLen : 1);
+    if (copy) SDL_memcpy(copy, baked, (size_t)bakedLen);
+    RC2D_safe_free(baked);
+    *len = bakedLen;
+    return copy;
+}
+
+/* Extension (".png") sur 8 caractères max, 4 par prop, premier caractère en poids fort */
+static void rrespack_extensionProps(const char *name, unsigned int props[2])
+{
+    props[0] = props[1] = 0;
+    const char *dot = SDL_strrchr(name, '.');
+    if (!dot || SDL_strchr(dot, '/')) return;
+
+    for (int i = 0; i < 8 && dot[i]; ++i) props[i / 4] |= (unsigned int)(Uint8)dot[i] << (8 * (3 - (i % 4)));
+}
+
+/* Écrit les infos + données du chunk RAWD de 'entry' à l'offset courant de 'out' */
+static bool rrespack_writeChunk(SDL_IOStream *out, RC2D_RrespackEntry *entry, const void *content, Uint64 contentLen, bool allowCompression)
+{
+    const Uint64 headerSize = sizeof(unsigned int) * (1 + RC2D_RRESPACK_RAWD_PROP_COUNT);
+    const Uint64 baseSize = headerSize + contentLen;
+    if (baseSize > 0x7FFFFFFF)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: '%s' is too large for a rres chunk", entry->name);
+        return false;
+    }
+
+    // Données du chunk non compressé : propCount, props puis le contenu
+    Uint8 *plain = (Uint8 *)RC2D_malloc((size_t)baseSize);
+    if (!plain) return false;
+    unsigned int props[1 + RC2D_RRESPACK_RAWD_PROP_COUNT] = { RC2D_RRESPACK_RAWD_PROP_COUNT, (unsigned int)contentLen, 0, 0 };
+    rrespack_extensionProps(entry->name, &props[2]);
+    SDL_memcpy(plain, props, (size_t)headerSize);
+    SDL_memcpy(plain + headerSize, content, (size_t)contentLen);
+
+    const Uint8 *packed = plain;
+    int packedSize = (int)baseSize;
+    entry->compType = RRES_COMP_NONE;
+
+    // LZ4 seulement si le gain mesuré en vaut la peine
+    Uint8 *compressed = NULL;
+    if (allowCompression)
+    {
+        const int bound = LZ4_compressBound((int)baseSize);
+        compressed = (bound > 0) ? (Uint8 *)RC2D_malloc((size_t)bound) : NULL;
+        const int compressedSize = compressed ? LZ4_compress_default((const char *)plain, (char *)compressed, (int)baseSize, bound) : 0;
+        if (compressedSize > 0 && (Uint64)compressedSize * 100 <= baseSize * (100 - RC2D_RRESPACK_MIN_GAIN_PERCENT))
+        {
+            packed = compressed;
+            packedSize = compressedSize;
+            entry->compType = RRES_COMP_LZ4;
+        }
+    }
+
+    rresResourceChunkInfo info = { 0 };
+    SDL_memcpy(info.type, "RAWD", 4);
+    info.id = (int)rresComputeCRC32((unsigned char *)entry->name, (int)SDL_strlen(entry->name));
+    info.compType = (unsigned char)entry->compType;
+    info.packedSize = (unsigned int)packedSize;
+    info.baseSize = (unsigned int)baseSize;
+    info.crc32 = rresComputeCRC32((unsigned char *)packed, packedSize);
+
+    const bool ok = SDL_WriteIO(out, &info, sizeof(info)) == sizeof(info) &&
+                    SDL_WriteIO(out, packed, (size_t)packedSize) == (size_t)packedSize;
+
+    entry->packedSize = info.packedSize;
+    entry->baseSize = info.baseSize;
+    RC2D_safe_free(compressed);
+    RC2D_free(plain);
+    return ok;
+}
+
+/* Recopie un chunk de l'ancien pack sans le relire ni le recompresser (seul l'id est réécrit) */
+static bool rrespack_copyChunk(SDL_IOStream *out, SDL_IOStream *previous, Uint32 offset, RC2D_RrespackEntry *entry)
+{
+    rresResourceChunkInfo info;
+    if (SDL_SeekIO(previous, offset, SDL_IO_SEEK_SET) != offset || SDL_ReadIO(previous, &info, sizeof(info)) != sizeof(info))
+    {
+        return false;
+    }
+
+    info.id = (int)rresComputeCRC32((unsigned char *)entry->name, (int)SDL_strlen(entry->name));
+    if (SDL_WriteIO(out, &info, sizeof(info)) != sizeof(info)) return false;
+
+    Uint8 buffer[64 * 1024];
+    for (Uint64 remaining = info.packedSize; remaining > 0;)
+    {
+        const size_t n = (size_t)SDL_min(remaining, sizeof(buffer));
+        if (SDL_ReadIO(previous, buffer, n) != n || SDL_WriteIO(out, buffer, n) != n) return false;
+        remaining -= n;
+    }
+
+    entry->compType = info.compType;
+    entry->packedSize = info.packedSize;
+    entry->baseSize = info.baseSize;
+    return true;
+}
+
+static RC2D_RrespackState *rrespack_loadState(const char *statePath, int *count)
+{
+    *count = 0;
+    size_t len = 0;
+    char *text = (char *)SDL_LoadFile(statePath, &len);
+    if (!text) return NULL;
+
+    int lines = 0;
+    for (size_t i = 0; i < len; ++i) if (text[i] == '\n') lines++;
+
+    RC2D_RrespackState *states = (RC2D_RrespackState *)RC2D_calloc(lines > 0 ? lines : 1, sizeof(RC2D_RrespackState));
+    char *save = NULL;
+    for (char *line = SDL_strtok_r(text, "\n", &save); states && line; line = SDL_strtok_r(NULL, "\n", &save))
+    {
+        // taille \t date \t hash \t taille du contenu \t offset \t compression \t nom
+        RC2D_RrespackState *s = &states[*count];
+        char *fields[7] = { 0 };
+        char *fieldSave = NULL;
+        int f = 0;
+        for (char *field = SDL_strtok_r(line, "\t", &fieldSave); field && f < 7; field = SDL_strtok_r(NULL, "\t", &fieldSave)) fields[f++] = field;
+        if (f != 7) continue;
+
+        s->sourceSize = SDL_strtoull(fields[0], NULL, 10);
+        s->sourceTime = SDL_strtoll(fields[1], NULL, 10);
+        s->hash = SDL_strtoull(fields[2], NULL, 16);
+        s->contentSize = SDL_strtoull(fields[3], NULL, 10);
+        s->offset = (Uint32)SDL_strtoul(fields[4], NULL, 10);
+        s->allowCompression = SDL_strcmp(fields[5], "1") == 0;
+        s->name = RC2D_strdup(fields[6]);
+        if (s->name) (*count)++;
+    }
+
+    SDL_free(text);
+    return states;
+}
+
+static const RC2D_RrespackState *rrespack_findState(const RC2D_RrespackState *states, int count, const char *name)
+{
+    for (int i = 0; i < count; ++i) if (SDL_strcmp(states[i].name, name) == 0) return &states[i];
+    return NULL;
+}
+
+/*
+ * Chunk déjà écrit pour le même contenu (hash + taille, vérifié octet par octet).
+ * `content` vaut NULL pour une entrée inchangée : elle n'est relue que si un candidat a le même hash.
+ */
+static int rrespack_findDuplicate(const RC2D_RrespackEntryList *list, int index, const void *content)
+{
+    const RC2D_RrespackEntry *entry = &list->items[index];
+    void *ownContent = NULL;
+    int found = -1;
+    for (int i = 0; i < index; ++i)
+    {
+        const RC2D_RrespackEntry *other = &list->items[i];
+        if (other->canonical != -1 || other->hash != entry->hash || other->contentSize != entry->contentSize) continue;
+        if (!content)
+        {
+            Uint64 ownLen = 0;
+            content = ownContent = rrespack_loadContent(entry, &ownLen);
+            if (!content || ownLen != entry->contentSize) break;
+        }
+
+        Uint64 otherLen = 0;
+        void *otherContent = rrespack_loadContent(other, &otherLen);
+        const bool same = otherContent && otherLen == entry->contentSize && SDL_memcmp(otherContent, content, (size_t)otherLen) == 0;
+        SDL_free(otherContent);
+        if (same)
+        {
+            found = i;
+            break;
+        }
+    }
+    SDL_free(ownContent);
+    return found;
+}
+
+static bool rrespack_writeCentralDirectory(SDL_IOStream *out, const RC2D_RrespackEntryList *list)
+{
+    // Entrées : id, offset, reserved, fileNameSize puis le nom (terminé par '\0', aligné sur 4 octets).
+    // Un doublon reprend l'id du chunk qu'il partage, sans quoi un lecteur rres standard ne le trouverait pas.
+    Uint64 size = 2 * sizeof(unsigned int);
+    for (int i = 0; i < list->count; ++i) size += 16 + ((SDL_strlen(list->items[i].name) + 4) & ~(size_t)3);
+
+    Uint8 *data = (Uint8 *)RC2D_calloc((size_t)size, 1);
+    if (!data) return false;
+
+    ((unsigned int *)data)[0] = 1;
+    ((unsigned int *)data)[1] = (unsigned int)list->count;
+    Uint8 *ptr = data + 2 * sizeof(unsigned int);
+    for (int i = 0; i < list->count; ++i)
+    {
+        const RC2D_RrespackEntry *entry = &list->items[i];
+        const RC2D_RrespackEntry *chunk = (entry->canonical == -1) ? entry : &list->items[entry->canonical];
+        const size_t nameLen = SDL_strlen(entry->name);
+        const unsigned int fields[4] = {
+            rresComputeCRC32((unsigned char *)chunk->name, (int)SDL_strlen(chunk->name)),
+            entry->offset, 0, (unsigned int)((nameLen + 4) & ~(size_t)3)
+        };
+        SDL_memcpy(ptr, fields, sizeof(fields));
+        SDL_memcpy(ptr + 16, entry->name, nameLen);
+        ptr += 16 + fields[3];
+    }
+
+    rresResourceChunkInfo info = { 0 };
+    SDL_memcpy(info.type, "CDIR", 4);
+    info.packedSize = info.baseSize = (unsigned int)size;
+    info.crc32 = rresComputeCRC32(data, (int)size);
+
+    const bool ok = SDL_WriteIO(out, &info, sizeof(info)) == sizeof(info) && SDL_WriteIO(out, data, (size_t)size) == (size_t)size;
+    RC2D_free(data);
+    return ok;
+}
+
+static bool rrespack_writeState(const char *statePath, const RC2D_RrespackEntryList *list, bool allowCompression)
+{
+    SDL_IOStream *io = SDL_IOFromFile(statePath, "wb");
+    if (!io) return false;
+
+    bool ok = true;
+    for (int i = 0; ok && i < list->count; ++i)
+    {
+        const RC2D_RrespackEntry *e = &list->items[i];
+        const Uint32 offset = (e->canonical == -1) ? e->offset : RC2D_RRESPACK_NO_CHUNK;
+        ok = SDL_IOprintf(io, "%llu\t%lld\t%016llx\t%llu\t%u\t%d\t%s\n", (unsigned long long)e->sourceSize, (long long)e->sourceTime,
+                          (unsigned long long)e->hash, (unsigned long long)e->contentSize, offset, allowCompression ? 1 : 0, e->name) > 0;
+    }
+    return SDL_CloseIO(io) && ok;
+}
+
+static bool rrespack_writeManifest(const char *manifestPath, const RC2D_RrespackEntryList *list)
+{
+    SDL_IOStream *io = SDL_IOFromFile(manifestPath, "wb");
+    if (!io) return false;
+
+    bool ok = SDL_IOprintf(io, "id\tname\toffset\tcompression\tbase_size\tpacked_size\tshared_with\n") > 0;
+    for (int i = 0; ok && i < list->count; ++i)
+    {
+        const RC2D_RrespackEntry *e = &list->items[i];
+        const RC2D_RrespackEntry *c = (e->canonical == -1) ? e : &list->items[e->canonical];
+        ok = SDL_IOprintf(io, "%08x\t%s\t%u\t%s\t%u\t%u\t%s\n",
+                          rresComputeCRC32((unsigned char *)c->name, (int)SDL_strlen(c->name)), e->name, c->offset,
+                          c->compType == RRES_COMP_LZ4 ? "lz4" : "none", c->baseSize, c->packedSize,
+                          e->canonical == -1 ? "-" : c->name) > 0;
+    }
+    return SDL_CloseIO(io) && ok;
+}
+
+static bool rrespack_build(const char *assetsDir, const char *outputPath, const char *manifestPath, bool allowCompression, bool force)
+{
+    RC2D_RrespackEntryList list = { 0 };
+    int stateCount = 0;
+    RC2D_RrespackState *states = NULL;
+    SDL_IOStream *previous = NULL;
+    SDL_IOStream *out = NULL;
+    char *statePath = NULL;
+    char *tempPath = NULL;
+    bool ok = false;
+
+    SDL_asprintf(&statePath, "%s%s", outputPath, RC2D_RRESPACK_STATE_EXTENSION);
+    SDL_asprintf(&tempPath, "%s.tmp", outputPath);
+    if (!statePath || !tempPath || !rrespack_listEntries(assetsDir, outputPath, &list)) goto done;
+
+    if (list.count > 0xFFFE)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: too many files (%d), a rres pack holds at most 65534", list.count);
+        goto done;
+    }
+
+    // Ancien pack + état : base de la reconstruction incrémentale
+    if (!force)
+    {
+        previous = SDL_IOFromFile(outputPath, "rb");
+        if (previous) states = rrespack_loadState(statePath, &stateCount);
+    }
+
+    out = SDL_IOFromFile(tempPath, "wb");
+    rresFileHeader header = { { 'r', 'r', 'e', 's' }, 100, 0, 0, 0 };
+    if (!out || SDL_WriteIO(out, &header, sizeof(header)) != sizeof(header))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: cannot write '%s': %s", tempPath, SDL_GetError());
+        goto done;
+    }
+
+    int reused = 0;
+    int chunkCount = 0;
+    for (int i = 0; i < list.count; ++i)
+    {
+        RC2D_RrespackEntry *entry = &list.items[i];
+        const Sint64 offset = SDL_TellIO(out);
+        if (offset < 0 || offset > 0xFFFFFFFFll)
+        {
+            RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: pack exceeds 4 GB");
+            goto done;
+        }
+
+        // Entrée inchangée depuis le dernier pack (même --no-compression) : hash mémorisé, chunk recopié
+        const RC2D_RrespackState *state = previous ? rrespack_findState(states, stateCount, entry->name) : NULL;
+        if (state && state->sourceSize == entry->sourceSize && state->sourceTime == entry->sourceTime &&
+            state->allowCompression == allowCompression)
+        {
+            entry->hash = state->hash;
+            entry->contentSize = state->contentSize;
+            entry->canonical = rrespack_findDuplicate(&list, i, NULL);
+            if (entry->canonical == -1 && state->offset != RC2D_RRESPACK_NO_CHUNK)
+            {
+                entry->offset = (Uint32)offset;
+                if (!rrespack_copyChunk(out, previous, state->offset, entry)) goto done;
+                chunkCount++;
+            }
+            if (entry->canonical != -1 || state->offset != RC2D_RRESPACK_NO_CHUNK)
+            {
+                reused++;
+                continue;
+            }
+            // Ancien doublon dont l'original a changé : reconstruit ci-dessous
+        }
+
+        Uint64 contentLen = 0;
+        void *content = rrespack_loadContent(entry, &contentLen);
+        if (!content) goto done;
+
+        entry->hash = rrespack_hash(content, (size_t)contentLen);
+        entry->contentSize = contentLen;
+        entry->canonical = rrespack_findDuplicate(&list, i, content);
+        if (entry->canonical == -1)
+        {
+            entry->offset = (Uint32)offset;
+            const bool written = rrespack_writeChunk(out, entry, content, contentLen, allowCompression);
+            SDL_free(content);
+            if (!written) goto done;
+            chunkCount++;
+        }
+        else
+        {
+            SDL_free(content);
+        }
+    }
+
+    // Les doublons pointent sur le chunk de leur original
+    for (int i = 0; i < list.count; ++i)
+    {
+        RC2D_RrespackEntry *entry = &list.items[i];
+        if (entry->canonical != -1) entry->offset = list.items[entry->canonical].offset;
+    }
+
+    // Rien n'a changé (mêmes entrées, toutes reprises) : l'ancien pack est à jour
+    if (previous && reused == list.count && stateCount == list.count)
+    {
+        SDL_CloseIO(out);
+        out = NULL;
+        SDL_RemovePath(tempPath);
+        RC2D_log(RC2D_LOG_INFO, "rc2d_rrespack: '%s' is up to date (%d entries)", outputPath, list.count);
+        ok = !manifestPath || rrespack_writeManifest(manifestPath, &list);
+        goto done;
+    }
+
+    header.cdOffset = (unsigned int)SDL_TellIO(out);
+    header.chunkCount = (unsigned short)(chunkCount + 1);
+    if (!rrespack_writeCentralDirectory(out, &list) || SDL_SeekIO(out, 0, SDL_IO_SEEK_SET) != 0 ||
+        SDL_WriteIO(out, &header, sizeof(header)) != sizeof(header))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: cannot write '%s': %s", tempPath, SDL_GetError());
+        goto done;
+    }
+
+    const bool closed = SDL_CloseIO(out);
+    out = NULL;
+    if (previous)
+    {
+        SDL_CloseIO(previous);
+        previous = NULL;
+    }
+
+    if (!closed || !SDL_RenamePath(tempPath, outputPath))
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_rrespack: cannot write '%s': %s", outputPath, SDL_GetError());
+        goto done;
+    }
+
+    if (!rrespack_writeState(statePath, &list, allowCompression))
+    {
+        // Sans état, le prochain build repartira de zéro : pas une erreur
+        RC2D_log(RC2D_LOG_WARN, "rc2d_rrespack: cannot write '%s'", statePath);
+    }
+
+    ok = !manifestPath || rrespack_writeManifest(manifestPath, &list);
+    RC2D_log(RC2D_LOG_INFO, "rc2d_rrespack: '%s' written: %d entries, %d chunks, %d reused", outputPath, list.count, chunkCount, reused);
+
+done:
+    if (out)
+    {
+        SDL_CloseIO(out);
+        SDL_RemovePath(tempPath);
+    }
+    if (previous) SDL_CloseIO(previous);
+    for (int i = 0; i < stateCount; ++i) RC2D_free(states[i].name);
+    RC2D_safe_free(states);
+    for (int i = 0; i < list.count; ++i)
+    {
+        RC2D_free(list.items[i].name);
+        RC2D_free(list.items[i].sourcePath);
+    }
+    RC2D_safe_free(list.items);
+    SDL_free(statePath);
+    SDL_free(tempPath);
+    return ok;
+}
+
+int main(int argc, char* argv[])
+{
+    const char *manifestPath = NULL;
+    bool allowCompression = true;
+    bool force = false;
+    const char *positional[2] = { NULL, NULL };
+    int positionalCount = 0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (SDL_strcmp(argv[i], "--manifest") == 0 && i + 1 < argc) manifestPath = argv[++i];
+        else if (SDL_strcmp(argv[i], "--no-compression") == 0) allowCompression = false;
+        else if (SDL_strcmp(argv[i], "--force") == 0) force = true;
+        else if (positionalCount < 2 && argv[i][0] != '-') positional[positionalCount++] = argv[i];
+        else positionalCount = 3;
+    }
+
+    if (positionalCount != 2)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "usage: rc2d_rrespack <assets_dir> <output.rres> [--manifest <manifest.tsv>] [--no-compression] [--force]");
+        return 1;
+    }
+
+    return rrespack_build(positional[0], positional[1], manifestPath, allowCompression, force) ? 0 : 1;
+}
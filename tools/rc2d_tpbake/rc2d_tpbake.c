@@ -0,0 +1,50 @@
+/**
+ * rc2d_tpbake : convertit un atlas TexturePacker "JSON (Array)" en atlas binaire précalculé.
+ *
+ * Usage : rc2d_tpbake <input.json> <output.rc2datlas>
+ *
+ * Exécuté au build (cf. rc2d_bake_texturepacker_atlases() dans CMakeLists.txt) ; au runtime,
+ * rc2d_tp_loadAtlasFromStorage() charge alors le .rc2datlas au lieu de parser le JSON.
+ */
+#include <RC2D/RC2D_texturepacker.h>
+#include <RC2D/RC2D_logger.h>
+#include <RC2D/RC2D_memory.h>
+
+#include <SDL3/SDL_iostream.h>
+
+int main(int argc, char* argv[])
+{
+    if (argc != 3)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "usage: rc2d_tpbake <input.json> <output%s>", RC2D_TP_BAKED_EXTENSION);
+        return 1;
+    }
+
+    size_t json_len = 0;
+    void* json = SDL_LoadFile(argv[1], &json_len);
+    if (!json)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_tpbake: cannot read '%s': %s", argv[1], SDL_GetError());
+        return 1;
+    }
+
+    void* baked = NULL;
+    Uint64 baked_len = 0;
+    const bool ok = rc2d_tp_bakeAtlas(json, (Uint64)json_len, &baked, &baked_len);
+    SDL_free(json);
+    if (!ok)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_tpbake: failed to bake '%s'", argv[1]);
+        return 1;
+    }
+
+    const bool saved = SDL_SaveFile(argv[2], baked, (size_t)baked_len);
+    RC2D_safe_free(baked);
+    if (!saved)
+    {
+        RC2D_log(RC2D_LOG_ERROR, "rc2d_tpbake: cannot write '%s': %s", argv[2], SDL_GetError());
+        return 1;
+    }
+
+    return 0;
+}